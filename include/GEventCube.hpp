@@ -39,6 +39,12 @@
  * @brief Abstract event bin container class
  *
  * This class is an abstract container class for event bins.
+ *
+ * The new_bin() and bin() methods give access to the event bins without
+ * modifying the event cube, so that several threads can loop over the
+ * bins at the same time. Each thread allocates its own bin buffer using
+ * new_bin() and passes it to bin(). Cubes that hold distinct event bins
+ * need no buffer and return NULL from new_bin().
  ***************************************************************************/
 class GEventCube : public GEvents {
 
@@ -65,6 +71,8 @@ public:
     virtual void        write(GFits& file) const = 0;
     virtual int         number(void) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
+    virtual GEventBin*  new_bin(void) const = 0;
+    virtual const GEventBin* bin(const int& index, GEventBin* buffer) const = 0;
 
 protected:
     // Protected methods
@@ -51,7 +51,8 @@ class GFits : public GBase {
 public:
     // Constructors and destructors
     GFits(void);
-    explicit GFits(const std::string& filename, bool create = false);
+    explicit GFits(const std::string& filename, bool create = false,
+                   bool mmap = false);
     GFits(const GFits& fits);
     virtual ~GFits(void);
 
@@ -62,7 +63,8 @@ public:
     void        clear(void);
     GFits*      clone(void) const;
     int         size(void) const;
-    void        open(const std::string& filename, bool create = false);
+    void        open(const std::string& filename, bool create = false,
+                     bool mmap = false);
     void        save(bool clobber = false);
     void        saveto(const std::string& filename, bool clobber = false);
     void        close(void);
@@ -76,6 +78,7 @@ public:
     GFitsTable* table(const std::string& extname) const;
     GFitsTable* table(int extno) const;
     std::string name(void) const { return m_filename; }
+    bool        ismapped(void) const { return m_mapped; }
     std::string print(const GChatter& chatter = NORMAL) const;
 
     // Complex single precision type
@@ -104,6 +107,7 @@ private:
     void*                  m_fitsfile;   //!< FITS file pointer
     bool                   m_readwrite;  //!< FITS file is readwrite (true/false)
     bool                   m_created;    //!< FITS file has been created (true/false)
+    bool                   m_mapped;     //!< FITS file is memory mapped (true/false)
 };
 
 #endif /* GFITS_HPP */
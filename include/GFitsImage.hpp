@@ -37,6 +37,11 @@
  * @brief Abstract interface for the FITS image classes.
  *
  * This class defines the abstract interface for a FITS image.
+ *
+ * If the image was opened from a memory mapped FITS file, the pixel()
+ * methods read the pixels directly from the mapping as long as the pixels
+ * have not been loaded into memory. The pixels are only loaded when they
+ * are accessed by reference.
  ***************************************************************************/
 class GFitsImage : public GFitsHDU {
 
@@ -75,6 +80,7 @@ public:
     int         anynul(void) const;
     void        nulval(const void* value);
     void*       nulval(void);
+    bool        ismapped(void) const { return (m_mmap != NULL); }
     std::string print(const GChatter& chatter = NORMAL) const;
 
 protected:
@@ -91,6 +97,10 @@ protected:
     void  load_image(int datatype, const void* pixels,
                      const void* nulval, int* anynul);
     void  save_image(int datatype, const void* pixels);
+    bool  load_image_mmap(int datatype, const void* pixels,
+                          const void* nulval, int* anynul);
+    void  open_image_mmap(void);
+    double mmap_pixel(const int& offset) const;
     void  fetch_data(void);
     int   offset(const int& ix) const;
     int   offset(const int& ix, const int& iy) const;
@@ -111,6 +121,9 @@ protected:
     long* m_naxes;       //!< Number of pixels in each dimension
     int   m_num_pixels;  //!< Number of image pixels
     int   m_anynul;      //!< Number of NULLs encountered
+
+    // Memory mapped pixels
+    const unsigned char* m_mmap; //!< Pixels in memory mapped FITS file
 };
 
 #endif /* GFITSIMAGE_HPP */
@@ -72,6 +72,7 @@ public:
     void        remove_rows(const int& rownum, const int& nrows);
     int         nrows(void) const;
     int         ncols(void) const;
+    int         optimal_rows(void) const;
     bool        hascolumn(const std::string& colname) const;
     std::string print(const GChatter& chatter = NORMAL) const;
 
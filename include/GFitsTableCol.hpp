@@ -79,6 +79,10 @@ public:
     int              number(void) const;
     int              length(void) const;
     int              anynul(void) const;
+    void             read_rows(const long long& row, const long long& nrows,
+                               double* values) const;
+    void             read_rows(const long long& row, const long long& nrows,
+                               long long* values) const;
     std::string      print(const GChatter& chatter = NORMAL) const;
 
 protected:
@@ -100,6 +104,8 @@ protected:
     mutable int      m_size;     //!< Size of allocated data area (0 if not loaded)
     int              m_anynul;   //!< Number of NULLs encountered
     void*            m_fitsfile; //!< FITS file pointer associated with column
+    int              m_tbcol;    //!< Byte offset of column in row (-1 if unknown)
+    int              m_rowlen;   //!< Length of table row in bytes
 
     // Protected pure virtual methods
     virtual std::string ascii_format(void) const = 0;
@@ -113,6 +119,7 @@ protected:
     virtual void        save(void);
     virtual void        fetch_data(void) const;
     virtual void        load_column(void);
+    bool                load_column_mmap(void);
     virtual void        save_column(void);
     virtual int         offset(const int& row, const int& inx) const;
 
@@ -122,6 +129,11 @@ protected:
     void copy_members(const GFitsTableCol& column);
     void free_members(void);
     void connect(void* vptr);
+    bool read_rows_file(const std::string& method, const long long& row,
+                        const long long& nrows, const int& type,
+                        void* values) const;
+    bool read_rows_mmap(const long long& row, const long long& nrows,
+                        const int& type, void* values) const;
 };
 
 #endif /* GFITSTABLECOL_HPP */
@@ -40,6 +40,13 @@
  * of derivatives. This class has no members. The only pure virtual method
  * that needs to be implemented by the derived class is the eval() method
  * that provides function evaluation at a given value x, e.g. y=eval(x).
+ *
+ * The batch method eval(x,y,n) evaluates the function for an array of
+ * values. It is used by GIntegral for all abscissae of a quadrature step.
+ * By default it calls eval(x) for each value; derived classes may override
+ * it to hoist computations that do not depend on x out of the loop, or to
+ * use vectorised code. The CTA response kernels for the azimuthal
+ * integration of radial, elliptical and diffuse models do so.
  ***************************************************************************/
 class GFunction {
 
@@ -55,6 +62,7 @@ public:
 
     // Methods
     virtual double eval(double x) = 0;
+    virtual void   eval(const double* x, double* y, int n);
 
 protected:
     // Protected methods
@@ -0,0 +1,69 @@
+/***************************************************************************
+ *      GFunctions.hpp - Vector valued function abstract base class        *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GFunctions.hpp
+ * @brief GFunctions abstract virtual base class interface definition.
+ * @author J. Knodlseder
+ */
+
+#ifndef GFUNCTIONS_HPP
+#define GFUNCTIONS_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include "GVector.hpp"
+
+
+/***********************************************************************//**
+ * @class GFunctions
+ *
+ * @brief GFunctions class interface defintion.
+ *
+ * This class implements the abstract interface for a set of one parameter
+ * functions that are evaluated simultaneously, e.g. a function and its
+ * parameter gradients. The class is used by GIntegral for integrating all
+ * functions with the same nodes. The derived class needs to implement the
+ * size() method that returns the number of functions and the eval() method
+ * that returns the vector of function values at a given value x.
+ ***************************************************************************/
+class GFunctions {
+
+public:
+
+    // Constructors and destructors
+    GFunctions(void);
+    GFunctions(const GFunctions& functions);
+    virtual ~GFunctions(void);
+
+    // Operators
+    GFunctions& operator= (const GFunctions& functions);
+
+    // Methods
+    virtual int     size(void) const = 0;
+    virtual GVector eval(double x) = 0;
+
+protected:
+    // Protected methods
+    void init_members(void);
+    void copy_members(const GFunctions& functions);
+    void free_members(void);
+};
+
+#endif /* GFUNCTIONS_HPP */
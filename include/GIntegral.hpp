@@ -31,6 +31,8 @@
 #include <string>
 #include "GBase.hpp"
 #include "GFunction.hpp"
+#include "GFunctions.hpp"
+#include "GVector.hpp"
 
 
 /***********************************************************************//**
@@ -40,6 +42,15 @@
  *
  * This class allows to perform integration using various methods. The
  * integrand is implemented by a derived class of GIntegrand.
+ *
+ * Besides Romberg integration (romb()), the class implements adaptive
+ * Gauss-Kronrod integration (gauss_kronrod()) and fixed-order
+ * Gauss-Legendre integration (gauss_legendre()). Both Gauss methods work
+ * without heap allocation. The number of integrand evaluations of the
+ * adaptive method is limited by a per-call budget (see max_calls()).
+ *
+ * Vector valued kernels (see GFunctions) are integrated by romb_vector(),
+ * which integrates all kernel functions with the same nodes.
  ***************************************************************************/
 class GIntegral : public GBase {
 
@@ -48,6 +59,7 @@ public:
     // Constructors and destructors
     explicit GIntegral(void);
     explicit GIntegral(GFunction* kernel);
+    explicit GIntegral(GFunctions* kernels);
     GIntegral(const GIntegral& integral);
     virtual ~GIntegral(void);
 
@@ -55,34 +67,47 @@ public:
     GIntegral& operator=(const GIntegral& integral);
 
     // Methods
-    void             clear(void);
-    GIntegral*       clone(void) const;
-    void             max_iter(const int& max_iter) { m_max_iter=max_iter; }
-    void             eps(const double& eps) { m_eps=eps; }
-    void             silent(const bool& silent) { m_silent=silent; }
-    const int&       iter(void) const { return m_iter; }
-    const int&       max_iter(void) const { return m_max_iter; }
-    const double&    eps(void) const { return m_eps; }
-    const bool&      silent(void) const { return m_silent; }
-    void             kernel(GFunction* kernel) { m_kernel=kernel; }
-    const GFunction* kernel(void) const { return m_kernel; }
-    double           romb(double a, double b, int k = 5);
-    double           trapzd(double a, double b, int n = 1, double result = 0.0);
-    std::string      print(const GChatter& chatter = NORMAL) const;
+    void              clear(void);
+    GIntegral*        clone(void) const;
+    void              max_iter(const int& max_iter) { m_max_iter=max_iter; }
+    void              max_calls(const int& max_calls) { m_max_calls=max_calls; }
+    void              eps(const double& eps) { m_eps=eps; }
+    void              silent(const bool& silent) { m_silent=silent; }
+    const int&        iter(void) const { return m_iter; }
+    const int&        max_iter(void) const { return m_max_iter; }
+    const int&        max_calls(void) const { return m_max_calls; }
+    const int&        calls(void) const { return m_calls; }
+    const double&     eps(void) const { return m_eps; }
+    const bool&       silent(void) const { return m_silent; }
+    void              kernel(GFunction* kernel) { m_kernel=kernel; }
+    const GFunction*  kernel(void) const { return m_kernel; }
+    void              kernels(GFunctions* kernels) { m_kernels=kernels; }
+    const GFunctions* kernels(void) const { return m_kernels; }
+    double            romb(double a, double b, int k = 5);
+    GVector           romb_vector(double a, double b, int k = 5);
+    double            trapzd(double a, double b, int n = 1, double result = 0.0);
+    double            gauss_kronrod(double a, double b);
+    double            gauss_legendre(double a, double b, int n = 16);
+    std::string       print(const GChatter& chatter = NORMAL) const;
 
 protected:
     // Protected methods
-    void   init_members(void);
-    void   copy_members(const GIntegral& integral);
-    void   free_members(void);
-    double polint(double* xa, double* ya, int n, double x, double *dy);
+    void    init_members(void);
+    void    copy_members(const GIntegral& integral);
+    void    free_members(void);
+    double  polint(double* xa, double* ya, int n, double x, double *dy);
+    GVector trapzd_vector(double a, double b, int n, const GVector& result);
+    double  gk15(double a, double b, double* error);
 
     // Protected data area
-    GFunction* m_kernel;       //!< Pointer to function kernel
-    double     m_eps;          //!< Integration precision
-    int        m_max_iter;     //!< Maximum number of iterations
-    int        m_iter;         //!< Number of iterations used
-    bool       m_silent;       //!< Suppress integration warnings
+    GFunction*  m_kernel;      //!< Pointer to function kernel
+    GFunctions* m_kernels;     //!< Pointer to vector function kernel
+    double      m_eps;         //!< Integration precision
+    int         m_max_iter;    //!< Maximum number of iterations
+    int         m_iter;        //!< Number of iterations used
+    int         m_max_calls;   //!< Maximum number of Gauss-Kronrod evaluations
+    int         m_calls;       //!< Number of function evaluations used
+    bool        m_silent;      //!< Suppress integration warnings
 };
 
 #endif /* GINTEGRAL_HPP */
@@ -140,6 +140,7 @@ private:
     void copy_members(const GMatrix& matrix);
     void free_members(void);
     void alloc_members(const int& rows, const int& columns);
+    void multiply(const GMatrix& a, const GMatrix& b);
 };
 
 
@@ -211,24 +212,6 @@ GMatrix GMatrix::operator-(const GMatrix& matrix) const
 }
 
 
-/***********************************************************************//**
- * @brief Binary matrix multiplication
- *
- * @param[in] matrix Matrix.
- * @return Result of matrix multiplication.
- *
- * Returns the product of two matrices. The method makes use of the unary
- * multiplication operator.
- ***************************************************************************/
-inline
-GMatrix GMatrix::operator*(const GMatrix& matrix) const
-{
-    GMatrix result = *this;
-    result *= matrix;
-    return result;
-}
-
-
 /***********************************************************************//**
  * @brief Scale matrix elements
  *
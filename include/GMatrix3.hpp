@@ -0,0 +1,167 @@
+/***************************************************************************
+ *                GMatrix3.hpp - Fixed-size 3x3 matrix class               *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GMatrix3.hpp
+ * @brief Fixed-size 3x3 matrix class definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GMATRIX3_HPP
+#define GMATRIX3_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <string>
+#include "GBase.hpp"
+#include "GVector3.hpp"
+#include "GMatrix.hpp"
+
+
+/***********************************************************************//**
+ * @class GMatrix3
+ *
+ * @brief Fixed-size 3x3 matrix class
+ *
+ * This class implements a 3x3 double precision matrix that is mainly used
+ * for rotations between celestial and native spherical coordinate
+ * systems. The elements are stored in row-major order within the object
+ * itself, hence a GMatrix3 can be created on the stack and combined with
+ * other matrices or GVector3 objects without any memory allocation.
+ *
+ * The rotation from native coordinates centred on a sky direction
+ * (@p ra, @p dec) into celestial coordinates is for example obtained
+ * using
+ *
+ *     GMatrix3 ry;
+ *     GMatrix3 rz;
+ *     ry.eulery(dec - 90.0);
+ *     rz.eulerz(-ra);
+ *     GMatrix3 rot = (ry * rz).transpose();
+ ***************************************************************************/
+class GMatrix3 : public GBase {
+
+public:
+    // Constructors and destructors
+    GMatrix3(void);
+    explicit GMatrix3(const GMatrix& matrix);
+    GMatrix3(const GMatrix3& matrix);
+    virtual ~GMatrix3(void);
+
+    // Matrix element access operators
+    double&       operator()(const int& row, const int& column);
+    const double& operator()(const int& row, const int& column) const;
+
+    // Matrix operators
+    bool      operator==(const GMatrix3& matrix) const;
+    bool      operator!=(const GMatrix3& matrix) const;
+    GMatrix3& operator=(const GMatrix3& matrix);
+    GMatrix3  operator*(const GMatrix3& matrix) const;
+    GVector3  operator*(const GVector3& vector) const;
+
+    // Matrix methods
+    void        clear(void);
+    GMatrix3*   clone(void) const;
+    int         rows(void) const;
+    int         columns(void) const;
+    GMatrix3    transpose(void) const;
+    GMatrix     matrix(void) const;
+    void        eulerx(const double& angle);
+    void        eulery(const double& angle);
+    void        eulerz(const double& angle);
+    std::string print(const GChatter& chatter = NORMAL) const;
+
+private:
+    // Private methods
+    void init_members(void);
+    void copy_members(const GMatrix3& matrix);
+    void free_members(void);
+
+    // Private data area
+    double m_data[9];   //!< Matrix elements (row-major)
+};
+
+
+/***********************************************************************//**
+ * @brief Return reference to matrix element
+ *
+ * @param[in] row Matrix row [0,...,2].
+ * @param[in] column Matrix column [0,...,2].
+ * @return Reference to matrix element.
+ ***************************************************************************/
+inline
+double& GMatrix3::operator()(const int& row, const int& column)
+{
+    return m_data[3*row+column];
+}
+
+
+/***********************************************************************//**
+ * @brief Return reference to matrix element (const version)
+ *
+ * @param[in] row Matrix row [0,...,2].
+ * @param[in] column Matrix column [0,...,2].
+ * @return Const reference to matrix element.
+ ***************************************************************************/
+inline
+const double& GMatrix3::operator()(const int& row, const int& column) const
+{
+    return m_data[3*row+column];
+}
+
+
+/***********************************************************************//**
+ * @brief Vector multiplication
+ *
+ * @param[in] vector Vector.
+ * @return Product of matrix and @p vector.
+ ***************************************************************************/
+inline
+GVector3 GMatrix3::operator*(const GVector3& vector) const
+{
+    return (GVector3(m_data[0]*vector[0] + m_data[1]*vector[1] + m_data[2]*vector[2],
+                     m_data[3]*vector[0] + m_data[4]*vector[1] + m_data[5]*vector[2],
+                     m_data[6]*vector[0] + m_data[7]*vector[1] + m_data[8]*vector[2]));
+}
+
+
+/***********************************************************************//**
+ * @brief Return number of matrix rows
+ *
+ * @return Number of matrix rows (always 3).
+ ***************************************************************************/
+inline
+int GMatrix3::rows(void) const
+{
+    return 3;
+}
+
+
+/***********************************************************************//**
+ * @brief Return number of matrix columns
+ *
+ * @return Number of matrix columns (always 3).
+ ***************************************************************************/
+inline
+int GMatrix3::columns(void) const
+{
+    return 3;
+}
+
+#endif /* GMATRIX3_HPP */
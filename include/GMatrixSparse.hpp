@@ -257,7 +257,10 @@ public:
     GVector       solve(const GVector& vector) const;
     GMatrixSparse abs(void) const;
     GMatrixSparse cholesky_decompose(bool compress = true) const;
+    GMatrixSparse cholesky_decompose(const GMatrixSparse& decomposition,
+                                     bool compress = true) const;
     GVector       cholesky_solver(const GVector& vector, bool compress = true) const;
+    GVector       cholesky_inverse_diagonal(bool compress = true) const;
     GMatrixSparse cholesky_invert(bool compress = true) const;
     void          set_mem_block(const int& block);
     void          stack_init(const int& size = 0, const int& entries = 0);
@@ -123,6 +123,9 @@ public:
     GMatrixSymmetric cholesky_decompose(bool compress = true) const;
     GVector          cholesky_solver(const GVector& vector, bool compress = true) const;
     GMatrixSymmetric cholesky_invert(bool compress = true) const;
+    void             rank1_update(const double& alpha, const GVector& vector);
+    void             rank1_update(const double& alpha, const double* values,
+                                  const int* inx, const int& num);
 
 private:
     // Private methods
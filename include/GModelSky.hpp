@@ -163,6 +163,9 @@ public:
     GModelTemporal*     temporal(void) const;
     double              value(const GPhoton& photon);
     GVector             gradients(const GPhoton& photon);
+    double              npred_gradients(const GEnergy& obsEng,
+                                        const GTime& obsTime,
+                                        const GObservation& obs) const;
     GPhotons            mc(const double& area,
                            const GSkyDir& dir, const double& radius,
                            const GEnergy& emin, const GEnergy& emax,
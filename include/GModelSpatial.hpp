@@ -65,6 +65,12 @@
  * for all \f$E\f$ and \f$t\f$, hence the spatial component does not
  * impact the spatially integrated spectral and temporal properties of the
  * source.
+ *
+ * Each spatial model object carries a unique instance identifier that is
+ * assigned on construction, copy, assignment and clearing. The identifier
+ * allows response caches to recognise a spatial model without comparing
+ * model names, even if a model is replaced by another one at the same
+ * address.
  ***************************************************************************/
 class GModelSpatial : public GBase {
 
@@ -94,17 +100,20 @@ public:
     virtual std::string    print(const GChatter& chatter = NORMAL) const = 0;
 
     // Methods
-    int  size(void) const;
-    void autoscale(void);
+    int           size(void) const;
+    void          autoscale(void);
+    unsigned long instance(void) const;
 
 protected:
     // Protected methods
-    void init_members(void);
-    void copy_members(const GModelSpatial& model);
-    void free_members(void);
+    void                 init_members(void);
+    void                 copy_members(const GModelSpatial& model);
+    void                 free_members(void);
+    static unsigned long new_instance(void);
 
     // Proteced members
-    std::vector<GModelPar*> m_pars;  //!< Parameter pointers
+    std::vector<GModelPar*> m_pars;      //!< Parameter pointers
+    unsigned long           m_instance;  //!< Instance identifier
 };
 
 
@@ -121,4 +130,18 @@ int GModelSpatial::size(void) const
     return (m_pars.size());
 }
 
+
+/***********************************************************************//**
+ * @brief Return instance identifier
+ *
+ * @return Instance identifier.
+ *
+ * Returns the unique instance identifier of the spatial model object.
+ ***************************************************************************/
+inline
+unsigned long GModelSpatial::instance(void) const
+{
+    return (m_instance);
+}
+
 #endif /* GMODELSPATIAL_HPP */
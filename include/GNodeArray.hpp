@@ -79,6 +79,11 @@ public:
     double        interpolate(const double& value,
                               const std::vector<double>& vector) const;
     void          set_value(const double& value) const;
+    void          weights(const double& value,
+                          int&          inx_left,
+                          int&          inx_right,
+                          double&       wgt_left,
+                          double&       wgt_right) const;
     const int&    inx_left(void) const { return m_inx_left; }
     const int&    inx_right(void) const { return m_inx_right; }
     const double& wgt_left(void) const { return m_wgt_left; }
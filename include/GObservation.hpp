@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GEvents.hpp"
 #include "GResponse.hpp"
@@ -37,6 +38,10 @@
 #include "GTime.hpp"
 #include "GEnergy.hpp"
 #include "GFunction.hpp"
+#include "GFunctions.hpp"
+
+/* __ Forward declarations _______________________________________________ */
+class GModelSky;
 
 
 /***********************************************************************//**
@@ -86,6 +91,7 @@ public:
     virtual double        model(const GModels& models, const GEvent& event,
                                 GVector* gradient = NULL) const;
     virtual double        npred(const GModels& models, GVector* gradient = NULL) const;
+    virtual void          prepare(const GModels& models);
 
     // Implemented methods
     void                  name(const std::string& name);
@@ -175,6 +181,49 @@ protected:
         int                 m_ipar;   //!< Parameter index
     };
 
+    // Analytical Npred gradient kernel classes
+    class npred_grad_temp_kern : public GFunctions {
+    public:
+        npred_grad_temp_kern(const GObservation*     parent,
+                             const GModelSky*        model,
+                             const std::vector<int>* ipars) :
+                             m_parent(parent),
+                             m_model(model),
+                             m_ipars(ipars) { }
+        int     size(void) const { return m_ipars->size()+1; }
+        GVector eval(double x);
+    protected:
+        const GObservation*     m_parent; //!< Pointer to parent
+        const GModelSky*        m_model;  //!< Pointer to sky model
+        const std::vector<int>* m_ipars;  //!< Pointer to parameter indices
+    };
+
+    class npred_grad_spec_kern : public GFunctions {
+    public:
+        npred_grad_spec_kern(const GObservation*     parent,
+                             const GModelSky*        model,
+                             const std::vector<int>* ipars,
+                             const GTime*            obsTime) :
+                             m_parent(parent),
+                             m_model(model),
+                             m_ipars(ipars),
+                             m_time(obsTime) { }
+        int     size(void) const { return m_ipars->size()+1; }
+        GVector eval(double x);
+    protected:
+        const GObservation*     m_parent; //!< Pointer to parent
+        const GModelSky*        m_model;  //!< Pointer to sky model
+        const std::vector<int>* m_ipars;  //!< Pointer to parameter indices
+        const GTime*            m_time;   //!< Pointer to time
+    };
+
+    // Analytical Npred gradient methods
+    virtual GVector npred_grad_temp(const GModelSky&        model,
+                                    const std::vector<int>& ipars) const;
+    virtual GVector npred_grad_spec(const GModelSky&        model,
+                                    const std::vector<int>& ipars,
+                                    const GTime&            obsTime) const;
+
     // Protected data area
     std::string m_name;         //!< Name of observation
     std::string m_id;           //!< Observation identifier
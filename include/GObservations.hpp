@@ -152,7 +152,7 @@ public:
                               const GOptimizerPars& pars);
         void poisson_unbinned(const GObservation&   obs,
                               const GOptimizerPars& pars,
-                              GMatrixSparse&        covar,
+                              GMatrixBase&          covar,
                               GVector&              mgrad,
                               double&               value,
                               GVector&              gradient);
@@ -160,7 +160,7 @@ public:
                             const GOptimizerPars& pars);
         void poisson_binned(const GObservation&   obs,
                             const GOptimizerPars& pars,
-                            GMatrixSparse&        covar,
+                            GMatrixBase&          covar,
                             GVector&              mgrad,
                             double&               value,
                             double&               npred,
@@ -169,7 +169,7 @@ public:
                              const GOptimizerPars& pars);
         void gaussian_binned(const GObservation&   obs,
                              const GOptimizerPars& pars,
-                             GMatrixSparse&        covar,
+                             GMatrixBase&          covar,
                              GVector&              mgrad,
                              double&               value,
                              double&               npred,
@@ -117,6 +117,7 @@ protected:
     int               m_status;          //!< Fit status
     int               m_iter;            //!< Iteration
     GLog*             m_logger;          //!< Pointer to optional logger
+    GMatrixSparse     m_decomposition;   //!< Last curvature matrix decomposition
 
 };
 
@@ -38,7 +38,7 @@
 #include "GModelSpatialRadial.hpp"
 #include "GModelSpatialElliptical.hpp"
 #include "GFunction.hpp"
-#include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 
 /* __ Forward declarations _______________________________________________ */
 class GObservation;
@@ -122,7 +122,7 @@ protected:
                                 const GEnergy&             srcEng,
                                 const GTime&               srcTime,
                                 const GObservation&        obs,
-                                const GMatrix&             rot) :
+                                const GMatrix3&            rot) :
                                 m_rsp(rsp),
                                 m_spatial(spatial),
                                 m_srcEng(srcEng),
@@ -136,7 +136,7 @@ protected:
         const GEnergy&             m_srcEng;   //!< True photon energy
         const GTime&               m_srcTime;  //!< True photon arrival time
         const GObservation&        m_obs;      //!< Observation
-        const GMatrix&             m_rot;      //!< Rotation matrix
+        const GMatrix3&            m_rot;      //!< Rotation matrix
     };
 
     // Npred phi integration kernel for radial model
@@ -146,7 +146,7 @@ protected:
                               const GEnergy&      srcEng,
                               const GTime&        srcTime,
                               const GObservation& obs,
-                              const GMatrix&      rot,
+                              const GMatrix3&     rot,
                               const double&       theta,
                               const double&       sin_theta) :
                               m_rsp(rsp),
@@ -163,7 +163,7 @@ protected:
         const GEnergy&      m_srcEng;    //!< True photon energy
         const GTime&        m_srcTime;   //!< True photon arrival time
         const GObservation& m_obs;       //!< Observation
-        const GMatrix&      m_rot;       //!< Rotation matrix
+        const GMatrix3&     m_rot;       //!< Rotation matrix
         const double&       m_theta;     //!< Offset angle (radians)
         double              m_cos_theta; //!< cosine of offset angle
         const double&       m_sin_theta; //!< Sine of offset angle
@@ -177,7 +177,7 @@ protected:
                                     const GEnergy&                 srcEng,
                                     const GTime&                   srcTime,
                                     const GObservation&            obs,
-                                    const GMatrix&                 rot) :
+                                    const GMatrix3&                rot) :
                                     m_rsp(rsp),
                                     m_spatial(spatial),
                                     m_srcEng(srcEng),
@@ -191,7 +191,7 @@ protected:
         const GEnergy&                 m_srcEng;   //!< True photon energy
         const GTime&                   m_srcTime;  //!< True photon arrival time
         const GObservation&            m_obs;      //!< Observation
-        const GMatrix&                 m_rot;      //!< Rotation matrix
+        const GMatrix3&                m_rot;      //!< Rotation matrix
     };
 
     // Npred phi integration kernel for elliptical model
@@ -202,7 +202,7 @@ protected:
                                   const GEnergy&                 srcEng,
                                   const GTime&                   srcTime,
                                   const GObservation&            obs,
-                                  const GMatrix&                 rot,
+                                  const GMatrix3&                rot,
                                   const double&                  theta,
                                   const double&                  sin_theta) :
                                   m_rsp(rsp),
@@ -221,7 +221,7 @@ protected:
         const GEnergy&                 m_srcEng;    //!< True photon energy
         const GTime&                   m_srcTime;   //!< True photon arrival time
         const GObservation&            m_obs;       //!< Observation
-        const GMatrix&                 m_rot;       //!< Rotation matrix
+        const GMatrix3&                m_rot;       //!< Rotation matrix
         const double&                  m_theta;     //!< Offset angle (radians)
         double                         m_cos_theta; //!< cosine of offset angle
         const double&                  m_sin_theta; //!< Sine of offset angle
@@ -31,6 +31,7 @@
 #include <string>
 #include "GBase.hpp"
 #include "GVector.hpp"
+#include "GVector3.hpp"
 
 /* __ Compile options ____________________________________________________ */
 #define G_SINCOS_CACHE
@@ -49,6 +50,10 @@
  * systems (in units of radians), and conversion is performed (and stored)
  * if requested. Coordinates can be given and returned in radians or in
  * degrees. Note that the epoch for celestial coordinates is fixed to J2000.
+ *
+ * The sine and cosine of the latitude are computed when the coordinates
+ * are set, so that dist() and posang() never write to the sky directions
+ * and may be called concurrently on shared instances.
  ***************************************************************************/
 class GSkyDir : public GBase {
 
@@ -73,6 +78,7 @@ public:
     void          lb(const double& l, const double& b);
     void          lb_deg(const double& l, const double& b);
     void          celvector(const GVector& vector);
+    void          celvector(const GVector3& vector);
     void          rotate_deg(const double& phi, const double& theta);
     const double& l(void) const;
     const double& b(void) const;
@@ -82,7 +88,7 @@ public:
     double        b_deg(void) const;
     double        ra_deg(void) const;
     double        dec_deg(void) const;
-    GVector       celvector(void) const;
+    GVector3      celvector(void) const;
     double        dist(const GSkyDir& dir) const;
     double        dist_deg(const GSkyDir& dir) const;
     double        posang(const GSkyDir& dir) const;
@@ -107,14 +113,12 @@ private:
     double m_ra;         //!< Right Ascension in radians
     double m_dec;        //!< Declination in radians
 
-    // Sincos cache
+    // Sincos cache (filled when the coordinates are set)
     #if defined(G_SINCOS_CACHE)
-    mutable bool   m_has_lb_cache;
-    mutable bool   m_has_radec_cache;
-    mutable double m_sin_b;
-    mutable double m_cos_b;
-    mutable double m_sin_dec;
-    mutable double m_cos_dec;
+    double m_sin_b;      //!< Sine of Galactic latitude
+    double m_cos_b;      //!< Cosine of Galactic latitude
+    double m_sin_dec;    //!< Sine of Declination
+    double m_cos_dec;    //!< Cosine of Declination
     #endif
 };
 
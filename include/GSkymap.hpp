@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GWcs.hpp"
 #include "GSkyDir.hpp"
@@ -93,6 +94,12 @@ public:
     GSkyPixel     dir2xy(const GSkyDir& dir) const;
     double        omega(const GSkyPixel& pix) const;
 
+    // Bulk pixel methods
+    std::vector<GSkyDir>   pix2dir(const std::vector<int>& pix) const;
+    std::vector<int>       dir2pix(const std::vector<GSkyDir>& dirs) const;
+    std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pix) const;
+    std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
+
     // Sky direction methods
     double        operator() (const GSkyDir& dir, const int& map = 0) const;
 
@@ -109,6 +116,7 @@ public:
     int           nmaps(void) const;
     int           xy2pix(const GSkyPixel& pix) const;
     GSkyPixel     pix2xy(const int& pix) const;
+    void          reorder(const std::string& ordering);
     GWcs*         wcs(void) const { return m_wcs; }
     void          wcs(const GWcs& wcs);
     double*       pixels(void) const { return m_pixels; }
@@ -28,6 +28,7 @@
 #define GTOOLS_HPP
 
 /* __ Includes ___________________________________________________________ */
+#include <cstddef>
 #include <vector>
 #include <string>
 #include <cmath>
@@ -85,6 +86,11 @@ namespace gammalib {
                                               const double& epivot,
                                               const double& gamma);
     bool                     file_exists(const std::string& filename);
+    int                      thread_id(void);
+    int                      max_threads(void);
+    unsigned long long       checksum(const char* data, const size_t& size);
+    unsigned long long       checksum(const char* data, const size_t& size,
+                                      const unsigned long long& hash);
     bool                     isinfinite(const double& x);
     bool                     isnotanumber(const double& x);
 }
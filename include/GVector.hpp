@@ -32,6 +32,7 @@
 #include <string>
 #include "GBase.hpp"
 #include "GException.hpp"
+#include "GVectorExpr.hpp"
 
 
 /***********************************************************************//**
@@ -42,8 +43,13 @@
  * This class implement a double precision floating point vector class that
  * is intended to be used for numerical computation (it is not ment to
  * replace the std::vector template class).
+ *
+ * Element-wise arithmetic and functions are implemented using expression
+ * templates (see GVectorExpr), so that an expression such as
+ * @p exp(a + 2.0 * b) is evaluated in a single loop when it is assigned
+ * to a vector, without creating any temporary vectors.
  ***************************************************************************/
-class GVector : public GBase {
+class GVector : public GBase, public GVectorExpr<GVector> {
 
     // Friend functions
     friend GVector cross(const GVector& a, const GVector& b);
@@ -54,24 +60,6 @@ class GVector : public GBase {
     friend double  sum(const GVector& vector);
     friend GVector perm(const GVector& vector, const int *p);
     friend GVector iperm(const GVector& vector, const int *p);
-    friend GVector acos(const GVector& vector);
-    friend GVector acosh(const GVector& vector);
-    friend GVector asin(const GVector& vector);
-    friend GVector asinh(const GVector& vector);
-    friend GVector atan(const GVector& vector);
-    friend GVector atanh(const GVector& vector);
-    friend GVector cos(const GVector& vector);
-    friend GVector cosh(const GVector& vector);
-    friend GVector exp(const GVector& vector);
-    friend GVector abs(const GVector& vector);
-    friend GVector log(const GVector& vector);
-    friend GVector log10(const GVector& vector);
-    friend GVector sin(const GVector& vector);
-    friend GVector sinh(const GVector& vector);
-    friend GVector sqrt(const GVector& vector);
-    friend GVector tan(const GVector& vector);
-    friend GVector tanh(const GVector& vector);
-    friend GVector pow(const GVector& vector, const double& power);
 
 public:
     // Constructors and destructors
@@ -81,6 +69,8 @@ public:
     explicit GVector(const double& a, const double& b);
     explicit GVector(const double& a, const double& b, const double& c);
     GVector(const GVector& vector);
+    template <class E>
+    GVector(const GVectorExpr<E>& expr);
     virtual ~GVector(void);
 
     // Vector element access operators
@@ -93,6 +83,12 @@ public:
     GVector& operator=(const GVector& vector);
     GVector& operator+=(const GVector& vector);
     GVector& operator-=(const GVector& vector);
+    template <class E>
+    GVector& operator=(const GVectorExpr<E>& expr);
+    template <class E>
+    GVector& operator+=(const GVectorExpr<E>& expr);
+    template <class E>
+    GVector& operator-=(const GVectorExpr<E>& expr);
     GVector& operator=(const double& scalar);
     GVector& operator+=(const double& scalar);
     GVector& operator-=(const double& scalar);
@@ -165,166 +161,145 @@ const int& GVector::size() const
 
 
 /***********************************************************************//**
- * @brief Add two vectors
- *
- * @param[in] a Vector.
- * @param[in] b Vector.
- * @return Sum of vectors @p a and @p b.
- *
- * Returns the sum of vectors @p a and @p b.
- ***************************************************************************/
-inline
-GVector operator+(const GVector& a, const GVector& b)
-{
-    GVector result = a;
-    result += b;
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Add scalar to vector
+ * @brief Vector expression constructor
  *
- * @param[in] vector Vector.
- * @param[in] scalar Scalar.
- * @return Vector with @p scalar added to all elements.
+ * @param[in] expr Vector expression.
  *
- * Returns a vector for which the @p scalar has been added to all elements.
+ * Constructs a vector by evaluating a vector expression in a single loop.
  ***************************************************************************/
-inline
-GVector operator+(const GVector& vector, const double& scalar)
-{
-    GVector result = vector;
-    result += scalar;
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Add scalar to vector
- *
- * @param[in] scalar Scalar.
- * @param[in] vector Vector.
- * @return Vector with @p scalar added to all elements.
- *
- * Returns a vector for which the @p scalar has been added to all elements.
- ***************************************************************************/
-inline
-GVector operator+(const double& scalar, const GVector& vector)
+template <class E>
+GVector::GVector(const GVectorExpr<E>& expr)
 {
-    GVector result = vector;
-    result += scalar;
-    return result;
-}
-
+    // Initialise class members
+    init_members();
 
-/***********************************************************************//**
- * @brief Subtract vector from vector
- *
- * @param[in] a Vector.
- * @param[in] b Vector.
- * @return Difference between vector @p a and @p b.
- *
- * Returns the difference between vector @p a and @p b.
- ***************************************************************************/
-inline
-GVector operator- (const GVector& a, const GVector& b)
-{
-    GVector result = a;
-    result -= b;
-    return result;
-}
+    // Allocate vector
+    m_num = expr.size();
+    alloc_members();
 
+    // Evaluate expression
+    const E& e = expr.self();
+    for (int i = 0; i < m_num; ++i) {
+        m_data[i] = e[i];
+    }
 
-/***********************************************************************//**
- * @brief Subtract scalar from vector
- *
- * @param[in] vector Vector.
- * @param[in] scalar Scalar.
- * @return Vector with @p scalar subtracted from all elements.
- *
- * Returns a vector for which the @p scalar has been subtracted from all
- * elements.
- ***************************************************************************/
-inline
-GVector operator-(const GVector& vector, const double& scalar)
-{
-    GVector result = vector;
-    result -= scalar;
-    return result;
+    // Return
+    return;
 }
 
 
 /***********************************************************************//**
- * @brief Subtract vector from scalar
+ * @brief Vector expression assignment operator
  *
- * @param[in] scalar Scalar.
- * @param[in] vector Vector.
- * @return Vector with all elements subtracted from @p scalar.
+ * @param[in] expr Vector expression.
+ * @return Vector.
  *
- * Returns a vector for which all elements have been subtracted from the 
- * @p scalar.
+ * Evaluates a vector expression in a single loop. If the vector has the
+ * same size as the expression, the elements are written into the existing
+ * storage, which is safe also if the vector itself appears in the
+ * expression since all operations are element-wise. Otherwise, the
+ * expression is evaluated into newly allocated storage.
  ***************************************************************************/
-inline
-GVector operator-(const double& scalar, const GVector& vector)
+template <class E>
+GVector& GVector::operator=(const GVectorExpr<E>& expr)
 {
-    GVector result = -vector;
-    result += scalar;
-    return result;
+    // Get expression
+    const E& e = expr.self();
+
+    // If expression has the same size then evaluate it in place
+    if (m_num == e.size()) {
+        for (int i = 0; i < m_num; ++i) {
+            m_data[i] = e[i];
+        }
+    }
+
+    // ... otherwise evaluate expression into new storage
+    else {
+        GVector result(expr);
+        free_members();
+        m_num         = result.m_num;
+        m_data        = result.m_data;
+        result.m_num  = 0;
+        result.m_data = NULL;
+    }
+
+    // Return this object
+    return *this;
 }
 
 
 /***********************************************************************//**
- * @brief Multiply vector by scalar
+ * @brief Vector expression addition operator
  *
- * @param[in] vector Vector.
- * @param[in] scalar Scalar.
- * @return Vector for which all elements have be multiplied by @p scalar.
+ * @param[in] expr Vector expression.
+ * @return Vector.
  *
- * Returns a vector for which all elements have be multiplied by @p scalar.
+ * @exception GException::vector_mismatch
+ *            Vector and expression have not the same size.
  ***************************************************************************/
-inline
-GVector operator*(const GVector& vector, const double& scalar)
+template <class E>
+GVector& GVector::operator+=(const GVectorExpr<E>& expr)
 {
-    GVector result = vector;
-    result *= scalar;
-    return result;
+    // Get expression
+    const E& e = expr.self();
+
+    // Raise exception if vectors mismatch
+    if (m_num != e.size()) {
+        throw GException::vector_mismatch("GVector::operator+=(GVector&)",
+                                          m_num, e.size());
+    }
+
+    // Add expression
+    for (int i = 0; i < m_num; ++i) {
+        m_data[i] += e[i];
+    }
+
+    // Return this object
+    return *this;
 }
 
 
 /***********************************************************************//**
- * @brief Multiply vector by scalar
+ * @brief Vector expression subtraction operator
  *
- * @param[in] scalar Scalar.
- * @param[in] vector Vector.
- * @return Vector for which all elements have be multiplied by @p scalar.
+ * @param[in] expr Vector expression.
+ * @return Vector.
  *
- * Returns a vector for which all elements have be multiplied by @p scalar.
+ * @exception GException::vector_mismatch
+ *            Vector and expression have not the same size.
  ***************************************************************************/
-inline
-GVector operator*(const double& scalar, const GVector& vector)
+template <class E>
+GVector& GVector::operator-=(const GVectorExpr<E>& expr)
 {
-    GVector result = vector;
-    result *= scalar;
-    return result;
+    // Get expression
+    const E& e = expr.self();
+
+    // Raise exception if vectors mismatch
+    if (m_num != e.size()) {
+        throw GException::vector_mismatch("GVector::operator-=(GVector&)",
+                                          m_num, e.size());
+    }
+
+    // Subtract expression
+    for (int i = 0; i < m_num; ++i) {
+        m_data[i] -= e[i];
+    }
+
+    // Return this object
+    return *this;
 }
 
 
 /***********************************************************************//**
- * @brief Divide vector by scalar
+ * @brief Print vector expression
  *
- * @param[in] vector Vector.
- * @param[in] scalar Scalar.
- * @return Vector for which all elements have be divided by @p scalar.
- *
- * Returns a vector for which all elements have be divided by @p scalar.
+ * @param[in] chatter Chattiness (defaults to NORMAL).
+ * @return String containing the evaluated vector expression.
  ***************************************************************************/
-inline
-GVector operator/(const GVector& vector, const double& scalar)
+template <class E>
+std::string GVectorExpr<E>::print(const GChatter& chatter) const
 {
-    GVector result = vector;
-    result /= scalar;
-    return result;
+    return (GVector(*this).print(chatter));
 }
 
 #endif /* GVECTOR_HPP */
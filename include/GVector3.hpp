@@ -0,0 +1,197 @@
+/***************************************************************************
+ *                 GVector3.hpp - Fixed-size 3-vector class                *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GVector3.hpp
+ * @brief Fixed-size 3-vector class definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GVECTOR3_HPP
+#define GVECTOR3_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <cmath>
+#include <string>
+#include "GBase.hpp"
+#include "GVector.hpp"
+
+
+/***********************************************************************//**
+ * @class GVector3
+ *
+ * @brief Fixed-size 3-vector class
+ *
+ * This class implements a three-element double precision vector that is
+ * used for the Cartesian representation of sky directions. As opposed to
+ * GVector, the elements are stored within the object itself, hence a
+ * GVector3 can be created on the stack and copied without any memory
+ * allocation. This makes the class suited for coordinate transformations
+ * that are performed for each event or integration point.
+ ***************************************************************************/
+class GVector3 : public GBase {
+
+public:
+    // Constructors and destructors
+    GVector3(void);
+    GVector3(const double& x, const double& y, const double& z);
+    explicit GVector3(const GVector& vector);
+    GVector3(const GVector3& vector);
+    virtual ~GVector3(void);
+
+    // Vector element access operators
+    double&       operator[](const int& index);
+    const double& operator[](const int& index) const;
+
+    // Vector operators
+    bool      operator==(const GVector3& vector) const;
+    bool      operator!=(const GVector3& vector) const;
+    GVector3& operator=(const GVector3& vector);
+    GVector3& operator+=(const GVector3& vector);
+    GVector3& operator-=(const GVector3& vector);
+    GVector3& operator*=(const double& scalar);
+
+    // Vector methods
+    void        clear(void);
+    GVector3*   clone(void) const;
+    int         size(void) const;
+    GVector     vector(void) const;
+    std::string print(const GChatter& chatter = NORMAL) const;
+
+private:
+    // Private methods
+    void init_members(void);
+    void copy_members(const GVector3& vector);
+    void free_members(void);
+
+    // Private data area
+    double m_data[3];   //!< Vector elements
+};
+
+
+/***********************************************************************//**
+ * @brief Vector element access operator
+ *
+ * @param[in] index Element index [0,...,2]
+ * @return Reference to vector element.
+ ***************************************************************************/
+inline
+double& GVector3::operator[](const int& index)
+{
+    return m_data[index];
+}
+
+
+/***********************************************************************//**
+ * @brief Vector element access operator (const variant)
+ *
+ * @param[in] index Element index [0,...,2]
+ * @return Reference to vector element.
+ ***************************************************************************/
+inline
+const double& GVector3::operator[](const int& index) const
+{
+    return m_data[index];
+}
+
+
+/***********************************************************************//**
+ * @brief Return size of vector
+ *
+ * @return Size of vector (always 3).
+ ***************************************************************************/
+inline
+int GVector3::size(void) const
+{
+    return 3;
+}
+
+
+/***********************************************************************//**
+ * @brief Scalar product of two 3-vectors
+ *
+ * @param[in] a Vector.
+ * @param[in] b Vector.
+ * @return Scalar product of @p a and @p b.
+ ***************************************************************************/
+inline
+double operator*(const GVector3& a, const GVector3& b)
+{
+    return (a[0]*b[0] + a[1]*b[1] + a[2]*b[2]);
+}
+
+
+/***********************************************************************//**
+ * @brief Multiply 3-vector by scalar
+ *
+ * @param[in] vector Vector.
+ * @param[in] scalar Scalar.
+ * @return Vector for which all elements have be multiplied by @p scalar.
+ ***************************************************************************/
+inline
+GVector3 operator*(const GVector3& vector, const double& scalar)
+{
+    return (GVector3(vector[0]*scalar, vector[1]*scalar, vector[2]*scalar));
+}
+
+
+/***********************************************************************//**
+ * @brief Multiply 3-vector by scalar
+ *
+ * @param[in] scalar Scalar.
+ * @param[in] vector Vector.
+ * @return Vector for which all elements have be multiplied by @p scalar.
+ ***************************************************************************/
+inline
+GVector3 operator*(const double& scalar, const GVector3& vector)
+{
+    return (vector * scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Vector cross product of two 3-vectors
+ *
+ * @param[in] a Vector.
+ * @param[in] b Vector.
+ * @return Vector cross product of @p a and @p b.
+ ***************************************************************************/
+inline
+GVector3 cross(const GVector3& a, const GVector3& b)
+{
+    return (GVector3(a[1]*b[2] - a[2]*b[1],
+                     a[2]*b[0] - a[0]*b[2],
+                     a[0]*b[1] - a[1]*b[0]));
+}
+
+
+/***********************************************************************//**
+ * @brief Computes norm of 3-vector
+ *
+ * @param[in] vector Vector.
+ * @return Vector norm.
+ ***************************************************************************/
+inline
+double norm(const GVector3& vector)
+{
+    return (std::sqrt(vector * vector));
+}
+
+#endif /* GVECTOR3_HPP */
@@ -0,0 +1,679 @@
+/***************************************************************************
+ *        GVectorExpr.hpp - Vector expression template definitions         *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GVectorExpr.hpp
+ * @brief Vector expression template definitions
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GVECTOREXPR_HPP
+#define GVECTOREXPR_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <cmath>
+#include <string>
+#include "GTypemaps.hpp"
+#include "GException.hpp"
+
+
+/***********************************************************************//**
+ * @class GVectorExpr
+ *
+ * @brief Vector expression base class
+ *
+ * This class is the base class of all vector expressions, including the
+ * GVector class itself. Element-wise arithmetic and functions on vector
+ * expressions do not compute a result vector but return a lightweight
+ * expression object that references its operands. The expression is only
+ * evaluated when it is assigned to a GVector, using a single loop over
+ * all elements without any temporary vectors. For example
+ *
+ *     GVector c = exp(a + 2.0 * b) / 3.0;
+ *
+ * allocates only the result vector @p c.
+ *
+ * Expression objects reference their operands and are only valid until
+ * the end of the full expression in which they have been created. They
+ * should therefore never be stored, but always be assigned to a GVector.
+ * The print() method evaluates the expression into a vector and prints
+ * the result.
+ ***************************************************************************/
+template <class E>
+class GVectorExpr {
+public:
+    const E& self(void) const { return static_cast<const E&>(*this); }
+    int      size(void) const { return self().size(); }
+    double   operator[](const int& index) const { return self()[index]; }
+    std::string print(const GChatter& chatter = NORMAL) const;
+};
+
+
+/***********************************************************************//**
+ * @class GVectorUnaryExpr
+ *
+ * @brief Element-wise function of a vector expression
+ ***************************************************************************/
+template <class E, class F>
+class GVectorUnaryExpr : public GVectorExpr<GVectorUnaryExpr<E,F> > {
+public:
+    explicit GVectorUnaryExpr(const E& e) : m_e(e) {}
+    int    size(void) const { return m_e.size(); }
+    double operator[](const int& index) const { return F::eval(m_e[index]); }
+private:
+    const E& m_e; //!< Operand
+};
+
+
+/***********************************************************************//**
+ * @class GVectorBinaryExpr
+ *
+ * @brief Element-wise operation on two vector expressions
+ ***************************************************************************/
+template <class A, class B, class F>
+class GVectorBinaryExpr : public GVectorExpr<GVectorBinaryExpr<A,B,F> > {
+public:
+    GVectorBinaryExpr(const A& a, const B& b, const char* origin) :
+                      m_a(a), m_b(b) {
+        if (a.size() != b.size()) {
+            throw GException::vector_mismatch(origin, a.size(), b.size());
+        }
+    }
+    int    size(void) const { return m_a.size(); }
+    double operator[](const int& index) const {
+        return F::eval(m_a[index], m_b[index]);
+    }
+private:
+    const A& m_a; //!< First operand
+    const B& m_b; //!< Second operand
+};
+
+
+/***********************************************************************//**
+ * @class GVectorScalarExpr
+ *
+ * @brief Element-wise operation on a vector expression and a scalar
+ ***************************************************************************/
+template <class E, class F>
+class GVectorScalarExpr : public GVectorExpr<GVectorScalarExpr<E,F> > {
+public:
+    GVectorScalarExpr(const E& e, const double& s) : m_e(e), m_s(s) {}
+    int    size(void) const { return m_e.size(); }
+    double operator[](const int& index) const {
+        return F::eval(m_e[index], m_s);
+    }
+private:
+    const E& m_e; //!< Vector operand
+    double   m_s; //!< Scalar operand
+};
+
+
+/* __ Element-wise operations ____________________________________________ */
+struct GVectorOpAdd  { static double eval(double a, double b) { return a + b; } };
+struct GVectorOpSub  { static double eval(double a, double b) { return a - b; } };
+struct GVectorOpRsub { static double eval(double a, double b) { return b - a; } };
+struct GVectorOpMul  { static double eval(double a, double b) { return a * b; } };
+struct GVectorOpDiv  { static double eval(double a, double b) { return a / b; } };
+struct GVectorOpPow  { static double eval(double a, double b) { return std::pow(a, b); } };
+struct GVectorFctNeg    { static double eval(double a) { return -a; } };
+struct GVectorFctAcos   { static double eval(double a) { return std::acos(a); } };
+struct GVectorFctAcosh  { static double eval(double a) { return ::acosh(a); } };
+struct GVectorFctAsin   { static double eval(double a) { return std::asin(a); } };
+struct GVectorFctAsinh  { static double eval(double a) { return ::asinh(a); } };
+struct GVectorFctAtan   { static double eval(double a) { return std::atan(a); } };
+struct GVectorFctAtanh  { static double eval(double a) { return ::atanh(a); } };
+struct GVectorFctCos    { static double eval(double a) { return std::cos(a); } };
+struct GVectorFctCosh   { static double eval(double a) { return std::cosh(a); } };
+struct GVectorFctExp    { static double eval(double a) { return std::exp(a); } };
+struct GVectorFctAbs    { static double eval(double a) { return std::fabs(a); } };
+struct GVectorFctLog    { static double eval(double a) { return std::log(a); } };
+struct GVectorFctLog10  { static double eval(double a) { return std::log10(a); } };
+struct GVectorFctSin    { static double eval(double a) { return std::sin(a); } };
+struct GVectorFctSinh   { static double eval(double a) { return std::sinh(a); } };
+struct GVectorFctSqrt   { static double eval(double a) { return std::sqrt(a); } };
+struct GVectorFctTan    { static double eval(double a) { return std::tan(a); } };
+struct GVectorFctTanh   { static double eval(double a) { return std::tanh(a); } };
+
+
+/***********************************************************************//**
+ * @brief Add two vector expressions
+ *
+ * @param[in] a Vector expression.
+ * @param[in] b Vector expression.
+ * @return Expression for sum of @p a and @p b.
+ *
+ * @exception GException::vector_mismatch
+ *            Vectors have not the same size.
+ ***************************************************************************/
+template <class A, class B>
+inline
+GVectorBinaryExpr<A,B,GVectorOpAdd> operator+(const GVectorExpr<A>& a,
+                                              const GVectorExpr<B>& b)
+{
+    return GVectorBinaryExpr<A,B,GVectorOpAdd>(a.self(), b.self(),
+           "operator+(GVector&, GVector&)");
+}
+
+
+/***********************************************************************//**
+ * @brief Subtract two vector expressions
+ *
+ * @param[in] a Vector expression.
+ * @param[in] b Vector expression.
+ * @return Expression for difference between @p a and @p b.
+ *
+ * @exception GException::vector_mismatch
+ *            Vectors have not the same size.
+ ***************************************************************************/
+template <class A, class B>
+inline
+GVectorBinaryExpr<A,B,GVectorOpSub> operator-(const GVectorExpr<A>& a,
+                                              const GVectorExpr<B>& b)
+{
+    return GVectorBinaryExpr<A,B,GVectorOpSub>(a.self(), b.self(),
+           "operator-(GVector&, GVector&)");
+}
+
+
+/***********************************************************************//**
+ * @brief Negate vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression with all elements negated.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctNeg> operator-(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctNeg>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Add scalar to vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @param[in] scalar Scalar.
+ * @return Expression with @p scalar added to all elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpAdd> operator+(const GVectorExpr<E>& vector,
+                                            const double&         scalar)
+{
+    return GVectorScalarExpr<E,GVectorOpAdd>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Add scalar to vector expression
+ *
+ * @param[in] scalar Scalar.
+ * @param[in] vector Vector expression.
+ * @return Expression with @p scalar added to all elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpAdd> operator+(const double&         scalar,
+                                            const GVectorExpr<E>& vector)
+{
+    return GVectorScalarExpr<E,GVectorOpAdd>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Subtract scalar from vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @param[in] scalar Scalar.
+ * @return Expression with @p scalar subtracted from all elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpSub> operator-(const GVectorExpr<E>& vector,
+                                            const double&         scalar)
+{
+    return GVectorScalarExpr<E,GVectorOpSub>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Subtract vector expression from scalar
+ *
+ * @param[in] scalar Scalar.
+ * @param[in] vector Vector expression.
+ * @return Expression with all elements subtracted from @p scalar.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpRsub> operator-(const double&         scalar,
+                                             const GVectorExpr<E>& vector)
+{
+    return GVectorScalarExpr<E,GVectorOpRsub>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Multiply vector expression by scalar
+ *
+ * @param[in] vector Vector expression.
+ * @param[in] scalar Scalar.
+ * @return Expression with all elements multiplied by @p scalar.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpMul> operator*(const GVectorExpr<E>& vector,
+                                            const double&         scalar)
+{
+    return GVectorScalarExpr<E,GVectorOpMul>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Multiply vector expression by scalar
+ *
+ * @param[in] scalar Scalar.
+ * @param[in] vector Vector expression.
+ * @return Expression with all elements multiplied by @p scalar.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpMul> operator*(const double&         scalar,
+                                            const GVectorExpr<E>& vector)
+{
+    return GVectorScalarExpr<E,GVectorOpMul>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Divide vector expression by scalar
+ *
+ * @param[in] vector Vector expression.
+ * @param[in] scalar Scalar.
+ * @return Expression with all elements divided by @p scalar.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpDiv> operator/(const GVectorExpr<E>& vector,
+                                            const double&         scalar)
+{
+    return GVectorScalarExpr<E,GVectorOpDiv>(vector.self(), scalar);
+}
+
+
+/***********************************************************************//**
+ * @brief Raise elements of vector expression to a power
+ *
+ * @param[in] vector Vector expression.
+ * @param[in] power Power.
+ * @return Expression with all elements raised to @p power.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorScalarExpr<E,GVectorOpPow> pow(const GVectorExpr<E>& vector,
+                                      const double&         power)
+{
+    return GVectorScalarExpr<E,GVectorOpPow>(vector.self(), power);
+}
+
+
+/***********************************************************************//**
+ * @brief Computes acos of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for acos of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAcos> acos(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAcos>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes acosh of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for acosh of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAcosh> acosh(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAcosh>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes asin of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for asin of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAsin> asin(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAsin>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes asinh of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for asinh of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAsinh> asinh(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAsinh>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes atan of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for atan of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAtan> atan(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAtan>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes atanh of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for atanh of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAtanh> atanh(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAtanh>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes cos of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for cos of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctCos> cos(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctCos>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes cosh of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for cosh of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctCosh> cosh(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctCosh>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes exp of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for exp of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctExp> exp(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctExp>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes abs of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for abs of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctAbs> abs(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctAbs>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes log of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for log of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctLog> log(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctLog>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes log10 of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for log10 of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctLog10> log10(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctLog10>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes sin of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for sin of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctSin> sin(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctSin>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes sinh of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for sinh of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctSinh> sinh(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctSinh>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes sqrt of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for sqrt of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctSqrt> sqrt(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctSqrt>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes tan of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for tan of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctTan> tan(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctTan>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Computes tanh of vector expression elements
+ *
+ * @param[in] vector Vector expression.
+ * @return Expression for tanh of vector elements.
+ ***************************************************************************/
+template <class E>
+inline
+GVectorUnaryExpr<E,GVectorFctTanh> tanh(const GVectorExpr<E>& vector)
+{
+    return GVectorUnaryExpr<E,GVectorFctTanh>(vector.self());
+}
+
+
+/***********************************************************************//**
+ * @brief Scalar product of vector expressions
+ *
+ * @param[in] a Vector expression.
+ * @param[in] b Vector expression.
+ * @return Scalar product between @p a and @p b.
+ *
+ * @exception GException::vector_mismatch
+ *            Vectors have not the same size.
+ ***************************************************************************/
+template <class A, class B>
+inline
+double operator*(const GVectorExpr<A>& a, const GVectorExpr<B>& b)
+{
+    if (a.size() != b.size()) {
+        throw GException::vector_mismatch("operator*(GVector&, GVector&)",
+                                          a.size(), b.size());
+    }
+    double result = 0.0;
+    for (int i = 0; i < a.size(); ++i) {
+        result += a[i] * b[i];
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Computes norm of vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @return Vector norm.
+ ***************************************************************************/
+template <class E>
+inline
+double norm(const GVectorExpr<E>& vector)
+{
+    double result = 0.0;
+    for (int i = 0; i < vector.size(); ++i) {
+        double value = vector[i];
+        result      += value * value;
+    }
+    return ((result > 0.0) ? std::sqrt(result) : 0.0);
+}
+
+
+/***********************************************************************//**
+ * @brief Computes minimum of vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @return Minimum element (0 for empty vectors).
+ ***************************************************************************/
+template <class E>
+inline
+double min(const GVectorExpr<E>& vector)
+{
+    double result = (vector.size() > 0) ? vector[0] : 0.0;
+    for (int i = 1; i < vector.size(); ++i) {
+        double value = vector[i];
+        if (value < result) {
+            result = value;
+        }
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Computes maximum of vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @return Maximum element (0 for empty vectors).
+ ***************************************************************************/
+template <class E>
+inline
+double max(const GVectorExpr<E>& vector)
+{
+    double result = (vector.size() > 0) ? vector[0] : 0.0;
+    for (int i = 1; i < vector.size(); ++i) {
+        double value = vector[i];
+        if (value > result) {
+            result = value;
+        }
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Computes sum of vector expression
+ *
+ * @param[in] vector Vector expression.
+ * @return Sum of elements.
+ ***************************************************************************/
+template <class E>
+inline
+double sum(const GVectorExpr<E>& vector)
+{
+    double result = 0.0;
+    for (int i = 0; i < vector.size(); ++i) {
+        result += vector[i];
+    }
+    return result;
+}
+
+#endif /* GVECTOREXPR_HPP */
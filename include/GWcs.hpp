@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GFitsHDU.hpp"
 #include "GSkyDir.hpp"
@@ -71,8 +72,12 @@ public:
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
     // Virtual methods
-    virtual std::string coordsys(void) const;
-    virtual void        coordsys(const std::string& coordsys);
+    virtual std::string            coordsys(void) const;
+    virtual void                   coordsys(const std::string& coordsys);
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<int>& pix) const;
+    virtual std::vector<int>       dir2pix(const std::vector<GSkyDir>& dirs) const;
+    virtual std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pix) const;
+    virtual std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
 
 protected:
     // Protected methods
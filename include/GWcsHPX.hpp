@@ -72,11 +72,19 @@ public:
     virtual GSkyPixel   dir2xy(const GSkyDir& dir) const;
     virtual std::string print(const GChatter& chatter = NORMAL) const;
 
+    // Bulk transformation methods
+    using GWcs::xy2dir;
+    using GWcs::dir2xy;
+    virtual std::vector<GSkyDir> pix2dir(const std::vector<int>& pix) const;
+    virtual std::vector<int>     dir2pix(const std::vector<GSkyDir>& dirs) const;
+
     // Additional class specific methods
     int          npix(void) const;
     int          nside(void) const;
     std::string  ordering(void) const;
     void         ordering(const std::string& ordering);
+    int          ring2nest(const int& pix) const;
+    int          nest2ring(const int& pix) const;
 
 private:
     // Private methods
@@ -93,6 +101,14 @@ private:
     void         pix2ang_nest(int ipix, double* theta, double* phi) const;
     int          ang2pix_z_phi_ring(double z, double phi) const;
     int          ang2pix_z_phi_nest(double z, double phi) const;
+    void         pix2ang_ring(const int& num, const int* ipix,
+                              double* theta, double* phi) const;
+    void         pix2ang_nest(const int& num, const int* ipix,
+                              double* theta, double* phi) const;
+    void         ang2pix_z_phi_ring(const int& num, const double* z,
+                                    const double* phi, int* ipix) const;
+    void         ang2pix_z_phi_nest(const int& num, const double* z,
+                                    const double* phi, int* ipix) const;
     unsigned int isqrt(unsigned int arg) const;
 
     // NEW VERSION
@@ -76,6 +76,12 @@ public:
     virtual GSkyDir     xy2dir(const GSkyPixel& pix) const;
     virtual GSkyPixel   dir2xy(const GSkyDir& dir) const;
 
+    // Bulk transformation methods
+    using GWcs::pix2dir;
+    using GWcs::dir2pix;
+    virtual std::vector<GSkyDir>   xy2dir(const std::vector<GSkyPixel>& pix) const;
+    virtual std::vector<GSkyPixel> dir2xy(const std::vector<GSkyDir>& dirs) const;
+
     // Other methods
     void   set(const std::string& coords,
                const double& crval1, const double& crval2,
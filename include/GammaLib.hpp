@@ -51,15 +51,18 @@
 
 /* __ Linear algebra module ______________________________________________ */
 #include "GVector.hpp"
+#include "GVector3.hpp"
 #include "GMatrixBase.hpp"
 #include "GMatrix.hpp"
 #include "GMatrixSparse.hpp"
 #include "GMatrixSymmetric.hpp"
+#include "GMatrix3.hpp"
 
 /* __ Numerics module ____________________________________________________ */
 #include "GIntegral.hpp"
 #include "GDerivative.hpp"
 #include "GFunction.hpp"
+#include "GFunctions.hpp"
 #include "GMath.hpp"
 
 /* __ FITS module ________________________________________________________ */
@@ -78,6 +78,10 @@ public:
     virtual int            number(void) const;
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual GCOMEventBin*       new_bin(void) const;
+    virtual const GCOMEventBin* bin(const int& index, GEventBin* buffer) const;
+
     // Other methods
     void                   map(const GSkymap& map, const double& phimin,
                                const double& dphi);
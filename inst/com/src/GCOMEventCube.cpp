@@ -39,6 +39,7 @@
 #define G_SET_SCATTER_DIRECTIONS    "GCOMEventCube::set_scatter_directions()"
 #define G_SET_ENERGIES                        "GCOMEventCube::set_energies()"
 #define G_SET_TIMES                              "GCOMEventCube::set_times()"
+#define G_BIN                        "GCOMEventCube::bin(int&, GEventBin*)"
 #define G_SET_BIN                              "GCOMEventCube::set_bin(int&)"
 
 /* __ Macros _____________________________________________________________ */
@@ -244,6 +245,85 @@ const GCOMEventBin* GCOMEventCube::operator[](const int& index) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Allocate event bin buffer
+ *
+ * @return Pointer to new COMPTEL event bin.
+ *
+ * Allocates an event bin that can be passed as buffer to the bin() method.
+ * The event cube is not accessed, hence the method can be called
+ * concurrently by several threads. The caller is responsible for deleting
+ * the event bin.
+ ***************************************************************************/
+GCOMEventBin* GCOMEventCube::new_bin(void) const
+{
+    // Return new event bin
+    return (new GCOMEventBin);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin without modifying the event cube
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] buffer Event bin buffer (a clone of a COMPTEL event bin).
+ * @return Pointer to event bin.
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GException::invalid_argument
+ *            Event bin buffer is not a cloned COMPTEL event bin.
+ * @exception GCOMException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Copies the attributes of the bin with the specified @p index into the
+ * memory owned by the event bin @p buffer, and returns a pointer to the
+ * @p buffer. As the event cube is not modified, the method can be called
+ * concurrently by several threads, each holding its own bin buffer. Note
+ * that setting the number of counts of the returned bin does not modify
+ * the event cube.
+ ***************************************************************************/
+const GCOMEventBin* GCOMEventCube::bin(const int& index, GEventBin* buffer) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_BIN, index, 0, size()-1);
+    }
+    #endif
+
+    // Get COMPTEL event bin buffer that owns its memory
+    GCOMEventBin* bin = dynamic_cast<GCOMEventBin*>(buffer);
+    if (bin == NULL || !bin->m_alloc) {
+        throw GException::invalid_argument(G_BIN,
+              "Event bin buffer is not a cloned COMPTEL event bin.");
+    }
+
+    // Check for the existence of sky directions and solid angles
+    if (int(m_dirs.size()) != npix() || int(m_omega.size()) != npix()) {
+        throw GCOMException::no_dirs(G_BIN);
+    }
+
+    // Get pixel and energy bin indices.
+    int ipix = index % npix();
+    int iphi = index / npix();
+
+    // Set bin attributes
+    bin->m_index   = index;
+    *bin->m_counts = m_map.pixels()[index];
+    bin->m_dir->dir(m_dirs[ipix]);
+    bin->m_dir->phibar(m_phi[iphi]);
+    *bin->m_omega  = m_omega[ipix];
+    *bin->m_time   = m_time;
+    *bin->m_ontime = m_ontime;
+    *bin->m_energy = m_energy;
+    *bin->m_ewidth = m_ewidth;
+
+    // Return pointer
+    return bin;
+}
+
+
 /***********************************************************************//**
  * @brief Clear instance
  *
@@ -704,12 +784,17 @@ void GCOMEventCube::set_scatter_directions(void)
     m_dirs.reserve(npix());
     m_omega.reserve(npix());
 
-    // Set pixel directions and solid angles
+    // Set pixel directions and solid angles. The sky directions of each
+    // row of pixels are computed using a bulk transformation.
+    std::vector<GSkyPixel> pixels(nchi());
     for (int iy = 0; iy < npsi(); ++iy) {
         for (int ix = 0; ix < nchi(); ++ix) {
-            GSkyPixel pixel = GSkyPixel(double(ix), double(iy));
-            m_dirs.push_back(m_map.xy2dir(pixel));
-            m_omega.push_back(m_map.omega(pixel));
+            pixels[ix] = GSkyPixel(double(ix), double(iy));
+        }
+        std::vector<GSkyDir> dirs = m_map.xy2dir(pixels);
+        for (int ix = 0; ix < nchi(); ++ix) {
+            m_dirs.push_back(dirs[ix]);
+            m_omega.push_back(m_map.omega(pixels[ix]));
         }
     }
 
@@ -41,7 +41,9 @@
  * @brief GCTAEventAtom class interface defintion
  *
  * This class implement a CTA event atom. It collects all the relevant event
- * information needed for CTA unbinned analysis.
+ * information needed for CTA unbinned analysis. Additional reconstruction
+ * information (shower core, Hillas parameters, ...) is not held by the
+ * atom but is stored in optional columns of the GCTAEventList container.
  ***************************************************************************/
 class GCTAEventAtom : public GEventAtom {
 
@@ -88,25 +90,6 @@ protected:
     GTime         m_time;           //!< Event time
     unsigned long m_event_id;       //!< Event identifier
     unsigned long m_obs_id;         //!< Observation identifier
-    int           m_multip;         //!< Multiplicity
-    char          m_telmask;        //!< Telescope mask
-    float         m_dir_err;        //!< Error on event direction
-    float         m_detx;           //!< Tangential coordinate in nominal sys
-    float         m_dety;           //!< Tangential coordinate in nominal sys
-    float         m_alt;            //!< Event altitude
-    float         m_az;             //!< Event azimuth
-    float         m_corex;          //!< Position on ground (m)
-    float         m_corey;          //!< Position on ground (m)
-    float         m_core_err;       //!< Error on core reconstruction
-    float         m_xmax;           //!< Position of shower max (g/cm2)
-    float         m_xmax_err;       //!< Error on shower max (g/cm2)
-    float         m_shwidth;        //!< Shower width (m)
-    float         m_shlength;       //!< Shower length (m)
-    float         m_energy_err;     //!< Error on event energy (MeV)
-    float         m_hil_msw;        //!< Hillas MSW
-    float         m_hil_msw_err;    //!< Hillas MSW error
-    float         m_hil_msl;        //!< Hillas MSL
-    float         m_hil_msl_err;    //!< Hillas MSL error
 };
 
 #endif /* GCTAEVENTATOM_HPP */
@@ -76,6 +76,10 @@ public:
     virtual int            number(void) const;
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual GCTAEventBin*       new_bin(void) const;
+    virtual const GCTAEventBin* bin(const int& index, GEventBin* buffer) const;
+
     // Other methods
     void                   map(const GSkymap& map);
     const GSkymap&         map(void) const { return m_map; }
@@ -96,6 +100,7 @@ protected:
     virtual void set_energies(void);
     virtual void set_times(void);
     void         set_bin(const int& index);
+    void         set_bin(const int& index, GCTAEventBin& bin) const;
 
     // Protected members
     GSkymap                  m_map;        //!< Counts map stored as sky map
@@ -30,12 +30,18 @@
 /* __ Includes ___________________________________________________________ */
 #include <string>
 #include <vector>
+#include <map>
 #include "GEventList.hpp"
 #include "GCTAEventAtom.hpp"
 #include "GCTARoi.hpp"
 #include "GFitsHDU.hpp"
 #include "GFitsTable.hpp"
 #include "GFitsBinTable.hpp"
+#include "GEbounds.hpp"
+#include "GGti.hpp"
+
+/* __ Forward declarations _______________________________________________ */
+class GSource;
 
 
 /***********************************************************************//**
@@ -44,6 +50,36 @@
  * @brief CTA event atom container class
  *
  * This class is a container class for CTA event atoms.
+ *
+ * Reconstruction information that is not needed for the analysis (shower
+ * core, Hillas parameters, ...) is not held by the event atoms but stored
+ * in optional columns that are only allocated if they are present in the
+ * event file.
+ *
+ * The Right Ascension, Declination, celestial unit vector, log10 energy
+ * and time of all events are in addition held in contiguous arrays, so
+ * that the response kernels can stream through the event quantities they
+ * need. The arrays are built when events are loaded or appended. As the
+ * events may be modified through the non-const access operator, that
+ * operator flags the arrays as outdated, and update_arrays() rebuilds
+ * them. GCTAObservation::prepare() does this before the likelihood
+ * evaluation.
+ *
+ * Events may be loaded selectively for a region of interest, energy
+ * boundaries and Good Time Intervals. The selection is applied while the
+ * FITS table is read, and only the columns needed for the analysis are
+ * accessed, hence events outside the selection are never stored.
+ *
+ * The class also holds a cache of IRF values for diffuse models. Each
+ * model is assigned an integer handle by irf_cache_handle(), which also
+ * allocates the values for all events. Values are stored in single
+ * precision and are read and written without locking in constant time
+ * using that handle and the event index. The handles of all models should
+ * be resolved before the event loop, which is done by
+ * GCTAObservation::prepare(). If the memory exceeds the limit set
+ * by irf_cache_max_memory(), the values of models whose handles were not
+ * resolved since the last eviction are dropped from the cache. Values are
+ * only dropped outside of parallel regions.
  ***************************************************************************/
 class GCTAEventList : public GEventList {
 
@@ -73,11 +109,37 @@ public:
     std::string            print(const GChatter& chatter = NORMAL) const;
 
     // Implement other methods
+    void   load(const std::string& filename, const GCTARoi& roi,
+                const GEbounds& ebounds, const GGti& gti,
+                const bool& columns = false);
+    void   read(const GFits& file, const GCTARoi& roi,
+                const GEbounds& ebounds, const GGti& gti,
+                const bool& columns = false);
     void   append(const GCTAEventAtom& event);
     void   reserve(const int& number);
+    bool   hascolumn(const std::string& name) const;
+    const std::vector<float>&  column(const std::string& name) const;
+    void   column(const std::string& name, const std::vector<float>& values);
+    bool   hasarrays(void) const { return m_has_arrays; }
+    void   update_arrays(void);
+    const std::vector<double>& ra(void) const { return m_ra; }
+    const std::vector<double>& dec(void) const { return m_dec; }
+    const std::vector<double>& dirx(void) const { return m_dirx; }
+    const std::vector<double>& diry(void) const { return m_diry; }
+    const std::vector<double>& dirz(void) const { return m_dirz; }
+    const std::vector<double>& logE(void) const { return m_logE; }
+    const std::vector<double>& secs(void) const { return m_secs; }
+    int    irf_cache_handle(const std::string& name) const;
+    int    irf_cache_handle(const GSource& source) const;
+    double irf_cache(const int& handle, const int& index) const;
+    void   irf_cache(const int& handle, const int& index,
+                     const double& irf) const;
     double irf_cache(const std::string& name, const int& index) const;
     void   irf_cache(const std::string& name, const int& index,
                      const double& irf) const;
+    size_t irf_cache_memory(void) const;
+    void   irf_cache_max_memory(const size_t& bytes);
+    size_t irf_cache_max_memory(void) const { return m_irf_max_memory; }
 
 protected:
     // Protected methods
@@ -86,24 +148,67 @@ protected:
     void         free_members(void);
     virtual void set_energies(void) { return; }
     virtual void set_times(void) { return; }
-    void         read_events(const GFitsTable* hdu);
-    void         read_events_v0(const GFitsTable* hdu);
-    void         read_events_v1(const GFitsTable* hdu);
-    void         read_events_hillas(const GFitsTable* hdu);
+    void         read_events(const GFitsTable* hdu, const GCTARoi& roi,
+                             const GEbounds& ebounds, const GGti& gti,
+                             const bool& columns);
+    void         read_events_v0(const GFitsTable* hdu,
+                                const std::vector<int>& rows);
+    void         read_events_v1(const GFitsTable* hdu,
+                                const std::vector<int>& rows);
+    void         read_events_columns(const GFitsTable* hdu,
+                                     const std::vector<int>& rows);
+    void         read_events_hillas(const GFitsTable* hdu,
+                                    const std::vector<int>& rows);
     void         read_ds_ebounds(const GFitsHDU* hdu);
     void         read_ds_roi(const GFitsHDU* hdu);
     void         write_events(GFitsBinTable* hdu) const;
     void         write_ds_keys(GFitsHDU* hdu) const;
-    int          irf_cache_init(const std::string& name) const;
-    int          irf_cache_index(const std::string& name) const;
+    void         irf_cache_evict(const int& handle, const size_t& bytes) const;
+    void         irf_cache_alloc(const int& handle) const;
+    void         append_arrays(const GCTAEventAtom& event);
+    void         read_column(const GFitsTable* table, const std::string& name,
+                             const std::vector<int>& rows);
+    std::vector<int> select_rows(const GFitsTable* table, const GCTARoi& roi,
+                                 const GEbounds& ebounds,
+                                 const GGti& gti) const;
+    int          column_index(const std::string& name) const;
+
+    static unsigned long new_instance(void);
+
+    // Protected IRF cache handle table entry
+    struct irf_memo {
+        unsigned long list;    //!< Event list instance
+        unsigned long model;   //!< Spatial model instance
+        int           handle;  //!< IRF cache handle
+    };
 
     // Protected members
     GCTARoi                    m_roi;     //!< Region of interest
     std::vector<GCTAEventAtom> m_events;  //!< Events
 
+    // Optional event columns
+    std::vector<std::string>         m_colnames; //!< Column names
+    std::vector<std::vector<float> > m_columns;  //!< Column values
+
+    // Contiguous event arrays
+    bool                m_has_arrays;  //!< Arrays are up to date
+    std::vector<double> m_ra;          //!< Right Ascensions (radians)
+    std::vector<double> m_dec;         //!< Declinations (radians)
+    std::vector<double> m_dirx;        //!< Unit vector x components
+    std::vector<double> m_diry;        //!< Unit vector y components
+    std::vector<double> m_dirz;        //!< Unit vector z components
+    std::vector<double> m_logE;        //!< log10 of energies in TeV
+    std::vector<double> m_secs;        //!< Times in seconds
+
     // IRF cache for diffuse models
-    mutable std::vector<std::string>          m_irf_names;  //!< Model names
-    mutable std::vector<std::vector<double> > m_irf_values; //!< IRF values
+    mutable std::map<std::string,int> m_irf_handles;    //!< Model handles
+    mutable std::vector<std::string>  m_irf_names;      //!< Model names
+    unsigned long                     m_instance;       //!< Instance
+    mutable std::vector<float*>       m_irf_values;     //!< IRF values
+    mutable std::vector<int>          m_irf_sizes;      //!< Number of values
+    mutable std::vector<char>         m_irf_used;       //!< Used flags
+    mutable size_t                    m_irf_memory;     //!< Used bytes
+    size_t                            m_irf_max_memory; //!< Max. bytes
 };
 
 #endif /* GCTAEVENTLIST_HPP */
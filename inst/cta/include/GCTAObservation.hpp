@@ -31,6 +31,9 @@
 #include "GObservation.hpp"
 #include "GCTAPointing.hpp"
 #include "GCTAResponse.hpp"
+#include "GCTARoi.hpp"
+#include "GEbounds.hpp"
+#include "GGti.hpp"
 #include "GTime.hpp"
 #include "GModel.hpp"
 #include "GFitsTable.hpp"
@@ -69,8 +72,16 @@ public:
     virtual void             write(GXmlElement& xml) const;
     virtual std::string      print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual void             prepare(const GModels& models);
+
     // Other methods
     void        load_unbinned(const std::string& filename);
+    void        load_unbinned(const std::string& filename,
+                              const GCTARoi&     roi,
+                              const GEbounds&    ebounds,
+                              const GGti&        gti,
+                              const bool&        columns = false);
     void        load_binned(const std::string& filename);
     void        save(const std::string& filename, bool clobber) const;
     void        response(const std::string& irfname, std::string caldb = "");
@@ -32,7 +32,7 @@
 #include "GPointing.hpp"
 #include "GSkyDir.hpp"
 #include "GTime.hpp"
-#include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 
 
 /***********************************************************************//**
@@ -63,7 +63,7 @@ public:
 
     // Other methods
     void   dir(const GSkyDir& dir);
-    const  GMatrix& rot(void) const;
+    const  GMatrix3& rot(void) const;
     double zenith(void) const { return m_zenith; }
     double azimuth(void) const { return m_azimuth; }
 
@@ -72,16 +72,13 @@ protected:
     void init_members(void);
     void copy_members(const GCTAPointing& pnt);
     void free_members(void);
-    void update(void) const;
+    void update(void);
 
     // Protected members
-    GSkyDir         m_dir;        //!< Pointing direction in sky coordinates
-    double          m_zenith;     //!< Pointing zenith angle
-    double          m_azimuth;    //!< Pointing azimuth angle
-
-    // Cached members
-    mutable bool    m_has_cache;  //!< Has transformation cache
-    mutable GMatrix m_Rback;      //!< Rotation matrix
+    GSkyDir          m_dir;        //!< Pointing direction in sky coordinates
+    double           m_zenith;     //!< Pointing zenith angle
+    double           m_azimuth;    //!< Pointing azimuth angle
+    GMatrix3         m_Rback;      //!< Rotation matrix
 };
 
 #endif /* GCTAPOINTING_HPP */
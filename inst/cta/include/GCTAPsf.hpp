@@ -82,6 +82,12 @@ public:
                                   const bool&   etrue = true) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
+    // Virtual methods
+    virtual int         gaussians(const double& logE,
+                                  const double& theta,
+                                  double*       amplitude,
+                                  double*       width) const;
+
 protected:
     // Methods
     void init_members(void);
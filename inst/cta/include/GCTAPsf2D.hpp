@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GFits.hpp"
 #include "GRan.hpp"
 #include "GCTAPsf.hpp"
@@ -82,29 +83,40 @@ public:
                           const bool&   etrue = true) const;
     std::string print(const GChatter& chatter = NORMAL) const;
 
+    // Overloaded virtual methods
+    int         gaussians(const double& logE,
+                          const double& theta,
+                          double*       amplitude,
+                          double*       width) const;
+
 private:
+    // Parameter cache
+    struct cache {
+        unsigned long id; //!< PSF identifier
+        double logE;      //!< Cache energy
+        double theta;     //!< Cache offset angle
+        double norm;      //!< Global normalization
+        double norm2;     //!< Gaussian 2 normalization
+        double norm3;     //!< Gaussian 3 normalization
+        double sigma1;    //!< Gaussian 1 sigma
+        double sigma2;    //!< Gaussian 2 sigma
+        double sigma3;    //!< Gaussian 3 sigma
+        double width1;    //!< Gaussian 1 width
+        double width2;    //!< Gaussian 2 width
+        double width3;    //!< Gaussian 3 width
+    };
+
     // Methods
-    void init_members(void);
-    void copy_members(const GCTAPsf2D& psf);
-    void free_members(void);
-    void update(const double& logE, const double& theta) const;
+    void         init_members(void);
+    void         copy_members(const GCTAPsf2D& psf);
+    void         free_members(void);
+    const cache& update(const double& logE, const double& theta) const;
+    static unsigned long new_id(void);
 
     // Members
-    std::string       m_filename;   //!< Name of Aeff response file
-    GCTAResponseTable m_psf;        //!< PSF response table
-
-    // Precomputation cache
-    mutable double    m_par_logE;   //!< Cache energy
-    mutable double    m_par_theta;  //!< Cache offset angle
-    mutable double    m_norm;       //!< Global normalization
-    mutable double    m_norm2;      //!< Gaussian 2 normalization
-    mutable double    m_norm3;      //!< Gaussian 3 normalization
-    mutable double    m_sigma1;     //!< Gaussian 1 sigma
-    mutable double    m_sigma2;     //!< Gaussian 2 sigma
-    mutable double    m_sigma3;     //!< Gaussian 3 sigma
-    mutable double    m_width1;     //!< Gaussian 1 width
-    mutable double    m_width2;     //!< Gaussian 2 width
-    mutable double    m_width3;     //!< Gaussian 3 width
+    std::string       m_filename; //!< Name of Aeff response file
+    GCTAResponseTable m_psf;      //!< PSF response table
+    unsigned long     m_id;       //!< PSF identifier for parameter cache
 };
 
 #endif /* GCTAPSF2D_HPP */
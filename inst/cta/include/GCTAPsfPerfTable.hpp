@@ -84,12 +84,17 @@ public:
                                 const bool&   etrue = true) const;
     std::string       print(const GChatter& chatter = NORMAL) const;
 
+    // Overloaded virtual methods
+    int               gaussians(const double& logE,
+                                const double& theta,
+                                double*       amplitude,
+                                double*       width) const;
+
 private:
     // Methods
     void init_members(void);
     void copy_members(const GCTAPsfPerfTable& psf);
     void free_members(void);
-    void update(const double& logE) const;
 
     // Members
     std::string         m_filename;  //!< Name of Aeff response file
@@ -97,12 +102,6 @@ private:
     std::vector<double> m_r68;       //!< 68% containment radius of PSF in degrees
     std::vector<double> m_r80;       //!< 80% containment radius of PSF in degrees
     std::vector<double> m_sigma;     //!< Sigma value of PSF in radians
-
-    // Precomputation cache
-    mutable double      m_par_logE;  //!< Energy for which precomputation is done
-    mutable double      m_par_scale; //!< Gaussian normalization
-    mutable double      m_par_sigma; //!< Gaussian sigma (radians)
-    mutable double      m_par_width; //!< Gaussian width parameter
 };
 
 #endif /* GCTAPSFPERFTABLE_HPP */
@@ -82,6 +82,12 @@ public:
                              const bool&   etrue = true) const;
     std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Overloaded virtual methods
+    int            gaussians(const double& logE,
+                             const double& theta,
+                             double*       amplitude,
+                             double*       width) const;
+
     // Other methods
     void read(const GFitsTable* hdu);
 
@@ -90,19 +96,12 @@ private:
     void init_members(void);
     void copy_members(const GCTAPsfVector& psf);
     void free_members(void);
-    void update(const double& logE) const;
 
     // Members
     std::string         m_filename;  //!< Name of Aeff response file
     GNodeArray          m_logE;      //!< log(E) nodes for Aeff interpolation
     std::vector<double> m_r68;       //!< 68% containment radius of PSF in degrees
     std::vector<double> m_sigma;     //!< Sigma value of PSF in radians
-
-    // Precomputation cache
-    mutable double      m_par_logE;  //!< Energy for which precomputation is done
-    mutable double      m_par_scale; //!< Gaussian normalization
-    mutable double      m_par_sigma; //!< Gaussian sigma (radians)
-    mutable double      m_par_width; //!< Gaussian width parameter
 };
 
 #endif /* GCTAPSFVECTOR_HPP */
@@ -31,6 +31,7 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <map>
 #include "GMatrix.hpp"
 #include "GEvent.hpp"
 #include "GModelSky.hpp"
@@ -46,6 +47,7 @@
 #include "GTime.hpp"
 #include "GPhoton.hpp"
 #include "GNodeArray.hpp"
+#include "GIntegral.hpp"
 #include "GCTAInstDir.hpp"
 #include "GCTAPointing.hpp"
 #include "GCTARoi.hpp"
@@ -55,11 +57,13 @@
 #include "GCTAAeff.hpp"
 #include "GCTAPsf.hpp"
 #include "GCTAEdisp.hpp"
+#include "GCTAResponseGrid.hpp"
 
 /* __ Type definitions ___________________________________________________ */
 
 /* __ Forward declaration ________________________________________________ */
 class GCTAObservation;
+class GCTAEventList;
 
 
 /***********************************************************************//**
@@ -117,6 +121,10 @@ public:
     void            load(const std::string& rspname);
     void            eps(const double& eps) { m_eps=eps; }
     const double&   eps(void) const { return m_eps; }
+    void            integrator(const std::string& integrator);
+    std::string     integrator(void) const;
+    double          integrate(GIntegral& integral, const double& a,
+                              const double& b) const;
     std::string     rmffile(void) const { return m_rmffile; }
     void            load_aeff(const std::string& filename);
     void            load_psf(const std::string& filename);
@@ -124,9 +132,17 @@ public:
     void            offset_sigma(const double& sigma);
     double          offset_sigma(void) const;
     const GCTAAeff* aeff(void) const { return m_aeff; }
-    void            aeff(GCTAAeff* aeff) { m_aeff=aeff; }
+    void            aeff(GCTAAeff* aeff);
     const GCTAPsf*  psf(void) const { return m_psf; }
-    void            psf(GCTAPsf* psf) { m_psf=psf; }
+    void            psf(GCTAPsf* psf);
+    void            compiled(const bool& compiled);
+    const bool&     compiled(void) const { return m_compiled; }
+    const GCTAResponseGrid& grid(void) const { return m_grid; }
+    int             npred_cache_size(void) const;
+    const int&      npred_cache_max_size(void) const { return m_npred_max_size; }
+    void            npred_cache_max_size(const int& size);
+    unsigned long   npred_cache_hits(void) const;
+    unsigned long   npred_cache_misses(void) const;
 
     // Low-level response methods
     double aeff(const double& theta,
@@ -163,25 +179,86 @@ public:
                   const GEbounds&     ebds) const;
 
 private:
+    // Npred cache key
+    struct npred_key {
+        int       source;  //!< Source and observation handle (-1: empty)
+        long long energy;  //!< Quantised logarithm of energy
+        long long time;    //!< Quantised time
+        bool operator==(const npred_key& key) const {
+            return (source == key.source && energy == key.energy &&
+                    time   == key.time);
+        }
+    };
+
+    // Npred cache entry
+    struct npred_entry {
+        npred_key key;     //!< Key
+        double    value;   //!< Npred value
+    };
+
+    // Npred cache stripe. Each stripe is a set-associative hash table that
+    // is protected by its own lock.
+    struct npred_stripe {
+        std::vector<npred_entry> entries; //!< Entries (allocated on use)
+        std::vector<int>         next;    //!< Next replaced way per set
+        int                      size;    //!< Maximum number of entries
+        unsigned long            hits;    //!< Cache hits
+        unsigned long            misses;  //!< Cache misses
+    };
+
+    // Npred cache source identifier
+    typedef std::pair<std::string,std::string> npred_id;
+
+    // Npred cache handle table entry
+    struct npred_memo {
+        unsigned long        instance; //!< Cache instance
+        const GModelSpatial* model;    //!< Spatial model
+        const GObservation*  obs;      //!< Observation
+        const npred_id*      id;       //!< Source identifier
+        int                  handle;   //!< Npred cache handle
+    };
+
     // Private methods
     void init_members(void);
     void copy_members(const GCTAResponse& rsp);
     void free_members(void);
+    int  npred_cache_handle(const GSource& source,
+                            const GObservation& obs) const;
+    static unsigned long npred_cache_instance(void);
+    npred_key npred_cache_key(const GSource& source,
+                              const GObservation& obs) const;
+    int  npred_cache_stripe(const npred_key& key, int* set) const;
+    bool npred_cache_get(const npred_key& key, double* value) const;
+    void npred_cache_set(const npred_key& key, const double& value) const;
+    void npred_cache_alloc(void);
+    void npred_cache_lock(const int& stripe) const;
+    void npred_cache_unlock(const int& stripe) const;
+    void compile(void);
+    const GCTAEventList* event_arrays(const GEvent& event,
+                                      const GObservation& obs,
+                                      int* index) const;
+    static double event_dist(const GCTAEventList& list, const int& index,
+                             const GVector3& dir);
 
     // Private data members
     std::string         m_caldb;    //!< Name of or path to the calibration database
     std::string         m_rspname;  //!< Name of the instrument response
     std::string         m_rmffile;  //!< Name of RMF file
     double              m_eps;      //!< Integration precision
+    int                 m_integrator; //!< Integration method
     GCTAAeff*           m_aeff;     //!< Effective area
     GCTAPsf*            m_psf;      //!< Point spread function
     GCTAEdisp*          m_edisp;    //!< Energy dispersion
+    bool                m_compiled; //!< Use compiled response grid
+    GCTAResponseGrid    m_grid;     //!< Compiled response grid
 
     // Npred cache
-    mutable std::vector<std::string> m_npred_names;    //!< Model names
-    mutable std::vector<GEnergy>     m_npred_energies; //!< Model energy
-    mutable std::vector<GTime>       m_npred_times;    //!< Model time
-    mutable std::vector<double>      m_npred_values;   //!< Model values
+    unsigned long                        m_npred_instance; //!< Cache instance
+    mutable std::map<npred_id,int>       m_npred_handles;  //!< Source handles
+    mutable std::vector<npred_id>        m_npred_ids;      //!< Source ids
+    mutable std::vector<npred_stripe>    m_npred_stripes;  //!< Npred values
+    void*                                m_npred_locks;    //!< Stripe locks
+    int                                  m_npred_max_size; //!< Max. values
 };
 
 #endif /* GCTARESPONSE_HPP */
@@ -0,0 +1,108 @@
+/***************************************************************************
+ *          GCTAResponseGrid.hpp - CTA compiled response grid class         *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GCTAResponseGrid.hpp
+ * @brief CTA compiled response grid class definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GCTARESPONSEGRID_HPP
+#define GCTARESPONSEGRID_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <string>
+#include <vector>
+#include "GBase.hpp"
+#include "GCTAAeff.hpp"
+#include "GCTAPsf.hpp"
+
+
+/***********************************************************************//**
+ * @class GCTAResponseGrid
+ *
+ * @brief CTA compiled response grid class
+ *
+ * This class holds the effective area and the Gaussian components of the
+ * point spread function tabulated on a regular grid in log10 of the true
+ * photon energy and offset angle. For each grid node, the effective area,
+ * the maximum PSF radius and the amplitudes and widths of up to three
+ * Gaussian PSF components are stored contiguously, so that the response
+ * can be evaluated by bilinear interpolation without any memory
+ * allocation.
+ *
+ * The grid is an approximation of the underlying response. Evaluation is
+ * only meaningful for arguments for which contains() returns true;
+ * arguments outside the grid are clamped to the grid boundaries.
+ ***************************************************************************/
+class GCTAResponseGrid : public GBase {
+
+public:
+    // Constructors and destructors
+    GCTAResponseGrid(void);
+    GCTAResponseGrid(const GCTAResponseGrid& grid);
+    GCTAResponseGrid(const GCTAAeff* aeff, const GCTAPsf* psf,
+                     const double& logE_min, const double& logE_max,
+                     const int& nlogE,
+                     const double& theta_max, const int& ntheta);
+    virtual ~GCTAResponseGrid(void);
+
+    // Operators
+    GCTAResponseGrid& operator=(const GCTAResponseGrid& grid);
+
+    // Methods
+    void              clear(void);
+    GCTAResponseGrid* clone(void) const;
+    int               size(void) const;
+    void              set(const GCTAAeff* aeff, const GCTAPsf* psf,
+                          const double& logE_min, const double& logE_max,
+                          const int& nlogE,
+                          const double& theta_max, const int& ntheta);
+    bool              contains(const double& logE, const double& theta) const;
+    double            aeff(const double& logE, const double& theta) const;
+    double            psf(const double& delta, const double& logE,
+                          const double& theta) const;
+    double            delta_max(const double& logE, const double& theta) const;
+    double            irf(const double& delta, const double& logE,
+                          const double& theta) const;
+    std::string       print(const GChatter& chatter = NORMAL) const;
+
+private:
+    // Methods
+    void init_members(void);
+    void copy_members(const GCTAResponseGrid& grid);
+    void free_members(void);
+    void weights(const double& logE, const double& theta,
+                 int* inx, double* wgt) const;
+    void interpolate(const int* inx, const double* wgt,
+                     double* values) const;
+
+    // Members
+    int                 m_nlogE;     //!< Number of energy nodes
+    int                 m_ntheta;    //!< Number of offset angle nodes
+    double              m_logE_min;  //!< First energy node (log10 TeV)
+    double              m_logE_max;  //!< Last energy node (log10 TeV)
+    double              m_logE_bin;  //!< Energy node spacing (log10 TeV)
+    double              m_theta_max; //!< Last offset angle node (rad)
+    double              m_theta_bin; //!< Offset angle node spacing (rad)
+    std::vector<double> m_nodes;     //!< Response values for all nodes
+};
+
+#endif /* GCTARESPONSEGRID_HPP */
@@ -85,8 +85,9 @@ private:
     void read_colnames(const GFitsTable* hdu);
     void read_axes(const GFitsTable* hdu);
     void read_pars(const GFitsTable* hdu);
-    void update(const double& arg) const;
-    void update(const double& arg1, const double& arg2) const;
+    void weights(const double& arg, int* inx, double* wgt) const;
+    void weights(const double& arg1, const double& arg2,
+                 int* inx, double* wgt) const;
 
     // Table information
     int                               m_naxes;       //!< Number of axes
@@ -99,22 +100,6 @@ private:
     std::vector<std::vector<double> > m_axis_hi;     //!< Axes upper boundaries
     std::vector<GNodeArray>           m_axis_nodes;  //!< Axes node arrays
     std::vector<std::vector<double> > m_pars;        //!< Parameters
-
-    // Response table computation cache for 1D access
-    mutable int    m_inx_left;                       //!< Index of left node
-    mutable int    m_inx_right;                      //!< Index of right node
-    mutable double m_wgt_left;                       //!< Weight of left node
-    mutable double m_wgt_right;                      //!< Weight of right node
-
-    // Response table computation cache for 2D access
-    mutable int    m_inx1;                           //!< Index of upper left node
-    mutable int    m_inx2;                           //!< Index of lower left node
-    mutable int    m_inx3;                           //!< Index of upper right node
-    mutable int    m_inx4;                           //!< Index of lower right node
-    mutable double m_wgt1;                           //!< Weight of upper left node
-    mutable double m_wgt2;                           //!< Weight of lower left node
-    mutable double m_wgt3;                           //!< Weight of upper right node
-    mutable double m_wgt4;                           //!< Weight of lower right node
 };
 
 #endif /* GCTARESPONSETABLE_HPP */
@@ -55,8 +55,17 @@ public:
     virtual const GCTARoi& roi(void) const { return m_roi; }
 
     // Implement other methods
+    void                   load(const std::string& filename, const GCTARoi& roi,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const bool& columns = false);
+    void                   read(const GFits& file, const GCTARoi& roi,
+                                const GEbounds& ebounds, const GGti& gti,
+                                const bool& columns = false);
     void                   append(const GCTAEventAtom& event);
     void                   reserve(const int& number);
+    bool                   hascolumn(const std::string& name) const;
+    bool                   hasarrays(void) const;
+    void                   update_arrays(void);
 };
 
 
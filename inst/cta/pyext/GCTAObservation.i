@@ -54,8 +54,16 @@ public:
     virtual void             read(const GXmlElement& xml);
     virtual void             write(GXmlElement& xml) const;
 
+    // Implemented virtual base class methods
+    virtual void             prepare(const GModels& models);
+
     // Other methods
     void        load_unbinned(const std::string& filename);
+    void        load_unbinned(const std::string& filename,
+                              const GCTARoi&     roi,
+                              const GEbounds&    ebounds,
+                              const GGti&        gti,
+                              const bool&        columns = false);
     void        load_binned(const std::string& filename);
     void        save(const std::string& filename, bool clobber) const;
     void        response(const std::string& irfname, std::string caldb = "");
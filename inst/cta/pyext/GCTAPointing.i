@@ -48,7 +48,7 @@ public:
 
     // Other methods
     void   dir(const GSkyDir& dir);
-    const  GMatrix& rot(void) const;
+    const  GMatrix3& rot(void) const;
     double zenith(void) const;
     double azimuth(void) const;
 };
@@ -74,6 +74,8 @@ public:
     void            load(const std::string& rspname);
     void            eps(const double& eps);
     const double&   eps(void) const;
+    void            integrator(const std::string& integrator);
+    std::string     integrator(void) const;
     std::string     rmffile(void) const;
     void            load_aeff(const std::string& filename);
     void            load_psf(const std::string& filename);
@@ -84,6 +86,14 @@ public:
     void            aeff(GCTAAeff* aeff);
     const GCTAPsf*  psf(void) const;
     void            psf(GCTAPsf* psf);
+    void            compiled(const bool& compiled);
+    const bool&     compiled(void) const;
+    const GCTAResponseGrid& grid(void) const;
+    int             npred_cache_size(void) const;
+    const int&      npred_cache_max_size(void) const;
+    void            npred_cache_max_size(const int& size);
+    unsigned long   npred_cache_hits(void) const;
+    unsigned long   npred_cache_misses(void) const;
 
     // Low-level response methods
     double aeff(const double& theta,
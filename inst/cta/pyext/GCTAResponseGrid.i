@@ -0,0 +1,75 @@
+/***************************************************************************
+ *           GCTAResponseGrid.i - CTA compiled response grid class          *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GCTAResponseGrid.i
+ * @brief CTA compiled response grid class definition
+ * @author Juergen Knoedlseder
+ */
+%{
+/* Put headers and other declarations here that are needed for compilation */
+#include "GTools.hpp"
+#include "GCTAResponseGrid.hpp"
+%}
+
+
+/***********************************************************************//**
+ * @class GCTAResponseGrid
+ *
+ * @brief CTA compiled response grid class
+ ***************************************************************************/
+class GCTAResponseGrid : public GBase {
+
+public:
+    // Constructors and destructors
+    GCTAResponseGrid(void);
+    GCTAResponseGrid(const GCTAResponseGrid& grid);
+    GCTAResponseGrid(const GCTAAeff* aeff, const GCTAPsf* psf,
+                     const double& logE_min, const double& logE_max,
+                     const int& nlogE,
+                     const double& theta_max, const int& ntheta);
+    virtual ~GCTAResponseGrid(void);
+
+    // Methods
+    void              clear(void);
+    GCTAResponseGrid* clone(void) const;
+    int               size(void) const;
+    void              set(const GCTAAeff* aeff, const GCTAPsf* psf,
+                          const double& logE_min, const double& logE_max,
+                          const int& nlogE,
+                          const double& theta_max, const int& ntheta);
+    bool              contains(const double& logE, const double& theta) const;
+    double            aeff(const double& logE, const double& theta) const;
+    double            psf(const double& delta, const double& logE,
+                          const double& theta) const;
+    double            delta_max(const double& logE, const double& theta) const;
+    double            irf(const double& delta, const double& logE,
+                          const double& theta) const;
+};
+
+
+/***********************************************************************//**
+ * @brief GCTAResponseGrid class extension
+ ***************************************************************************/
+%extend GCTAResponseGrid {
+    GCTAResponseGrid copy() {
+        return (*self);
+    }
+};
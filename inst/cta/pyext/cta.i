@@ -70,6 +70,7 @@
 %include "GCTAPointing.i"
 %include "GCTAResponse.i"
 %include "GCTAResponseTable.i"
+%include "GCTAResponseGrid.i"
 %include "GCTAAeff.i"
 %include "GCTAAeffPerfTable.i"
 %include "GCTAAeffArf.i"
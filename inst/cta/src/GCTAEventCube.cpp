@@ -38,7 +38,8 @@
 #define G_SET_DIRECTIONS                    "GCTAEventCube::set_directions()"
 #define G_SET_ENERGIES                        "GCTAEventCube::set_energies()"
 #define G_SET_TIME                                "GCTAEventCube::set_time()"
-#define G_SET_BIN                              "GCTAEventCube::set_bin(int&)"
+#define G_BIN                        "GCTAEventCube::bin(int&, GEventBin*)"
+#define G_SET_BIN                "GCTAEventCube::set_bin(int&, GCTAEventBin&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -208,6 +209,56 @@ const GCTAEventBin* GCTAEventCube::operator[](const int& index) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Allocate event bin buffer
+ *
+ * @return Pointer to new CTA event bin.
+ *
+ * Allocates an event bin that can be passed as buffer to the bin() method.
+ * The event cube is not accessed, hence the method can be called
+ * concurrently by several threads. The caller is responsible for deleting
+ * the event bin.
+ ***************************************************************************/
+GCTAEventBin* GCTAEventCube::new_bin(void) const
+{
+    // Return new event bin
+    return (new GCTAEventBin);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin without modifying the event cube
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] buffer Event bin buffer (a clone of a CTA event bin).
+ * @return Pointer to event bin.
+ *
+ * @exception GException::invalid_argument
+ *            Event bin buffer is not a CTA event bin.
+ *
+ * Sets the pointers of the event bin @p buffer so that they point to the
+ * information of the bin with the specified @p index, and returns a
+ * pointer to the @p buffer. As the event cube is not modified, the method
+ * can be called concurrently by several threads, each holding its own
+ * bin buffer.
+ ***************************************************************************/
+const GCTAEventBin* GCTAEventCube::bin(const int& index, GEventBin* buffer) const
+{
+    // Get CTA event bin buffer
+    GCTAEventBin* bin = dynamic_cast<GCTAEventBin*>(buffer);
+    if (bin == NULL) {
+        throw GException::invalid_argument(G_BIN,
+              "Event bin buffer is not a CTA event bin.");
+    }
+
+    // Set event bin
+    set_bin(index, *bin);
+
+    // Return pointer
+    return bin;
+}
+
+
 /***********************************************************************//**
  * @brief Clear instance
  *
@@ -666,12 +717,17 @@ void GCTAEventCube::set_directions(void)
     m_dirs.reserve(npix());
     m_omega.reserve(npix());
 
-    // Set pixel directions and solid angles
+    // Set pixel directions and solid angles. The sky directions of each
+    // row of pixels are computed using a bulk transformation.
+    std::vector<GSkyPixel> pixels(nx());
     for (int iy = 0; iy < ny(); ++iy) {
         for (int ix = 0; ix < nx(); ++ix) {
-            GSkyPixel pixel = GSkyPixel(double(ix), double(iy));
-            m_dirs.push_back(GCTAInstDir(m_map.xy2dir(pixel)));
-            m_omega.push_back(m_map.omega(pixel));
+            pixels[ix] = GSkyPixel(double(ix), double(iy));
+        }
+        std::vector<GSkyDir> dirs = m_map.xy2dir(pixels);
+        for (int ix = 0; ix < nx(); ++ix) {
+            m_dirs.push_back(GCTAInstDir(dirs[ix]));
+            m_omega.push_back(m_map.omega(pixels[ix]));
         }
     }
 
@@ -767,6 +823,32 @@ void GCTAEventCube::set_times(void)
  * as if they were stored in an array.
  ***************************************************************************/
 void GCTAEventCube::set_bin(const int& index)
+{
+    // Set actual event bin
+    set_bin(index, m_bin);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set event bin
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] bin Event bin.
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GCTAException::no_energies
+ *            Energy vectors have not been set up.
+ * @exception GCTAException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Sets up the pointers in the event @p bin so that they point to the
+ * information of the bin with the specified @p index.
+ ***************************************************************************/
+void GCTAEventCube::set_bin(const int& index, GCTAEventBin& bin) const
 {
     // Optionally check if the index is valid
     #if defined(G_RANGE_CHECK)
@@ -787,13 +869,13 @@ void GCTAEventCube::set_bin(const int& index)
     int ieng = index / npix();
 
     // Set pointers
-    m_bin.m_counts = &(m_map.pixels()[index]);
-    m_bin.m_energy = &(m_energies[ieng]);
-    m_bin.m_time   = &m_time;
-    m_bin.m_dir    = &(m_dirs[ipix]);
-    m_bin.m_omega  = &(m_omega[ipix]);
-    m_bin.m_ewidth = &(m_ewidth[ieng]);
-    m_bin.m_ontime = &m_ontime;
+    bin.m_counts = &(m_map.pixels()[index]);
+    bin.m_energy = const_cast<GEnergy*>(&(m_energies[ieng]));
+    bin.m_time   = const_cast<GTime*>(&m_time);
+    bin.m_dir    = const_cast<GCTAInstDir*>(&(m_dirs[ipix]));
+    bin.m_omega  = const_cast<double*>(&(m_omega[ipix]));
+    bin.m_ewidth = const_cast<GEnergy*>(&(m_ewidth[ieng]));
+    bin.m_ontime = const_cast<double*>(&m_ontime);
 
     // Return
     return;
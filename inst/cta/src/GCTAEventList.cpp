@@ -28,9 +28,14 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "GCTAEventList.hpp"
 #include "GCTAException.hpp"
 #include "GTools.hpp"
+#include "GMath.hpp"
 #include "GFits.hpp"
 #include "GFitsTableBitCol.hpp"
 #include "GFitsTableFloatCol.hpp"
@@ -40,16 +45,25 @@
 #include "GFitsTableStringCol.hpp"
 #include "GTime.hpp"
 #include "GTimeReference.hpp"
+#include "GSource.hpp"
+#include "GModelSpatial.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 #define G_OPERATOR                          "GCTAEventList::operator[](int&)"
 #define G_ROI                                     "GCTAEventList::roi(GRoi&)"
 #define G_READ_DS_EBOUNDS         "GCTAEventList::read_ds_ebounds(GFitsHDU*)"
 #define G_READ_DS_ROI                 "GCTAEventList::read_ds_roi(GFitsHDU*)"
+#define G_IRF_CACHE_GET                  "GCTAEventList::irf_cache(int&, int&)"
+#define G_IRF_CACHE_SET         "GCTAEventList::irf_cache(int&, int&, double&)"
+#define G_COLUMN_GET                "GCTAEventList::column(std::string&)"
+#define G_COLUMN_SET "GCTAEventList::column(std::string&, std::vector<float>&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_IRF_CACHE_MAX_MEMORY 1073741824 //!< Default IRF cache limit (bytes)
+#define G_IRF_CACHE_MAX_HANDLES 256       //!< Maximum number of cached models
+#define G_IRF_CACHE_MEMO 16               //!< Thread-private handle table size
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -148,7 +162,8 @@ GCTAEventList& GCTAEventList::operator=(const GCTAEventList& list)
  * @exception GException::out_of_range
  *            Event index outside valid range.
  *
- * Returns pointer to an event atom.
+ * Returns pointer to an event atom. As the event may be modified through
+ * the pointer, the contiguous event arrays are flagged as outdated.
  ***************************************************************************/
 GCTAEventAtom* GCTAEventList::operator[](const int& index)
 {
@@ -159,6 +174,9 @@ GCTAEventAtom* GCTAEventList::operator[](const int& index)
     }
     #endif
 
+    // Flag contiguous event arrays as outdated
+    m_has_arrays = false;
+
     // Return pointer
     return (&(m_events[index]));
 }
@@ -259,6 +277,43 @@ void GCTAEventList::load(const std::string& filename)
 }
 
 
+/***********************************************************************//**
+ * @brief Load selected events from event FITS file.
+ *
+ * @param[in] filename Name of FITS file from which events are loaded.
+ * @param[in] roi Region of interest.
+ * @param[in] ebounds Energy boundaries.
+ * @param[in] gti Good Time Intervals.
+ * @param[in] columns Read optional event columns? (default: false)
+ *
+ * Load CTA events that fall within the region of interest, the energy
+ * boundaries and the Good Time Intervals from the EVENTS extension. See
+ * read(const GFits&, const GCTARoi&, const GEbounds&, const GGti&,
+ * const bool&) for details.
+ ***************************************************************************/
+void GCTAEventList::load(const std::string& filename,
+                         const GCTARoi&     roi,
+                         const GEbounds&    ebounds,
+                         const GGti&        gti,
+                         const bool&        columns)
+{
+    // Clear object
+    clear();
+
+    // Open FITS file
+    GFits file(filename);
+
+    // Read event list
+    read(file, roi, ebounds, gti, columns);
+
+    // Close FITS file
+    file.close();
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Save CTA events into FITS file.
  *
@@ -297,6 +352,8 @@ void GCTAEventList::save(const std::string& filename, bool clobber) const
  * "GTI". If no "GTI" extension is present, a single Good Time Interval will
  * be assumed based on the TSTART and TSTOP keywords.
  *
+ * All events and all optional event columns are read.
+ *
  * The method clears the object before reading, thus any information residing
  * in the event list prior to reading will be lost.
  *
@@ -304,6 +361,46 @@ void GCTAEventList::save(const std::string& filename, bool clobber) const
  *       extraction of GTIs from TSTART and TSTOP should not be necessary.
  ***************************************************************************/
 void GCTAEventList::read(const GFits& file)
+{
+    // Read all events and columns
+    read(file, GCTARoi(), GEbounds(), GGti(), true);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read selected CTA events from FITS file.
+ *
+ * @param[in] file FITS file.
+ * @param[in] roi Region of interest.
+ * @param[in] ebounds Energy boundaries.
+ * @param[in] gti Good Time Intervals.
+ * @param[in] columns Read optional event columns? (default: false)
+ *
+ * This method reads the CTA events that fall within the region of
+ * interest, the energy boundaries and the Good Time Intervals from a FITS
+ * file. The selection is applied while reading the FITS table, hence
+ * events that are not selected are never stored in memory. An empty
+ * selection (zero RoI radius, empty energy boundaries or empty Good Time
+ * Intervals) does not restrict the events.
+ *
+ * Unless @p columns is true, only the columns that are needed for the
+ * analysis (EVENT_ID, OBS_ID, TIME, RA, DEC and ENERGY) are read from the
+ * FITS table, and the optional event columns are not allocated.
+ *
+ * A non-empty selection replaces the corresponding region of interest,
+ * energy boundaries or Good Time Intervals of the event list.
+ *
+ * The method clears the object before reading, thus any information residing
+ * in the event list prior to reading will be lost.
+ ***************************************************************************/
+void GCTAEventList::read(const GFits&    file,
+                         const GCTARoi&  roi,
+                         const GEbounds& ebounds,
+                         const GGti&     gti,
+                         const bool&     columns)
 {
     // Clear object
     clear();
@@ -314,8 +411,8 @@ void GCTAEventList::read(const GFits& file)
     // If we have a GTI extension, then read Good Time Intervals from that
     // extension
     if (file.hashdu("GTI")) {
-        GFitsTable* gti = file.table("GTI");
-        m_gti.read(gti);
+        GFitsTable* hdu = file.table("GTI");
+        m_gti.read(hdu);
     }
 
     // ... otherwise build GTI from TSTART and TSTOP
@@ -341,7 +438,7 @@ void GCTAEventList::read(const GFits& file)
     } // endelse: GTI built from TSTART and TSTOP
 
     // Load event data
-    read_events(events);
+    read_events(events, roi, ebounds, gti, columns);
 
     // Read region of interest from data selection keyword
     read_ds_roi(events);
@@ -349,6 +446,17 @@ void GCTAEventList::read(const GFits& file)
     // Read energy boundaries from data selection keyword
     read_ds_ebounds(events);
 
+    // Set selection
+    if (roi.radius() > 0.0) {
+        m_roi = roi;
+    }
+    if (ebounds.size() > 0) {
+        m_ebounds = ebounds;
+    }
+    if (gti.size() > 0) {
+        m_gti = gti;
+    }
+
     // Return
     return;
 }
@@ -467,12 +575,18 @@ std::string GCTAEventList::print(const GChatter& chatter) const
 
         // EXPLICIT: Append IRF cache
         if (chatter >= EXPLICIT) {
-            for (int i = 0; i < m_irf_names.size(); ++i) {
+            result.append("\n"+gammalib::parformat("IRF cache memory"));
+            result.append(gammalib::str(double(irf_cache_memory())/1048576.0));
+            result.append(" MB (maximum ");
+            result.append(gammalib::str(double(m_irf_max_memory)/1048576.0));
+            result.append(" MB)");
+            int nhandles = m_irf_handles.size();
+            for (int i = 0; i < nhandles; ++i) {
                 result.append("\n"+gammalib::parformat("IRF cache " +
                               gammalib::str(i)));
                 result.append(m_irf_names[i]+" = ");
                 int num   = 0;
-                for (int k = 0; k < size(); ++k) {
+                for (int k = 0; k < m_irf_sizes[i]; ++k) {
                     if ((m_irf_values[i])[k] != -1.0) {
                         num++;
                     }
@@ -493,7 +607,9 @@ std::string GCTAEventList::print(const GChatter& chatter) const
  *
  * @param[in] event Event.
  *
- * Appends an event atom to the event list.
+ * Appends an event atom to the event list. Optional columns that exist
+ * in the event list are extended by a zero value. The event is also
+ * appended to the contiguous event arrays if they are up to date.
  ***************************************************************************/
 void GCTAEventList::append(const GCTAEventAtom& event)
 {
@@ -504,6 +620,17 @@ void GCTAEventList::append(const GCTAEventAtom& event)
     int index = m_events.size()-1;
     m_events[index].m_index = index;
 
+    // Extend optional columns
+    int ncolumns = m_columns.size();
+    for (int i = 0; i < ncolumns; ++i) {
+        m_columns[i].push_back(0.0);
+    }
+
+    // Extend contiguous event arrays
+    if (m_has_arrays) {
+        append_arrays(m_events[index]);
+    }
+
     // Return
     return;
 }
@@ -520,6 +647,127 @@ void GCTAEventList::reserve(const int& number)
 {
     // Reserve space
     m_events.reserve(number);
+    int ncolumns = m_columns.size();
+    for (int i = 0; i < ncolumns; ++i) {
+        m_columns[i].reserve(number);
+    }
+    m_ra.reserve(number);
+    m_dec.reserve(number);
+    m_dirx.reserve(number);
+    m_diry.reserve(number);
+    m_dirz.reserve(number);
+    m_logE.reserve(number);
+    m_secs.reserve(number);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Signals if optional event column exists
+ *
+ * @param[in] name Column name.
+ * @return True if the optional event column exists.
+ ***************************************************************************/
+bool GCTAEventList::hascolumn(const std::string& name) const
+{
+    // Return
+    return (column_index(name) != -1);
+}
+
+
+/***********************************************************************//**
+ * @brief Return optional event column
+ *
+ * @param[in] name Column name.
+ * @return Column values.
+ *
+ * @exception GException::fits_column_not_found
+ *            Optional column does not exist.
+ *
+ * Returns the values of an optional event column (e.g. "DETX", "HIL_MSW").
+ * The values are ordered by event index.
+ ***************************************************************************/
+const std::vector<float>& GCTAEventList::column(const std::string& name) const
+{
+    // Get column index
+    int icol = column_index(name);
+    if (icol == -1) {
+        throw GException::fits_column_not_found(G_COLUMN_GET, name);
+    }
+
+    // Return column
+    return (m_columns[icol]);
+}
+
+
+/***********************************************************************//**
+ * @brief Set optional event column
+ *
+ * @param[in] name Column name.
+ * @param[in] values Column values.
+ *
+ * @exception GException::invalid_argument
+ *            Number of values differs from number of events.
+ *
+ * Sets the values of an optional event column. If the column does not yet
+ * exist it will be added to the event list.
+ ***************************************************************************/
+void GCTAEventList::column(const std::string& name,
+                           const std::vector<float>& values)
+{
+    // Check number of values
+    if (int(values.size()) != size()) {
+        std::string msg = "Number of column values ("+
+                          gammalib::str((int)values.size())+") differs "
+                          "from number of events ("+gammalib::str(size())+
+                          ").";
+        throw GException::invalid_argument(G_COLUMN_SET, msg);
+    }
+
+    // Set or append column
+    int icol = column_index(name);
+    if (icol == -1) {
+        m_colnames.push_back(name);
+        m_columns.push_back(values);
+    }
+    else {
+        m_columns[icol] = values;
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Update contiguous event arrays
+ *
+ * Rebuilds the contiguous arrays of Right Ascension, Declination,
+ * celestial unit vector, log10 energy and time from the event atoms and
+ * flags the arrays as up to date.
+ ***************************************************************************/
+void GCTAEventList::update_arrays(void)
+{
+    // Clear arrays
+    m_ra.clear();
+    m_dec.clear();
+    m_dirx.clear();
+    m_diry.clear();
+    m_dirz.clear();
+    m_logE.clear();
+    m_secs.clear();
+
+    // Fill arrays
+    int num = m_events.size();
+    reserve(num);
+    for (int i = 0; i < num; ++i) {
+        append_arrays(m_events[i]);
+    }
+
+    // Flag arrays as up to date
+    m_has_arrays = true;
 
     // Return
     return;
@@ -540,10 +788,28 @@ void GCTAEventList::init_members(void)
     // Initialise members
     m_roi.clear();
     m_events.clear();
+    m_colnames.clear();
+    m_columns.clear();
+
+    // Initialise contiguous event arrays
+    m_has_arrays = true;
+    m_ra.clear();
+    m_dec.clear();
+    m_dirx.clear();
+    m_diry.clear();
+    m_dirz.clear();
+    m_logE.clear();
+    m_secs.clear();
 
     // Initialise cache
-    m_irf_names.clear();
-    m_irf_values.clear();
+    m_instance = new_instance();
+    m_irf_handles.clear();
+    m_irf_names.assign(G_IRF_CACHE_MAX_HANDLES, "");
+    m_irf_values.assign(G_IRF_CACHE_MAX_HANDLES, (float*)NULL);
+    m_irf_sizes.assign(G_IRF_CACHE_MAX_HANDLES, 0);
+    m_irf_used.assign(G_IRF_CACHE_MAX_HANDLES, 0);
+    m_irf_memory     = 0;
+    m_irf_max_memory = G_IRF_CACHE_MAX_MEMORY;
 
     // Return
     return;
@@ -558,12 +824,36 @@ void GCTAEventList::init_members(void)
 void GCTAEventList::copy_members(const GCTAEventList& list)
 {
     // Copy members
-    m_roi    = list.m_roi;
-    m_events = list.m_events;
+    m_roi      = list.m_roi;
+    m_events   = list.m_events;
+    m_colnames = list.m_colnames;
+    m_columns  = list.m_columns;
+
+    // Copy contiguous event arrays
+    m_has_arrays = list.m_has_arrays;
+    m_ra         = list.m_ra;
+    m_dec        = list.m_dec;
+    m_dirx       = list.m_dirx;
+    m_diry       = list.m_diry;
+    m_dirz       = list.m_dirz;
+    m_logE       = list.m_logE;
+    m_secs       = list.m_secs;
 
     // Copy cache
-    m_irf_names  = list.m_irf_names;
-    m_irf_values = list.m_irf_values;
+    m_irf_handles    = list.m_irf_handles;
+    m_irf_names      = list.m_irf_names;
+    m_irf_sizes      = list.m_irf_sizes;
+    m_irf_used       = list.m_irf_used;
+    m_irf_memory     = list.m_irf_memory;
+    m_irf_max_memory = list.m_irf_max_memory;
+    for (int i = 0; i < G_IRF_CACHE_MAX_HANDLES; ++i) {
+        if (list.m_irf_values[i] != NULL) {
+            m_irf_values[i] = new float[m_irf_sizes[i]];
+            for (int k = 0; k < m_irf_sizes[i]; ++k) {
+                m_irf_values[i][k] = list.m_irf_values[i][k];
+            }
+        }
+    }
 
     // Return
     return;
@@ -575,24 +865,75 @@ void GCTAEventList::copy_members(const GCTAEventList& list)
  ***************************************************************************/
 void GCTAEventList::free_members(void)
 {
+    // Free IRF cache values
+    for (int i = 0; i < G_IRF_CACHE_MAX_HANDLES; ++i) {
+        delete [] m_irf_values[i];
+        m_irf_values[i] = NULL;
+    }
+
     // Return
     return;
 }
 
 
+/***********************************************************************//**
+ * @brief Return new event list instance identifier
+ *
+ * @return New instance identifier.
+ *
+ * Returns a new unique instance identifier. The identifier is assigned to
+ * the event list on construction, copy, assignment and clearing, so that
+ * the IRF cache handles memorised by irf_cache_handle(const GSource&) can
+ * be verified to apply to the event list.
+ ***************************************************************************/
+unsigned long GCTAEventList::new_instance(void)
+{
+    // Identifier counter
+    static unsigned long last_instance = 0;
+
+    // Get new identifier
+    unsigned long instance;
+    #pragma omp critical(GCTAEventList_new_instance)
+    {
+        instance = ++last_instance;
+    }
+
+    // Return identifier
+    return instance;
+}
+
+
 /***********************************************************************//**
  * @brief Read CTA events from FITS table
  *
  * @param[in] table FITS table pointer.
+ * @param[in] roi Region of interest for event selection.
+ * @param[in] ebounds Energy boundaries for event selection.
+ * @param[in] gti Good Time Intervals for event selection.
+ * @param[in] columns Read optional event columns?
  *
  * This method reads the CTA event list from a FITS table HDU into memory.
  * Depending on the columns existing in the file, it either selects v0 or
  * v1 of the event list reader.
+ *
+ * Only events that fall within the region of interest, the energy
+ * boundaries and the Good Time Intervals are read. An empty selection
+ * (zero RoI radius, empty energy boundaries or empty Good Time Intervals)
+ * does not restrict the events. The optional event columns are only read
+ * if @p columns is true, otherwise only the columns that are needed for
+ * the analysis are accessed.
  ***************************************************************************/
-void GCTAEventList::read_events(const GFitsTable* table)
+void GCTAEventList::read_events(const GFitsTable* table,
+                                const GCTARoi&    roi,
+                                const GEbounds&   ebounds,
+                                const GGti&       gti,
+                                const bool&       columns)
 {
-    // Clear existing events
+    // Clear existing events and columns
     m_events.clear();
+    m_colnames.clear();
+    m_columns.clear();
+    m_has_arrays = false;
 
     // Continue only if HDU is valid
     if (table != NULL) {
@@ -603,23 +944,32 @@ void GCTAEventList::read_events(const GFitsTable* table)
         // Continue only if there are events
         if (num > 0) {
 
+            // Select rows
+            std::vector<int> rows = select_rows(table, roi, ebounds, gti);
+
             // Read events for v1
             if (table->hascolumn("SHWIDTH") && table->hascolumn("SHLENGTH")) {
-                read_events_v1(table);
+                read_events_v1(table, rows);
             }
 
             // ... otherwise read events for v0
             else {
-                read_events_v0(table);
+                read_events_v0(table, rows);
             }
 
-            // Read (optional) Hillas parameters
-            read_events_hillas(table);
+            // Read optional columns
+            if (columns) {
+                read_events_columns(table, rows);
+                read_events_hillas(table, rows);
+            }
 
         } // endif: there were events
 
     } // endif: HDU was valid
 
+    // Build contiguous event arrays
+    update_arrays();
+
     // Return
     return;
 }
@@ -629,22 +979,22 @@ void GCTAEventList::read_events(const GFitsTable* table)
  * @brief Read CTA events from FITS table (version 0)
  *
  * @param[in] table FITS table pointer.
+ * @param[in] rows Table rows to read.
  *
  * This method reads the CTA event list from a FITS table HDU into memory.
  * It is a minimal event reader that is compliant with the initial data
- * format distributed by Karl Kosack. Information that is not present in
- * that format is set to 0.
+ * format distributed by Karl Kosack. Only the columns needed for the
+ * analysis are read by this method. The columns are read in chunks of rows
+ * so that they are never loaded entirely into memory.
  ***************************************************************************/
-void GCTAEventList::read_events_v0(const GFitsTable* table)
+void GCTAEventList::read_events_v0(const GFitsTable*       table,
+                                   const std::vector<int>& rows)
 {
-    // Clear existing events
-    m_events.clear();
-
     // Continue only if HDU is valid
     if (table != NULL) {
 
-        // Extract number of events in FITS file
-        int num = table->integer("NAXIS2");
+        // Extract number of events to read
+        int num = rows.size();
 
         // If there are events then load them
         if (num > 0) {
@@ -652,51 +1002,56 @@ void GCTAEventList::read_events_v0(const GFitsTable* table)
             // Reserve data
             m_events.reserve(num);
 
-            // Get column pointers
-            GFitsTableULongCol*  ptr_eid         = (GFitsTableULongCol*)&(*table)["EVENT_ID"];
-            GFitsTableDoubleCol* ptr_time        = (GFitsTableDoubleCol*)&(*table)["TIME"];
-            GFitsTableShortCol*  ptr_multip      = (GFitsTableShortCol*)&(*table)["MULTIP"];
-            GFitsTableFloatCol*  ptr_ra          = (GFitsTableFloatCol*)&(*table)["RA"];
-            GFitsTableFloatCol*  ptr_dec         = (GFitsTableFloatCol*)&(*table)["DEC"];
-            GFitsTableFloatCol*  ptr_dir_err     = (GFitsTableFloatCol*)&(*table)["DIR_ERR"];
-            GFitsTableFloatCol*  ptr_detx        = (GFitsTableFloatCol*)&(*table)["DETX"];
-            GFitsTableFloatCol*  ptr_dety        = (GFitsTableFloatCol*)&(*table)["DETY"];
-            GFitsTableFloatCol*  ptr_alt         = (GFitsTableFloatCol*)&(*table)["ALT"];
-            GFitsTableFloatCol*  ptr_az          = (GFitsTableFloatCol*)&(*table)["AZ"];
-            GFitsTableFloatCol*  ptr_corex       = (GFitsTableFloatCol*)&(*table)["COREX"];
-            GFitsTableFloatCol*  ptr_corey       = (GFitsTableFloatCol*)&(*table)["COREY"];
-            GFitsTableFloatCol*  ptr_core_err    = (GFitsTableFloatCol*)&(*table)["CORE_ERR"];
-            GFitsTableFloatCol*  ptr_xmax        = (GFitsTableFloatCol*)&(*table)["XMAX"];
-            GFitsTableFloatCol*  ptr_xmax_err    = (GFitsTableFloatCol*)&(*table)["XMAX_ERR"];
-            GFitsTableFloatCol*  ptr_energy      = (GFitsTableFloatCol*)&(*table)["ENERGY"];
-            GFitsTableFloatCol*  ptr_energy_err  = (GFitsTableFloatCol*)&(*table)["ENERGY_ERR"];
-
-            // Copy data from columns into GCTAEventAtom objects
+            // Get columns
+            const GFitsTableCol& col_eid    = (*table)["EVENT_ID"];
+            const GFitsTableCol& col_time   = (*table)["TIME"];
+            const GFitsTableCol& col_ra     = (*table)["RA"];
+            const GFitsTableCol& col_dec    = (*table)["DEC"];
+            const GFitsTableCol& col_energy = (*table)["ENERGY"];
+
+            // Allocate row buffers
+            int                    nrows = table->integer("NAXIS2");
+            int                    chunk = table->optimal_rows();
+            std::vector<long long> eid(chunk);
+            std::vector<double>    time(chunk);
+            std::vector<double>    ra(chunk);
+            std::vector<double>    dec(chunk);
+            std::vector<double>    energy(chunk);
+
+            // Loop over chunks of rows and copy data of selected rows into
+            // GCTAEventAtom objects. Chunks without selected rows are not
+            // read.
             GCTAEventAtom event;
-            for (int i = 0; i < num; ++i) {
-                event.m_index     = i;
-                event.m_time.set((*ptr_time)(i), m_gti.reference());
-                event.m_dir.radec_deg((*ptr_ra)(i), (*ptr_dec)(i));
-                event.m_energy.TeV((*ptr_energy)(i));
-                event.m_event_id    = (*ptr_eid)(i);
-                event.m_obs_id      = 0;
-                event.m_multip      = (*ptr_multip)(i);
-                event.m_telmask     = 0;
-                event.m_dir_err     = (*ptr_dir_err)(i);
-                event.m_detx        = (*ptr_detx)(i);
-                event.m_dety        = (*ptr_dety)(i);
-                event.m_alt         = (*ptr_alt)(i);
-                event.m_az          = (*ptr_az)(i);
-                event.m_corex       = (*ptr_corex)(i);
-                event.m_corey       = (*ptr_corey)(i);
-                event.m_core_err    = (*ptr_core_err)(i);
-                event.m_xmax        = (*ptr_xmax)(i);
-                event.m_xmax_err    = (*ptr_xmax_err)(i);
-                event.m_shwidth     = 0.0;
-                event.m_shlength    = 0.0;
-                event.m_energy_err  = (*ptr_energy_err)(i);
-                m_events.push_back(event);
-            }
+            int           i = 0;
+            for (int start = 0; start < nrows && i < num; start += chunk) {
+
+                // Determine number of rows in chunk and skip chunk if it
+                // contains no selected rows
+                int n = (start+chunk > nrows) ? nrows-start : chunk;
+                if (rows[i] >= start+n) {
+                    continue;
+                }
+
+                // Read chunk
+                col_eid.read_rows(start, n, &eid[0]);
+                col_time.read_rows(start, n, &time[0]);
+                col_ra.read_rows(start, n, &ra[0]);
+                col_dec.read_rows(start, n, &dec[0]);
+                col_energy.read_rows(start, n, &energy[0]);
+
+                // Copy data of selected rows
+                for (; i < num && rows[i] < start+n; ++i) {
+                    int k            = rows[i] - start;
+                    event.m_index    = i;
+                    event.m_time.set(time[k], m_gti.reference());
+                    event.m_dir.radec_deg(ra[k], dec[k]);
+                    event.m_energy.TeV(energy[k]);
+                    event.m_event_id = (unsigned long)eid[k];
+                    event.m_obs_id   = 0;
+                    m_events.push_back(event);
+                }
+
+            } // endfor: looped over chunks
 
         } // endif: there were events
 
@@ -711,21 +1066,23 @@ void GCTAEventList::read_events_v0(const GFitsTable* table)
  * @brief Read CTA events from FITS table (version 1)
  *
  * @param[in] table FITS table pointer.
+ * @param[in] rows Table rows to read.
  *
  * This method reads the CTA event list from a FITS table HDU into memory.
+ * Only the columns needed for the analysis are read by this method. The
+ * columns are read in chunks of rows so that they are never loaded
+ * entirely into memory.
  *
  * @todo Implement agreed column format
  ***************************************************************************/
-void GCTAEventList::read_events_v1(const GFitsTable* table)
+void GCTAEventList::read_events_v1(const GFitsTable*       table,
+                                   const std::vector<int>& rows)
 {
-    // Clear existing events
-    m_events.clear();
-
     // Continue only if HDU is valid
     if (table != NULL) {
 
-        // Extract number of events in FITS file
-        int num = table->integer("NAXIS2");
+        // Extract number of events to read
+        int num = rows.size();
 
         // If there are events then load them
         if (num > 0) {
@@ -733,54 +1090,59 @@ void GCTAEventList::read_events_v1(const GFitsTable* table)
             // Reserve data
             m_events.reserve(num);
 
-            // Get column pointers
-            GFitsTableULongCol*  ptr_eid         = (GFitsTableULongCol*)&(*table)["EVENT_ID"];
-            GFitsTableULongCol*  ptr_oid         = (GFitsTableULongCol*)&(*table)["OBS_ID"];
-            GFitsTableDoubleCol* ptr_time        = (GFitsTableDoubleCol*)&(*table)["TIME"];
-            GFitsTableShortCol*  ptr_multip      = (GFitsTableShortCol*)&(*table)["MULTIP"];
-            GFitsTableFloatCol*  ptr_ra          = (GFitsTableFloatCol*)&(*table)["RA"];
-            GFitsTableFloatCol*  ptr_dec         = (GFitsTableFloatCol*)&(*table)["DEC"];
-            GFitsTableFloatCol*  ptr_dir_err     = (GFitsTableFloatCol*)&(*table)["DIR_ERR"];
-            GFitsTableFloatCol*  ptr_detx        = (GFitsTableFloatCol*)&(*table)["DETX"];
-            GFitsTableFloatCol*  ptr_dety        = (GFitsTableFloatCol*)&(*table)["DETY"];
-            GFitsTableFloatCol*  ptr_alt         = (GFitsTableFloatCol*)&(*table)["ALT"];
-            GFitsTableFloatCol*  ptr_az          = (GFitsTableFloatCol*)&(*table)["AZ"];
-            GFitsTableFloatCol*  ptr_corex       = (GFitsTableFloatCol*)&(*table)["COREX"];
-            GFitsTableFloatCol*  ptr_corey       = (GFitsTableFloatCol*)&(*table)["COREY"];
-            GFitsTableFloatCol*  ptr_core_err    = (GFitsTableFloatCol*)&(*table)["CORE_ERR"];
-            GFitsTableFloatCol*  ptr_xmax        = (GFitsTableFloatCol*)&(*table)["XMAX"];
-            GFitsTableFloatCol*  ptr_xmax_err    = (GFitsTableFloatCol*)&(*table)["XMAX_ERR"];
-            GFitsTableFloatCol*  ptr_shw         = (GFitsTableFloatCol*)&(*table)["SHWIDTH"];
-            GFitsTableFloatCol*  ptr_shl         = (GFitsTableFloatCol*)&(*table)["SHLENGTH"];
-            GFitsTableFloatCol*  ptr_energy      = (GFitsTableFloatCol*)&(*table)["ENERGY"];
-            GFitsTableFloatCol*  ptr_energy_err  = (GFitsTableFloatCol*)&(*table)["ENERGY_ERR"];
-
-            // Copy data from columns into GCTAEventAtom objects
+            // Get columns
+            const GFitsTableCol& col_eid    = (*table)["EVENT_ID"];
+            const GFitsTableCol& col_oid    = (*table)["OBS_ID"];
+            const GFitsTableCol& col_time   = (*table)["TIME"];
+            const GFitsTableCol& col_ra     = (*table)["RA"];
+            const GFitsTableCol& col_dec    = (*table)["DEC"];
+            const GFitsTableCol& col_energy = (*table)["ENERGY"];
+
+            // Allocate row buffers
+            int                    nrows = table->integer("NAXIS2");
+            int                    chunk = table->optimal_rows();
+            std::vector<long long> eid(chunk);
+            std::vector<long long> oid(chunk);
+            std::vector<double>    time(chunk);
+            std::vector<double>    ra(chunk);
+            std::vector<double>    dec(chunk);
+            std::vector<double>    energy(chunk);
+
+            // Loop over chunks of rows and copy data of selected rows into
+            // GCTAEventAtom objects. Chunks without selected rows are not
+            // read.
             GCTAEventAtom event;
-            for (int i = 0; i < num; ++i) {
-                event.m_index     = i;
-                event.m_time.set((*ptr_time)(i), m_gti.reference());
-                event.m_dir.radec_deg((*ptr_ra)(i), (*ptr_dec)(i));
-                event.m_energy.TeV((*ptr_energy)(i));
-                event.m_event_id   = (*ptr_eid)(i);
-                event.m_obs_id     = (*ptr_oid)(i);
-                event.m_multip     = (*ptr_multip)(i);
-                event.m_telmask    = 0;
-                event.m_dir_err    = (*ptr_dir_err)(i);
-                event.m_detx       = (*ptr_detx)(i);
-                event.m_dety       = (*ptr_dety)(i);
-                event.m_alt        = (*ptr_alt)(i);
-                event.m_az         = (*ptr_az)(i);
-                event.m_corex      = (*ptr_corex)(i);
-                event.m_corey      = (*ptr_corey)(i);
-                event.m_core_err   = (*ptr_core_err)(i);
-                event.m_xmax       = (*ptr_xmax)(i);
-                event.m_xmax_err   = (*ptr_xmax_err)(i);
-                event.m_shwidth    = (*ptr_shw)(i);
-                event.m_shlength   = (*ptr_shl)(i);
-                event.m_energy_err = (*ptr_energy_err)(i);
-                m_events.push_back(event);
-            }
+            int           i = 0;
+            for (int start = 0; start < nrows && i < num; start += chunk) {
+
+                // Determine number of rows in chunk and skip chunk if it
+                // contains no selected rows
+                int n = (start+chunk > nrows) ? nrows-start : chunk;
+                if (rows[i] >= start+n) {
+                    continue;
+                }
+
+                // Read chunk
+                col_eid.read_rows(start, n, &eid[0]);
+                col_oid.read_rows(start, n, &oid[0]);
+                col_time.read_rows(start, n, &time[0]);
+                col_ra.read_rows(start, n, &ra[0]);
+                col_dec.read_rows(start, n, &dec[0]);
+                col_energy.read_rows(start, n, &energy[0]);
+
+                // Copy data of selected rows
+                for (; i < num && rows[i] < start+n; ++i) {
+                    int k            = rows[i] - start;
+                    event.m_index    = i;
+                    event.m_time.set(time[k], m_gti.reference());
+                    event.m_dir.radec_deg(ra[k], dec[k]);
+                    event.m_energy.TeV(energy[k]);
+                    event.m_event_id = (unsigned long)eid[k];
+                    event.m_obs_id   = (unsigned long)oid[k];
+                    m_events.push_back(event);
+                }
+
+            } // endfor: looped over chunks
 
         } // endif: there were events
 
@@ -792,69 +1154,66 @@ void GCTAEventList::read_events_v1(const GFitsTable* table)
 
 
 /***********************************************************************//**
- * @brief Read Hillas information for CTA events from FITS table
+ * @brief Read optional event columns from FITS table
  *
  * @param[in] table FITS table pointer.
+ * @param[in] rows Table rows to read.
  *
- * This method reads the Hillas reconstruction information for CTA events
- * from an EVENTS file. It searches for the columns HIL_MSW, HIL_MSW_ERR,
- * HIL_MSL, and HIL_MSL_ERR in the FITS table and extracts the relevant
- * columns from the FITS file. If a column is not found, no action is
- * performed.
- *
- * @todo Verify consistency of event list size
+ * This method reads the event reconstruction information (multiplicity,
+ * detector coordinates, shower core, ...) that exists in the FITS table
+ * into optional event columns.
  ***************************************************************************/
-void GCTAEventList::read_events_hillas(const GFitsTable* table)
+void GCTAEventList::read_events_columns(const GFitsTable*       table,
+                                        const std::vector<int>& rows)
 {
     // Continue only if HDU is valid
     if (table != NULL) {
 
-        // Extract number of events in FITS file
-        int num = table->integer("NAXIS2");
-
-        //TODO: Make sure that dimension is consistent with existing event
-        //      list
+        // Read optional columns
+        read_column(table, "MULTIP", rows);
+        read_column(table, "DIR_ERR", rows);
+        read_column(table, "DETX", rows);
+        read_column(table, "DETY", rows);
+        read_column(table, "ALT", rows);
+        read_column(table, "AZ", rows);
+        read_column(table, "COREX", rows);
+        read_column(table, "COREY", rows);
+        read_column(table, "CORE_ERR", rows);
+        read_column(table, "XMAX", rows);
+        read_column(table, "XMAX_ERR", rows);
+        read_column(table, "SHWIDTH", rows);
+        read_column(table, "SHLENGTH", rows);
+        read_column(table, "ENERGY_ERR", rows);
 
-        // Continue only if there are events
-        if (num > 0) {
-
-            // HIL_MSW
-            if (table->hascolumn("HIL_MSW")) {
-                GFitsTableFloatCol* ptr =
-                     (GFitsTableFloatCol*)&(*table)["HIL_MSW"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msw = (*ptr)(i);
-                }
-            }
+    } // endif: HDU was valid
 
-            // HIL_MSW_ERR
-            if (table->hascolumn("HIL_MSW_ERR")) {
-                GFitsTableFloatCol* ptr =
-                     (GFitsTableFloatCol*)&(*table)["HIL_MSW_ERR"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msw_err = (*ptr)(i);
-                }
-            }
+    // Return
+    return;
+}
 
-            // HIL_MSL
-            if (table->hascolumn("HIL_MSL")) {
-                GFitsTableFloatCol* ptr =
-                     (GFitsTableFloatCol*)&(*table)["HIL_MSL"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msl = (*ptr)(i);
-                }
-            }
 
-            // HIL_MSL_ERR
-            if (table->hascolumn("HIL_MSL_ERR")) {
-                GFitsTableFloatCol* ptr =
-                     (GFitsTableFloatCol*)&(*table)["HIL_MSL_ERR"];
-                for (int i = 0; i < num; ++i) {
-                    m_events[i].m_hil_msl_err = (*ptr)(i);
-                }
-            }
+/***********************************************************************//**
+ * @brief Read Hillas information for CTA events from FITS table
+ *
+ * @param[in] table FITS table pointer.
+ * @param[in] rows Table rows to read.
+ *
+ * This method reads the Hillas reconstruction information for CTA events
+ * from an EVENTS file. It searches for the columns HIL_MSW, HIL_MSW_ERR,
+ * HIL_MSL, and HIL_MSL_ERR in the FITS table and stores them as optional
+ * columns. If a column is not found, no action is performed.
+ ***************************************************************************/
+void GCTAEventList::read_events_hillas(const GFitsTable*       table,
+                                       const std::vector<int>& rows)
+{
+    // Continue only if HDU is valid
+    if (table != NULL) {
 
-        } // endif: there were events
+        // Read optional columns
+        read_column(table, "HIL_MSW", rows);
+        read_column(table, "HIL_MSW_ERR", rows);
+        read_column(table, "HIL_MSL", rows);
+        read_column(table, "HIL_MSL_ERR", rows);
 
     } // endif: HDU was valid
 
@@ -1081,36 +1440,47 @@ void GCTAEventList::write_events(GFitsBinTable* hdu) const
             GFitsTableFloatCol  col_hil_msl     = GFitsTableFloatCol("HIL_MSL", size());
             GFitsTableFloatCol  col_hil_msl_err = GFitsTableFloatCol("HIL_MSL_ERR", size());
 
-            // Fill columns
+            // Fill event columns
             for (int i = 0; i < size(); ++i) {
-                col_eid(i)         = m_events[i].m_event_id;
-                col_oid(i)         = m_events[i].m_obs_id;
-                col_time(i)        = m_events[i].time().convert(m_gti.reference());
-                col_live(i)        = 0.0;
-                col_multip(i)      = 0;
+                col_eid(i)    = m_events[i].m_event_id;
+                col_oid(i)    = m_events[i].m_obs_id;
+                col_time(i)   = m_events[i].time().convert(m_gti.reference());
+                col_live(i)   = 0.0;
                 //col_telmask
-                col_ra(i)          = m_events[i].dir().ra_deg();
-                col_dec(i)         = m_events[i].dir().dec_deg();
-                col_direrr(i)      = m_events[i].m_dir_err;
-                col_detx(i)        = m_events[i].m_detx;
-                col_dety(i)        = m_events[i].m_dety;
-                col_alt(i)         = m_events[i].m_alt;
-                col_az(i)          = m_events[i].m_az;
-                col_corex(i)       = m_events[i].m_corex;
-                col_corey(i)       = m_events[i].m_corey;
-                col_core_err(i)    = m_events[i].m_core_err;
-                col_xmax(i)        = m_events[i].m_xmax;
-                col_xmax_err(i)    = m_events[i].m_xmax_err;
-                col_shw(i)         = m_events[i].m_shwidth;
-                col_shl(i)         = m_events[i].m_shlength;
-                col_energy(i)      = m_events[i].energy().TeV();
-                col_energy_err(i)  = m_events[i].m_energy_err;
-                col_hil_msw(i)     = m_events[i].m_hil_msw;
-                col_hil_msw_err(i) = m_events[i].m_hil_msw_err;
-                col_hil_msl(i)     = m_events[i].m_hil_msl;
-                col_hil_msl_err(i) = m_events[i].m_hil_msl_err;
+                col_ra(i)     = m_events[i].dir().ra_deg();
+                col_dec(i)    = m_events[i].dir().dec_deg();
+                col_energy(i) = m_events[i].energy().TeV();
             } // endfor: looped over rows
 
+            // Fill optional columns. Columns that are not present are
+            // written with zero values
+            int imultip = column_index("MULTIP");
+            if (imultip != -1) {
+                const std::vector<float>& values = m_columns[imultip];
+                for (int i = 0; i < size(); ++i) {
+                    col_multip(i) = short(values[i]);
+                }
+            }
+            GFitsTableFloatCol* cols[] = {&col_direrr,      &col_detx,
+                                          &col_dety,        &col_alt,
+                                          &col_az,          &col_corex,
+                                          &col_corey,       &col_core_err,
+                                          &col_xmax,        &col_xmax_err,
+                                          &col_shw,         &col_shl,
+                                          &col_energy_err,  &col_hil_msw,
+                                          &col_hil_msw_err, &col_hil_msl,
+                                          &col_hil_msl_err};
+            int ncols = sizeof(cols) / sizeof(GFitsTableFloatCol*);
+            for (int k = 0; k < ncols; ++k) {
+                int icol = column_index(cols[k]->name());
+                if (icol != -1) {
+                    const std::vector<float>& values = m_columns[icol];
+                    for (int i = 0; i < size(); ++i) {
+                        (*cols[k])(i) = values[i];
+                    }
+                }
+            }
+
             // Append columns to table
             hdu->append_column(col_eid);
             hdu->append_column(col_oid);
@@ -1211,79 +1581,242 @@ void GCTAEventList::write_ds_keys(GFitsHDU* hdu) const
 
 
 /***********************************************************************//**
- * @brief Initialize IRF cache for a given model
+ * @brief Drop IRF cache values until memory limit is respected
  *
- * @param[in] name Model name.
- * @return Cache index (-1 if invalid).
+ * @param[in] handle Cache handle that should not be dropped.
+ * @param[in] bytes Memory that should be made available (bytes).
+ *
+ * Drops the IRF values of models, excluding the model with @p handle, until
+ * the cache memory plus @p bytes is within the limit. Models whose handles
+ * have not been resolved since the last call are dropped first. The used flags
+ * of all models are reset on return. The handles of the dropped models
+ * remain valid, and their values will be recomputed when needed.
+ *
+ * As values are read without locking, this method frees memory only
+ * outside of parallel regions. Within a parallel region the method does
+ * nothing. It needs to be called within the IRF cache critical zone.
  ***************************************************************************/
-int GCTAEventList::irf_cache_init(const std::string& name) const
+void GCTAEventList::irf_cache_evict(const int& handle, const size_t& bytes) const
 {
-    // Initialise cache index
-    int index = irf_cache_index(name);
+    // Do nothing within parallel regions
+    #ifdef _OPENMP
+    if (omp_in_parallel()) {
+        return;
+    }
+    #endif
 
-    // Continue only if model does not yet exist
-    if (index == -1) {
+    // Get number of handles
+    int nhandles = m_irf_handles.size();
 
-        // Add model name and vector to cache. The vector is initialized
-        // to -1, which signals that no cache values exist
-        m_irf_names.push_back(name);
-        m_irf_values.push_back(std::vector<double>(size(), -1.0));
+    // Drop models while memory limit is exceeded. First drop models that
+    // have not been used, then all other models.
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < nhandles; ++i) {
 
-        // Set index
-        index = m_irf_names.size()-1;
+            // Break if memory limit is respected
+            if (m_irf_memory + bytes <= m_irf_max_memory) {
+                break;
+            }
 
-    } // endif: model cache did not yet exist
+            // Drop values of model
+            if (i != handle && m_irf_values[i] != NULL &&
+                (pass == 1 || !m_irf_used[i])) {
+                m_irf_memory -= m_irf_sizes[i] * sizeof(float);
+                delete [] m_irf_values[i];
+                m_irf_values[i] = NULL;
+                m_irf_sizes[i]  = 0;
+            }
 
-    // Return index
-    return index;
+        } // endfor: looped over models
+    } // endfor: looped over passes
+
+    // Reset used flags
+    for (int i = 0; i < nhandles; ++i) {
+        m_irf_used[i] = 0;
+    }
+
+    // Return
+    return;
 }
 
 
 /***********************************************************************//**
- * @brief Determines the cache index for a given model name
+ * @brief Allocate IRF cache values for a model
+ *
+ * @param[in] handle Cache handle.
+ *
+ * Allocates IRF values for all events of the list and initialises them to
+ * -1, which signals that no cache value exists. If the memory limit does
+ * not allow for the allocation, values of other models are dropped (see
+ * irf_cache_evict()). If the values do not fit in the memory limit, no
+ * values are allocated and the IRF values of the model are not cached.
+ *
+ * This method needs to be called within the IRF cache critical zone, and
+ * before the handle is made available to other threads or outside of a
+ * parallel region.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_alloc(const int& handle) const
+{
+    // Continue only if there are events and no values exist so far
+    if (size() > 0 && m_irf_values[handle] == NULL) {
+
+        // Get required memory
+        size_t bytes = size() * sizeof(float);
+
+        // Drop values of other models if required
+        irf_cache_evict(handle, bytes);
+
+        // Allocate values if they fit in the memory limit
+        if (m_irf_memory + bytes <= m_irf_max_memory) {
+            float* values = new float[size()];
+            for (int i = 0; i < size(); ++i) {
+                values[i] = -1.0;
+            }
+            m_irf_values[handle] = values;
+            m_irf_sizes[handle]  = size();
+            m_irf_memory        += bytes;
+        }
+
+    } // endif: values were required
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return IRF cache handle for a given model
  *
  * @param[in] name Model name.
- * @return Cache index (-1 if model has not been found).
+ * @return Cache handle (-1 if no more models can be cached).
+ *
+ * Returns the cache handle for the model with the specified @p name. If the
+ * model is not yet in the cache, a new handle is assigned and memory for
+ * the IRF values of all events is allocated. A handle remains valid until
+ * the event list is cleared. The model is flagged as used, which protects
+ * its values from being dropped by the next eviction.
+ *
+ * The handle lookup is done within a critical zone. To avoid the lookup
+ * for every event, use irf_cache_handle(const GSource&).
  ***************************************************************************/
-int GCTAEventList::irf_cache_index(const std::string& name) const
+int GCTAEventList::irf_cache_handle(const std::string& name) const
 {
-    // Initialise index
-    int index = -1;
+    // Initialise handle
+    int handle = -1;
+
+    // Access handles within a critical zone as other threads may add models
+    #pragma omp critical(GCTAEventList_irf_cache)
+    {
+        // Search handle for model
+        std::map<std::string,int>::const_iterator it = m_irf_handles.find(name);
+
+        // If model was found then return handle ...
+        if (it != m_irf_handles.end()) {
+            handle = it->second;
+        }
 
-    // Continue only if there are models in cache
-    if (!m_irf_names.empty()) {
+        // ... otherwise assign new handle if possible
+        else if (m_irf_handles.size() < G_IRF_CACHE_MAX_HANDLES) {
+            handle = m_irf_handles.size();
+            m_irf_names[handle] = name;
+            m_irf_handles[name] = handle;
+        }
 
-         // Search for model name
-         for (int i = 0; i < m_irf_names.size(); ++i) {
-             if (m_irf_names[i] == name) {
-                 index = i;
-                 break;
-             }
-         }
+        // Flag model as used and allocate values if required. Within a
+        // parallel region, values are only allocated for new handles as
+        // other threads may read the values of existing handles.
+        if (handle != -1) {
+            m_irf_used[handle] = 1;
+            #ifdef _OPENMP
+            if (it == m_irf_handles.end() || !omp_in_parallel()) {
+                irf_cache_alloc(handle);
+            }
+            #else
+            irf_cache_alloc(handle);
+            #endif
+        }
+    }
 
-    } // endif: there were models in cache
+    // Return handle
+    return handle;
+}
 
-    // Return index
-    return index;
+
+/***********************************************************************//**
+ * @brief Return IRF cache handle for a given source
+ *
+ * @param[in] source Source.
+ * @return Cache handle (-1 if no more models can be cached).
+ *
+ * Returns the cache handle for the model of the specified @p source. The
+ * handle is looked up by irf_cache_handle(const std::string&) only once
+ * per thread and spatial model. Subsequent calls for the same spatial model
+ * return the handle from a thread-private table that is keyed on the
+ * instance identifiers of the event list and the spatial model, without
+ * locking, map lookup or name comparison.
+ ***************************************************************************/
+int GCTAEventList::irf_cache_handle(const GSource& source) const
+{
+    // Thread-private table of resolved handles
+    static irf_memo memo[G_IRF_CACHE_MEMO];
+    static int      memo_next = 0;
+    #pragma omp threadprivate(memo, memo_next)
+
+    // Get spatial model instance
+    unsigned long model = source.model()->instance();
+
+    // Search handle in table
+    for (int i = 0; i < G_IRF_CACHE_MEMO; ++i) {
+        if (memo[i].list == m_instance && memo[i].model == model) {
+            return memo[i].handle;
+        }
+    }
+
+    // Get handle
+    int handle = irf_cache_handle(source.name());
+
+    // Store handle in table
+    memo[memo_next].list   = m_instance;
+    memo[memo_next].model  = model;
+    memo[memo_next].handle = handle;
+    memo_next              = (memo_next + 1) % G_IRF_CACHE_MEMO;
+
+    // Return handle
+    return handle;
 }
 
 
 /***********************************************************************//**
  * @brief Get cache IRF value
  *
- * @param[in] name Model name.
+ * @param[in] handle Cache handle.
  * @param[in] index Event index [0,...,size()-1].
  * @return IRF value (-1 if no cache value found).
+ *
+ * @exception GException::out_of_range
+ *            Cache handle or event index out of range.
+ *
+ * Returns the cached IRF value without locking.
  ***************************************************************************/
-double GCTAEventList::irf_cache(const std::string& name, const int& index) const
+double GCTAEventList::irf_cache(const int& handle, const int& index) const
 {
     // Initialise IRF value to invalid value
     double irf = -1.0;
 
-    // Get cache index. Continue only if index is valid
-    int icache = irf_cache_index(name);
-    if (icache != -1) {
-        irf = (m_irf_values[icache])[index];
+    // Raise exception if handle or index is out of range
+    #if defined(G_RANGE_CHECK)
+    if (handle < 0 || handle >= G_IRF_CACHE_MAX_HANDLES) {
+        throw GException::out_of_range(G_IRF_CACHE_GET, handle, 0,
+                                       G_IRF_CACHE_MAX_HANDLES-1);
+    }
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_IRF_CACHE_GET, index, 0, size()-1);
+    }
+    #endif
+
+    // Get value if it exists
+    if (index < m_irf_sizes[handle]) {
+        irf = m_irf_values[handle][index];
     }
 
     // Return IRF value
@@ -1291,6 +1824,105 @@ double GCTAEventList::irf_cache(const std::string& name, const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set cache IRF value
+ *
+ * @param[in] handle Cache handle.
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] irf IRF value.
+ *
+ * @exception GException::out_of_range
+ *            Cache handle or event index out of range.
+ *
+ * Sets the IRF value for a given event without locking. If no values
+ * were allocated for the model, for example because the memory limit was
+ * reached, the value is not cached.
+ ***************************************************************************/
+void GCTAEventList::irf_cache(const int& handle, const int& index,
+                              const double& irf) const
+{
+    // Raise exception if handle or index is out of range
+    #if defined(G_RANGE_CHECK)
+    if (handle < 0 || handle >= G_IRF_CACHE_MAX_HANDLES) {
+        throw GException::out_of_range(G_IRF_CACHE_SET, handle, 0,
+                                       G_IRF_CACHE_MAX_HANDLES-1);
+    }
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_IRF_CACHE_SET, index, 0, size()-1);
+    }
+    #endif
+
+    // Set value if values exist
+    if (index < m_irf_sizes[handle]) {
+        m_irf_values[handle][index] = float(irf);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return memory used by IRF cache
+ *
+ * @return Memory used by IRF cache values (bytes).
+ ***************************************************************************/
+size_t GCTAEventList::irf_cache_memory(void) const
+{
+    // Initialise memory
+    size_t memory = 0;
+
+    // Get memory within critical zone
+    #pragma omp critical(GCTAEventList_irf_cache)
+    {
+        memory = m_irf_memory;
+    }
+
+    // Return memory
+    return memory;
+}
+
+
+/***********************************************************************//**
+ * @brief Set maximum memory of IRF cache
+ *
+ * @param[in] bytes Maximum memory for IRF cache values (bytes).
+ *
+ * Sets the maximum memory that may be used by the IRF cache values. If the
+ * cache currently uses more memory, values are dropped, starting with the
+ * models whose values have not been used since the last eviction.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_max_memory(const size_t& bytes)
+{
+    // Set limit and drop values if necessary
+    #pragma omp critical(GCTAEventList_irf_cache)
+    {
+        m_irf_max_memory = bytes;
+        irf_cache_evict(-1, 0);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Get cache IRF value
+ *
+ * @param[in] name Model name.
+ * @param[in] index Event index [0,...,size()-1].
+ * @return IRF value (-1 if no cache value found).
+ ***************************************************************************/
+double GCTAEventList::irf_cache(const std::string& name, const int& index) const
+{
+    // Get handle
+    int handle = irf_cache_handle(name);
+
+    // Return IRF value
+    return ((handle >= 0) ? irf_cache(handle, index) : -1.0);
+}
+
+
 /***********************************************************************//**
  * @brief Set cache IRF value
  *
@@ -1301,12 +1933,241 @@ double GCTAEventList::irf_cache(const std::string& name, const int& index) const
 void GCTAEventList::irf_cache(const std::string& name, const int& index,
                               const double& irf) const
 {
-    // Initialize cache index. Continue only if index is valid
-    int icache = irf_cache_init(name);
-    if (icache != -1) {
-        (m_irf_values[icache])[index] = irf;
+    // Get handle
+    int handle = irf_cache_handle(name);
+
+    // Set IRF value
+    if (handle >= 0) {
+        irf_cache(handle, index, irf);
     }
 
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Append event to contiguous event arrays
+ *
+ * @param[in] event Event atom.
+ ***************************************************************************/
+void GCTAEventList::append_arrays(const GCTAEventAtom& event)
+{
+    // Get celestial unit vector
+    const GSkyDir& dir    = event.dir().dir();
+    GVector3       vector = dir.celvector();
+
+    // Append event
+    m_ra.push_back(dir.ra());
+    m_dec.push_back(dir.dec());
+    m_dirx.push_back(vector[0]);
+    m_diry.push_back(vector[1]);
+    m_dirz.push_back(vector[2]);
+    m_logE.push_back(event.energy().log10TeV());
+    m_secs.push_back(event.time().secs());
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read optional event column from FITS table
+ *
+ * @param[in] table FITS table pointer.
+ * @param[in] name Column name.
+ * @param[in] rows Table rows to read.
+ *
+ * Reads an optional event column from a FITS table. If the column does not
+ * exist in the table, no action is performed. The column is read in
+ * chunks of rows.
+ ***************************************************************************/
+void GCTAEventList::read_column(const GFitsTable*       table,
+                                const std::string&      name,
+                                const std::vector<int>& rows)
+{
+    // Continue only if column exists
+    if (table->hascolumn(name)) {
+
+        // Get column
+        const GFitsTableCol& col = (*table)[name];
+
+        // Allocate values and row buffer
+        int                 num   = size();
+        int                 nrows = table->integer("NAXIS2");
+        int                 chunk = table->optimal_rows();
+        std::vector<float>  values(num, 0.0);
+        std::vector<double> buffer(chunk);
+
+        // Loop over chunks of rows and copy values of selected rows.
+        // Chunks without selected rows are not read.
+        int i = 0;
+        for (int start = 0; start < nrows && i < num; start += chunk) {
+            int n = (start+chunk > nrows) ? nrows-start : chunk;
+            if (rows[i] >= start+n) {
+                continue;
+            }
+            col.read_rows(start, n, &buffer[0]);
+            for (; i < num && rows[i] < start+n; ++i) {
+                values[i] = float(buffer[rows[i]-start]);
+            }
+        }
+
+        // Set column
+        column(name, values);
+
+    } // endif: column existed
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Select rows of FITS table
+ *
+ * @param[in] table FITS table pointer.
+ * @param[in] roi Region of interest.
+ * @param[in] ebounds Energy boundaries.
+ * @param[in] gti Good Time Intervals.
+ * @return Indices of selected table rows.
+ *
+ * Returns the indices of all rows of the FITS table with events that fall
+ * within the region of interest, the energy boundaries and the Good Time
+ * Intervals. Only the ENERGY, TIME, RA and DEC columns are accessed, and
+ * a column is only accessed if the corresponding selection is not empty.
+ * The columns are read in chunks of rows, hence the columns are never
+ * loaded entirely into memory.
+ * The region of interest test is done using the scalar product of
+ * celestial unit vectors.
+ ***************************************************************************/
+std::vector<int> GCTAEventList::select_rows(const GFitsTable* table,
+                                            const GCTARoi&    roi,
+                                            const GEbounds&   ebounds,
+                                            const GGti&       gti) const
+{
+    // Extract number of events in FITS file
+    int num = table->integer("NAXIS2");
+
+    // Determine which selections are needed
+    bool sel_roi     = (roi.radius() > 0.0);
+    bool sel_ebounds = (ebounds.size() > 0);
+    bool sel_gti     = (gti.size() > 0);
+
+    // Initialise selected rows. Memory for all rows is only reserved if
+    // there is no selection, as otherwise the number of selected rows is
+    // not known in advance.
+    std::vector<int> rows;
+    if (!sel_roi && !sel_ebounds && !sel_gti) {
+        rows.reserve(num);
+    }
+
+    // Precompute RoI centre unit vector and cosine of RoI radius
+    double cos_radius = 0.0;
+    double cx         = 0.0;
+    double cy         = 0.0;
+    double cz         = 0.0;
+    if (sel_roi) {
+        double ra      = roi.centre().ra();
+        double dec     = roi.centre().dec();
+        double cos_dec = std::cos(dec);
+        cx             = cos_dec * std::cos(ra);
+        cy             = cos_dec * std::sin(ra);
+        cz             = std::sin(dec);
+        cos_radius     = std::cos(roi.radius() * gammalib::deg2rad);
+    }
+
+    // Allocate row buffers
+    int                 chunk = table->optimal_rows();
+    std::vector<double> time((sel_gti)       ? chunk : 0);
+    std::vector<double> ra((sel_roi)         ? chunk : 0);
+    std::vector<double> dec((sel_roi)        ? chunk : 0);
+    std::vector<double> energy((sel_ebounds) ? chunk : 0);
+
+    // Loop over chunks of rows
+    GEnergy eng;
+    GTime   t;
+    for (int start = 0; start < num; start += chunk) {
+
+        // Determine number of rows in chunk
+        int n = (start+chunk > num) ? num-start : chunk;
+
+        // Read chunk of those columns that are needed for the selection
+        if (sel_gti) {
+            (*table)["TIME"].read_rows(start, n, &time[0]);
+        }
+        if (sel_roi) {
+            (*table)["RA"].read_rows(start, n, &ra[0]);
+            (*table)["DEC"].read_rows(start, n, &dec[0]);
+        }
+        if (sel_ebounds) {
+            (*table)["ENERGY"].read_rows(start, n, &energy[0]);
+        }
+
+        // Loop over rows in chunk
+        for (int k = 0; k < n; ++k) {
+
+            // Apply energy selection
+            if (sel_ebounds) {
+                eng.TeV(energy[k]);
+                if (!ebounds.contains(eng)) {
+                    continue;
+                }
+            }
+
+            // Apply time selection
+            if (sel_gti) {
+                t.set(time[k], m_gti.reference());
+                if (!gti.contains(t)) {
+                    continue;
+                }
+            }
+
+            // Apply RoI selection
+            if (sel_roi) {
+                double ra_rad  = ra[k]  * gammalib::deg2rad;
+                double dec_rad = dec[k] * gammalib::deg2rad;
+                double cos_dec = std::cos(dec_rad);
+                double cosdist = cos_dec * std::cos(ra_rad) * cx +
+                                 cos_dec * std::sin(ra_rad) * cy +
+                                 std::sin(dec_rad)          * cz;
+                if (cosdist < cos_radius) {
+                    continue;
+                }
+            }
+
+            // Select row
+            rows.push_back(start+k);
+
+        } // endfor: looped over rows in chunk
+
+    } // endfor: looped over chunks
+
+    // Return rows
+    return rows;
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of optional event column
+ *
+ * @param[in] name Column name.
+ * @return Column index (-1 if column does not exist).
+ ***************************************************************************/
+int GCTAEventList::column_index(const std::string& name) const
+{
+    // Initialise index
+    int index = -1;
+
+    // Search column
+    int num = m_colnames.size();
+    for (int i = 0; i < num; ++i) {
+        if (m_colnames[i] == name) {
+            index = i;
+            break;
+        }
+    }
+
+    // Return index
+    return index;
+}
@@ -33,6 +33,9 @@
 #include "GFits.hpp"
 #include "GTools.hpp"
 #include "GIntegral.hpp"
+#include "GModels.hpp"
+#include "GModelSky.hpp"
+#include "GModelSpatialDiffuse.hpp"
 #include "GCTAException.hpp"
 #include "GCTAObservation.hpp"
 #include "GCTAEventList.hpp"
@@ -743,12 +746,89 @@ std::string GCTAObservation::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Prepare observation for model evaluation
+ *
+ * @param[in] models Models.
+ *
+ * Rebuilds the contiguous event arrays of the event list if they are
+ * outdated, and resolves the IRF cache handles of all diffuse sky models
+ * of the @p models that apply to the observation, so that the IRF values
+ * of the events are allocated before the likelihood evaluation and the
+ * handles are not assigned within the event loop. Nothing is done if the
+ * events are not an event list.
+ ***************************************************************************/
+void GCTAObservation::prepare(const GModels& models)
+{
+    // Get pointer on event list
+    GCTAEventList* list = dynamic_cast<GCTAEventList*>(m_events);
+
+    // Continue only if events are an event list
+    if (list != NULL) {
+
+        // Rebuild contiguous event arrays
+        if (!list->hasarrays()) {
+            list->update_arrays();
+        }
+
+        // Loop over models
+        for (int i = 0; i < models.size(); ++i) {
+
+            // Resolve handle for diffuse sky models that apply to the
+            // observation
+            const GModelSky* model = dynamic_cast<const GModelSky*>(models[i]);
+            if (model != NULL && model->isvalid(instrument(), id()) &&
+                dynamic_cast<const GModelSpatialDiffuse*>(model->spatial()) != NULL) {
+                list->irf_cache_handle(model->name());
+            }
+
+        } // endfor: looped over models
+
+    } // endif: events were an event list
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Load data for unbinned analysis
  *
  * @param[in] filename Event FITS file name.
+ *
+ * Loads all events and all optional event columns from the event file.
  ***************************************************************************/
 void GCTAObservation::load_unbinned(const std::string& filename)
+{
+    // Load all events and columns
+    load_unbinned(filename, GCTARoi(), GEbounds(), GGti(), true);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Load selected data for unbinned analysis
+ *
+ * @param[in] filename Event FITS file name.
+ * @param[in] roi Region of interest.
+ * @param[in] ebounds Energy boundaries.
+ * @param[in] gti Good Time Intervals.
+ * @param[in] columns Read optional event columns? (default: false)
+ *
+ * Loads the events that fall within the region of interest, the energy
+ * boundaries and the Good Time Intervals from the event file. Events
+ * outside the selection are never stored, and unless @p columns is true
+ * only the event columns needed for the analysis are read. An empty
+ * selection does not restrict the events. See GCTAEventList::read() for
+ * details.
+ ***************************************************************************/
+void GCTAObservation::load_unbinned(const std::string& filename,
+                                    const GCTARoi&     roi,
+                                    const GEbounds&    ebounds,
+                                    const GGti&        gti,
+                                    const bool&        columns)
 {
     // Delete any existing event container (do not call clear() as we do not
     // want to delete the response function)
@@ -765,7 +845,7 @@ void GCTAObservation::load_unbinned(const std::string& filename)
     GFits file(filename);
 
     // Read event list
-    events->read(file);
+    events->read(file, roi, ebounds, gti, columns);
 
     // Read observation attributes from EVENTS extension
     GFitsHDU* hdu = file.hdu("EVENTS");
@@ -187,8 +187,8 @@ void GCTAPointing::dir(const GSkyDir& dir)
     // Set sky direction
     m_dir = dir;
 
-    // Invalidate cache
-    m_has_cache = false;
+    // Update rotation matrix
+    update();
 
     // Return
     return;
@@ -198,11 +198,8 @@ void GCTAPointing::dir(const GSkyDir& dir)
 /***********************************************************************//**
  * @brief Return rotation matrix
 ***************************************************************************/
-const GMatrix& GCTAPointing::rot(void) const
+const GMatrix3& GCTAPointing::rot(void) const
 {
-    // Update cache
-    update();
-
     // Return rotation matrix
     return m_Rback;
 }
@@ -249,11 +246,13 @@ void GCTAPointing::init_members(void)
 {
     // Initialise members
     m_dir.clear();
-    m_zenith    = 0.0;
-    m_azimuth   = 0.0;
-    m_has_cache = false;
+    m_zenith  = 0.0;
+    m_azimuth = 0.0;
     m_Rback.clear();
 
+    // Set rotation matrix for default pointing direction
+    update();
+
     // Return
     return;
 }
@@ -267,11 +266,10 @@ void GCTAPointing::init_members(void)
 void GCTAPointing::copy_members(const GCTAPointing& pnt)
 {
     // Copy members
-    m_dir       = pnt.m_dir;
-    m_zenith    = pnt.m_zenith;
-    m_azimuth   = pnt.m_azimuth;
-    m_has_cache = pnt.m_has_cache;
-    m_Rback     = pnt.m_Rback;
+    m_dir     = pnt.m_dir;
+    m_zenith  = pnt.m_zenith;
+    m_azimuth = pnt.m_azimuth;
+    m_Rback   = pnt.m_Rback;
 
     // Return
     return;
@@ -289,26 +287,23 @@ void GCTAPointing::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update coordinate transformation cache
+ * @brief Update rotation matrix
+ *
+ * Computes the rotation matrix from the pointing direction. The method is
+ * called whenever the pointing direction is set, so that the rotation
+ * matrix can be accessed concurrently by several threads without any
+ * further update.
  ***************************************************************************/
-void GCTAPointing::update(void) const
+void GCTAPointing::update(void)
 {
-    // Update coordinate transformation cache only if required
-    if (!m_has_cache) {
-
-        // Set up Euler matrices
-        GMatrix Ry;
-        GMatrix Rz;
-        Ry.eulery(m_dir.dec_deg() - 90.0);
-        Rz.eulerz(-m_dir.ra_deg());
-
-        // Compute rotation matrix
-        m_Rback = (Ry * Rz).transpose();
-
-        // Signal that we have a valid transformation cache
-        m_has_cache = true;
-
-    } // endif: Update of cache was required
+    // Set up Euler matrices
+    GMatrix3 Ry;
+    GMatrix3 Rz;
+    Ry.eulery(m_dir.dec_deg() - 90.0);
+    Rz.eulerz(-m_dir.ra_deg());
+
+    // Compute rotation matrix
+    m_Rback = (Ry * Rz).transpose();
 
     // Return
     return;
@@ -130,6 +130,35 @@ GCTAPsf& GCTAPsf::operator= (const GCTAPsf& psf)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Return Gaussian components of point spread function
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @param[out] amplitude Array of at least 3 component amplitudes (sr^-1).
+ * @param[out] width Array of at least 3 component widths (rad^-2).
+ * @return Number of Gaussian components.
+ *
+ * Decomposes the point spread function into a sum of Gaussians
+ *
+ * \f[
+ *    PSF(\delta) = \sum_i a_i \exp(w_i \delta^2)
+ * \f]
+ *
+ * where \f$a_i\f$ are the amplitudes and \f$w_i\f$ are the (negative)
+ * widths of the components. The base class implementation returns 0,
+ * signalling that the point spread function has no such decomposition.
+ ***************************************************************************/
+int GCTAPsf::gaussians(const double&,
+                       const double&,
+                       double*,
+                       double*) const
+{
+    // Return number of components
+    return 0;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Private methods                              =
@@ -180,23 +180,23 @@ double GCTAPsf2D::operator()(const double& delta,
     double psf = 0.0;
 
     // Update the parameter cache
-    update(logE, theta);
+    const cache& pars = update(logE, theta);
 
     // Continue only if normalization is positive
-    if (m_norm > 0.0) {
+    if (pars.norm > 0.0) {
 
         // Compute distance squared
         double delta2 = delta * delta;
 
         // Compute Psf value
-        psf = std::exp(m_width1 * delta2);
-        if (m_norm2 > 0.0) {
-            psf += std::exp(m_width2 * delta2) * m_norm2;
+        psf = std::exp(pars.width1 * delta2);
+        if (pars.norm2 > 0.0) {
+            psf += std::exp(pars.width2 * delta2) * pars.norm2;
         }
-        if (m_norm3 > 0.0) {
-            psf += std::exp(m_width3 * delta2) * m_norm3;
+        if (pars.norm3 > 0.0) {
+            psf += std::exp(pars.width3 * delta2) * pars.norm3;
         }
-        psf *= m_norm;
+        psf *= pars.norm;
 
     } // endif: normalization was positive
     
@@ -275,6 +275,9 @@ void GCTAPsf2D::load(const std::string& filename)
     m_psf.scale(3, gammalib::deg2rad);
     m_psf.scale(5, gammalib::deg2rad);
 
+    // Invalidate parameter caches
+    m_id = new_id();
+
     // Close PSF FITS file
     file.close();
 
@@ -320,20 +323,20 @@ double GCTAPsf2D::mc(GRan&         ran,
                      const bool&   etrue) const
 {
     // Update the parameter cache
-    update(logE, theta);
+    const cache& pars = update(logE, theta);
 
     // Select in which Gaussian we are
-    double sigma = m_sigma1;
-    double sum1  = m_sigma1;
-    double sum2  = m_sigma2 * m_norm2;
-    double sum3  = m_sigma3 * m_norm3;
+    double sigma = pars.sigma1;
+    double sum1  = pars.sigma1;
+    double sum2  = pars.sigma2 * pars.norm2;
+    double sum3  = pars.sigma3 * pars.norm3;
     double sum   = sum1 + sum2 + sum3;
     double u     = ran.uniform() * sum;
     if (u >= sum2) {
-        sigma = m_sigma3;
+        sigma = pars.sigma3;
     }
     else if (u >= sum1) {
-        sigma = m_sigma2;
+        sigma = pars.sigma2;
     }
 
     // Now draw from the selected Gaussian
@@ -366,12 +369,12 @@ double GCTAPsf2D::delta_max(const double& logE,
                             const bool&   etrue) const
 {
     // Update the parameter cache
-    update(logE, theta);
+    const cache& pars = update(logE, theta);
 
     // Compute maximum sigma
-    double sigma = m_sigma1;
-    if (m_sigma2 > sigma) sigma = m_sigma2;
-    if (m_sigma3 > sigma) sigma = m_sigma3;
+    double sigma = pars.sigma1;
+    if (pars.sigma2 > sigma) sigma = pars.sigma2;
+    if (pars.sigma3 > sigma) sigma = pars.sigma3;
 
     // Compute maximum PSF radius
     double radius = 5.0 * sigma;
@@ -409,6 +412,40 @@ std::string GCTAPsf2D::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return Gaussian components of point spread function
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @param[out] amplitude Array of at least 3 component amplitudes (sr^-1).
+ * @param[out] width Array of at least 3 component widths (rad^-2).
+ * @return Number of Gaussian components (always 3).
+ *
+ * Returns the amplitudes and widths of the three Gaussians that describe
+ * the point spread function. Components with a vanishing normalization
+ * have an amplitude of zero.
+ ***************************************************************************/
+int GCTAPsf2D::gaussians(const double& logE,
+                         const double& theta,
+                         double*       amplitude,
+                         double*       width) const
+{
+    // Update the parameter cache
+    const cache& pars = update(logE, theta);
+
+    // Set Gaussian components
+    amplitude[0] = pars.norm;
+    amplitude[1] = pars.norm * pars.norm2;
+    amplitude[2] = pars.norm * pars.norm3;
+    width[0]     = pars.width1;
+    width[1]     = pars.width2;
+    width[2]     = pars.width3;
+
+    // Return number of components
+    return 3;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Private methods                              =
@@ -423,17 +460,7 @@ void GCTAPsf2D::init_members(void)
     // Initialise members
     m_filename.clear();
     m_psf.clear();
-    m_par_logE  = -1.0e30;
-    m_par_theta = -1.0;
-    m_norm      = 1.0;
-    m_norm2     = 0.0;
-    m_norm3     = 0.0;
-    m_sigma1    = 0.0;
-    m_sigma2    = 0.0;
-    m_sigma3    = 0.0;
-    m_width1    = 0.0;
-    m_width2    = 0.0;
-    m_width3    = 0.0;
+    m_id = new_id();
 
     // Return
     return;
@@ -448,19 +475,9 @@ void GCTAPsf2D::init_members(void)
 void GCTAPsf2D::copy_members(const GCTAPsf2D& psf)
 {
     // Copy members
-    m_filename  = psf.m_filename;
-    m_psf       = psf.m_psf;
-    m_par_logE  = psf.m_par_logE;
-    m_par_theta = psf.m_par_theta;
-    m_norm      = psf.m_norm;
-    m_norm2     = psf.m_norm2;
-    m_norm3     = psf.m_norm3;
-    m_sigma1    = psf.m_sigma1;
-    m_sigma2    = psf.m_sigma2;
-    m_sigma3    = psf.m_sigma3;
-    m_width1    = psf.m_width1;
-    m_width2    = psf.m_width2;
-    m_width3    = psf.m_width3;
+    m_filename = psf.m_filename;
+    m_psf      = psf.m_psf;
+    m_id       = psf.m_id;
 
     // Return
     return;
@@ -482,65 +499,107 @@ void GCTAPsf2D::free_members(void)
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
  * @param[in] theta Offset angle in camera system (rad).
+ * @return PSF parameters.
  *
- * This method updates the PSF parameter cache.
+ * This method updates the PSF parameter cache of the calling thread and
+ * returns the PSF parameters. The cache is thread-private, so that the
+ * PSF can be evaluated concurrently by any number of threads. The cache
+ * holds the parameters of the PSF that was last evaluated by the thread,
+ * which is identified by the PSF identifier.
  ***************************************************************************/
-void GCTAPsf2D::update(const double& logE, const double& theta) const
+const GCTAPsf2D::cache& GCTAPsf2D::update(const double& logE,
+                                          const double& theta) const
 {
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE || theta != m_par_theta) {
+    // Thread-private parameter cache
+    static cache pars_cache = {0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+                               0.0, 0.0, 0.0};
+    #pragma omp threadprivate(pars_cache)
+
+    // Get cache of calling thread
+    cache* pars = &pars_cache;
+
+    // Only compute PSF parameters if PSF or arguments have changed
+    if (m_id != pars->id || logE != pars->logE || theta != pars->theta) {
 
         // Save parameters
-        m_par_logE  = logE;
-        m_par_theta = theta;
+        pars->id    = m_id;
+        pars->logE  = logE;
+        pars->theta = theta;
 
         // Interpolate response parameters
-        std::vector<double> pars = m_psf(logE, theta);
+        std::vector<double> table = m_psf(logE, theta);
 
         // Set Gaussian sigmas
-        m_sigma1 = pars[1];
-        m_sigma2 = pars[3];
-        m_sigma3 = pars[5];
+        pars->sigma1 = table[1];
+        pars->sigma2 = table[3];
+        pars->sigma3 = table[5];
 
         // Set width parameters
-        double sigma1 = m_sigma1 * m_sigma1;
-        double sigma2 = m_sigma2 * m_sigma2;
-        double sigma3 = m_sigma3 * m_sigma3;
+        double sigma1 = pars->sigma1 * pars->sigma1;
+        double sigma2 = pars->sigma2 * pars->sigma2;
+        double sigma3 = pars->sigma3 * pars->sigma3;
 
         // Compute Gaussian 1
         if (sigma1 > 0.0) {
-            m_width1 = -0.5 / sigma1;
+            pars->width1 = -0.5 / sigma1;
         }
         else {
-            m_width1 = 0.0;
+            pars->width1 = 0.0;
         }
 
         // Compute Gaussian 2
         if (sigma2 > 0.0) {
-            m_width2 = -0.5 / sigma2;
-            m_norm2  = pars[2];
+            pars->width2 = -0.5 / sigma2;
+            pars->norm2  = table[2];
         }
         else {
-            m_width2 = 0.0;
-            m_norm2  = 0.0;
+            pars->width2 = 0.0;
+            pars->norm2  = 0.0;
         }
 
         // Compute Gaussian 3
         if (sigma3 > 0.0) {
-            m_width3 = -0.5 / sigma3;
-            m_norm3  = pars[4];
+            pars->width3 = -0.5 / sigma3;
+            pars->norm3  = table[4];
         }
         else {
-            m_width3 = 0.0;
-            m_norm3  = 0.0;
+            pars->width3 = 0.0;
+            pars->norm3  = 0.0;
         }
 
         // Compute global normalization parameter
-        double integral = gammalib::twopi * (sigma1 + sigma2*m_norm2 + sigma3*m_norm3);
-        m_norm = (integral > 0.0) ? 1.0 / integral : 0.0;
+        double integral = gammalib::twopi *
+                          (sigma1 + sigma2*pars->norm2 + sigma3*pars->norm3);
+        pars->norm = (integral > 0.0) ? 1.0 / integral : 0.0;
 
     }
 
-    // Return
-    return;
+    // Return parameters
+    return *pars;
+}
+
+
+/***********************************************************************//**
+ * @brief Return new PSF identifier
+ *
+ * @return Unique PSF identifier (>0).
+ *
+ * Returns a PSF identifier that has not been used before. The identifier
+ * is used to check whether the thread-private parameter cache holds the
+ * parameters of a given PSF.
+ ***************************************************************************/
+unsigned long GCTAPsf2D::new_id(void)
+{
+    // Identifier counter
+    static unsigned long last_id = 0;
+
+    // Get new identifier
+    unsigned long id;
+    #pragma omp critical(GCTAPsf2D_new_id)
+    {
+        id = ++last_id;
+    }
+
+    // Return identifier
+    return id;
 }
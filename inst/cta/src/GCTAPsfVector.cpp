@@ -178,11 +178,17 @@ double GCTAPsfVector::operator()(const double& delta,
                                  const double& azimuth,
                                  const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Determine Gaussian sigma in radians. The interpolation does not
+    // make use of any cache so that the PSF can be evaluated concurrently
+    double sigma = m_logE.interpolate(logE, m_sigma);
+
+    // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
+    double sigma2 = sigma * sigma;
+    double scale  =  1.0 / (gammalib::twopi * sigma2);
+    double width  = -0.5 / sigma2;
 
     // Compute PSF value
-    double psf = m_par_scale * std::exp(m_par_width * delta * delta);
+    double psf = scale * std::exp(width * delta * delta);
     
     // Return PSF
     return psf;
@@ -381,11 +387,11 @@ double GCTAPsfVector::mc(GRan&         ran,
                          const double& azimuth,
                          const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Determine Gaussian sigma in radians
+    double sigma = m_logE.interpolate(logE, m_sigma);
 
     // Draw offset
-    double delta = m_par_sigma * ran.chisq2();
+    double delta = sigma * ran.chisq2();
     
     // Return PSF offset
     return delta;
@@ -413,11 +419,11 @@ double GCTAPsfVector::delta_max(const double& logE,
                                    const double& azimuth,
                                    const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Determine Gaussian sigma in radians
+    double sigma = m_logE.interpolate(logE, m_sigma);
 
     // Compute maximum PSF radius
-    double radius = 5.0 * m_par_sigma;
+    double radius = 5.0 * sigma;
     
     // Return maximum PSF radius
     return radius;
@@ -460,6 +466,36 @@ std::string GCTAPsfVector::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return Gaussian components of point spread function
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad). Not used.
+ * @param[out] amplitude Array of at least 3 component amplitudes (sr^-1).
+ * @param[out] width Array of at least 3 component widths (rad^-2).
+ * @return Number of Gaussian components (always 1).
+ *
+ * Returns the amplitude and width of the single Gaussian that describes
+ * the point spread function.
+ ***************************************************************************/
+int GCTAPsfVector::gaussians(const double& logE,
+                             const double&,
+                             double*       amplitude,
+                             double*       width) const
+{
+    // Determine Gaussian sigma in radians
+    double sigma = m_logE.interpolate(logE, m_sigma);
+
+    // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
+    double sigma2 = sigma * sigma;
+    amplitude[0]  =  1.0 / (gammalib::twopi * sigma2);
+    width[0]      = -0.5 / sigma2;
+
+    // Return number of components
+    return 1;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Private methods                              =
@@ -476,10 +512,6 @@ void GCTAPsfVector::init_members(void)
     m_logE.clear();
     m_r68.clear();
     m_sigma.clear();
-    m_par_logE  = -1.0e30;
-    m_par_scale = 1.0;
-    m_par_sigma = 0.0;
-    m_par_width = 0.0;
 
     // Return
     return;
@@ -498,10 +530,6 @@ void GCTAPsfVector::copy_members(const GCTAPsfVector& psf)
     m_logE      = psf.m_logE;
     m_r68       = psf.m_r68;
     m_sigma     = psf.m_sigma;
-    m_par_logE  = psf.m_par_logE;
-    m_par_scale = psf.m_par_scale;
-    m_par_sigma = psf.m_par_sigma;
-    m_par_width = psf.m_par_width;
 
     // Return
     return;
@@ -516,35 +544,3 @@ void GCTAPsfVector::free_members(void)
     // Return
     return;
 }
-
-
-/***********************************************************************//**
- * @brief Update PSF parameter cache
- *
- * @param[in] logE Log10 of the true photon energy (TeV).
- *
- * This method updates the PSF parameter cache. As the performance table PSF
- * only depends on energy, the only parameter on which the cache values
- * depend is the energy.
- ***************************************************************************/
-void GCTAPsfVector::update(const double& logE) const
-{
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE) {
-
-        // Save energy
-        m_par_logE = logE;
-    
-        // Determine Gaussian sigma in radians
-        m_par_sigma = m_logE.interpolate(logE, m_sigma);
-
-        // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
-        double sigma2 = m_par_sigma * m_par_sigma;
-        m_par_scale   =  1.0 / (gammalib::twopi * sigma2);
-        m_par_width   = -0.5 / sigma2;
-
-    }
-
-    // Return
-    return;
-}
@@ -31,6 +31,9 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "GFits.hpp"
 #include "GTools.hpp"
 #include "GMath.hpp"
@@ -74,12 +77,24 @@
 #define G_NPRED_DIFFUSE               "GCTAResponse::npred_diffuse(GSource&,"\
                                                             " GObservation&)"
 #define G_READ           "GCTAResponse::read_performance_table(std::string&)"
+#define G_INTEGRATOR                 "GCTAResponse::integrator(std::string&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
 #define G_USE_IRF_CACHE            //!< Use IRF cache in irf_diffuse method
 #define G_USE_NPRED_CACHE      //!< Use Npred cache in npred_diffuse method
+#define G_NPRED_CACHE_MAX_SIZE 100000  //!< Default max. Npred cache entries
+#define G_NPRED_CACHE_MEMO 16          //!< Thread-private handle table size
+#define G_NPRED_CACHE_STRIPES 64       //!< Number of Npred cache lock stripes
+#define G_NPRED_CACHE_WAYS 4           //!< Npred cache entries per set
+#define G_NPRED_CACHE_LOGE 1.0e-9      //!< Npred cache ln(energy) quantum
+#define G_NPRED_CACHE_TIME 1.0e-6      //!< Npred cache time quantum (s)
+#define G_GRID_LOGE_MIN         -2.0  //!< First compiled energy node (log10 TeV)
+#define G_GRID_LOGE_MAX          3.0  //!< Last compiled energy node (log10 TeV)
+#define G_GRID_NLOGE             251  //!< Number of compiled energy nodes
+#define G_GRID_THETA_MAX        10.0  //!< Last compiled offset node (deg)
+#define G_GRID_NTHETA            201  //!< Number of compiled offset nodes
 
 /* __ Debug definitions __________________________________________________ */
 //#define G_DEBUG_READ_ARF                         //!< Debug read_arf method
@@ -321,42 +336,48 @@ double GCTAResponse::irf(const GEvent&       event,
     // Get log10(E/TeV) of true photon energy.
     double srcLogEng = srcEng.log10TeV();
 
+    // Get contiguous event arrays of event list
+    int                  index = 0;
+    const GCTAEventList* list  = event_arrays(event, obs, &index);
+
     // Determine angular separation between true and measured photon
     // direction in radians
-    double delta = obsDir.dist(srcDir);
-
-    // Get maximum angular separation for which PSF is significant
-    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
+    double delta = (list != NULL) ? event_dist(*list, index, srcDir.celvector())
+                                  : obsDir.dist(srcDir);
 
     // Initialise IRF value
     double irf = 0.0;
 
-    // Compute only if we're sufficiently close to PSF
-    if (delta <= delta_max) {
+    // If the compiled response covers the photon then evaluate the product
+    // of effective area and PSF in one step from the response grid
+    if (m_compiled && m_grid.contains(srcLogEng, theta)) {
+        irf = m_grid.irf(delta, srcLogEng, theta);
+    }
+
+    // ... otherwise compute only if we're sufficiently close to PSF
+    else if (delta <= psf_delta_max(theta, phi, zenith, azimuth, srcLogEng)) {
 
         // Get effective area component
         irf = aeff(theta, phi, zenith, azimuth, srcLogEng);
 
         // Multiply-in PSF
         if (irf > 0) {
-
-            // Get PSF component
             irf *= psf(delta, theta, phi, zenith, azimuth, srcLogEng);
+        }
 
-            // Multiply-in energy dispersion
-            if (hasedisp() && irf > 0) {
-
-                // Get log10(E/TeV) of measured photon energy.
-                double obsLogEng = obsEng.log10TeV();
+    } // endif: we were sufficiently close to PSF
 
-                // Multiply-in energy dispersion
-                irf *= edisp(obsLogEng, theta, phi, zenith, azimuth, srcLogEng);
+    // Multiply-in energy dispersion
+    if (hasedisp() && irf > 0) {
 
-            } // endif: energy dispersion was available and PSF was non-zero
+        // Get log10(E/TeV) of measured photon energy.
+        double obsLogEng = (list != NULL) ? list->logE()[index]
+                                          : obsEng.log10TeV();
 
-        } // endif: Aeff was non-zero
+        // Multiply-in energy dispersion
+        irf *= edisp(obsLogEng, theta, phi, zenith, azimuth, srcLogEng);
 
-    } // endif: we were sufficiently close to PSF
+    } // endif: energy dispersion was available and IRF was non-zero
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
@@ -578,14 +599,16 @@ void GCTAResponse::caldb(const std::string& caldb)
  ***************************************************************************/
 void GCTAResponse::load(const std::string& irfname)
 {
-    // Save calibration database name
-    std::string caldb = m_caldb;
+    // Save calibration database name and compilation flag
+    std::string caldb    = m_caldb;
+    bool        compiled = m_compiled;
 
     // Clear instance
     clear();
 
-    // Restore calibration database name
-    m_caldb = caldb;
+    // Restore calibration database name and compilation flag
+    m_caldb    = caldb;
+    m_compiled = compiled;
 
     // Build filename
     std::string filename = m_caldb + "/" + irfname + ".dat";
@@ -668,6 +691,9 @@ void GCTAResponse::load_aeff(const std::string& filename)
         m_aeff = new GCTAAeffPerfTable(filename);
     }
 
+    // Update compiled response
+    compile();
+
     // Return
     return;
 }
@@ -731,6 +757,9 @@ void GCTAResponse::load_psf(const std::string& filename)
         m_psf = new GCTAPsfPerfTable(filename);
     }
 
+    // Update compiled response
+    compile();
+
     // Return
     return;
 }
@@ -744,7 +773,7 @@ void GCTAResponse::load_psf(const std::string& filename)
  * Set the offset angle dependence for 1D effective area functions. The
  * method set the sigma value in case that the effective area function
  * is of type GCTAAeffArf or GCTAAeffPerfTable. Otherwise, nothing will
- * be done.
+ * be done. A compiled response is updated.
  ***************************************************************************/
 void GCTAResponse::offset_sigma(const double& sigma)
 {
@@ -760,6 +789,9 @@ void GCTAResponse::offset_sigma(const double& sigma)
         prf->sigma(sigma);
     }
 
+    // Update compiled response
+    compile();
+
     // Return
     return;
 }
@@ -797,6 +829,240 @@ double GCTAResponse::offset_sigma(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set effective area
+ *
+ * @param[in] aeff Effective area.
+ *
+ * Sets the effective area. The response takes ownership of the effective
+ * area. A compiled response is updated.
+ ***************************************************************************/
+void GCTAResponse::aeff(GCTAAeff* aeff)
+{
+    // Set effective area
+    m_aeff = aeff;
+
+    // Update compiled response
+    compile();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set point spread function
+ *
+ * @param[in] psf Point spread function.
+ *
+ * Sets the point spread function. The response takes ownership of the
+ * point spread function. A compiled response is updated.
+ ***************************************************************************/
+void GCTAResponse::psf(GCTAPsf* psf)
+{
+    // Set point spread function
+    m_psf = psf;
+
+    // Update compiled response
+    compile();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Switch compiled response on or off
+ *
+ * @param[in] compiled Use compiled response?
+ *
+ * In compiled mode, the effective area and the Gaussian components of the
+ * point spread function are tabulated on a regular grid in log10 of the
+ * true energy and offset angle (see GCTAResponseGrid) each time the
+ * response is loaded or modified. The response is then evaluated from
+ * this grid without any memory allocation. Arguments outside the grid, or
+ * point spread functions without a Gaussian decomposition, are evaluated
+ * from the original response.
+ ***************************************************************************/
+void GCTAResponse::compiled(const bool& compiled)
+{
+    // Set flag
+    m_compiled = compiled;
+
+    // Update compiled response
+    compile();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set numerical integration method
+ *
+ * @param[in] integrator Integration method (ROMBERG or GAUSS-KRONROD).
+ *
+ * @exception GException::invalid_argument
+ *            Invalid integration method.
+ *
+ * Selects the method that is used for the numerical integrations of the
+ * response over extended and diffuse source models and over the region of
+ * interest. Romberg integration is used by default. Adaptive Gauss-Kronrod
+ * integration generally requires substantially fewer kernel evaluations
+ * for the same precision, and handles small integration intervals.
+ ***************************************************************************/
+void GCTAResponse::integrator(const std::string& integrator)
+{
+    // Convert argument to upper case
+    std::string uintegrator = gammalib::toupper(integrator);
+
+    // Set integration method
+    if (uintegrator == "ROMBERG") {
+        m_integrator = 0;
+    }
+    else if (uintegrator == "GAUSS-KRONROD") {
+        m_integrator = 1;
+    }
+    else {
+        throw GException::invalid_argument(G_INTEGRATOR, integrator,
+              "Integration method must be ROMBERG or GAUSS-KRONROD.");
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return numerical integration method
+ *
+ * @return Integration method (ROMBERG or GAUSS-KRONROD).
+ ***************************************************************************/
+std::string GCTAResponse::integrator(void) const
+{
+    // Return integration method
+    return (m_integrator == 1) ? "GAUSS-KRONROD" : "ROMBERG";
+}
+
+
+/***********************************************************************//**
+ * @brief Integrate kernel using the selected integration method
+ *
+ * @param[in] integral Integral (kernel and precision already set).
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @return Integral of the kernel from a to b.
+ *
+ * This method is used by the response and its integration kernels for all
+ * numerical integrations, so that the integration method set using
+ * integrator() applies to all nesting levels.
+ ***************************************************************************/
+double GCTAResponse::integrate(GIntegral&    integral,
+                               const double& a,
+                               const double& b) const
+{
+    // Integrate using the selected method
+    double result = (m_integrator == 1) ? integral.gauss_kronrod(a, b)
+                                        : integral.romb(a, b);
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Return number of values in Npred cache
+ *
+ * @return Number of values in Npred cache.
+ ***************************************************************************/
+int GCTAResponse::npred_cache_size(void) const
+{
+    // Initialise size
+    int size = 0;
+
+    // Count entries of all stripes
+    int nstripes = m_npred_stripes.size();
+    for (int s = 0; s < nstripes; ++s) {
+        npred_cache_lock(s);
+        const std::vector<npred_entry>& entries = m_npred_stripes[s].entries;
+        int nentries = entries.size();
+        for (int i = 0; i < nentries; ++i) {
+            if (entries[i].key.source >= 0) {
+                size++;
+            }
+        }
+        npred_cache_unlock(s);
+    }
+
+    // Return size
+    return size;
+}
+
+
+/***********************************************************************//**
+ * @brief Set maximum number of values in Npred cache
+ *
+ * @param[in] size Maximum number of values in Npred cache.
+ *
+ * Sets the maximum number of values that are held in the Npred cache.
+ * Setting the maximum to 0 disables caching. The cache is flushed. The
+ * method should not be called from within a parallel region.
+ ***************************************************************************/
+void GCTAResponse::npred_cache_max_size(const int& size)
+{
+    // Set maximum size
+    m_npred_max_size = (size > 0) ? size : 0;
+
+    // Reallocate cache
+    npred_cache_alloc();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return number of Npred cache hits
+ *
+ * @return Number of Npred cache hits.
+ ***************************************************************************/
+unsigned long GCTAResponse::npred_cache_hits(void) const
+{
+    // Sum hits of all stripes
+    unsigned long hits     = 0;
+    int           nstripes = m_npred_stripes.size();
+    for (int s = 0; s < nstripes; ++s) {
+        npred_cache_lock(s);
+        hits += m_npred_stripes[s].hits;
+        npred_cache_unlock(s);
+    }
+
+    // Return hits
+    return hits;
+}
+
+
+/***********************************************************************//**
+ * @brief Return number of Npred cache misses
+ *
+ * @return Number of Npred cache misses.
+ ***************************************************************************/
+unsigned long GCTAResponse::npred_cache_misses(void) const
+{
+    // Sum misses of all stripes
+    unsigned long misses   = 0;
+    int           nstripes = m_npred_stripes.size();
+    for (int s = 0; s < nstripes; ++s) {
+        npred_cache_lock(s);
+        misses += m_npred_stripes[s].misses;
+        npred_cache_unlock(s);
+    }
+
+    // Return misses
+    return misses;
+}
+
+
 /***********************************************************************//**
  * @brief Print CTA response information
  *
@@ -818,6 +1084,8 @@ std::string GCTAResponse::print(const GChatter& chatter) const
         result.append("\n"+gammalib::parformat("Calibration database")+m_caldb);
         result.append("\n"+gammalib::parformat("Response name")+m_rspname);
         result.append("\n"+gammalib::parformat("RMF file name")+m_rmffile);
+        result.append("\n"+gammalib::parformat("Integration method"));
+        result.append(integrator());
 
         // Append effective area information
         if (m_aeff != NULL) {
@@ -829,17 +1097,58 @@ std::string GCTAResponse::print(const GChatter& chatter) const
             result.append("\n"+m_psf->print(chatter));
         }
 
+        // Append compiled response information
+        if (m_compiled && m_grid.size() > 0) {
+            result.append("\n"+m_grid.print(chatter));
+        }
+
         // EXPLICIT: Append Npred cache information
         if (chatter >= EXPLICIT) {
-            if (!m_npred_names.empty()) {
-                for (int i = 0; i < m_npred_names.size(); ++i) {
-                    result.append("\n"+gammalib::parformat("Npred cache " +
-                                  gammalib::str(i)));
-                    result.append(m_npred_names[i]+", ");
-                    result.append(m_npred_energies[i].print()+", ");
-                    result.append(m_npred_times[i].print()+" = ");
-                    result.append(gammalib::str(m_npred_values[i]));
+            result.append("\n"+gammalib::parformat("Npred cache"));
+
+            // Copy cache entries stripe by stripe as other threads may
+            // modify the cache
+            std::vector<npred_entry> values;
+            std::vector<npred_id>    ids;
+            unsigned long            hits     = 0;
+            unsigned long            misses   = 0;
+            int                      nstripes = m_npred_stripes.size();
+            for (int s = 0; s < nstripes; ++s) {
+                npred_cache_lock(s);
+                const npred_stripe& stripe = m_npred_stripes[s];
+                int nentries = stripe.entries.size();
+                for (int k = 0; k < nentries; ++k) {
+                    if (stripe.entries[k].key.source >= 0) {
+                        values.push_back(stripe.entries[k]);
+                    }
                 }
+                hits   += stripe.hits;
+                misses += stripe.misses;
+                npred_cache_unlock(s);
+            }
+            #pragma omp critical(GCTAResponse_npred_cache)
+            {
+                ids = m_npred_ids;
+            }
+
+            // Append cache
+            int nvalues = values.size();
+            result.append(gammalib::str(nvalues)+" values (");
+            result.append(gammalib::str(int(hits))+" hits, ");
+            result.append(gammalib::str(int(misses))+" misses)");
+            for (int i = 0; i < nvalues; ++i) {
+                GEnergy energy;
+                GTime   time;
+                energy.MeV(std::exp(double(values[i].key.energy) *
+                                    G_NPRED_CACHE_LOGE));
+                time.secs(double(values[i].key.time) * G_NPRED_CACHE_TIME);
+                const npred_id& id = ids[values[i].key.source];
+                result.append("\n"+gammalib::parformat("Npred cache " +
+                              gammalib::str(i)));
+                result.append(id.first+"::"+id.second+", ");
+                result.append(energy.print()+", ");
+                result.append(time.print()+" = ");
+                result.append(gammalib::str(values[i].value));
             }
         } // endif: chatter was explicit
 
@@ -950,13 +1259,19 @@ double GCTAResponse::irf_radial(const GEvent&       event,
     double zenith  = pnt->zenith();
     double azimuth = pnt->azimuth();
 
+    // Get contiguous event arrays of event list
+    int                  index = 0;
+    const GCTAEventList* list  = event_arrays(event, obs, &index);
+
     // Determine angular distance between measured photon direction and model
     // centre [radians]
-    double zeta = centre.dist(dir->dir());
+    double zeta = (list != NULL) ? event_dist(*list, index, centre.celvector())
+                                 : centre.dist(dir->dir());
 
     // Determine angular distance between measured photon direction and
     // pointing direction [radians]
-    double eta = pnt->dir().dist(dir->dir());
+    double eta = (list != NULL) ? event_dist(*list, index, pnt->dir().celvector())
+                                : pnt->dir().dist(dir->dir());
 
     // Determine angular distance between model centre and pointing direction
     // [radians]
@@ -973,7 +1288,8 @@ double GCTAResponse::irf_radial(const GEvent&       event,
 
     // Get log10(E/TeV) of true and measured photon energies
     double srcLogEng = srcEng.log10TeV();
-    double obsLogEng = obsEng.log10TeV();
+    double obsLogEng = (list != NULL) ? list->logE()[index]
+                                      : obsEng.log10TeV();
 
     // Assign the observed theta angle (eta) as the true theta angle
     // between the source and the pointing directions. This is a (not
@@ -1019,7 +1335,7 @@ double GCTAResponse::irf_radial(const GEvent&       event,
         // Integrate over zenith angle
         GIntegral integral(&integrand);
         integral.eps(m_eps);
-        irf = integral.romb(rho_min, rho_max);
+        irf = integrate(integral, rho_min, rho_max);
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -1131,15 +1447,21 @@ double GCTAResponse::irf_elliptical(const GEvent&       event,
     double zenith  = pnt->zenith();
     double azimuth = pnt->azimuth();
 
+    // Get contiguous event arrays of event list
+    int                  index = 0;
+    const GCTAEventList* list  = event_arrays(event, obs, &index);
+
     // Determine angular distance between observed photon direction and model
     // centre and position angle of observed photon direction seen from the
     // model centre [radians]
-    double zeta     = centre.dist(obsDir);
+    double zeta     = (list != NULL) ? event_dist(*list, index, centre.celvector())
+                                     : centre.dist(obsDir);
     double obsOmega = centre.posang(obsDir);
 
     // Determine angular distance between measured photon direction and
     // pointing direction [radians]
-    double eta = pnt->dir().dist(obsDir);
+    double eta = (list != NULL) ? event_dist(*list, index, pnt->dir().celvector())
+                                : pnt->dir().dist(obsDir);
 
     // Determine angular distance between model centre and pointing direction
     // [radians]
@@ -1157,7 +1479,8 @@ double GCTAResponse::irf_elliptical(const GEvent&       event,
 
     // Get log10(E/TeV) of true and measured photon energies
     double srcLogEng = srcEng.log10TeV();
-    double obsLogEng = obsEng.log10TeV();
+    double obsLogEng = (list != NULL) ? list->logE()[index]
+                                      : obsEng.log10TeV();
 
     // Get maximum PSF radius [radians]. We assign here the measured theta
     // angle (eta) as the true theta angle between the source and the pointing
@@ -1201,7 +1524,7 @@ double GCTAResponse::irf_elliptical(const GEvent&       event,
         // Integrate over zenith angle
         GIntegral integral(&integrand);
         integral.eps(m_eps);
-        irf = integral.romb(rho_min, rho_max);
+        irf = integrate(integral, rho_min, rho_max);
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -1280,10 +1603,12 @@ double GCTAResponse::irf_diffuse(const GEvent&       event,
 
     // Try getting the IRF value from cache
     #if defined(G_USE_IRF_CACHE)
-    const GCTAEventList* list = dynamic_cast<const GCTAEventList*>(obs.events());
-    const GCTAEventAtom* atom = dynamic_cast<const GCTAEventAtom*>(&event);
+    const GCTAEventList* list   = dynamic_cast<const GCTAEventList*>(obs.events());
+    const GCTAEventAtom* atom   = dynamic_cast<const GCTAEventAtom*>(&event);
+    int                  handle = -1;
     if (list != NULL && atom != NULL) {
-        irf = list->irf_cache(source.name(), atom->index());
+        handle = list->irf_cache_handle(source);
+        irf    = (handle >= 0) ? list->irf_cache(handle, atom->index()) : -1.0;
         if (irf >= 0.0) {
             has_irf = true;
             #if defined(G_DEBUG_IRF_DIFFUSE)
@@ -1358,11 +1683,11 @@ double GCTAResponse::irf_diffuse(const GEvent&       event,
             // Compute rotation matrix to convert from coordinates (theta,phi)
             // in the reference frame of the observed arrival direction into
             // celestial coordinates
-            GMatrix ry;
-            GMatrix rz;
+            GMatrix3 ry;
+            GMatrix3 rz;
             ry.eulery(dir->dec_deg() - 90.0);
             rz.eulerz(-dir->ra_deg());
-            GMatrix rot = (ry * rz).transpose();
+            GMatrix3 rot = (ry * rz).transpose();
 
             // Setup integration kernel
             cta_irf_diffuse_kern_theta integrand(*this,
@@ -1381,7 +1706,7 @@ double GCTAResponse::irf_diffuse(const GEvent&       event,
             // Integrate over zenith angle
             GIntegral integral(&integrand);
             integral.eps(1.0e-4);
-            irf = integral.romb(0.0, delta_max);
+            irf = integrate(integral, 0.0, delta_max);
 
             // Compile option: Check for NaN/Inf
             #if defined(G_NAN_CHECK)
@@ -1397,8 +1722,8 @@ double GCTAResponse::irf_diffuse(const GEvent&       event,
 
         // Put IRF value in cache
         #if defined(G_USE_IRF_CACHE)
-        if (list != NULL && atom != NULL) {
-            list->irf_cache(source.name(), atom->index(), irf);
+        if (handle >= 0) {
+            list->irf_cache(handle, atom->index(), irf);
         }
         #endif
 
@@ -1544,11 +1869,11 @@ double GCTAResponse::npred_radial(const GSource& source,
 
         // Compute rotation matrix to convert from native model coordinates,
         // given by (rho,omega), into celestial coordinates.
-        GMatrix ry;
-        GMatrix rz;
+        GMatrix3 ry;
+        GMatrix3 rz;
         ry.eulery(model->dec() - 90.0);
         rz.eulerz(-model->ra());
-        GMatrix rot = (ry * rz).transpose();
+        GMatrix3 rot = (ry * rz).transpose();
 
         // Compute position angle of ROI centre with respect to model
         // centre (radians)
@@ -1567,7 +1892,7 @@ double GCTAResponse::npred_radial(const GSource& source,
 
         // Integrate over theta
         GIntegral integral(&integrand);
-        npred = integral.romb(rho_min, rho_max);
+        npred = integrate(integral, rho_min, rho_max);
 
         // Compile option: Show integration results
         #if defined(G_DEBUG_NPRED_RADIAL)
@@ -1722,11 +2047,11 @@ double GCTAResponse::npred_elliptical(const GSource& source,
 
         // Compute rotation matrix to convert from native model coordinates,
         // given by (rho,omega), into celestial coordinates.
-        GMatrix ry;
-        GMatrix rz;
+        GMatrix3 ry;
+        GMatrix3 rz;
         ry.eulery(model->dec() - 90.0);
         rz.eulerz(-model->ra());
-        GMatrix rot = (ry * rz).transpose();
+        GMatrix3 rot = (ry * rz).transpose();
 
         // Compute position angle of ROI centre with respect to model
         // centre (radians)
@@ -1745,7 +2070,7 @@ double GCTAResponse::npred_elliptical(const GSource& source,
 
         // Integrate over theta
         GIntegral integral(&integrand);
-        npred = integral.romb(rho_min, rho_max);
+        npred = integrate(integral, rho_min, rho_max);
 
         // Compile option: Show integration results
         #if defined(G_DEBUG_NPRED_ELLIPTICAL)
@@ -1828,31 +2153,17 @@ double GCTAResponse::npred_diffuse(const GSource& source,
     double npred     = 0.0;
     bool   has_npred = false;
 
-    // Build unique identifier
-    std::string id = source.name() + "::" + obs.id();
-
     // Check if Npred value is already in cache
     #if defined(G_USE_NPRED_CACHE)
-    if (!m_npred_names.empty()) {
-
-         // Search for unique identifier, and if found, recover Npred value
-         // and break
-         for (int i = 0; i < m_npred_names.size(); ++i) {
-             if (m_npred_names[i]    == id &&
-                 m_npred_energies[i] == source.energy() &&
-                 m_npred_times[i]    == source.time()) {
-                 npred = m_npred_values[i];
-                 has_npred = true;
-                 #if defined(G_DEBUG_NPRED_DIFFUSE)
-                 std::cout << "GCTAResponse::npred_diffuse:";
-                 std::cout << " cache=" << i;
-                 std::cout << " npred=" << npred << std::endl;
-                 #endif
-                 break;
-             }
-         }
-
-    } // endif: there were values in the Npred cache
+    npred_key key = npred_cache_key(source, obs);
+    has_npred     = npred_cache_get(key, &npred);
+    #if defined(G_DEBUG_NPRED_DIFFUSE)
+    if (has_npred) {
+        std::cout << "GCTAResponse::npred_diffuse:";
+        std::cout << " cache hit";
+        std::cout << " npred=" << npred << std::endl;
+    }
+    #endif
     #endif
 
     // Continue only if no Npred cache value was found
@@ -1915,11 +2226,11 @@ double GCTAResponse::npred_diffuse(const GSource& source,
 
             // Compute rotation matrix to convert from native ROI coordinates,
             // given by (theta,phi), into celestial coordinates.
-            GMatrix ry;
-            GMatrix rz;
+            GMatrix3 ry;
+            GMatrix3 rz;
             ry.eulery(events->roi().centre().dec_deg() - 90.0);
             rz.eulerz(-events->roi().centre().ra_deg());
-            GMatrix rot = (ry * rz).transpose();
+            GMatrix3 rot = (ry * rz).transpose();
 
             // Setup integration kernel
             cta_npred_diffuse_kern_theta integrand(*this,
@@ -1932,24 +2243,22 @@ double GCTAResponse::npred_diffuse(const GSource& source,
             // Integrate over theta
             GIntegral integral(&integrand);
             integral.eps(1.0e-4);
-            npred = integral.romb(0.0, roi_psf_radius);
+            npred = integrate(integral, 0.0, roi_psf_radius);
 
             // Compile option: Show integration results
             #if defined(G_DEBUG_NPRED_DIFFUSE)
             std::cout << "GCTAResponse::npred_diffuse:";
             std::cout << " roi_psf_radius=" << roi_psf_radius;
             std::cout << " npred=" << npred;
-            std::cout << " id=" << id << std::endl;
+            std::cout << " source=" << source.name() << std::endl;
             #endif
 
         } // endif: offset angle range was valid
 
-        // Store result in Npred cache
+        // Store result in Npred cache. If the set of the key is full, the
+        // oldest entry of the set is replaced.
         #if defined(G_USE_NPRED_CACHE)
-        m_npred_names.push_back(id);
-        m_npred_energies.push_back(source.energy());
-        m_npred_times.push_back(source.time());
-        m_npred_values.push_back(npred);
+        npred_cache_set(key, npred);
         #endif
 
         // Debug: Check for NaN
@@ -1988,6 +2297,7 @@ double GCTAResponse::npred_diffuse(const GSource& source,
  *
  * Returns the effective area as function of the true photon position in the
  * camera system and the telescope pointing direction in the Earth system.
+ * In compiled mode the effective area is taken from the response grid.
  *
  * If no effective area response is defined, 0.0 is returned.
  ***************************************************************************/
@@ -1998,7 +2308,9 @@ double GCTAResponse::aeff(const double& theta,
                           const double& srcLogEng) const
 {
     // Get effective area
-    double aeff = (m_aeff != NULL)
+    double aeff = (m_compiled && m_grid.contains(srcLogEng, theta))
+                  ? m_grid.aeff(srcLogEng, theta)
+                  : (m_aeff != NULL)
                   ? (*m_aeff)(srcLogEng, theta, phi, zenith, azimuth)
                   : 0.0;
 
@@ -2032,7 +2344,9 @@ double GCTAResponse::psf(const double& delta,
                          const double& srcLogEng) const
 {
     // Compute PSF
-    double psf = (m_psf != NULL)
+    double psf = (m_compiled && m_grid.contains(srcLogEng, theta))
+                 ? m_grid.psf(delta, srcLogEng, theta)
+                 : (m_psf != NULL)
                  ? (*m_psf)(delta, srcLogEng, theta, phi, zenith, azimuth)
                  : 0.0;
 
@@ -2064,7 +2378,9 @@ double GCTAResponse::psf_delta_max(const double& theta,
                                    const double& srcLogEng) const
 {
     // Compute PSF
-    double delta_max = (m_psf != NULL)
+    double delta_max = (m_compiled && m_grid.contains(srcLogEng, theta))
+                 ? m_grid.delta_max(srcLogEng, theta)
+                 : (m_psf != NULL)
                  ? m_psf->delta_max(srcLogEng, theta, phi, zenith, azimuth)
                  : 0.0;
 
@@ -2123,7 +2439,9 @@ double GCTAResponse::edisp(const double& obsLogEng,
  * is considered.
  *
  * @todo Enhance romb() integration method for small integration regions
- *       (see comment about kluge below)
+ *       (see comment about kluge below); the Gauss-Kronrod integrator
+ *       that can be selected using integrator() does not suffer from
+ *       this problem
  * @todo Implement phi dependence in camera system
  ***************************************************************************/
 double GCTAResponse::npsf(const GSkyDir&      srcDir,
@@ -2190,7 +2508,7 @@ double GCTAResponse::npsf(const GSkyDir&      srcDir,
                 value = integral.trapzd(rmin, rmax);
             }
             else {
-                value = integral.romb(rmin, rmax);
+                value = integrate(integral, rmin, rmax);
             }
 
             // Compile option: Check for NaN/Inf
@@ -2270,15 +2588,34 @@ void GCTAResponse::init_members(void)
     m_rspname.clear();
     m_rmffile.clear();
     m_eps   = 1.0e-5; // Precision for Romberg integration
+    m_integrator = 0;
     m_aeff  = NULL;
     m_psf   = NULL;
     m_edisp = NULL;
 
+    // Initialise compiled response
+    m_compiled = false;
+    m_grid.clear();
+
     // Initialise Npred cache
-    m_npred_names.clear();
-    m_npred_energies.clear();
-    m_npred_times.clear();
-    m_npred_values.clear();
+    m_npred_instance = npred_cache_instance();
+    m_npred_handles.clear();
+    m_npred_ids.clear();
+    m_npred_stripes.clear();
+    m_npred_locks    = NULL;
+    m_npred_max_size = G_NPRED_CACHE_MAX_SIZE;
+
+    // Allocate Npred cache locks
+    #ifdef _OPENMP
+    omp_lock_t* locks = new omp_lock_t[G_NPRED_CACHE_STRIPES];
+    for (int i = 0; i < G_NPRED_CACHE_STRIPES; ++i) {
+        omp_init_lock(&locks[i]);
+    }
+    m_npred_locks = locks;
+    #endif
+
+    // Allocate Npred cache stripes
+    npred_cache_alloc();
 
     // Return
     return;
@@ -2297,12 +2634,17 @@ void GCTAResponse::copy_members(const GCTAResponse& rsp)
     m_rspname = rsp.m_rspname;
     m_rmffile = rsp.m_rmffile;
     m_eps     = rsp.m_eps;
+    m_integrator = rsp.m_integrator;
+
+    // Copy compiled response
+    m_compiled = rsp.m_compiled;
+    m_grid     = rsp.m_grid;
 
-    // Copy cache
-    m_npred_names    = rsp.m_npred_names;
-    m_npred_energies = rsp.m_npred_energies;
-    m_npred_times    = rsp.m_npred_times;
-    m_npred_values   = rsp.m_npred_values;
+    // Copy cache (the locks are not copied)
+    m_npred_handles  = rsp.m_npred_handles;
+    m_npred_ids      = rsp.m_npred_ids;
+    m_npred_stripes  = rsp.m_npred_stripes;
+    m_npred_max_size = rsp.m_npred_max_size;
 
     // Clone members
     m_aeff  = (rsp.m_aeff  != NULL) ? rsp.m_aeff->clone()  : NULL;
@@ -2324,11 +2666,483 @@ void GCTAResponse::free_members(void)
     if (m_psf   != NULL) delete m_psf;
     if (m_edisp != NULL) delete m_edisp;
 
+    // Free Npred cache locks
+    #ifdef _OPENMP
+    if (m_npred_locks != NULL) {
+        omp_lock_t* locks = static_cast<omp_lock_t*>(m_npred_locks);
+        for (int i = 0; i < G_NPRED_CACHE_STRIPES; ++i) {
+            omp_destroy_lock(&locks[i]);
+        }
+        delete [] locks;
+    }
+    #endif
+
     // Initialise pointers
-    m_aeff  = NULL;
-    m_psf   = NULL;
-    m_edisp = NULL;
+    m_aeff        = NULL;
+    m_psf         = NULL;
+    m_edisp       = NULL;
+    m_npred_locks = NULL;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return Npred cache handle for source and observation
+ *
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @return Npred cache handle.
+ *
+ * Returns a handle that identifies the combination of source name and
+ * observation identifier in the Npred cache. A new handle is assigned if
+ * the combination is not yet known. Handles are never released, so that
+ * they remain valid if the cache is flushed.
+ *
+ * Resolved handles are kept in a thread-private table keyed on the spatial
+ * model and the observation, hence the handle map is only searched within
+ * the critical zone when a source is encountered for the first time. The
+ * table entry points to the identifier held by the handle map, which is
+ * compared to the source name and observation identifier in case that a
+ * model or observation has been replaced by another one at the same
+ * address. Map entries never move and are only removed when the response
+ * is cleared, which assigns a new cache instance that invalidates the
+ * table entries.
+ ***************************************************************************/
+int GCTAResponse::npred_cache_handle(const GSource&      source,
+                                     const GObservation& obs) const
+{
+    // Thread-private table of resolved handles
+    static npred_memo memo[G_NPRED_CACHE_MEMO];
+    static int        memo_next = 0;
+    #pragma omp threadprivate(memo, memo_next)
+
+    // Search handle in table
+    for (int i = 0; i < G_NPRED_CACHE_MEMO; ++i) {
+        if (memo[i].instance == m_npred_instance &&
+            memo[i].model    == source.model()   &&
+            memo[i].obs      == &obs             &&
+            memo[i].id->first  == source.name()  &&
+            memo[i].id->second == obs.id()) {
+            return memo[i].handle;
+        }
+    }
+
+    // Initialise handle and identifier
+    int             handle = -1;
+    const npred_id* id     = NULL;
+
+    // Search or assign handle within critical zone
+    #pragma omp critical(GCTAResponse_npred_cache)
+    {
+        npred_id key(source.name(), obs.id());
+        std::map<npred_id,int>::iterator it = m_npred_handles.find(key);
+        if (it == m_npred_handles.end()) {
+            it = m_npred_handles.insert(std::make_pair(key,
+                                        int(m_npred_ids.size()))).first;
+            m_npred_ids.push_back(key);
+        }
+        handle = it->second;
+        id     = &(it->first);
+    }
+
+    // Store handle in table
+    memo[memo_next].instance = m_npred_instance;
+    memo[memo_next].model    = source.model();
+    memo[memo_next].obs      = &obs;
+    memo[memo_next].id       = id;
+    memo[memo_next].handle   = handle;
+    memo_next                = (memo_next + 1) % G_NPRED_CACHE_MEMO;
+
+    // Return handle
+    return handle;
+}
+
+
+/***********************************************************************//**
+ * @brief Return new Npred cache instance identifier
+ *
+ * @return Unique Npred cache instance identifier (>0).
+ *
+ * Returns an identifier that has not been used before. The identifier is
+ * used to check whether entries of the thread-private handle table belong
+ * to a given Npred cache.
+ ***************************************************************************/
+unsigned long GCTAResponse::npred_cache_instance(void)
+{
+    // Identifier counter
+    static unsigned long last_instance = 0;
+
+    // Get new identifier
+    unsigned long instance;
+    #pragma omp critical(GCTAResponse_npred_cache_instance)
+    {
+        instance = ++last_instance;
+    }
+
+    // Return identifier
+    return instance;
+}
+
+
+/***********************************************************************//**
+ * @brief Return Npred cache key for source and observation
+ *
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @return Npred cache key.
+ *
+ * Returns the key under which the Npred value of a source is stored in the
+ * cache. The key combines the source handle with the natural logarithm of
+ * the energy and the time, both quantised to integers. The quanta are
+ * chosen well below the precision of the Npred computation, so that only
+ * energies and times that differ by rounding errors share a key.
+ ***************************************************************************/
+GCTAResponse::npred_key GCTAResponse::npred_cache_key(const GSource&      source,
+                                                      const GObservation& obs) const
+{
+    // Get energy
+    double energy = source.energy().MeV();
+
+    // Set key
+    npred_key key;
+    key.source = npred_cache_handle(source, obs);
+    key.energy = (energy > 0.0)
+                 ? (long long)(std::floor(std::log(energy) / G_NPRED_CACHE_LOGE + 0.5))
+                 : 0;
+    key.time   = (long long)(std::floor(source.time().secs() / G_NPRED_CACHE_TIME + 0.5));
+
+    // Return key
+    return key;
+}
+
+
+/***********************************************************************//**
+ * @brief Return Npred cache stripe and set for key
+ *
+ * @param[in] key Npred cache key.
+ * @param[out] set Set within stripe.
+ * @return Stripe index.
+ *
+ * Hashes the key and returns the index of the stripe and of the set within
+ * the stripe in which the key is stored.
+ ***************************************************************************/
+int GCTAResponse::npred_cache_stripe(const npred_key& key, int* set) const
+{
+    // Hash key
+    unsigned long long hash = (unsigned long long)(key.source);
+    hash = hash * 0x9e3779b97f4a7c15ULL + (unsigned long long)(key.energy);
+    hash = hash * 0x9e3779b97f4a7c15ULL + (unsigned long long)(key.time);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+
+    // Get stripe and set
+    unsigned long long nstripes = m_npred_stripes.size();
+    int                stripe   = int(hash % nstripes);
+    unsigned long long nsets    = m_npred_stripes[stripe].next.size();
+    *set = (nsets > 0) ? int((hash / nstripes) % nsets) : 0;
+
+    // Return stripe
+    return stripe;
+}
+
+
+/***********************************************************************//**
+ * @brief Get Npred value from cache
+ *
+ * @param[in] key Npred cache key.
+ * @param[out] value Npred value.
+ * @return True if the key was found in the cache.
+ *
+ * Searches the key in the set of the cache stripe that holds the key. Only
+ * the lock of that stripe is taken, and the hit and miss counters of the
+ * stripe are updated under the same lock.
+ ***************************************************************************/
+bool GCTAResponse::npred_cache_get(const npred_key& key, double* value) const
+{
+    // Initialise flag
+    bool found = false;
+
+    // Get stripe and set
+    int set    = 0;
+    int stripe = npred_cache_stripe(key, &set);
+
+    // Search key within stripe lock
+    npred_cache_lock(stripe);
+    npred_stripe& s = m_npred_stripes[stripe];
+    if (!s.entries.empty()) {
+        int first = set * G_NPRED_CACHE_WAYS;
+        int last  = first + G_NPRED_CACHE_WAYS;
+        if (last > s.size) {
+            last = s.size;
+        }
+        for (int i = first; i < last; ++i) {
+            if (s.entries[i].key == key) {
+                *value = s.entries[i].value;
+                found  = true;
+                break;
+            }
+        }
+    }
+    if (found) {
+        s.hits++;
+    }
+    else {
+        s.misses++;
+    }
+    npred_cache_unlock(stripe);
+
+    // Return flag
+    return found;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Npred value in cache
+ *
+ * @param[in] key Npred cache key.
+ * @param[in] value Npred value.
+ *
+ * Stores the Npred value in the set of the cache stripe that holds the key.
+ * If the set is full, the entry that was inserted first into the set is
+ * replaced. The entries of a stripe are allocated on first insertion.
+ ***************************************************************************/
+void GCTAResponse::npred_cache_set(const npred_key& key, const double& value) const
+{
+    // Get stripe and set
+    int set    = 0;
+    int stripe = npred_cache_stripe(key, &set);
+
+    // Store value within stripe lock
+    npred_cache_lock(stripe);
+    npred_stripe& s = m_npred_stripes[stripe];
+    if (s.size > 0) {
+
+        // Allocate entries on first insertion
+        if (s.entries.empty()) {
+            npred_entry empty;
+            empty.key.source = -1;
+            empty.key.energy = 0;
+            empty.key.time   = 0;
+            empty.value      = 0.0;
+            s.entries.assign(s.size, empty);
+        }
+
+        // Search key or free entry in set
+        int first = set * G_NPRED_CACHE_WAYS;
+        int last  = first + G_NPRED_CACHE_WAYS;
+        if (last > s.size) {
+            last = s.size;
+        }
+        int index = -1;
+        for (int i = first; i < last; ++i) {
+            if (s.entries[i].key.source < 0 || s.entries[i].key == key) {
+                index = i;
+                break;
+            }
+        }
+
+        // If the set is full then replace the oldest entry
+        if (index < 0) {
+            index       = first + s.next[set];
+            s.next[set] = (s.next[set] + 1) % (last - first);
+        }
+
+        // Store entry
+        s.entries[index].key   = key;
+        s.entries[index].value = value;
+
+    } // endif: stripe had entries
+    npred_cache_unlock(stripe);
 
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Allocate Npred cache stripes
+ *
+ * Distributes the maximum number of cache entries over the stripes and
+ * flushes the cache. The hit and miss counters are kept. The entries of
+ * a stripe are only allocated on first insertion. If the maximum number of
+ * entries is 0 a single empty stripe is allocated that counts the misses.
+ * The method should not be called from within a parallel region.
+ ***************************************************************************/
+void GCTAResponse::npred_cache_alloc(void)
+{
+    // Sum hit and miss counters
+    unsigned long hits   = 0;
+    unsigned long misses = 0;
+    for (int s = 0; s < int(m_npred_stripes.size()); ++s) {
+        hits   += m_npred_stripes[s].hits;
+        misses += m_npred_stripes[s].misses;
+    }
+
+    // Determine number of stripes
+    int nstripes = (m_npred_max_size < G_NPRED_CACHE_STRIPES)
+                   ? m_npred_max_size : G_NPRED_CACHE_STRIPES;
+    if (nstripes < 1) {
+        nstripes = 1;
+    }
+
+    // Allocate stripes
+    m_npred_stripes.assign(nstripes, npred_stripe());
+    for (int s = 0; s < nstripes; ++s) {
+        npred_stripe& stripe = m_npred_stripes[s];
+        stripe.size   = m_npred_max_size / nstripes +
+                        ((s < m_npred_max_size % nstripes) ? 1 : 0);
+        stripe.next.assign((stripe.size + G_NPRED_CACHE_WAYS - 1) /
+                           G_NPRED_CACHE_WAYS, 0);
+        stripe.hits   = 0;
+        stripe.misses = 0;
+    }
+
+    // Keep counters
+    m_npred_stripes[0].hits   = hits;
+    m_npred_stripes[0].misses = misses;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Lock Npred cache stripe
+ *
+ * @param[in] stripe Stripe index.
+ ***************************************************************************/
+void GCTAResponse::npred_cache_lock(const int& stripe) const
+{
+    // Set lock
+    #ifdef _OPENMP
+    omp_set_lock(&(static_cast<omp_lock_t*>(m_npred_locks)[stripe]));
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Unlock Npred cache stripe
+ *
+ * @param[in] stripe Stripe index.
+ ***************************************************************************/
+void GCTAResponse::npred_cache_unlock(const int& stripe) const
+{
+    // Unset lock
+    #ifdef _OPENMP
+    omp_unset_lock(&(static_cast<omp_lock_t*>(m_npred_locks)[stripe]));
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Update compiled response
+ *
+ * Tabulates the effective area and point spread function on the response
+ * grid if the response is in compiled mode, otherwise clears the grid. The
+ * grid is also cleared if no effective area or point spread function is
+ * defined, or if the point spread function has no Gaussian decomposition,
+ * so that the response is evaluated from the original functions.
+ ***************************************************************************/
+void GCTAResponse::compile(void)
+{
+    // Clear response grid
+    m_grid.clear();
+
+    // Tabulate response if required and possible
+    if (m_compiled && m_aeff != NULL && m_psf != NULL) {
+        double amplitude[3];
+        double width[3];
+        if (m_psf->gaussians(G_GRID_LOGE_MIN, 0.0, amplitude, width) > 0) {
+            m_grid.set(m_aeff, m_psf,
+                       G_GRID_LOGE_MIN, G_GRID_LOGE_MAX, G_GRID_NLOGE,
+                       G_GRID_THETA_MAX * gammalib::deg2rad, G_GRID_NTHETA);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return event list holding contiguous arrays for event
+ *
+ * @param[in] event Event.
+ * @param[in] obs Observation.
+ * @param[out] index Index of event in event list.
+ * @return Pointer to event list (NULL if no arrays are available).
+ *
+ * Returns a pointer to the event list of the observation if the event is
+ * an atom of this list and if the contiguous event arrays of the list are
+ * up to date. In that case the index of the event in the arrays is
+ * returned in @p index.
+ ***************************************************************************/
+const GCTAEventList* GCTAResponse::event_arrays(const GEvent&       event,
+                                                const GObservation& obs,
+                                                int*                index) const
+{
+    // Initialise result
+    const GCTAEventList* result = NULL;
+
+    // Get pointers on event list and event atom
+    const GCTAEventList* list = dynamic_cast<const GCTAEventList*>(obs.events());
+    const GCTAEventAtom* atom = dynamic_cast<const GCTAEventAtom*>(&event);
+
+    // Use event list if its arrays are up to date and if the event is an
+    // atom of the list
+    if (list != NULL && atom != NULL && list->hasarrays()) {
+        int i = atom->index();
+        if (i >= 0 && i < list->size() && (*list)[i] == atom) {
+            *index = i;
+            result = list;
+        }
+    }
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Return angular distance between event and direction
+ *
+ * @param[in] list Event list.
+ * @param[in] index Event index.
+ * @param[in] dir Celestial unit vector of direction.
+ * @return Angular distance (radians).
+ *
+ * Computes the angular distance from the chord between the celestial unit
+ * vectors using
+ *
+ * \f[
+ *    \delta = 2 \arcsin \left( \frac{|\vec{e} - \vec{d}|}{2} \right)
+ * \f]
+ *
+ * which, contrary to the arc cosine of the scalar product, is accurate
+ * for small distances.
+ ***************************************************************************/
+double GCTAResponse::event_dist(const GCTAEventList& list,
+                                const int&           index,
+                                const GVector3&      dir)
+{
+    // Compute half chord length
+    double dx    = list.dirx()[index] - dir[0];
+    double dy    = list.diry()[index] - dir[1];
+    double dz    = list.dirz()[index] - dir[2];
+    double chord = 0.5 * std::sqrt(dx*dx + dy*dy + dz*dz);
+    if (chord > 1.0) {
+        chord = 1.0;
+    }
+
+    // Return angular distance
+    return (2.0 * std::asin(chord));
+}
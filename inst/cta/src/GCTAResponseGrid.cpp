@@ -0,0 +1,630 @@
+/***************************************************************************
+ *          GCTAResponseGrid.cpp - CTA compiled response grid class         *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GCTAResponseGrid.cpp
+ * @brief CTA compiled response grid class implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <cmath>
+#include "GTools.hpp"
+#include "GMath.hpp"
+#include "GException.hpp"
+#include "GCTAResponseGrid.hpp"
+
+/* __ Method name definitions ____________________________________________ */
+#define G_SET            "GCTAResponseGrid::set(GCTAAeff*, GCTAPsf*, double&,"\
+                                              " double&, int&, double&, int&)"
+
+/* __ Macros _____________________________________________________________ */
+
+/* __ Coding definitions _________________________________________________ */
+
+/* __ Debug definitions __________________________________________________ */
+
+/* __ Constants __________________________________________________________ */
+const int g_node_size = 8;   //!< Number of values per grid node
+
+
+/*==========================================================================
+ =                                                                         =
+ =                        Constructors/destructors                         =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Void constructor
+ ***************************************************************************/
+GCTAResponseGrid::GCTAResponseGrid(void)
+{
+    // Initialise class members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy constructor
+ *
+ * @param[in] grid Response grid.
+ ***************************************************************************/
+GCTAResponseGrid::GCTAResponseGrid(const GCTAResponseGrid& grid)
+{
+    // Initialise class members
+    init_members();
+
+    // Copy members
+    copy_members(grid);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Response constructor
+ *
+ * @param[in] aeff Effective area.
+ * @param[in] psf Point spread function.
+ * @param[in] logE_min First energy node (log10 TeV).
+ * @param[in] logE_max Last energy node (log10 TeV).
+ * @param[in] nlogE Number of energy nodes.
+ * @param[in] theta_max Last offset angle node (rad).
+ * @param[in] ntheta Number of offset angle nodes.
+ *
+ * Constructs a response grid by tabulating the effective area and point
+ * spread function. See the set() method for details.
+ ***************************************************************************/
+GCTAResponseGrid::GCTAResponseGrid(const GCTAAeff* aeff, const GCTAPsf* psf,
+                                   const double& logE_min,
+                                   const double& logE_max,
+                                   const int&    nlogE,
+                                   const double& theta_max,
+                                   const int&    ntheta)
+{
+    // Initialise class members
+    init_members();
+
+    // Tabulate response
+    set(aeff, psf, logE_min, logE_max, nlogE, theta_max, ntheta);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Destructor
+ ***************************************************************************/
+GCTAResponseGrid::~GCTAResponseGrid(void)
+{
+    // Free members
+    free_members();
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                               Operators                                 =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Assignment operator
+ *
+ * @param[in] grid Response grid.
+ * @return Response grid.
+ ***************************************************************************/
+GCTAResponseGrid& GCTAResponseGrid::operator=(const GCTAResponseGrid& grid)
+{
+    // Execute only if object is not identical
+    if (this != &grid) {
+
+        // Free members
+        free_members();
+
+        // Initialise private members
+        init_members();
+
+        // Copy members
+        copy_members(grid);
+
+    } // endif: object was not identical
+
+    // Return this object
+    return *this;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Public methods                              =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Clear instance
+ *
+ * This method properly resets the object to an initial state.
+ ***************************************************************************/
+void GCTAResponseGrid::clear(void)
+{
+    // Free class members
+    free_members();
+
+    // Initialise members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clone instance
+ *
+ * @return Deep copy of response grid.
+ ***************************************************************************/
+GCTAResponseGrid* GCTAResponseGrid::clone(void) const
+{
+    return new GCTAResponseGrid(*this);
+}
+
+
+/***********************************************************************//**
+ * @brief Return number of grid nodes
+ *
+ * @return Number of grid nodes.
+ ***************************************************************************/
+int GCTAResponseGrid::size(void) const
+{
+    // Return number of nodes
+    return (m_nlogE * m_ntheta);
+}
+
+
+/***********************************************************************//**
+ * @brief Tabulate response on grid
+ *
+ * @param[in] aeff Effective area.
+ * @param[in] psf Point spread function.
+ * @param[in] logE_min First energy node (log10 TeV).
+ * @param[in] logE_max Last energy node (log10 TeV).
+ * @param[in] nlogE Number of energy nodes.
+ * @param[in] theta_max Last offset angle node (rad).
+ * @param[in] ntheta Number of offset angle nodes.
+ *
+ * @exception GException::invalid_argument
+ *            Invalid response or grid definition.
+ *
+ * Evaluates the effective area, the maximum PSF radius and the Gaussian
+ * components of the point spread function at all nodes of a regular grid
+ * in log10 of the true photon energy and offset angle. The offset angle
+ * axis starts at zero. Both axes need at least two nodes.
+ *
+ * The point spread function needs to provide a Gaussian decomposition
+ * through the GCTAPsf::gaussians() method.
+ ***************************************************************************/
+void GCTAResponseGrid::set(const GCTAAeff* aeff, const GCTAPsf* psf,
+                           const double& logE_min, const double& logE_max,
+                           const int&    nlogE,
+                           const double& theta_max, const int& ntheta)
+{
+    // Check arguments
+    if (aeff == NULL || psf == NULL) {
+        throw GException::invalid_argument(G_SET,
+              "Effective area and point spread function are required.");
+    }
+    if (nlogE < 2 || ntheta < 2) {
+        throw GException::invalid_argument(G_SET,
+              "At least two nodes are required for each grid axis.");
+    }
+    if (logE_max <= logE_min || theta_max <= 0.0) {
+        throw GException::invalid_argument(G_SET,
+              "Grid axes need to have a positive extent.");
+    }
+
+    // Check that point spread function has a Gaussian decomposition
+    double amplitude[3];
+    double width[3];
+    if (psf->gaussians(logE_min, 0.0, amplitude, width) < 1) {
+        throw GException::invalid_argument(G_SET,
+              "Point spread function has no Gaussian decomposition.");
+    }
+
+    // Clear grid
+    clear();
+
+    // Set grid axes
+    m_nlogE     = nlogE;
+    m_ntheta    = ntheta;
+    m_logE_min  = logE_min;
+    m_logE_max  = logE_max;
+    m_logE_bin  = (logE_max - logE_min) / double(nlogE - 1);
+    m_theta_max = theta_max;
+    m_theta_bin = theta_max / double(ntheta - 1);
+
+    // Allocate nodes
+    m_nodes.assign(size() * g_node_size, 0.0);
+
+    // Tabulate response
+    double* node = &(m_nodes[0]);
+    for (int i = 0; i < m_nlogE; ++i) {
+        double logE = m_logE_min + double(i) * m_logE_bin;
+        for (int k = 0; k < m_ntheta; ++k, node += g_node_size) {
+            double theta = double(k) * m_theta_bin;
+
+            // Set effective area and maximum PSF radius
+            node[0] = (*aeff)(logE, theta);
+            node[1] = psf->delta_max(logE, theta);
+
+            // Set Gaussian components. Unused components have a zero
+            // amplitude and width.
+            int ncomp = psf->gaussians(logE, theta, amplitude, width);
+            for (int m = 0; m < ncomp && m < 3; ++m) {
+                node[2+m] = amplitude[m];
+                node[5+m] = width[m];
+            }
+
+        } // endfor: looped over offset angles
+    } // endfor: looped over energies
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Check whether arguments are covered by grid
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return True if arguments are covered by grid.
+ ***************************************************************************/
+bool GCTAResponseGrid::contains(const double& logE, const double& theta) const
+{
+    // Return containment flag
+    return (size() > 0 &&
+            logE  >= m_logE_min && logE  <= m_logE_max &&
+            theta >= 0.0        && theta <= m_theta_max);
+}
+
+
+/***********************************************************************//**
+ * @brief Return effective area (in units of cm2)
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return Effective area (cm2).
+ ***************************************************************************/
+double GCTAResponseGrid::aeff(const double& logE, const double& theta) const
+{
+    // Interpolate node values
+    int    inx[4];
+    double wgt[4];
+    double values[g_node_size];
+    weights(logE, theta, inx, wgt);
+    interpolate(inx, wgt, values);
+
+    // Return effective area
+    return values[0];
+}
+
+
+/***********************************************************************//**
+ * @brief Return point spread function (in units of sr^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (rad).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return Point spread function (sr^-1).
+ ***************************************************************************/
+double GCTAResponseGrid::psf(const double& delta, const double& logE,
+                             const double& theta) const
+{
+    // Interpolate node values
+    int    inx[4];
+    double wgt[4];
+    double values[g_node_size];
+    weights(logE, theta, inx, wgt);
+    interpolate(inx, wgt, values);
+
+    // Compute point spread function
+    double delta2 = delta * delta;
+    double psf    = values[2] * std::exp(values[5] * delta2) +
+                    values[3] * std::exp(values[6] * delta2) +
+                    values[4] * std::exp(values[7] * delta2);
+
+    // Return point spread function
+    return psf;
+}
+
+
+/***********************************************************************//**
+ * @brief Return maximum size of PSF (radians)
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return Maximum PSF radius (rad).
+ ***************************************************************************/
+double GCTAResponseGrid::delta_max(const double& logE,
+                                   const double& theta) const
+{
+    // Interpolate node values
+    int    inx[4];
+    double wgt[4];
+    double values[g_node_size];
+    weights(logE, theta, inx, wgt);
+    interpolate(inx, wgt, values);
+
+    // Return maximum PSF radius
+    return values[1];
+}
+
+
+/***********************************************************************//**
+ * @brief Return instrument response function
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (rad).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return Product of effective area and point spread function.
+ *
+ * Returns the product of effective area and point spread function. Zero
+ * is returned if the angular separation exceeds the maximum PSF radius.
+ ***************************************************************************/
+double GCTAResponseGrid::irf(const double& delta, const double& logE,
+                             const double& theta) const
+{
+    // Initialise response
+    double irf = 0.0;
+
+    // Interpolate node values
+    int    inx[4];
+    double wgt[4];
+    double values[g_node_size];
+    weights(logE, theta, inx, wgt);
+    interpolate(inx, wgt, values);
+
+    // Compute response if angular separation is within maximum PSF radius
+    if (delta <= values[1]) {
+        double delta2 = delta * delta;
+        double psf    = values[2] * std::exp(values[5] * delta2) +
+                        values[3] * std::exp(values[6] * delta2) +
+                        values[4] * std::exp(values[7] * delta2);
+        irf = (values[0] > 0.0) ? values[0] * psf : values[0];
+    }
+
+    // Return response
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Print response grid information
+ *
+ * @param[in] chatter Chattiness (defaults to NORMAL).
+ * @return String containing response grid information.
+ ***************************************************************************/
+std::string GCTAResponseGrid::print(const GChatter& chatter) const
+{
+    // Initialise result string
+    std::string result;
+
+    // Continue only if chatter is not silent
+    if (chatter != SILENT) {
+
+        // Append header
+        result.append("=== GCTAResponseGrid ===");
+
+        // Append information
+        result.append("\n"+gammalib::parformat("Number of energy nodes"));
+        result.append(gammalib::str(m_nlogE));
+        result.append("\n"+gammalib::parformat("Energy range"));
+        result.append(gammalib::str(m_logE_min)+" - ");
+        result.append(gammalib::str(m_logE_max)+" log10(TeV)");
+        result.append("\n"+gammalib::parformat("Number of offset nodes"));
+        result.append(gammalib::str(m_ntheta));
+        result.append("\n"+gammalib::parformat("Offset angle range"));
+        result.append("0 - ");
+        result.append(gammalib::str(m_theta_max*gammalib::rad2deg)+" deg");
+
+    } // endif: chatter was not silent
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                            Private methods                              =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GCTAResponseGrid::init_members(void)
+{
+    // Initialise members
+    m_nlogE     = 0;
+    m_ntheta    = 0;
+    m_logE_min  = 0.0;
+    m_logE_max  = 0.0;
+    m_logE_bin  = 0.0;
+    m_theta_max = 0.0;
+    m_theta_bin = 0.0;
+    m_nodes.clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] grid Response grid.
+ ***************************************************************************/
+void GCTAResponseGrid::copy_members(const GCTAResponseGrid& grid)
+{
+    // Copy members
+    m_nlogE     = grid.m_nlogE;
+    m_ntheta    = grid.m_ntheta;
+    m_logE_min  = grid.m_logE_min;
+    m_logE_max  = grid.m_logE_max;
+    m_logE_bin  = grid.m_logE_bin;
+    m_theta_max = grid.m_theta_max;
+    m_theta_bin = grid.m_theta_bin;
+    m_nodes     = grid.m_nodes;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GCTAResponseGrid::free_members(void)
+{
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute node indices and weighting factors
+ *
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @param[out] inx Array of 4 node indices.
+ * @param[out] wgt Array of 4 weighting factors.
+ *
+ * Computes the four grid nodes and weights for bilinear interpolation.
+ * Arguments outside the grid are clamped to the grid boundaries. As the
+ * grid is regular, no search is needed. For an empty grid all weights are
+ * zero.
+ ***************************************************************************/
+void GCTAResponseGrid::weights(const double& logE, const double& theta,
+                               int* inx, double* wgt) const
+{
+    // If grid is empty then return zero weights
+    if (size() == 0) {
+        for (int m = 0; m < 4; ++m) {
+            inx[m] = 0;
+            wgt[m] = 0.0;
+        }
+        return;
+    }
+
+    // Compute fractional energy node index
+    double x = (logE - m_logE_min) / m_logE_bin;
+    if (x < 0.0) {
+        x = 0.0;
+    }
+    int i = int(x);
+    if (i > m_nlogE - 2) {
+        i = m_nlogE - 2;
+    }
+    double fx = x - double(i);
+    if (fx > 1.0) {
+        fx = 1.0;
+    }
+
+    // Compute fractional offset angle node index
+    double y = theta / m_theta_bin;
+    if (y < 0.0) {
+        y = 0.0;
+    }
+    int k = int(y);
+    if (k > m_ntheta - 2) {
+        k = m_ntheta - 2;
+    }
+    double fy = y - double(k);
+    if (fy > 1.0) {
+        fy = 1.0;
+    }
+
+    // Set node indices
+    inx[0] = i * m_ntheta + k;
+    inx[1] = inx[0] + 1;
+    inx[2] = inx[0] + m_ntheta;
+    inx[3] = inx[2] + 1;
+
+    // Set weighting factors
+    wgt[0] = (1.0 - fx) * (1.0 - fy);
+    wgt[1] = (1.0 - fx) * fy;
+    wgt[2] = fx * (1.0 - fy);
+    wgt[3] = fx * fy;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Interpolate node values
+ *
+ * @param[in] inx Array of 4 node indices.
+ * @param[in] wgt Array of 4 weighting factors.
+ * @param[out] values Array of interpolated node values.
+ *
+ * For an empty grid all values are zero.
+ ***************************************************************************/
+void GCTAResponseGrid::interpolate(const int* inx, const double* wgt,
+                                   double* values) const
+{
+    // If grid is empty then return zero values
+    if (size() == 0) {
+        for (int m = 0; m < g_node_size; ++m) {
+            values[m] = 0.0;
+        }
+        return;
+    }
+
+    // Get pointers to nodes
+    const double* n0 = &(m_nodes[inx[0] * g_node_size]);
+    const double* n1 = &(m_nodes[inx[1] * g_node_size]);
+    const double* n2 = &(m_nodes[inx[2] * g_node_size]);
+    const double* n3 = &(m_nodes[inx[3] * g_node_size]);
+
+    // Interpolate values
+    for (int m = 0; m < g_node_size; ++m) {
+        values[m] = wgt[0] * n0[m] + wgt[1] * n1[m] +
+                    wgt[2] * n2[m] + wgt[3] * n3[m];
+    }
+
+    // Return
+    return;
+}
@@ -34,13 +34,14 @@
 #include "GTools.hpp"
 #include "GMath.hpp"
 #include "GIntegral.hpp"
-#include "GVector.hpp"
+#include "GVector3.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_KERN_BLOCK 64   //!< Number of arguments per batch evaluation block
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -182,7 +183,7 @@ double cta_irf_radial_kern_rho::eval(double rho)
         // Integrate over phi
         GIntegral integral(&integrand);
         integral.eps(m_rsp.eps());
-        irf = integral.romb(omega_min, omega_max) * model * sin_rho;
+        irf = m_rsp.integrate(integral, omega_min, omega_max) * model * sin_rho;
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -245,40 +246,104 @@ double cta_irf_radial_kern_rho::eval(double rho)
  ***************************************************************************/
 double cta_irf_radial_kern_omega::eval(double omega)
 {
-    // Compute PSF offset angle [radians]
-    double delta = std::acos(m_cos_psf + m_sin_psf * std::cos(omega));
-    
-    // Compute observed photon offset angle in camera system [radians]
-    double offset = std::acos(m_cos_ph + m_sin_ph * std::cos(m_omega0 - omega));
-    
+    // Evaluate kernel for a single azimuth angle
+    double irf;
+    eval(&omega, &irf, 1);
+
+    // Return
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Kernel for radial model azimuth angle IRF integration for many
+ *        azimuth angles
+ *
+ * @param[in] omega Azimuth angles (radians).
+ * @param[out] irf IRF values for all azimuth angles.
+ * @param[in] n Number of azimuth angles.
+ *
+ * Computes the kernel of eval(double) for @p n azimuth angles. The angles
+ * are processed in blocks: the PSF offset angles \f$\delta\f$ and the
+ * photon offset angles \f$\theta\f$ are first computed for all angles of
+ * a block in a loop without function calls that the compiler can
+ * vectorise, then the response is evaluated for each angle. The point
+ * spread function and energy dispersion are only evaluated for angles
+ * with a positive effective area.
+ ***************************************************************************/
+void cta_irf_radial_kern_omega::eval(const double* omega, double* irf, int n)
+{
+    // Allocate block arrays
+    double delta[G_KERN_BLOCK];
+    double offset[G_KERN_BLOCK];
+
+    // Determine once whether energy dispersion is needed
+    bool edisp = m_rsp.hasedisp();
+
     //TODO: Compute true photon azimuth angle in camera system [radians]
     double azimuth = 0.0;
 
-    // Evaluate IRF
-    double irf = m_rsp.aeff(offset, azimuth, m_zenith, m_azimuth, m_srcLogEng) *
-                 m_rsp.psf(delta, offset, azimuth, m_zenith, m_azimuth, m_srcLogEng);
+    // Loop over blocks of azimuth angles
+    for (int start = 0; start < n; start += G_KERN_BLOCK) {
 
-    // Optionally take energy dispersion into account
-    if (m_rsp.hasedisp() && irf > 0.0) {
-        irf *= m_rsp.edisp(m_obsLogEng, offset, azimuth, m_zenith, m_azimuth, m_srcLogEng);
-    }
-    
-    // Compile option: Check for NaN/Inf
-    #if defined(G_NAN_CHECK)
-    if (gammalib::isnotanumber(irf) || gammalib::isinfinite(irf)) {
-        std::cout << "*** ERROR: cta_irf_radial_kern_omega::eval";
-        std::cout << "(omega=" << omega << "):";
-        std::cout << " NaN/Inf encountered";
-        std::cout << " (irf=" << irf;
-        std::cout << ", delta=" << delta;
-        std::cout << ", offset=" << offset;
-        std::cout << ", azimuth=" << azimuth << ")";
-        std::cout << std::endl;
-    }
-    #endif
+        // Determine number of azimuth angles in block
+        int num = (n - start < G_KERN_BLOCK) ? n - start : G_KERN_BLOCK;
+
+        // Set block pointers
+        const double* x = omega + start;
+        double*       y = irf   + start;
+
+        // Compute PSF offset angles and observed photon offset angles in
+        // camera system [radians]
+        for (int i = 0; i < num; ++i) {
+            delta[i]  = std::acos(m_cos_psf + m_sin_psf * std::cos(x[i]));
+            offset[i] = std::acos(m_cos_ph  + m_sin_ph  * std::cos(m_omega0 - x[i]));
+        }
+
+        // Evaluate IRF
+        for (int i = 0; i < num; ++i) {
+
+            // Evaluate effective area
+            double value = m_rsp.aeff(offset[i], azimuth, m_zenith, m_azimuth,
+                                      m_srcLogEng);
+
+            // Multiply with point spread function and optionally with
+            // energy dispersion
+            if (value > 0.0) {
+                value *= m_rsp.psf(delta[i], offset[i], azimuth, m_zenith,
+                                   m_azimuth, m_srcLogEng);
+                if (edisp && value > 0.0) {
+                    value *= m_rsp.edisp(m_obsLogEng, offset[i], azimuth,
+                                         m_zenith, m_azimuth, m_srcLogEng);
+                }
+            }
+            else {
+                value = 0.0;
+            }
+
+            // Compile option: Check for NaN/Inf
+            #if defined(G_NAN_CHECK)
+            if (gammalib::isnotanumber(value) || gammalib::isinfinite(value)) {
+                std::cout << "*** ERROR: cta_irf_radial_kern_omega::eval";
+                std::cout << "(omega=" << x[i] << "):";
+                std::cout << " NaN/Inf encountered";
+                std::cout << " (irf=" << value;
+                std::cout << ", delta=" << delta[i];
+                std::cout << ", offset=" << offset[i];
+                std::cout << ", azimuth=" << azimuth << ")";
+                std::cout << std::endl;
+            }
+            #endif
+
+            // Store IRF value
+            y[i] = value;
+
+        } // endfor: looped over azimuth angles of block
+
+    } // endfor: looped over blocks
 
     // Return
-    return irf;
+    return;
 }
 
 
@@ -339,7 +404,8 @@ double cta_npred_radial_kern_rho::eval(double rho)
 
         // Integrate over phi
         GIntegral integral(&integrand);
-        npred = integral.romb(omega_min, omega_max) * sin_rho * model;
+        npred = m_rsp.integrate(integral, omega_min, omega_max) *
+                sin_rho * model;
 
         // Debug: Check for NaN
         #if defined(G_NAN_CHECK)
@@ -376,10 +442,10 @@ double cta_npred_radial_kern_omega::eval(double omega)
     // Compute sky direction vector in native coordinates
     double  cos_omega = std::cos(omega);
     double  sin_omega = std::sin(omega);
-    GVector native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
+    GVector3 native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -478,7 +544,7 @@ double cta_irf_elliptical_kern_rho::eval(double rho)
         // Integrate over phi
         GIntegral integral(&integrand);
         integral.eps(m_rsp.eps());
-        irf = integral.romb(omega_min, omega_max) * sin_rho;
+        irf = m_rsp.integrate(integral, omega_min, omega_max) * sin_rho;
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -538,53 +604,113 @@ double cta_irf_elliptical_kern_rho::eval(double rho)
  ***************************************************************************/
 double cta_irf_elliptical_kern_omega::eval(double omega)
 {
-    // Initialise IRF value
-    double irf = 0.0;
+    // Evaluate kernel for a single azimuth angle
+    double irf;
+    eval(&omega, &irf, 1);
 
-    // Evaluate sky model
-    double model = m_model.eval(m_rho, omega + m_obsOmega, m_srcEng, m_srcTime);
+    // Return
+    return irf;
+}
 
-    // Continue only if model is positive
-    if (model > 0.0) {
 
-        // Compute PSF offset angle [radians]
-        double delta = std::acos(m_cos_psf + m_sin_psf * std::cos(omega));
-    
-        // Compute true photon offset and azimuth angle in camera system
-        // [radians]
-        double theta = std::acos(m_cos_ph + m_sin_ph * std::cos(m_omega0 - omega));
-        double phi   = 0.0; //TODO: Implement IRF Phi dependence
+/***********************************************************************//**
+ * @brief Kernel for elliptical model integration over model's azimuth angle
+ *        for many azimuth angles
+ *
+ * @param[in] omega Azimuth angles (radians).
+ * @param[out] irf Kernel values for all azimuth angles.
+ * @param[in] n Number of azimuth angles.
+ *
+ * Computes the kernel of eval(double) for @p n azimuth angles. The angles
+ * are processed in blocks: the PSF offset angles \f$\delta\f$ and the
+ * photon offset angles \f$\theta\f$ are computed for all angles of a
+ * block in a loop without function calls that the compiler can vectorise,
+ * then the sky model and the response are evaluated for each angle. The
+ * response is only evaluated for angles with a positive sky model.
+ ***************************************************************************/
+void cta_irf_elliptical_kern_omega::eval(const double* omega, double* irf,
+                                         int n)
+{
+    // Allocate block arrays
+    double delta[G_KERN_BLOCK];
+    double theta[G_KERN_BLOCK];
 
-        // Evaluate IRF * model
-        irf = m_rsp.aeff(theta, phi, m_zenith, m_azimuth, m_srcLogEng) *
-              m_rsp.psf(delta, theta, phi, m_zenith, m_azimuth, m_srcLogEng) *
-              model;
-
-        // Optionally take energy dispersion into account
-        if (m_rsp.hasedisp() && irf > 0.0) {
-            irf *= m_rsp.edisp(m_obsLogEng, theta, phi, 
-                               m_zenith, m_azimuth, m_srcLogEng);
-        }
+    // Determine once whether energy dispersion is needed
+    bool edisp = m_rsp.hasedisp();
 
-        // Compile option: Check for NaN/Inf
-        #if defined(G_NAN_CHECK)
-        if (gammalib::isnotanumber(irf) || gammalib::isinfinite(irf)) {
-            std::cout << "*** ERROR: cta_irf_elliptical_kern_omega::eval";
-            std::cout << "(omega=" << omega << "):";
-            std::cout << " NaN/Inf encountered";
-            std::cout << " (irf=" << irf;
-            std::cout << ", model=" << model;
-            std::cout << ", delta=" << delta;
-            std::cout << ", theta=" << theta;
-            std::cout << ", phi=" << phi << ")";
-            std::cout << std::endl;
+    //TODO: Implement IRF Phi dependence
+    double phi = 0.0;
+
+    // Loop over blocks of azimuth angles
+    for (int start = 0; start < n; start += G_KERN_BLOCK) {
+
+        // Determine number of azimuth angles in block
+        int num = (n - start < G_KERN_BLOCK) ? n - start : G_KERN_BLOCK;
+
+        // Set block pointers
+        const double* x = omega + start;
+        double*       y = irf   + start;
+
+        // Compute PSF offset angles and true photon offset angles in
+        // camera system [radians]
+        for (int i = 0; i < num; ++i) {
+            delta[i] = std::acos(m_cos_psf + m_sin_psf * std::cos(x[i]));
+            theta[i] = std::acos(m_cos_ph  + m_sin_ph  * std::cos(m_omega0 - x[i]));
         }
-        #endif
 
-    } // endif: model is positive
+        // Evaluate IRF * model
+        for (int i = 0; i < num; ++i) {
+
+            // Initialise IRF value
+            double value = 0.0;
+
+            // Evaluate sky model
+            double model = m_model.eval(m_rho, x[i] + m_obsOmega, m_srcEng,
+                                        m_srcTime);
+
+            // Continue only if model is positive
+            if (model > 0.0) {
+
+                // Evaluate IRF * model
+                value = m_rsp.aeff(theta[i], phi, m_zenith, m_azimuth,
+                                   m_srcLogEng) *
+                        m_rsp.psf(delta[i], theta[i], phi, m_zenith,
+                                  m_azimuth, m_srcLogEng) *
+                        model;
+
+                // Optionally take energy dispersion into account
+                if (edisp && value > 0.0) {
+                    value *= m_rsp.edisp(m_obsLogEng, theta[i], phi,
+                                         m_zenith, m_azimuth, m_srcLogEng);
+                }
+
+                // Compile option: Check for NaN/Inf
+                #if defined(G_NAN_CHECK)
+                if (gammalib::isnotanumber(value) ||
+                    gammalib::isinfinite(value)) {
+                    std::cout << "*** ERROR: cta_irf_elliptical_kern_omega::eval";
+                    std::cout << "(omega=" << x[i] << "):";
+                    std::cout << " NaN/Inf encountered";
+                    std::cout << " (irf=" << value;
+                    std::cout << ", model=" << model;
+                    std::cout << ", delta=" << delta[i];
+                    std::cout << ", theta=" << theta[i];
+                    std::cout << ", phi=" << phi << ")";
+                    std::cout << std::endl;
+                }
+                #endif
+
+            } // endif: model is positive
+
+            // Store IRF value
+            y[i] = value;
+
+        } // endfor: looped over azimuth angles of block
+
+    } // endfor: looped over blocks
 
     // Return
-    return irf;
+    return;
 }
 
 
@@ -643,7 +769,7 @@ double cta_npred_elliptical_kern_rho::eval(double rho)
 
         // Integrate over phi
         GIntegral integral(&integrand);
-        npred = integral.romb(omega_min, omega_max) * sin_rho;
+        npred = m_rsp.integrate(integral, omega_min, omega_max) * sin_rho;
 
         // Debug: Check for NaN
         #if defined(G_NAN_CHECK)
@@ -685,10 +811,10 @@ double cta_npred_elliptical_kern_omega::eval(double omega)
     // Compute sky direction vector in native coordinates
     double  cos_omega = std::cos(omega);
     double  sin_omega = std::sin(omega);
-    GVector native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
+    GVector3 native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -798,7 +924,8 @@ double cta_irf_diffuse_kern_theta::eval(double theta)
             // Integrate over phi
             GIntegral integral(&integrand);
             integral.eps(1.0e-2);
-            irf = integral.romb(0.0, gammalib::twopi) * psf * sin_theta;
+            irf = m_rsp.integrate(integral, 0.0, gammalib::twopi) *
+                  psf * sin_theta;
 
             // Compile option: Check for NaN/Inf
             #if defined(G_NAN_CHECK)
@@ -856,64 +983,122 @@ double cta_irf_diffuse_kern_theta::eval(double theta)
  ***************************************************************************/
 double cta_irf_diffuse_kern_phi::eval(double phi)
 {
-    // Initialise result
-    double irf = 0.0;
+    // Evaluate kernel for a single azimuth angle
+    double irf;
+    eval(&phi, &irf, 1);
 
-    // Compute sine and cosine of azimuth angle
-    double sin_phi = std::sin(phi);
-    double cos_phi = std::cos(phi);
+    // Return
+    return irf;
+}
 
-    // Compute sky direction vector in native coordinates
-    GVector native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
 
-    // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+/***********************************************************************//**
+ * @brief Kernel for IRF azimuth angle integration of the diffuse source
+ *        model for many azimuth angles
+ *
+ * @param[in] phi Azimuth angles around observed photon direction (radians).
+ * @param[out] irf Kernel values for all azimuth angles.
+ * @param[in] n Number of azimuth angles.
+ *
+ * Computes the kernel of eval(double) for @p n azimuth angles. The angles
+ * are processed in blocks: the sines and cosines of the azimuth angles and
+ * the true photon offset angles are computed for all angles of a block in
+ * a loop without function calls that the compiler can vectorise, then the
+ * sky model and the response are evaluated for each angle. The response is
+ * only evaluated for angles with a positive sky intensity.
+ ***************************************************************************/
+void cta_irf_diffuse_kern_phi::eval(const double* phi, double* irf, int n)
+{
+    // Allocate block arrays
+    double sin_phi[G_KERN_BLOCK];
+    double cos_phi[G_KERN_BLOCK];
+    double offset[G_KERN_BLOCK];
 
-    // Set sky direction
-    GSkyDir srcDir;
-    srcDir.celvector(cel);
+    // Determine once whether energy dispersion is needed
+    bool edisp = m_rsp.hasedisp();
 
-    // Get sky intensity for this sky direction
-    double intensity = m_model.eval(GPhoton(srcDir, m_srcEng, m_srcTime));
+    //TODO: Compute true photon azimuth angle in camera system [radians]
+    double azimuth = 0.0;
 
-    // Continue only if sky intensity is positive
-    if (intensity > 0.0) {
+    // Loop over blocks of azimuth angles
+    for (int start = 0; start < n; start += G_KERN_BLOCK) {
 
-        // Compute true photon offset angle in camera system [radians]
-        double offset = std::acos(m_cos_ph + m_sin_ph * cos_phi);
+        // Determine number of azimuth angles in block
+        int num = (n - start < G_KERN_BLOCK) ? n - start : G_KERN_BLOCK;
 
-        //TODO: Compute true photon azimuth angle in camera system [radians]
-        double azimuth = 0.0;
+        // Set block pointers
+        const double* x = phi + start;
+        double*       y = irf + start;
+
+        // Compute sine and cosine of azimuth angles and true photon offset
+        // angles in camera system [radians]
+        for (int i = 0; i < num; ++i) {
+            sin_phi[i] = std::sin(x[i]);
+            cos_phi[i] = std::cos(x[i]);
+            offset[i]  = std::acos(m_cos_ph + m_sin_ph * cos_phi[i]);
+        }
 
         // Evaluate model times the effective area
-        irf = intensity *
-              m_rsp.aeff(offset, azimuth, m_zenith, m_azimuth, m_srcLogEng);
+        for (int i = 0; i < num; ++i) {
 
-        // Optionally take energy dispersion into account
-        if (m_rsp.hasedisp() && irf > 0.0) {
-            irf *= m_rsp.edisp(m_obsLogEng, offset, azimuth,
-                               m_zenith, m_azimuth, m_srcLogEng);
-        }
+            // Initialise result
+            double value = 0.0;
 
-        // Compile option: Check for NaN/Inf
-        #if defined(G_NAN_CHECK)
-        if (gammalib::isnotanumber(irf) || gammalib::isinfinite(irf)) {
-            std::cout << "*** ERROR: cta_irf_diffuse_kern_phi::eval";
-            std::cout << "(phi=" << phi << "):";
-            std::cout << " NaN/Inf encountered";
-            std::cout << " (irf=" << irf;
-            std::cout << ", intensity=" << intensity;
-            std::cout << ", offset=" << offset;
-            std::cout << ", azimuth=" << azimuth;
-            std::cout << ")";
-            std::cout << std::endl;
-        }
-        #endif
+            // Compute sky direction vector in native coordinates
+            GVector3 native(-cos_phi[i]*m_sin_theta, sin_phi[i]*m_sin_theta,
+                            m_cos_theta);
 
-    } // endif: sky intensity was positive
+            // Rotate from native into celestial system
+            GVector3 cel = m_rot * native;
+
+            // Set sky direction
+            GSkyDir srcDir;
+            srcDir.celvector(cel);
+
+            // Get sky intensity for this sky direction
+            double intensity = m_model.eval(GPhoton(srcDir, m_srcEng, m_srcTime));
+
+            // Continue only if sky intensity is positive
+            if (intensity > 0.0) {
+
+                // Evaluate model times the effective area
+                value = intensity *
+                        m_rsp.aeff(offset[i], azimuth, m_zenith, m_azimuth,
+                                   m_srcLogEng);
+
+                // Optionally take energy dispersion into account
+                if (edisp && value > 0.0) {
+                    value *= m_rsp.edisp(m_obsLogEng, offset[i], azimuth,
+                                         m_zenith, m_azimuth, m_srcLogEng);
+                }
+
+                // Compile option: Check for NaN/Inf
+                #if defined(G_NAN_CHECK)
+                if (gammalib::isnotanumber(value) ||
+                    gammalib::isinfinite(value)) {
+                    std::cout << "*** ERROR: cta_irf_diffuse_kern_phi::eval";
+                    std::cout << "(phi=" << x[i] << "):";
+                    std::cout << " NaN/Inf encountered";
+                    std::cout << " (irf=" << value;
+                    std::cout << ", intensity=" << intensity;
+                    std::cout << ", offset=" << offset[i];
+                    std::cout << ", azimuth=" << azimuth;
+                    std::cout << ")";
+                    std::cout << std::endl;
+                }
+                #endif
+
+            } // endif: sky intensity was positive
+
+            // Store IRF value
+            y[i] = value;
+
+        } // endfor: looped over azimuth angles of block
+
+    } // endfor: looped over blocks
 
     // Return
-    return irf;
+    return;
 }
 
 
@@ -967,7 +1152,7 @@ double cta_npred_diffuse_kern_theta::eval(double theta)
         // Integrate over phi
         GIntegral integral(&integrand);
         integral.eps(1.0e-4);
-        npred = integral.romb(0.0, gammalib::twopi) * sin_theta;
+        npred = m_rsp.integrate(integral, 0.0, gammalib::twopi) * sin_theta;
 
         // Debug: Check for NaN
         #if defined(G_NAN_CHECK)
@@ -1011,10 +1196,10 @@ double cta_npred_diffuse_kern_phi::eval(double phi)
     // Compute sky direction vector in native coordinates
     double  cos_phi = std::cos(phi);
     double  sin_phi = std::sin(phi);
-    GVector native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
+    GVector3 native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
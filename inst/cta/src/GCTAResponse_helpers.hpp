@@ -31,7 +31,7 @@
 #include <cmath>
 #include "GCTAResponse.hpp"
 #include "GCTAObservation.hpp"
-#include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 #include "GEnergy.hpp"
 #include "GTime.hpp"
 #include "GModelSpatialRadial.hpp"
@@ -222,6 +222,7 @@ public:
                               m_cos_ph(cos_ph),
                               m_sin_ph(sin_ph) { }
     double eval(double omega);
+    void   eval(const double* omega, double* irf, int n);
 protected:
     const GCTAResponse& m_rsp;           //!< CTA response
     const double&       m_zenith;        //!< Zenith angle
@@ -276,7 +277,7 @@ public:
                               const GEnergy&             srcEng,
                               const GTime&               srcTime,
                               const GCTAObservation&     obs,
-                              const GMatrix&             rot,
+                              const GMatrix3&            rot,
                               double                     dist,
                               double                     radius,
                               double                     omega0) :
@@ -299,7 +300,7 @@ protected:
     const GEnergy&             m_srcEng;     //!< True photon energy
     const GTime&               m_srcTime;    //!< True photon arrival time
     const GCTAObservation&     m_obs;        //!< CTA observation
-    const GMatrix&             m_rot;        //!< Rotation matrix
+    const GMatrix3&            m_rot;        //!< Rotation matrix
     double                     m_dist;       //!< Distance model-ROI centre
     double                     m_cos_dist;   //!< Cosine of distance model-ROI centre
     double                     m_sin_dist;   //!< Sine of distance model-ROI centre
@@ -335,7 +336,7 @@ public:
                                 const GEnergy&         srcEng,
                                 const GTime&           srcTime,
                                 const GCTAObservation& obs,
-                                const GMatrix&         rot,
+                                const GMatrix3&        rot,
                                 double                 sin_rho,
                                 double                 cos_rho) :
                                 m_rsp(rsp),
@@ -351,7 +352,7 @@ protected:
     const GEnergy&         m_srcEng;     //!< True photon energy
     const GTime&           m_srcTime;    //!< True photon arrival time
     const GCTAObservation& m_obs;        //!< CTA observation
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     double                 m_cos_rho;    //!< Cosine of offset angle
     double                 m_sin_rho;    //!< Sine of offset angle
 };
@@ -494,6 +495,7 @@ public:
                                   m_cos_ph(cos_ph),
                                   m_sin_ph(sin_ph) { }
     double eval(double omega);
+    void   eval(const double* omega, double* irf, int n);
 public:
     const GCTAResponse&            m_rsp;        //!< CTA response
     const GModelSpatialElliptical& m_model;      //!< Spatial model
@@ -551,7 +553,7 @@ public:
                                   const GEnergy&                 srcEng,
                                   const GTime&                   srcTime,
                                   const GCTAObservation&         obs,
-                                  const GMatrix&                 rot,
+                                  const GMatrix3&                rot,
                                   const double&                  dist,
                                   const double&                  radius,
                                   const double&                  omega0) :
@@ -574,7 +576,7 @@ protected:
     const GEnergy&                 m_srcEng;     //!< True photon energy
     const GTime&                   m_srcTime;    //!< True photon arrival time
     const GCTAObservation&         m_obs;        //!< CTA observation
-    const GMatrix&                 m_rot;        //!< Rotation matrix
+    const GMatrix3&                m_rot;        //!< Rotation matrix
     const double&                  m_dist;       //!< Distance model-ROI centre
     double                         m_cos_dist;   //!< Cosine of distance model-ROI centre
     double                         m_sin_dist;   //!< Sine of distance model-ROI centre
@@ -613,7 +615,7 @@ public:
                                     const GEnergy&                 srcEng,
                                     const GTime&                   srcTime,
                                     const GCTAObservation&         obs,
-                                    const GMatrix&                 rot,
+                                    const GMatrix3&                rot,
                                     const double&                  sin_rho,
                                     const double&                  cos_rho) :
                                     m_rsp(rsp),
@@ -631,7 +633,7 @@ protected:
     const GEnergy&                 m_srcEng;   //!< True photon energy
     const GTime&                   m_srcTime;  //!< True photon arrival time
     const GCTAObservation&         m_obs;      //!< Pointer to observation
-    const GMatrix&                 m_rot;      //!< Rotation matrix
+    const GMatrix3&                m_rot;      //!< Rotation matrix
     const double&                  m_sin_rho;  //!< Sine of offset angle
     const double&                  m_cos_rho;  //!< Cosine of offset angle
 };
@@ -679,7 +681,7 @@ public:
                                const GTime&         srcTime,
                                const double&        srcLogEng,
                                const double&        obsLogEng,
-                               const GMatrix&       rot,
+                               const GMatrix3&      rot,
                                const double&        eta) :
                                m_rsp(rsp),
                                m_model(model),
@@ -706,7 +708,7 @@ protected:
     const GTime&         m_srcTime;    //!< True photon arrival time
     const double&        m_srcLogEng;  //!< True photon log energy
     const double&        m_obsLogEng;  //!< Measured photon energy
-    const GMatrix&       m_rot;        //!< Rotation matrix
+    const GMatrix3&      m_rot;        //!< Rotation matrix
     double               m_sin_eta;    //!< Sine of angular distance between
                                        //   observed photon direction and
                                        //   camera centre
@@ -746,7 +748,7 @@ public:
                              const GTime&         srcTime,
                              const double&        srcLogEng,
                              const double&        obsLogEng,
-                             const GMatrix&       rot,
+                             const GMatrix3&      rot,
                              const double&        sin_theta,
                              const double&        cos_theta,
                              const double&        sin_ph,
@@ -765,6 +767,7 @@ public:
                              m_sin_ph(sin_ph),
                              m_cos_ph(cos_ph) { }
     double eval(double phi);
+    void   eval(const double* phi, double* irf, int n);
 protected:
     const GCTAResponse&  m_rsp;        //!< CTA response
     const GModelSpatial& m_model;      //!< Spatial model
@@ -774,7 +777,7 @@ protected:
     const GTime&         m_srcTime;    //!< True photon arrival time
     const double&        m_srcLogEng;  //!< True photon log energy
     const double&        m_obsLogEng;  //!< Measured photon energy
-    const GMatrix&       m_rot;        //!< Rotation matrix
+    const GMatrix3&      m_rot;        //!< Rotation matrix
     const double&        m_sin_theta;  //!< Sine of offset angle
     const double&        m_cos_theta;  //!< Cosine of offset angle
     const double&        m_sin_ph;     //!< Sine term in angular distance equation
@@ -819,7 +822,7 @@ public:
                                  const GEnergy&         srcEng,
                                  const GTime&           srcTime,
                                  const GCTAObservation& obs,
-                                 const GMatrix&         rot) :
+                                 const GMatrix3&        rot) :
                                  m_rsp(rsp),
                                  m_model(model),
                                  m_srcEng(srcEng),
@@ -833,7 +836,7 @@ protected:
     const GEnergy&         m_srcEng;     //!< True photon energy
     const GTime&           m_srcTime;    //!< True photon arrival time
     const GCTAObservation& m_obs;        //!< CTA observation
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
 };
 
 
@@ -864,7 +867,7 @@ public:
                                const GEnergy&         srcEng,
                                const GTime&           srcTime,
                                const GCTAObservation& obs,
-                               const GMatrix&         rot,
+                               const GMatrix3&        rot,
                                const double&          theta,
                                const double&          sin_theta) :
                                m_rsp(rsp),
@@ -883,7 +886,7 @@ protected:
     const GEnergy&         m_srcEng;     //!< True photon energy
     const GTime&           m_srcTime;    //!< True photon arrival time
     const GCTAObservation& m_obs;        //!< CTA observation
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     const double&          m_theta;      //!< Offset angle (radians)
     double                 m_cos_theta;  //!< Cosine of offset angle
     const double&          m_sin_theta;  //!< Sine of offset angle
@@ -29,6 +29,7 @@
 #include <config.h>
 #endif
 #include <stdlib.h>
+#include <cmath>
 #include <iostream>
 #include <unistd.h>
 #include "GCTALib.hpp"
@@ -66,6 +67,9 @@ void TestGCTAResponse::set(void)
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_npsf), "Test integrated PSF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_diffuse), "Test diffuse IRF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_npred_diffuse), "Test diffuse IRF integration");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_npred_gradients), "Test Npred gradients");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_npred_cache), "Test Npred cache");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_compiled), "Test compiled response");
 
     // Return
     return;
@@ -83,6 +87,8 @@ void TestGCTAObservation::set(void)
     // Append tests to test suite
     append(static_cast<pfunction>(&TestGCTAObservation::test_unbinned_obs), "Test unbinned observations");
     append(static_cast<pfunction>(&TestGCTAObservation::test_binned_obs), "Test binned observation");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_irf_cache), "Test event list IRF cache");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_event_columns), "Test event list columns");
 
     // Return
     return;
@@ -207,6 +213,13 @@ void TestGCTAResponse::test_response_npsf(void)
     npsf = rsp.npsf(srcDir, srcEng.log10TeV(), srcTime, pnt, roi);
     test_value(npsf, 0.492373, 1.0e-3, "PSF(0,2) integration");
 
+    // Test PSF outside and overlapping ROI using Gauss-Kronrod integration
+    rsp.integrator("GAUSS-KRONROD");
+    test_assert(rsp.integrator() == "GAUSS-KRONROD", "Check integration method");
+    npsf = rsp.npsf(srcDir, srcEng.log10TeV(), srcTime, pnt, roi);
+    test_value(npsf, 0.492373, 1.0e-3, "PSF(0,2) Gauss-Kronrod integration");
+    rsp.integrator("ROMBERG");
+
     // Test PSF outside ROI
     srcDir.radec_deg(2.0, 2.0);
     npsf = rsp.npsf(srcDir, srcEng.log10TeV(), srcTime, pnt, roi);
@@ -363,6 +376,186 @@ void TestGCTAResponse::test_response_npred_diffuse(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test CTA Npred gradients
+ *
+ * Compares the Npred gradients of the free spectral parameters of a point
+ * source, which are integrated analytically together with Npred, to
+ * gradients computed by finite differences of Npred.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_npred_gradients(void)
+{
+    // Setup ROI centred on the Crab with a radius of 4 deg
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.radec_deg(83.6331, 22.0145);
+    roi.centre(instDir);
+    roi.radius(4.0);
+
+    // Setup pointing on the Crab
+    GSkyDir skyDir;
+    skyDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(skyDir);
+
+    // Setup dummy event list
+    GGti     gti;
+    GEbounds ebounds;
+    GTime    tstart(0.0);
+    GTime    tstop(1800.0);
+    GEnergy  emin(0.1, "TeV");
+    GEnergy  emax(100.0, "TeV");
+    gti.append(tstart, tstop);
+    ebounds.append(emin, emax);
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+
+    // Setup dummy CTA observation
+    GCTAObservation obs;
+    obs.ontime(1800.0);
+    obs.livetime(1600.0);
+    obs.deadc(1600.0/1800.0);
+    obs.response(cta_irf, cta_caldb);
+    obs.events(&events);
+    obs.pointing(pnt);
+
+    // Load point source model
+    GModels crab(cta_model_xml);
+    GModels models;
+    models.append(*crab[0]);
+
+    // Compute Npred and gradients
+    GVector gradient(models.npars());
+    double  npred = obs.npred(models, &gradient);
+    test_assert(npred > 0.0, "Check that Npred is positive");
+
+    // Compare gradients of free parameters to finite differences
+    for (int i = 0; i < models.npars(); ++i) {
+        GModelPar& par = models.par(i);
+        if (par.isfree()) {
+            double value = par.factor_value();
+            double h     = 1.0e-4 * value;
+            par.factor_value(value + h);
+            double npred_plus = obs.npred(models, NULL);
+            par.factor_value(value - h);
+            double npred_minus = obs.npred(models, NULL);
+            par.factor_value(value);
+            double numeric = (npred_plus - npred_minus) / (2.0 * h);
+            test_value(gradient[i], numeric, 1.0e-3 * std::abs(numeric),
+                       "Npred gradient of parameter \""+par.name()+"\"");
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test CTA Npred cache
+ *
+ * Checks that the Npred cache of the CTA response counts hits and misses,
+ * distinguishes sources that share a spatial model, shares values between
+ * energies that differ by rounding errors, replaces single entries when it
+ * is full, and is flushed when its maximum size is changed.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_npred_cache(void)
+{
+    // Setup ROI centred on the Crab with a radius of 1 deg
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.radec_deg(83.6331, 22.0145);
+    roi.centre(instDir);
+    roi.radius(1.0);
+
+    // Setup pointing on the Crab
+    GSkyDir skyDir;
+    skyDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(skyDir);
+
+    // Setup dummy event list
+    GGti     gti;
+    GEbounds ebounds;
+    GTime    tstart(0.0);
+    GTime    tstop(1800.0);
+    GEnergy  emin(0.1, "TeV");
+    GEnergy  emax(100.0, "TeV");
+    gti.append(tstart, tstop);
+    ebounds.append(emin, emax);
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+
+    // Setup dummy CTA observation
+    GCTAObservation obs;
+    obs.ontime(1800.0);
+    obs.livetime(1600.0);
+    obs.deadc(1600.0/1800.0);
+    obs.response(cta_irf, cta_caldb);
+    obs.events(&events);
+    obs.pointing(pnt);
+    const GCTAResponse* rsp = obs.response();
+
+    // Setup sources that share a diffuse model
+    GModelSpatialDiffuseConst model(1.0);
+    GSource source1("Diffuse1", &model, GEnergy(1.0, "TeV"), GTime(0.0));
+    GSource source2("Diffuse2", &model, GEnergy(1.0, "TeV"), GTime(0.0));
+    GSource source3("Diffuse1", &model, GEnergy(2.0, "TeV"), GTime(0.0));
+    GSource source4("Diffuse1", &model, GEnergy(1.0+1.0e-13, "TeV"), GTime(0.0));
+
+    // Test miss and hit
+    double npred1 = rsp->npred_diffuse(source1, obs);
+    double npred2 = rsp->npred_diffuse(source1, obs);
+    test_assert(npred1 > 0.0, "Check that Npred is positive");
+    test_value(npred2, npred1, 1.0e-10, "Check cached Npred value");
+    test_value(int(rsp->npred_cache_misses()), 1, "Check cache misses");
+    test_value(int(rsp->npred_cache_hits()), 1, "Check cache hits");
+    test_value(rsp->npred_cache_size(), 1, "Check cache size");
+
+    // Test that an energy that differs by a rounding error hits the cache
+    test_value(rsp->npred_diffuse(source4, obs), npred1, 1.0e-10,
+               "Check cached Npred value for rounded energy");
+    test_value(int(rsp->npred_cache_hits()), 2, "Check cache hits");
+
+    // Test that other source names and energies miss the cache
+    rsp->npred_diffuse(source2, obs);
+    rsp->npred_diffuse(source3, obs);
+    test_value(int(rsp->npred_cache_misses()), 3, "Check cache misses");
+    test_value(int(rsp->npred_cache_hits()), 2, "Check cache hits");
+    test_value(rsp->npred_cache_size(), 3, "Check cache size");
+
+    // Test that reducing the maximum size flushes the cache
+    obs.response()->npred_cache_max_size(2);
+    test_value(rsp->npred_cache_size(), 0, "Check flushed cache size");
+    test_value(rsp->npred_diffuse(source1, obs), npred1, 1.0e-10,
+               "Check recomputed Npred value");
+    test_value(int(rsp->npred_cache_misses()), 4, "Check cache misses");
+
+    // Test that a full cache replaces single entries
+    rsp->npred_diffuse(source2, obs);
+    rsp->npred_diffuse(source3, obs);
+    test_value(int(rsp->npred_cache_misses()), 6, "Check cache misses");
+    test_assert(rsp->npred_cache_size() >= 1 && rsp->npred_cache_size() <= 2,
+                "Check cache size after replacement");
+    rsp->npred_diffuse(source3, obs);
+    test_value(int(rsp->npred_cache_hits()), 3, "Check hit of last value");
+
+    // Test that a size of zero disables the cache
+    obs.response()->npred_cache_max_size(0);
+    rsp->npred_diffuse(source1, obs);
+    rsp->npred_diffuse(source1, obs);
+    test_value(int(rsp->npred_cache_misses()), 8, "Check disabled cache");
+    test_value(rsp->npred_cache_size(), 0, "Check disabled cache size");
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test CTA response handling
  ***************************************************************************/
@@ -386,6 +579,52 @@ void TestGCTAResponse::test_response(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test compiled CTA response
+ *
+ * Compares effective area, PSF and maximum PSF radius of a compiled
+ * response to the values of the original response for a set of energies
+ * and offset angles.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_compiled(void)
+{
+    // Load response
+    GCTAResponse rsp;
+    rsp.caldb(cta_caldb);
+    rsp.load(cta_irf);
+
+    // Setup compiled response
+    GCTAResponse compiled = rsp;
+    compiled.compiled(true);
+    test_assert(compiled.compiled(), "Check compilation flag");
+    test_assert(compiled.grid().size() > 0, "Check response grid");
+
+    // Compare compiled to original response
+    for (double logE = -1.5; logE < 2.0; logE += 0.37) {
+        for (double theta = 0.0; theta < 3.0; theta += 0.7) {
+            double t     = theta * gammalib::deg2rad;
+            double aeff  = rsp.aeff(t, 0.0, 0.0, 0.0, logE);
+            double dmax  = rsp.psf_delta_max(t, 0.0, 0.0, 0.0, logE);
+            double delta = 0.3 * dmax;
+            double psf   = rsp.psf(delta, t, 0.0, 0.0, 0.0, logE);
+            test_value(compiled.aeff(t, 0.0, 0.0, 0.0, logE), aeff,
+                       1.0e-2 * aeff, "Compiled effective area");
+            test_value(compiled.psf_delta_max(t, 0.0, 0.0, 0.0, logE), dmax,
+                       1.0e-2 * dmax, "Compiled maximum PSF radius");
+            test_value(compiled.psf(delta, t, 0.0, 0.0, 0.0, logE), psf,
+                       1.0e-2 * psf, "Compiled PSF");
+        }
+    }
+
+    // Check that switching off compiled mode clears the grid
+    compiled.compiled(false);
+    test_assert(compiled.grid().size() == 0, "Check cleared response grid");
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test unbinned observation handling
  ***************************************************************************/
@@ -430,6 +669,43 @@ void TestGCTAObservation::test_unbinned_obs(void)
     }
     test_value(num, 4397, 1.0e-20, "Test event iterator");
 
+    // Test selective event loading
+    test_try("Test selective event loading");
+    try {
+        GCTAEventList list;
+        list.load(cta_events);
+        GCTARoi roi;
+        roi.centre(list[0]->dir());
+        roi.radius(1.0);
+        GEbounds ebounds;
+        ebounds.append(GEnergy(0.5, "TeV"), GEnergy(10.0, "TeV"));
+        int nsel = 0;
+        for (int i = 0; i < list.size(); ++i) {
+            if (list[i]->dir().dist_deg(roi.centre()) <= roi.radius() &&
+                ebounds.contains(list[i]->energy())) {
+                nsel++;
+            }
+        }
+        GCTAEventList sel;
+        sel.load(cta_events, roi, ebounds, GGti());
+        test_value(sel.size(), nsel, "Check number of selected events");
+        test_assert(list.hascolumn("DETX"), "Check optional column");
+        test_assert(!sel.hascolumn("DETX"), "Check projected column");
+        GFits fits(cta_events);
+        const GFitsTable* table = fits.table("EVENTS");
+        test_value(int(list[10]->event_id()), (*table)["EVENT_ID"].integer(10),
+                   "Check event identifier");
+        fits.close();
+        GCTAObservation selobs;
+        selobs.load_unbinned(cta_events, roi, ebounds, GGti());
+        test_value(selobs.events()->size(), nsel,
+                   "Check number of events selected by observation");
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
     // Test XML loading
     test_try("Test XML loading");
     try {
@@ -487,6 +763,121 @@ void TestGCTAObservation::test_binned_obs(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test event list IRF cache
+ ***************************************************************************/
+void TestGCTAObservation::test_irf_cache(void)
+{
+    // Setup event list
+    GCTAEventList list;
+    for (int i = 0; i < 100; ++i) {
+        list.append(GCTAEventAtom());
+    }
+
+    // Test handle assignment
+    int handle1 = list.irf_cache_handle("Model1");
+    int handle2 = list.irf_cache_handle("Model2");
+    test_value(handle1, 0, "Check first handle");
+    test_value(handle2, 1, "Check second handle");
+    test_value(list.irf_cache_handle("Model1"), handle1, "Check handle lookup");
+    test_value(int(list.irf_cache_memory()), int(200*sizeof(float)),
+               "Check cache memory after handle assignment");
+
+    // Test setting and getting values
+    list.irf_cache(handle1, 10, 3.7);
+    list.irf_cache("Model2", 20, 1.3);
+    test_value(list.irf_cache(handle1, 10), 3.7, 1.0e-6, "Check value");
+    test_value(list.irf_cache("Model2", 20), 1.3, 1.0e-6, "Check value");
+    test_value(list.irf_cache(handle1, 11), -1.0, 1.0e-6, "Check unset value");
+    test_value(int(list.irf_cache_memory()), int(200*sizeof(float)),
+               "Check cache memory");
+
+    // Test handle lookup for a source. The handle is resolved once for a
+    // spatial model, and looked up again if the spatial model is replaced.
+    GModelSpatialPointSource model(0.0, 0.0);
+    GSource source1("Model2", &model, GEnergy(), GTime());
+    GSource source2("Model3", &model, GEnergy(), GTime());
+    test_value(list.irf_cache_handle(source1), handle2, "Check source handle");
+    test_value(list.irf_cache_handle(source1), handle2, "Check source handle");
+    model = GModelSpatialPointSource(1.0, 1.0);
+    test_value(list.irf_cache_handle(source2), 2, "Check new source handle");
+    test_value(list.irf_cache_handle(source2), 2, "Check new source handle");
+    test_value(int(list.irf_cache_memory()), int(300*sizeof(float)),
+               "Check cache memory after new source handle");
+
+    // Test eviction of unused model. Setting the limit resets the used
+    // flags, then only the handle of the first model is resolved.
+    list.irf_cache_max_memory(300*sizeof(float));
+    test_value(list.irf_cache_handle("Model1"), handle1, "Check handle lookup");
+    list.irf_cache_max_memory(150*sizeof(float));
+    test_value(int(list.irf_cache_memory()), int(100*sizeof(float)),
+               "Check cache memory after eviction");
+    test_value(list.irf_cache(handle1, 10), 3.7, 1.0e-6, "Check kept value");
+    test_value(list.irf_cache(handle2, 20), -1.0, 1.0e-6, "Check dropped value");
+
+    // Test that a new handle drops values of other models
+    int handle4 = list.irf_cache_handle("Model4");
+    test_value(int(list.irf_cache_memory()), int(100*sizeof(float)),
+               "Check cache memory after insertion");
+    test_value(list.irf_cache(handle1, 10), -1.0, 1.0e-6, "Check dropped value");
+    list.irf_cache(handle4, 30, 2.1);
+    test_value(list.irf_cache(handle4, 30), 2.1, 1.0e-6, "Check new value");
+
+    // Exit test
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test event list optional columns
+ ***************************************************************************/
+void TestGCTAObservation::test_event_columns(void)
+{
+    // Setup event list
+    GCTAEventList list;
+    for (int i = 0; i < 10; ++i) {
+        GCTAEventAtom event;
+        GCTAInstDir   dir;
+        dir.radec_deg(10.0*i, 5.0*i-20.0);
+        event.dir(dir);
+        event.energy(GEnergy(1.0+i, "TeV"));
+        list.append(event);
+    }
+
+    // Test optional columns
+    test_assert(!list.hascolumn("DETX"), "Check absent column");
+    list.column("DETX", std::vector<float>(10, 0.5));
+    test_assert(list.hascolumn("DETX"), "Check present column");
+    list.append(GCTAEventAtom());
+    test_value(int(list.column("DETX").size()), 11, "Check column size");
+    test_value(list.column("DETX")[0], 0.5, 1.0e-6, "Check column value");
+    test_value(list.column("DETX")[10], 0.0, 1.0e-6, "Check appended column value");
+
+    // Test contiguous event arrays
+    const GCTAEventList& clist = list;
+    test_assert(list.hasarrays(), "Check that arrays are up to date");
+    test_value(int(list.logE().size()), 11, "Check array size");
+    test_value(list.ra()[3], clist[3]->dir().dir().ra(), 1.0e-12,
+               "Check Right Ascension array");
+    test_value(list.dec()[3], clist[3]->dir().dir().dec(), 1.0e-12,
+               "Check Declination array");
+    test_value(list.logE()[3], std::log10(4.0), 1.0e-12,
+               "Check energy array");
+    GVector3 vector = clist[3]->dir().dir().celvector();
+    test_value(list.dirx()[3], vector[0], 1.0e-12, "Check unit vector array");
+    test_value(list.diry()[3], vector[1], 1.0e-12, "Check unit vector array");
+    test_value(list.dirz()[3], vector[2], 1.0e-12, "Check unit vector array");
+    list[3]->energy(GEnergy(10.0, "TeV"));
+    test_assert(!list.hasarrays(), "Check that arrays are outdated");
+    list.update_arrays();
+    test_assert(list.hasarrays(), "Check that arrays are rebuilt");
+    test_value(list.logE()[3], 1.0, 1.0e-12, "Check rebuilt energy array");
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test unbinned optimizer
  ***************************************************************************/
@@ -51,7 +51,10 @@ public:
     void         test_response_npsf(void);
     void         test_response_irf_diffuse(void);
     void         test_response_npred_diffuse(void);
+    void         test_response_npred_gradients(void);
+    void         test_response_npred_cache(void);
     void         test_response(void);
+    void         test_response_compiled(void);
 };
 
 
@@ -72,6 +75,8 @@ public:
     virtual void set(void);
     void         test_unbinned_obs(void);
     void         test_binned_obs(void);
+    void         test_irf_cache(void);
+    void         test_event_columns(void);
 };
 
 
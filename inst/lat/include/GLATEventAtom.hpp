@@ -62,6 +62,10 @@ public:
     const GTime&       time(void) const { return m_time; }
     std::string        print(const GChatter& chatter = NORMAL) const;
 
+    // Other methods
+    int                ndiffrsp(void) const { return m_num_difrsp; }
+    double             diffrsp(const int& index) const;
+
 protected:
     // Protected methods
     void init_members(void);
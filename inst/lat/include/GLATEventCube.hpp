@@ -30,6 +30,7 @@
 /* __ Includes ___________________________________________________________ */
 #include <string>
 #include <vector>
+#include <map>
 #include "GEventCube.hpp"
 #include "GLATInstDir.hpp"
 #include "GLATEventBin.hpp"
@@ -73,14 +74,18 @@ public:
     virtual int            number(void) const;
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual GLATEventBin*       new_bin(void) const;
+    virtual const GLATEventBin* bin(const int& index, GEventBin* buffer) const;
+
     // Other methods
     void              time(const GTime& time) { m_time=time; }
     void              map(const GSkymap& map);
-    void              enodes(const GNodeArray& enodes) { m_enodes=enodes; }
+    void              enodes(const GNodeArray& enodes);
     void              ontime(const double& ontime) { m_ontime=ontime; }
     const GTime&      time(void) const { return m_time; }
     const GSkymap&    map(void) const { return m_map; }
-    const GNodeArray& enodes(void) { return m_enodes; }
+    const GNodeArray& enodes(void) const { return m_enodes; }
     const double&     ontime(void) const { return m_ontime; }
     int               nx(void) const { return m_map.nx(); }
     int               ny(void) const { return m_map.ny(); }
@@ -89,7 +94,11 @@ public:
     int               ndiffrsp(void) const { return m_srcmap.size(); }
     std::string       diffname(const int& index) const;
     GSkymap*          diffrsp(const int& index) const;
+    int               diffindex(const std::string& name) const;
+    double            diffrsp(const int& index, const int& ipix,
+                              const int& ieng) const;
     double            maxrad(const GSkyDir& dir) const;
+    unsigned long     srcmap_instance(void) const { return m_srcmap_instance; }
 
 protected:
     // Protected methods
@@ -104,6 +113,9 @@ protected:
     virtual void set_energies(void);
     virtual void set_times(void);
     void         set_bin(const int& index);
+    void         set_bin(const int& index, GLATEventBin& bin) const;
+    void         set_enodes_weights(void);
+    static unsigned long new_srcmap_instance(void);
 
     // Protected data area
     GLATEventBin             m_bin;          //!< Actual energy bin
@@ -116,7 +128,11 @@ protected:
     std::vector<GEnergy>     m_ewidth;       //!< Array of energy bin widths
     std::vector<GSkymap*>    m_srcmap;       //!< Pointers to source maps
     std::vector<std::string> m_srcmap_names; //!< Source map names
+    std::map<std::string,int> m_srcmap_handles; //!< Source map handles
+    unsigned long            m_srcmap_instance; //!< Source map instance
     GNodeArray               m_enodes;       //!< Energy nodes
+    std::vector<int>         m_enodes_inx;   //!< Node indices per energy bin
+    std::vector<double>      m_enodes_wgt;   //!< Node weights per energy bin
 };
 
 #endif /* GLATEVENTCUBE_HPP */
@@ -30,6 +30,7 @@
 /* __ Includes ___________________________________________________________ */
 #include <string>
 #include <vector>
+#include <map>
 #include "GEventList.hpp"
 #include "GLATEventAtom.hpp"
 #include "GLATRoi.hpp"
@@ -70,6 +71,10 @@ public:
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
     // Other methods
+    int                    ndiffrsp(void) const { return m_difrsp_label.size(); }
+    std::string            diffname(const int& index) const;
+    int                    diffindex(const std::string& name) const;
+    unsigned long          diffrsp_instance(void) const { return m_diffrsp_instance; }
 
 protected:
     // Protected methods
@@ -80,11 +85,14 @@ protected:
     virtual void set_times(void) { return; }
     void         read_events(const GFitsTable& hdu);
     void         read_ds_keys(const GFitsHDU& hdu);
+    static unsigned long new_diffrsp_instance(void);
 
     // Protected members
     GLATRoi                    m_roi;            //!< Region of interest
     std::vector<GLATEventAtom> m_events;         //!< Events
     std::vector<std::string>   m_difrsp_label;   //!< Diffuse response model labels
+    std::map<std::string,int>  m_difrsp_handles; //!< Diffuse response handles
+    unsigned long              m_diffrsp_instance; //!< Diffuse response instance
     std::vector<std::string>   m_ds_type;        //!< Data selection types
     std::vector<std::string>   m_ds_unit;        //!< Data selection units
     std::vector<std::string>   m_ds_value;       //!< Data selection values
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GLATLtCubeMap.hpp"
 #include "GLATAeff.hpp"
@@ -66,13 +67,22 @@ public:
     double      operator() (const GSkyDir& dir, const GEnergy& energy,
                             const double& offset, const GLATPsf& psf,
                             const GLATAeff& aeff);
+    double      operator() (const GSkyDir& dir, const GEnergy& energy,
+                            const std::vector<double>& weights,
+                            const GLATAeff& aeff) const;
 
     // Methods
     void        clear(void);
     GLATLtCube* clone(void) const;
     void        load(const std::string& filename);
     void        save(const std::string& filename, bool clobber=false) const;
+    void        weights(const GEnergy& energy, const GLATAeff& aeff,
+                        std::vector<double>& weights) const;
+    void        weights(const GEnergy& energy, const double& offset,
+                        const GLATPsf& psf, const GLATAeff& aeff,
+                        std::vector<double>& weights) const;
     std::string print(const GChatter& chatter = NORMAL) const;
+    unsigned long long checksum(void) const { return m_checksum; }
 
 private:
     // Methods
@@ -81,9 +91,10 @@ private:
     void free_members(void);
     
     // Protected members
-    GLATLtCubeMap m_exposure;
-    GLATLtCubeMap m_weighted_exposure;
-    GGti          m_gti;
+    GLATLtCubeMap      m_exposure;
+    GLATLtCubeMap      m_weighted_exposure;
+    GGti               m_gti;
+    unsigned long long m_checksum;
 };
 
 #endif /* GLATLTCUBE_HPP */
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GFitsTable.hpp"
 #include "GSkymap.hpp"
@@ -48,6 +49,12 @@ typedef double (*_ltcube_ctheta_phi)(const double& costheta, const double& phi);
  *
  * A livetime cube map holds a set of HEALPix skymaps that are a function
  * of the cosine of the zenith angle and (optionally) of the azimuth angle.
+ *
+ * After reading, the skymap pixels are rearranged in pixel-major order,
+ * so that all cos theta (and phi) bins of a given pixel are contiguous in
+ * memory. The skymap is hence only used for its projection and for the
+ * storage of the livetimes, and its pixels should not be accessed through
+ * the skymap (pixel,map) operator.
  ***************************************************************************/
 class GLATLtCubeMap : public GBase {
 
@@ -66,6 +73,9 @@ public:
     double         operator()(const GSkyDir& dir, const GEnergy& energy,
                               const double& offset, const GLATPsf& psf,
                               const GLATAeff& aeff);
+    double         operator()(const GSkyDir& dir,
+                              const std::vector<double>& weights,
+                              const GLATAeff& aeff) const;
 
     // Methods
     void           clear(void);
@@ -79,20 +89,30 @@ public:
     double         phi(const int& index) const;
     double         costhetamin(void) const { return m_min_ctheta; }
     std::string    costhetabin(void) const;
+    unsigned long long checksum(const unsigned long long& hash) const;
     std::string    print(const GChatter& chatter = NORMAL) const;
+    void           weights(const GEnergy& energy, const GLATAeff& aeff,
+                           std::vector<double>& weights) const;
+    void           weights(const GEnergy& energy, const double& offset,
+                           const GLATPsf& psf, const GLATAeff& aeff,
+                           std::vector<double>& weights) const;
 
 private:
     // Methods
-    void init_members(void);
-    void copy_members(const GLATLtCubeMap& cube);
-    void free_members(void);
-    
+    void   init_members(void);
+    void   copy_members(const GLATLtCubeMap& cube);
+    void   free_members(void);
+    void   set_livetimes(void);
+    double sum(const int& pixel, const int& offset,
+               const std::vector<double>& weights) const;
+    const double* livetimes(const int& pixel) const;
+
     // Protected members
-    GSkymap m_map;          //!< Lifetime cube map
-    int     m_num_ctheta;   //!< Number of bins in cos theta
-    int     m_num_phi;      //!< Number of bins in phi
-    double  m_min_ctheta;   //!< Minimum cos theta value
-    bool    m_sqrt_bin;     //!< Square root binning?
+    GSkymap             m_map;        //!< Lifetime cube map (pixel-major)
+    int                 m_num_ctheta; //!< Number of bins in cos theta
+    int                 m_num_phi;    //!< Number of bins in phi
+    double              m_min_ctheta; //!< Minimum cos theta value
+    bool                m_sqrt_bin;   //!< Square root binning?
 };
 
 #endif /* GLATLTCUBEMAP_HPP */
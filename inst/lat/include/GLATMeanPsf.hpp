@@ -36,6 +36,7 @@
 
 /* __ Forward declarations _______________________________________________ */
 class GLATObservation;
+class GFits;
 
 
 /***********************************************************************//**
@@ -66,6 +67,12 @@ public:
     GLATMeanPsf* clone(void) const;
     int          size(void) const;
     void         set(const GSkyDir& dir, const GLATObservation& obs);
+    void         set(const GSkyDir& dir, const GLATObservation& obs,
+                     const std::vector<std::vector<double> >& aeff_weights,
+                     const std::vector<std::vector<double> >& psf_weights);
+    void         weights(const GLATObservation& obs,
+                         std::vector<std::vector<double> >& aeff_weights,
+                         std::vector<std::vector<double> >& psf_weights) const;
     int          noffsets(void) const { return m_offset.size(); }
     int          nenergies(void) const { return m_energy.size(); }
     double       offset(const int& inx) { return m_offset[inx]; }
@@ -77,6 +84,12 @@ public:
     void         thetamax(const double& value) { m_theta_max=value; }
     double       psf(const double& offset, const double& logE);
     double       exposure(const double& logE);
+    double       containment(const GSkyDir& centre, const double& radius,
+                             const double& logE);
+    void         load(const std::string& filename);
+    void         save(const std::string& filename, bool clobber = false) const;
+    void         read(const GFits* file);
+    void         write(GFits& file) const;
     std::string  print(const GChatter& chatter = NORMAL) const;
 
 private:
@@ -101,16 +114,6 @@ private:
     // Bi-linear interpolation data
     double               m_last_energy;  //!< Last requested logE value
     double               m_last_offset;  //!< Last requested offset value
-    int                  m_inx1_exp;     //!< Exposure index 1
-    int                  m_inx2_exp;     //!< Exposure index 2
-    int                  m_inx1;         //!< Index 1
-    int                  m_inx2;         //!< Index 2
-    int                  m_inx3;         //!< Index 3
-    int                  m_inx4;         //!< Index 4
-    double               m_wgt1;         //!< Weighting factor 1
-    double               m_wgt2;         //!< Weighting factor 2
-    double               m_wgt3;         //!< Weighting factor 3
-    double               m_wgt4;         //!< Weighting factor 4
 };
 
 #endif /* GLATMEANPSF_HPP */
@@ -70,6 +70,9 @@ public:
     virtual void             write(GXmlElement& xml) const;
     virtual std::string      print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual void             prepare(const GModels& models);
+
     // Other methods
     void                     load_unbinned(const std::string& ft1name,
                                            const std::string& ft2name,
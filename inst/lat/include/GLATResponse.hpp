@@ -30,17 +30,27 @@
 /* __ Includes ___________________________________________________________ */
 #include <vector>
 #include <string>
+#include <map>
+#include <set>
 #include "GLATEventAtom.hpp"
 #include "GLATEventBin.hpp"
 #include "GLATAeff.hpp"
 #include "GLATPsf.hpp"
 #include "GLATEdisp.hpp"
 #include "GLATMeanPsf.hpp"
+#include "GNodeArray.hpp"
 #include "GEvent.hpp"
 #include "GModel.hpp"
 #include "GObservation.hpp"
 #include "GResponse.hpp"
 
+/* __ Forward declarations _______________________________________________ */
+class GModels;
+class GModelSpatial;
+class GLATEventCube;
+class GLATEventList;
+class GLATObservation;
+
 
 /***********************************************************************//**
  * @class GLATResponse
@@ -74,6 +84,10 @@ public:
     virtual double irf(const GEvent&       event,
                        const GSource&      source,
                        const GObservation& obs) const;
+    virtual double npred_ptsrc(const GSource&      source,
+                               const GObservation& obs) const;
+    virtual double npred_diffuse(const GSource&      source,
+                                 const GObservation& obs) const;
 
     // Other Methods
     void        caldb(const std::string& caldb);
@@ -87,6 +101,12 @@ public:
     void        save(const std::string& rspname) const;
     bool        force_mean(void) { return m_force_mean; }
     void        force_mean(const bool& value) { m_force_mean=value; }
+    void        set_mean_psfs(const GModels& models,
+                              const GLATObservation& obs);
+    void        set_roi_exposure(const GModels& models,
+                                 const GLATObservation& obs);
+    std::string meanpsf_cache(void) const { return m_meanpsf_cache; }
+    void        meanpsf_cache(const std::string& dirname);
 
     // Reponse methods
     double irf(const GLATEventAtom& event,
@@ -97,10 +117,47 @@ public:
                const GObservation& obs) const;
 
 private:
+    // Mean PSF table entry
+    struct ptsrc_memo {
+        unsigned long        instance; //!< Response instance
+        const GModelSpatial* model;    //!< Spatial model
+        const std::string*   name;     //!< Source name
+        GLATMeanPsf*         psf;      //!< Mean PSF
+    };
+
+    // Diffuse model index table entry
+    struct diffindex_memo {
+        unsigned long        instance; //!< Response instance
+        unsigned long        events;   //!< Source map or diffuse response instance
+        const GModelSpatial* model;    //!< Spatial model
+        const std::string*   name;     //!< Source name
+        int                  index;    //!< Diffuse model index
+    };
+
     // Private methods
     void init_members(void);
     void copy_members(const GLATResponse& rsp);
     void free_members(void);
+    GLATMeanPsf* mean_psf(const GSource& source, const GObservation& obs) const;
+    GLATMeanPsf* mean_psf(const GSkyDir& dir, const GObservation& obs) const;
+    GLATMeanPsf* new_mean_psf(const GSkyDir& dir,
+                              const GLATObservation& obs) const;
+    static unsigned long ptsrc_instance(void);
+    int          diffindex(const GLATEventCube& cube,
+                           const GSource&       source) const;
+    int          diffindex(const GLATEventList& list,
+                           const GSource&       source) const;
+    double       npred_mean_psf(GLATMeanPsf&        psf,
+                                const GEnergy&      energy,
+                                const GObservation& obs) const;
+    bool         has_roi_exposure(const GLATObservation& obs) const;
+    void         compute_roi_exposure(const GLATObservation& obs);
+    std::string  meanpsf_cache_file(const GSkyDir& dir,
+                                    const GLATObservation& obs) const;
+    bool         meanpsf_cache_load(GLATMeanPsf& psf, const GSkyDir& dir,
+                                    const GLATObservation& obs) const;
+    bool         meanpsf_cache_save(const GLATMeanPsf& psf,
+                                    const GLATObservation& obs) const;
 
     // Private members
     std::string               m_caldb;      //!< Name of or path to the calibration database
@@ -112,6 +169,17 @@ private:
     std::vector<GLATPsf*>     m_psf;        //!< Point spread functions
     std::vector<GLATEdisp*>   m_edisp;      //!< Energy dispersions
     std::vector<GLATMeanPsf*> m_ptsrc;      //!< Mean PSFs for point sources
+    std::map<std::string,int> m_ptsrc_handles; //!< Mean PSF handles
+    unsigned long             m_ptsrc_instance; //!< Response instance
+    std::string               m_meanpsf_cache; //!< Mean PSF cache directory
+    std::set<std::string>     m_diffnames;  //!< Names of resolved diffuse models
+    std::vector<GSkyDir>      m_roi_dirs;   //!< ROI exposure directions
+    std::vector<double>       m_roi_omega;  //!< ROI exposure solid angles
+    GNodeArray                m_roi_energies; //!< ROI exposure log10 energies
+    std::vector<double>       m_roi_exposure; //!< ROI exposure (pixel-major)
+    GSkyDir                   m_roi_centre; //!< ROI exposure centre
+    double                    m_roi_radius; //!< ROI exposure radius (deg)
+    unsigned long long        m_roi_ltcube; //!< ROI exposure livetime cube checksum
 };
 
 #endif /* GLATRESPONSE_HPP */
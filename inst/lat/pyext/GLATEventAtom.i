@@ -48,6 +48,10 @@ public:
     const GLATInstDir& dir(void) const;
     const GEnergy&     energy(void) const;
     const GTime&       time(void) const;
+
+    // Other methods
+    int                ndiffrsp(void) const;
+    double             diffrsp(const int& index) const;
 };
 
 
@@ -53,6 +53,12 @@ public:
     virtual int            number(void) const;
     virtual void           roi(const GRoi& roi);
     virtual const GLATRoi& roi(void) const;
+
+    // Other methods
+    int                    ndiffrsp(void) const;
+    std::string            diffname(const int& index) const;
+    int                    diffindex(const std::string& name) const;
+    unsigned long          diffrsp_instance(void) const;
 };
 
 
@@ -58,6 +58,7 @@ public:
     GLATLtCube* clone(void) const;
     void        load(const std::string& filename);
     void        save(const std::string& filename, bool clobber=false) const;
+    unsigned long long checksum(void) const;
 };
 
 
@@ -68,6 +68,12 @@ public:
     void         thetamax(const double& value);
     double       psf(const double& offset, const double& logE);
     double       exposure(const double& logE);
+    double       containment(const GSkyDir& centre, const double& radius,
+                             const double& logE);
+    void         load(const std::string& filename);
+    void         save(const std::string& filename, bool clobber = false) const;
+    void         read(const GFits* file);
+    void         write(GFits& file) const;
 };
 
 
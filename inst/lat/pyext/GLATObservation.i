@@ -54,6 +54,9 @@ public:
     virtual void             read(const GXmlElement& xml);
     virtual void             write(GXmlElement& xml) const;
 
+    // Implemented virtual base class methods
+    virtual void             prepare(const GModels& models);
+
     // Other methods
     void                     load_unbinned(const std::string& ft1name,
                                            const std::string& ft2name,
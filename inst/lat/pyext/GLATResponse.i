@@ -57,6 +57,10 @@ public:
     virtual double irf(const GEvent&       event,
                        const GSource&      source,
                        const GObservation& obs) const;
+    virtual double npred_ptsrc(const GSource&      source,
+                               const GObservation& obs) const;
+    virtual double npred_diffuse(const GSource&      source,
+                                 const GObservation& obs) const;
 
     // Other Methods
     void        caldb(const std::string& caldb);
@@ -70,6 +74,12 @@ public:
     void        save(const std::string& rspname) const;
     bool        force_mean(void);
     void        force_mean(const bool& value);
+    void        set_mean_psfs(const GModels& models,
+                              const GLATObservation& obs);
+    void        set_roi_exposure(const GModels& models,
+                                 const GLATObservation& obs);
+    std::string meanpsf_cache(void) const;
+    void        meanpsf_cache(const std::string& dirname);
 
     // Reponse methods
     double irf(const GLATEventAtom& event,
@@ -29,11 +29,13 @@
 #include <config.h>
 #endif
 #include <string>
+#include "GException.hpp"
 #include "GLATEventAtom.hpp"
 #include "GLATException.hpp"
 #include "GTools.hpp"
 
 /* __ Method name definitions ____________________________________________ */
+#define G_DIFFRSP                              "GLATEventAtom::diffrsp(int&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -164,6 +166,32 @@ GLATEventAtom* GLATEventAtom::clone(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return diffuse response component
+ *
+ * @param[in] index Diffuse response component index [0,...,ndiffrsp()-1].
+ *
+ * @exception GException::out_of_range
+ *            Component index outside valid range.
+ *
+ * Returns the diffuse response of the event for a given diffuse model
+ * component. The diffuse responses are read from the DIFRSPx columns of
+ * the event list.
+ ***************************************************************************/
+double GLATEventAtom::diffrsp(const int& index) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= m_num_difrsp) {
+        throw GException::out_of_range(G_DIFFRSP, index, 0, m_num_difrsp-1);
+    }
+    #endif
+
+    // Return diffuse response
+    return m_difrsp[index];
+}
+
+
 /***********************************************************************//**
  * @brief Print event information
  *
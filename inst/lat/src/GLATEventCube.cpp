@@ -38,11 +38,13 @@
 #define G_NAXIS                                   "GLATEventCube::naxis(int)"
 #define G_DIFFNAME                            "GLATEventCube::diffname(int&)"
 #define G_DIFFRSP                              "GLATEventCube::diffrsp(int&)"
+#define G_DIFFRSP_BIN            "GLATEventCube::diffrsp(int&, int&, int&)"
 #define G_READ_SRCMAP               "GLATEventCube::read_srcmap(GFitsImage*)"
 #define G_SET_DIRECTIONS                    "GLATEventCube::set_directions()"
 #define G_SET_ENERGIES                        "GLATEventCube::set_energies()"
 #define G_SET_TIMES                              "GLATEventCube::set_times()"
-#define G_SET_BIN                              "GLATEventCube::set_bin(int&)"
+#define G_BIN                        "GLATEventCube::bin(int&, GEventBin*)"
+#define G_SET_BIN                "GLATEventCube::set_bin(int&, GLATEventBin&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -179,6 +181,56 @@ const GLATEventBin* GLATEventCube::operator[](const int& index) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Allocate event bin buffer
+ *
+ * @return Pointer to new LAT event bin.
+ *
+ * Allocates an event bin that can be passed as buffer to the bin() method.
+ * The event cube is not accessed, hence the method can be called
+ * concurrently by several threads. The caller is responsible for deleting
+ * the event bin.
+ ***************************************************************************/
+GLATEventBin* GLATEventCube::new_bin(void) const
+{
+    // Return new event bin
+    return (new GLATEventBin);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin without modifying the event cube
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] buffer Event bin buffer (a clone of a LAT event bin).
+ * @return Pointer to event bin.
+ *
+ * @exception GException::invalid_argument
+ *            Event bin buffer is not a LAT event bin.
+ *
+ * Sets the pointers of the event bin @p buffer so that they point to the
+ * information of the bin with the specified @p index, and returns a
+ * pointer to the @p buffer. As the event cube is not modified, the method
+ * can be called concurrently by several threads, each holding its own
+ * bin buffer.
+ ***************************************************************************/
+const GLATEventBin* GLATEventCube::bin(const int& index, GEventBin* buffer) const
+{
+    // Get LAT event bin buffer
+    GLATEventBin* bin = dynamic_cast<GLATEventBin*>(buffer);
+    if (bin == NULL) {
+        throw GException::invalid_argument(G_BIN,
+              "Event bin buffer is not a LAT event bin.");
+    }
+
+    // Set event bin
+    set_bin(index, *bin);
+
+    // Return pointer
+    return bin;
+}
+
+
 /***********************************************************************//**
  * @brief Clear instance
  *
@@ -541,6 +593,97 @@ GSkymap* GLATEventCube::diffrsp(const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set energy nodes
+ *
+ * @param[in] enodes Energy nodes (log10 of energy in MeV).
+ *
+ * Sets the energy nodes of the source maps and recomputes the energy node
+ * interpolation weights of all energy bins.
+ ***************************************************************************/
+void GLATEventCube::enodes(const GNodeArray& enodes)
+{
+    // Set energy nodes
+    m_enodes = enodes;
+
+    // Set energy node interpolation weights
+    set_enodes_weights();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of diffuse model
+ *
+ * @param[in] name Name of diffuse model.
+ * @return Diffuse model index [0,...,ndiffrsp()-1] (-1 if not found).
+ *
+ * Returns the index of the diffuse model with the specified @p name, or -1
+ * if the event cube holds no source map for this model. The index is
+ * looked up from a map that is set up when the source maps are read, so
+ * that the source maps need not be scanned by name.
+ ***************************************************************************/
+int GLATEventCube::diffindex(const std::string& name) const
+{
+    // Search diffuse model
+    std::map<std::string,int>::const_iterator it = m_srcmap_handles.find(name);
+
+    // Return index
+    return ((it != m_srcmap_handles.end()) ? it->second : -1);
+}
+
+
+/***********************************************************************//**
+ * @brief Return diffuse response value for an event bin
+ *
+ * @param[in] index Diffuse model index [0,...,ndiffrsp()-1].
+ * @param[in] ipix Spatial pixel index [0,...,npix()-1].
+ * @param[in] ieng Energy bin index [0,...,ebins()-1].
+ * @return Diffuse response value (counts/pixel/MeV).
+ *
+ * @exception GException::out_of_range
+ *            Model, pixel or energy index out of valid range.
+ *
+ * Returns the source map value of a diffuse model for a spatial pixel at
+ * the log mean energy of an energy bin. The source map is linearly
+ * interpolated between the energy nodes, using interpolation indices and
+ * weights that are precomputed for all energy bins, so that no node array
+ * needs to be set up for each call.
+ ***************************************************************************/
+double GLATEventCube::diffrsp(const int& index, const int& ipix,
+                              const int& ieng) const
+{
+    // Optionally check if the indices are valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= ndiffrsp()) {
+        throw GException::out_of_range(G_DIFFRSP_BIN, index, 0, ndiffrsp()-1);
+    }
+    if (ipix < 0 || ipix >= npix()) {
+        throw GException::out_of_range(G_DIFFRSP_BIN, ipix, 0, npix()-1);
+    }
+    if (ieng < 0 || 2*ieng >= (int)m_enodes_inx.size()) {
+        throw GException::out_of_range(G_DIFFRSP_BIN, ieng, 0,
+                                       m_enodes_inx.size()/2-1);
+    }
+    #endif
+
+    // Get pointer to source map pixels
+    const GSkymap* map    = m_srcmap[index];
+    const double*  pixels = map->pixels() + ipix;
+    int            npix   = map->npix();
+
+    // Get interpolation indices and weights
+    int           inx = 2 * ieng;
+    const int*    i   = &m_enodes_inx[inx];
+    const double* w   = &m_enodes_wgt[inx];
+
+    // Return interpolated value
+    return (w[0] * pixels[i[0] * npix] + w[1] * pixels[i[1] * npix]);
+}
+
+
 /***********************************************************************//**
  * @brief Computes the maximum radius (in degrees) around a given source
  *        direction that fits spatially into the event cube
@@ -619,7 +762,11 @@ void GLATEventCube::init_members(void)
     m_time.clear();
     m_srcmap.clear();
     m_srcmap_names.clear();
+    m_srcmap_handles.clear();
+    m_srcmap_instance = new_srcmap_instance();
     m_enodes.clear();
+    m_enodes_inx.clear();
+    m_enodes_wgt.clear();
     m_dirs.clear();
     m_omega.clear();
     m_energies.clear(); 
@@ -645,7 +792,10 @@ void GLATEventCube::copy_members(const GLATEventCube& cube)
     m_ontime       = cube.m_ontime;
     m_srcmap       = cube.m_srcmap;
     m_srcmap_names = cube.m_srcmap_names;
+    m_srcmap_handles = cube.m_srcmap_handles;
     m_enodes       = cube.m_enodes;
+    m_enodes_inx   = cube.m_enodes_inx;
+    m_enodes_wgt   = cube.m_enodes_wgt;
     m_dirs         = cube.m_dirs;
     m_omega        = cube.m_omega;
     m_energies     = cube.m_energies;
@@ -734,9 +884,13 @@ void GLATEventCube::read_srcmap(const GFitsImage* hdu)
         }
 
         // Append source map to list of maps
+        m_srcmap_handles[hdu->extname()] = m_srcmap.size();
         m_srcmap.push_back(map);
         m_srcmap_names.push_back(hdu->extname());
 
+        // Signal that the source map handles have changed
+        m_srcmap_instance = new_srcmap_instance();
+
     } // endif: HDU was valid
 
     // Return
@@ -823,12 +977,17 @@ void GLATEventCube::set_directions(void)
     m_dirs.reserve(npix());
     m_omega.reserve(npix());
 
-    // Set pixel directions and solid angles
+    // Set pixel directions and solid angles. The sky directions of each
+    // row of pixels are computed using a bulk transformation.
+    std::vector<GSkyPixel> pixels(nx());
     for (int iy = 0; iy < ny(); ++iy) {
         for (int ix = 0; ix < nx(); ++ix) {
-            GSkyPixel pixel = GSkyPixel(double(ix), double(iy));
-            m_dirs.push_back(GLATInstDir(m_map.xy2dir(pixel)));
-            m_omega.push_back(m_map.omega(pixel));
+            pixels[ix] = GSkyPixel(double(ix), double(iy));
+        }
+        std::vector<GSkyDir> dirs = m_map.xy2dir(pixels);
+        for (int ix = 0; ix < nx(); ++ix) {
+            m_dirs.push_back(GLATInstDir(dirs[ix]));
+            m_omega.push_back(m_map.omega(pixels[ix]));
         }
     }
 
@@ -870,12 +1029,85 @@ void GLATEventCube::set_energies(void)
         m_enodes.append(log10(ebounds().emin(i).MeV()));
     }
     m_enodes.append(log10(ebounds().emax(ebins()-1).MeV()));
+
+    // Set energy node interpolation weights
+    set_enodes_weights();
     
     // Return
     return;
 }
 
 
+/***********************************************************************//**
+ * @brief Set energy node interpolation indices and weights
+ *
+ * Computes for all energy bins the indices and weights of the energy nodes
+ * that are needed to interpolate the source maps at the log mean energy of
+ * the bin. For energy bin i, the indices and weights are stored at
+ * positions 2i and 2i+1 of the m_enodes_inx and m_enodes_wgt arrays.
+ ***************************************************************************/
+void GLATEventCube::set_enodes_weights(void)
+{
+    // Clear indices and weights
+    m_enodes_inx.clear();
+    m_enodes_wgt.clear();
+
+    // Continue only if there are energy nodes and bin energies
+    if (m_enodes.size() > 0 && !m_energies.empty()) {
+
+        // Reserve space for indices and weights
+        m_enodes_inx.reserve(2*m_energies.size());
+        m_enodes_wgt.reserve(2*m_energies.size());
+
+        // Compute indices and weights for all energy bins
+        int nenergies = m_energies.size();
+        for (int i = 0; i < nenergies; ++i) {
+            int    inx_left;
+            int    inx_right;
+            double wgt_left;
+            double wgt_right;
+            m_enodes.weights(m_energies[i].log10MeV(), inx_left, inx_right,
+                             wgt_left, wgt_right);
+            m_enodes_inx.push_back(inx_left);
+            m_enodes_inx.push_back(inx_right);
+            m_enodes_wgt.push_back(wgt_left);
+            m_enodes_wgt.push_back(wgt_right);
+        }
+
+    } // endif: there were energy nodes and bin energies
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return new source map instance identifier
+ *
+ * @return Unique source map instance identifier (>0).
+ *
+ * Returns an identifier that has not been used before. A new identifier is
+ * assigned to the event cube whenever its source map handles change, so
+ * that clients that memorise diffuse model indices can verify that the
+ * indices still apply to the event cube.
+ ***************************************************************************/
+unsigned long GLATEventCube::new_srcmap_instance(void)
+{
+    // Identifier counter
+    static unsigned long last_instance = 0;
+
+    // Get new identifier
+    unsigned long instance;
+    #pragma omp critical(GLATEventCube_new_srcmap_instance)
+    {
+        instance = ++last_instance;
+    }
+
+    // Return identifier
+    return instance;
+}
+
+
 /***********************************************************************//**
  * @brief Set mean event time and ontime of event cube.
  *
@@ -928,6 +1160,32 @@ void GLATEventCube::set_times(void)
  * as if they were stored in an array.
  ***************************************************************************/
 void GLATEventCube::set_bin(const int& index)
+{
+    // Set actual event bin
+    set_bin(index, m_bin);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set event bin
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] bin Event bin.
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GLATException::no_energies
+ *            Energy vectors have not been set up.
+ * @exception GLATException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Sets up the pointers in the event @p bin so that they point to the
+ * information of the bin with the specified @p index.
+ ***************************************************************************/
+void GLATEventCube::set_bin(const int& index, GLATEventBin& bin) const
 {
     // Optionally check if the index is valid
     #if defined(G_RANGE_CHECK)
@@ -947,19 +1205,19 @@ void GLATEventCube::set_bin(const int& index)
     }
 
     // Get pixel and energy bin indices.
-    m_bin.m_index = index;
-    m_bin.m_ipix  = index % npix();
-    m_bin.m_ieng  = index / npix();
+    bin.m_index = index;
+    bin.m_ipix  = index % npix();
+    bin.m_ieng  = index / npix();
 
     // Set pointers
-    m_bin.m_cube   = this;
-    m_bin.m_counts = &(m_map.pixels()[index]);
-    m_bin.m_energy = &(m_energies[m_bin.m_ieng]);
-    m_bin.m_time   = &m_time;
-    m_bin.m_dir    = &(m_dirs[m_bin.m_ipix]);
-    m_bin.m_omega  = &(m_omega[m_bin.m_ipix]);
-    m_bin.m_ewidth = &(m_ewidth[m_bin.m_ieng]);
-    m_bin.m_ontime = &m_ontime;
+    bin.m_cube   = const_cast<GLATEventCube*>(this);
+    bin.m_counts = &(m_map.pixels()[index]);
+    bin.m_energy = const_cast<GEnergy*>(&(m_energies[bin.m_ieng]));
+    bin.m_time   = const_cast<GTime*>(&m_time);
+    bin.m_dir    = const_cast<GLATInstDir*>(&(m_dirs[bin.m_ipix]));
+    bin.m_omega  = const_cast<double*>(&(m_omega[bin.m_ipix]));
+    bin.m_ewidth = const_cast<GEnergy*>(&(m_ewidth[bin.m_ieng]));
+    bin.m_ontime = const_cast<double*>(&m_ontime);
 
     // Return
     return;
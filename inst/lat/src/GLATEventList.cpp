@@ -42,6 +42,7 @@
 /* __ Method name definitions ____________________________________________ */
 #define G_OPERATOR                          "GLATEventList::operator[](int&)"
 #define G_ROI                                     "GLATEventList::roi(GRoi&)"
+#define G_DIFFNAME                            "GLATEventList::diffname(int&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -365,6 +366,50 @@ void GLATEventList::roi(const GRoi& roi)
 }
 
 
+/***********************************************************************//**
+ * @brief Return name of diffuse response component
+ *
+ * @param[in] index Diffuse response component index [0,...,ndiffrsp()-1].
+ *
+ * @exception GException::out_of_range
+ *            Component index outside valid range.
+ *
+ * Returns the model label of a diffuse response component.
+ ***************************************************************************/
+std::string GLATEventList::diffname(const int& index) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= ndiffrsp()) {
+        throw GException::out_of_range(G_DIFFNAME, index, 0, ndiffrsp()-1);
+    }
+    #endif
+
+    // Return name
+    return m_difrsp_label[index];
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of diffuse response component
+ *
+ * @param[in] name Name of diffuse model.
+ * @return Diffuse response component index (-1 if not found).
+ *
+ * Returns the index of the diffuse response component of the model with
+ * the specified @p name, or -1 if the event list holds no diffuse response
+ * for this model.
+ ***************************************************************************/
+int GLATEventList::diffindex(const std::string& name) const
+{
+    // Search diffuse response component
+    std::map<std::string,int>::const_iterator it = m_difrsp_handles.find(name);
+
+    // Return index
+    return ((it != m_difrsp_handles.end()) ? it->second : -1);
+}
+
+
 /***********************************************************************//**
  * @brief Print event list information
  *
@@ -430,6 +475,8 @@ void GLATEventList::init_members(void)
     m_roi.clear();
     m_events.clear();
     m_difrsp_label.clear();
+    m_difrsp_handles.clear();
+    m_diffrsp_instance = new_diffrsp_instance();
     m_ds_type.clear();
     m_ds_unit.clear();
     m_ds_value.clear();
@@ -451,6 +498,7 @@ void GLATEventList::copy_members(const GLATEventList& list)
     m_roi          = list.m_roi;
     m_events       = list.m_events;
     m_difrsp_label = list.m_difrsp_label;
+    m_difrsp_handles = list.m_difrsp_handles;
     m_ds_type      = list.m_ds_type;
     m_ds_unit      = list.m_ds_unit;
     m_ds_value     = list.m_ds_value;
@@ -545,7 +593,8 @@ void GLATEventList::read_events(const GFitsTable& table)
 
             // Allocate components
             for (int i = 0; i < num; ++i) {
-                m_events[i].m_difrsp = new double[num_difrsp];
+                m_events[i].m_difrsp     = new double[num_difrsp];
+                m_events[i].m_num_difrsp = num_difrsp;
             }
 
             // Load diffuse columns
@@ -563,6 +612,9 @@ void GLATEventList::read_events(const GFitsTable& table)
                     m_difrsp_label.push_back("NONE");
                 }
 
+                // Set DIFRSP handle
+                m_difrsp_handles[m_difrsp_label.back()] = k;
+
                 // Get column pointer
                 GFitsTableFloatCol* ptr_dif = 
                     static_cast<GFitsTableFloatCol*>(const_cast<GFitsTableCol*>(&table[std::string(keyword)]));
@@ -574,6 +626,9 @@ void GLATEventList::read_events(const GFitsTable& table)
 
             } // endfor: looped over diffuse columns
 
+            // Signal that the diffuse response handles have changed
+            m_diffrsp_instance = new_diffrsp_instance();
+
         } // endif: diffuse components found
 
     } // endif: events found
@@ -661,6 +716,33 @@ void GLATEventList::read_ds_keys(const GFitsHDU& hdu)
 }
 
 
+/***********************************************************************//**
+ * @brief Return new diffuse response instance identifier
+ *
+ * @return Unique diffuse response instance identifier (>0).
+ *
+ * Returns an identifier that has not been used before. A new identifier is
+ * assigned to the event list whenever its diffuse response handles change,
+ * so that clients that memorise diffuse model indices can verify that the
+ * indices still apply to the event list.
+ ***************************************************************************/
+unsigned long GLATEventList::new_diffrsp_instance(void)
+{
+    // Identifier counter
+    static unsigned long last_instance = 0;
+
+    // Get new identifier
+    unsigned long instance;
+    #pragma omp critical(GLATEventList_new_diffrsp_instance)
+    {
+        instance = ++last_instance;
+    }
+
+    // Return identifier
+    return instance;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                               Friends                                   =
@@ -342,6 +342,55 @@ double GLATLtCube::operator() (const GSkyDir& dir, const GEnergy& energy,
 }
 
 
+/***********************************************************************//**
+ * @brief Sum zenith angle weights multiplied by efficiency corrected
+ *        livetime
+ *
+ * @param[in] dir Sky direction.
+ * @param[in] energy Energy.
+ * @param[in] weights Zenith angle weights.
+ * @param[in] aeff Effective area.
+ *
+ * Computes
+ * \f[\sum_{\cos \theta, \phi} T_{\rm corr.~live}(\cos \theta, \phi)
+ *    w(\cos \theta, \phi)\f]
+ * where
+ * \f$T_{\rm corr.~live}(\cos \theta, \phi)\f$ is the efficiency corrected
+ * livetime as a function of the cosine of the zenith and of the azimuth
+ * angle, and
+ * \f$w(\cos \theta, \phi)\f$ are weights that have been computed using
+ * one of the weights() methods. The effective area is only used for the
+ * efficiency correction factors and to decide whether the sum extends
+ * over azimuth angles.
+ ***************************************************************************/
+double GLATLtCube::operator() (const GSkyDir& dir, const GEnergy& energy,
+                               const std::vector<double>& weights,
+                               const GLATAeff& aeff) const
+{
+    // Compute exposure
+    double exposure = m_exposure(dir, weights, aeff);
+
+    // Optionally compute livetime factors for trigger rate- and
+    // energy-dependent efficiency corrections
+    if (aeff.hasefficiency()) {
+    
+        // Compute correction factors
+        double f1 = aeff.efficiency_factor1(energy);
+        double f2 = aeff.efficiency_factor2(energy);
+
+        // Compute correction
+        double correction = m_weighted_exposure(dir, weights, aeff);
+
+        // Set exposure
+        exposure = f1 * exposure + f2 * correction;
+
+    } // endif: corrections requested
+
+    // Return exposure
+    return exposure;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Public methods                              =
@@ -375,6 +424,57 @@ GLATLtCube* GLATLtCube::clone(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return effective area zenith angle weights
+ *
+ * @param[in] energy Energy.
+ * @param[in] aeff Effective area.
+ * @param[out] weights Zenith angle weights.
+ *
+ * Sets the effective area as function of the zenith (and optionally
+ * azimuth) angle bins of the livetime cube. The weights can be passed to
+ * the livetime sum operator for any number of sky directions.
+ ***************************************************************************/
+void GLATLtCube::weights(const GEnergy&       energy,
+                         const GLATAeff&      aeff,
+                         std::vector<double>& weights) const
+{
+    // Set weights
+    m_exposure.weights(energy, aeff, weights);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return PSF times effective area zenith angle weights
+ *
+ * @param[in] energy Energy.
+ * @param[in] offset Offset from true direction (deg).
+ * @param[in] psf Point spread function.
+ * @param[in] aeff Effective area.
+ * @param[out] weights Zenith angle weights.
+ *
+ * Sets the point spread function times the effective area as function of
+ * the zenith (and optionally azimuth) angle bins of the livetime cube.
+ * The weights can be passed to the livetime sum operator for any number
+ * of sky directions.
+ ***************************************************************************/
+void GLATLtCube::weights(const GEnergy&       energy,
+                         const double&        offset,
+                         const GLATPsf&       psf,
+                         const GLATAeff&      aeff,
+                         std::vector<double>& weights) const
+{
+    // Set weights
+    m_exposure.weights(energy, offset, psf, aeff, weights);
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Load livetime cube from FITS file
  *
@@ -409,6 +509,11 @@ void GLATLtCube::load(const std::string& filename)
     // Load GTIs
     m_gti.read(hdu_gti);
 
+    // Compute checksum of livetime cube content
+    m_checksum = gammalib::checksum(NULL, 0);
+    m_checksum = m_exposure.checksum(m_checksum);
+    m_checksum = m_weighted_exposure.checksum(m_checksum);
+
     // Close FITS file
     file.close();
 
@@ -476,6 +581,7 @@ void GLATLtCube::init_members(void)
     m_exposure.clear();
     m_weighted_exposure.clear();
     m_gti.clear();
+    m_checksum = 0;
 
     // Return
     return;
@@ -493,6 +599,7 @@ void GLATLtCube::copy_members(const GLATLtCube& cube)
     m_exposure          = cube.m_exposure;
     m_weighted_exposure = cube.m_weighted_exposure;
     m_gti               = cube.m_gti;
+    m_checksum          = cube.m_checksum;
 
     // Return
     return;
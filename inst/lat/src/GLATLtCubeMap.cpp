@@ -145,15 +145,15 @@ GLATLtCubeMap& GLATLtCubeMap::operator= (const GLATLtCubeMap& map)
  ***************************************************************************/
 double GLATLtCubeMap::operator() (const GSkyDir& dir, _ltcube_ctheta fct)
 {
-    // Get map index
-    int pixel = m_map.dir2pix(dir);
+    // Get livetimes of pixel
+    const double* livetime = livetimes(m_map.dir2pix(dir));
 
     // Initialise sum
     double sum = 0.0;
 
     // Loop over zenith angles
     for (int i = 0; i < m_num_ctheta; ++i)
-        sum += m_map(pixel, i) * (*fct)(costheta(i));
+        sum += livetime[i] * (*fct)(costheta(i));
 
     // Return sum
     return sum;
@@ -182,8 +182,8 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, _ltcube_ctheta fct)
  ***************************************************************************/
 double GLATLtCubeMap::operator() (const GSkyDir& dir, _ltcube_ctheta_phi fct)
 {
-    // Get map index
-    int pixel = m_map.dir2pix(dir);
+    // Get livetimes of pixel
+    const double* livetime = livetimes(m_map.dir2pix(dir));
 
     // Initialise sum
     double sum = 0.0;
@@ -194,7 +194,7 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, _ltcube_ctheta_phi fct)
     for (int iphi = 0, i = m_num_ctheta; iphi < m_num_phi; ++iphi) {
         double p = phi(iphi);
         for (int itheta = 0; itheta < m_num_ctheta; ++itheta, ++i) {
-            sum += m_map(pixel, i) * (*fct)(costheta(itheta), p);
+            sum += livetime[i] * (*fct)(costheta(itheta), p);
         }
     }
 
@@ -231,8 +231,8 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, _ltcube_ctheta_phi fct)
 double GLATLtCubeMap::operator() (const GSkyDir& dir, const GEnergy& energy,
                                   const GLATAeff& aeff)
 {
-    // Get map index
-    int pixel = m_map.dir2pix(dir);
+    // Get livetimes of pixel
+    const double* livetime = livetimes(m_map.dir2pix(dir));
 
     // Initialise sum
     double sum = 0.0;
@@ -240,6 +240,9 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, const GEnergy& energy,
     // Circumvent const correctness
     GLATAeff* fct = ((GLATAeff*)&aeff);
 
+    // Get log10 of energy
+    double logE = energy.log10MeV();
+
     // If livetime cube and response have phi dependence then sum over
     // zenith and azimuth. Note that the map index starts with m_num_ctheta
     // as the first m_num_ctheta maps correspond to an evaluation without
@@ -248,14 +251,14 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, const GEnergy& energy,
         for (int iphi = 0, i = m_num_ctheta; iphi < m_num_phi; ++iphi) {
             double p = phi(iphi);
             for (int itheta = 0; itheta < m_num_ctheta; ++itheta, ++i)
-                sum += m_map(pixel, i) * (*fct)(energy.log10MeV(), costheta(i), p);
+                sum += livetime[i] * (*fct)(logE, costheta(itheta), p);
         }
     }
 
     // ... otherwise sum only over zenith angle
     else {
         for (int i = 0; i < m_num_ctheta; ++i)
-            sum += m_map(pixel, i) * (*fct)(energy.log10MeV(), costheta(i));
+            sum += livetime[i] * (*fct)(logE, costheta(i));
     }
 
     // Return sum
@@ -290,8 +293,8 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, const GEnergy& energy,
                                   const double& offset, const GLATPsf& psf,
                                   const GLATAeff& aeff)
 {
-    // Get map index
-    int pixel = m_map.dir2pix(dir);
+    // Get livetimes of pixel
+    const double* livetime = livetimes(m_map.dir2pix(dir));
 
     // Initialise sum
     double sum = 0.0;
@@ -306,20 +309,23 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, const GEnergy& energy,
     // If livetime cube and response have phi dependence then sum over
     // zenith and azimuth. Note that the map index starts with m_num_ctheta
     // as the first m_num_ctheta maps correspond to an evaluation without
-    // any phi-dependence.
+    // any phi-dependence. The PSF does not depend on the azimuth angle,
+    // hence it is only evaluated once per zenith angle.
     if (hasphi() && aeff.hasphi()) {
-        for (int iphi = 0, i = m_num_ctheta; iphi < m_num_phi; ++iphi) {
-            double p = phi(iphi);
-            for (int itheta = 0; itheta < m_num_ctheta; ++itheta, ++i)
-                sum += m_map(pixel, i) * (*faeff)(logE, costheta(i), p) *
-                       (*fpsf)(offset, logE, costheta(i));
+        for (int itheta = 0; itheta < m_num_ctheta; ++itheta) {
+            double ctheta   = costheta(itheta);
+            double exposure = 0.0;
+            for (int iphi = 0, i = m_num_ctheta+itheta; iphi < m_num_phi;
+                 ++iphi, i += m_num_ctheta)
+                exposure += livetime[i] * (*faeff)(logE, ctheta, phi(iphi));
+            sum += exposure * (*fpsf)(offset, logE, ctheta);
         }
     }
 
     // ... otherwise sum only over zenith angle
     else {
         for (int i = 0; i < m_num_ctheta; ++i)
-            sum += m_map(pixel, i) * (*faeff)(logE, costheta(i)) *
+            sum += livetime[i] * (*faeff)(logE, costheta(i)) *
                    (*fpsf)(offset, logE, costheta(i));
     }
 
@@ -328,6 +334,40 @@ double GLATLtCubeMap::operator() (const GSkyDir& dir, const GEnergy& energy,
 }
 
 
+/***********************************************************************//**
+ * @brief Sum zenith angle weights multiplied by livetime
+ *
+ * @param[in] dir True sky direction.
+ * @param[in] weights Zenith angle weights.
+ * @param[in] aeff Effective area.
+ *
+ * Computes
+ * \f[\sum_{\cos \theta, \phi} T_{\rm live}(\cos \theta, \phi)
+ *    w(\cos \theta, \phi)\f]
+ * where
+ * \f$T_{\rm live}(\cos \theta, \phi)\f$ is the livetime as a function of
+ * the cosine of the zenith and the azimuth angle, and
+ * \f$w(\cos \theta, \phi)\f$ are the weights returned by one of the
+ * weights() methods for the same effective area. The effective area is
+ * only used to decide whether the sum extends over azimuth angles.
+ ***************************************************************************/
+double GLATLtCubeMap::operator() (const GSkyDir&             dir,
+                                  const std::vector<double>& weights,
+                                  const GLATAeff&            aeff) const
+{
+    // Get pixel index
+    int pixel = m_map.dir2pix(dir);
+
+    // If livetime cube and response have phi dependence then the weights
+    // start with map m_num_ctheta as the first m_num_ctheta maps correspond
+    // to an evaluation without any phi-dependence
+    int offset = (hasphi() && aeff.hasphi()) ? m_num_ctheta : 0;
+
+    // Return livetime weighted sum
+    return (sum(pixel, offset, weights));
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Public methods                              =
@@ -383,6 +423,9 @@ void GLATLtCubeMap::read(const GFitsTable* hdu)
     m_num_phi    = hdu->integer("PHIBINS");
     m_min_ctheta = hdu->real("COSMIN");
 
+    // Rearrange livetimes in pixel-major order
+    set_livetimes();
+
     // Return
     return;
 }
@@ -402,6 +445,94 @@ void GLATLtCubeMap::write(GFits* file) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return effective area zenith angle weights
+ *
+ * @param[in] energy True photon energy.
+ * @param[in] aeff Effective area.
+ * @param[out] weights Zenith angle weights.
+ *
+ * Sets the effective area for all zenith angle bins, or for all zenith
+ * and azimuth angle bins if the livetime cube and the effective area have
+ * a phi dependence. In the latter case the zenith angle is the most
+ * rapidely varying parameter. The @p weights vector is resized, hence a
+ * vector that is reused by the caller is not reallocated.
+ ***************************************************************************/
+void GLATLtCubeMap::weights(const GEnergy&       energy,
+                            const GLATAeff&      aeff,
+                            std::vector<double>& weights) const
+{
+    // Circumvent const correctness
+    GLATAeff* fct = ((GLATAeff*)&aeff);
+
+    // Get log10 of energy
+    double logE = energy.log10MeV();
+
+    // If livetime cube and response have phi dependence then set weights
+    // for zenith and azimuth ...
+    if (hasphi() && aeff.hasphi()) {
+        weights.resize(m_num_phi*m_num_ctheta);
+        for (int iphi = 0, i = 0; iphi < m_num_phi; ++iphi) {
+            double p = phi(iphi);
+            for (int itheta = 0; itheta < m_num_ctheta; ++itheta, ++i)
+                weights[i] = (*fct)(logE, costheta(itheta), p);
+        }
+    }
+
+    // ... otherwise set weights only for zenith angle
+    else {
+        weights.resize(m_num_ctheta);
+        for (int i = 0; i < m_num_ctheta; ++i)
+            weights[i] = (*fct)(logE, costheta(i));
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return PSF times effective area zenith angle weights
+ *
+ * @param[in] energy True photon energy.
+ * @param[in] offset Offset from true direction (deg).
+ * @param[in] psf Point spread function.
+ * @param[in] aeff Effective area.
+ * @param[out] weights Zenith angle weights.
+ *
+ * Sets the point spread function times the effective area for all zenith
+ * angle bins, or for all zenith and azimuth angle bins if the livetime
+ * cube and the effective area have a phi dependence.
+ ***************************************************************************/
+void GLATLtCubeMap::weights(const GEnergy&       energy,
+                            const double&        offset,
+                            const GLATPsf&       psf,
+                            const GLATAeff&      aeff,
+                            std::vector<double>& weights) const
+{
+    // Circumvent const correctness
+    GLATPsf* fpsf = ((GLATPsf*)&psf);
+
+    // Get log10 of energy
+    double logE = energy.log10MeV();
+
+    // Set effective area weights
+    this->weights(energy, aeff, weights);
+
+    // Multiply by PSF. The PSF does not depend on the azimuth angle, hence
+    // it is only evaluated once per zenith angle.
+    int num = weights.size();
+    for (int itheta = 0; itheta < m_num_ctheta; ++itheta) {
+        double value = (*fpsf)(offset, logE, costheta(itheta));
+        for (int i = itheta; i < num; i += m_num_ctheta)
+            weights[i] *= value;
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return cos theta value for an index
  *
@@ -486,6 +617,41 @@ std::string GLATLtCubeMap::costhetabin(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Continue checksum with livetime cube map content
+ *
+ * @param[in] hash Checksum of preceding data.
+ * @return Checksum.
+ *
+ * Continues the checksum @p hash with the binning and the livetimes of the
+ * livetime cube map. The checksum identifies the livetime cube content
+ * independently of the file from which it was loaded.
+ ***************************************************************************/
+unsigned long long GLATLtCubeMap::checksum(const unsigned long long& hash) const
+{
+    // Set binning attributes
+    int attributes[5] = {m_map.npix(), m_map.nmaps(), m_num_ctheta,
+                         m_num_phi, (m_sqrt_bin) ? 1 : 0};
+
+    // Hash binning attributes
+    unsigned long long result =
+        gammalib::checksum((const char*)attributes, sizeof(attributes), hash);
+    result = gammalib::checksum((const char*)&m_min_ctheta, sizeof(double),
+                                result);
+
+    // Hash livetimes
+    if (m_map.pixels() != NULL) {
+        result = gammalib::checksum((const char*)m_map.pixels(),
+                                    size_t(m_map.npix())*m_map.nmaps()*
+                                    sizeof(double),
+                                    result);
+    }
+
+    // Return checksum
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Print lifetime cube map information
  *
@@ -576,3 +742,99 @@ void GLATLtCubeMap::free_members(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Rearrange livetimes in pixel-major order
+ *
+ * Rearranges the skymap pixels so that all maps of a given pixel are
+ * contiguous in memory. The livetime of map @p i in pixel @p pixel is then
+ * stored at index pixel*nmaps+i. GSkymap stores the maps map-major, hence
+ * a sum over the maps of a pixel would otherwise stride over npix values
+ * for each term.
+ ***************************************************************************/
+void GLATLtCubeMap::set_livetimes(void)
+{
+    // Get map dimensions
+    int npix  = m_map.npix();
+    int nmaps = m_map.nmaps();
+
+    // Continue only if there are several maps
+    if (npix > 0 && nmaps > 1) {
+
+        // Copy map-major livetimes
+        double*             pixels = m_map.pixels();
+        std::vector<double> maps(pixels, pixels+npix*nmaps);
+
+        // Store livetimes in pixel-major order
+        const double* src = &maps[0];
+        for (int i = 0; i < nmaps; ++i, src += npix) {
+            double* dst = pixels + i;
+            for (int pixel = 0; pixel < npix; ++pixel, dst += nmaps)
+                *dst = src[pixel];
+        }
+
+    } // endif: there were several maps
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return pointer on livetimes of a pixel
+ *
+ * @param[in] pixel Pixel index.
+ * @return Pointer on the livetimes of all maps of the pixel.
+ ***************************************************************************/
+const double* GLATLtCubeMap::livetimes(const int& pixel) const
+{
+    // Return pointer on livetimes
+    return (m_map.pixels() + pixel*m_map.nmaps());
+}
+
+
+/***********************************************************************//**
+ * @brief Return livetime weighted sum for a pixel
+ *
+ * @param[in] pixel Pixel index.
+ * @param[in] offset Index of first map.
+ * @param[in] weights Weights for maps offset to offset+weights.size()-1.
+ * @return Livetime weighted sum.
+ *
+ * Computes the dot product between the livetimes of the maps starting at
+ * @p offset in pixel @p pixel and the @p weights vector. The sum is split
+ * over four independent partial sums so that the compiler can vectorise
+ * the loop.
+ ***************************************************************************/
+double GLATLtCubeMap::sum(const int&                 pixel,
+                          const int&                 offset,
+                          const std::vector<double>& weights) const
+{
+    // Return zero if there is nothing to sum
+    int num = weights.size();
+    if (num == 0 || m_map.pixels() == NULL)
+        return 0.0;
+
+    // Get pointers on livetimes and weights
+    const double* livetime = livetimes(pixel) + offset;
+    const double* weight   = &weights[0];
+
+    // Compute partial sums
+    double sum0 = 0.0;
+    double sum1 = 0.0;
+    double sum2 = 0.0;
+    double sum3 = 0.0;
+    int    i    = 0;
+    for (; i+3 < num; i += 4) {
+        sum0 += livetime[i]   * weight[i];
+        sum1 += livetime[i+1] * weight[i+1];
+        sum2 += livetime[i+2] * weight[i+2];
+        sum3 += livetime[i+3] * weight[i+3];
+    }
+    for (; i < num; ++i)
+        sum0 += livetime[i] * weight[i];
+
+    // Return sum
+    return ((sum0 + sum1) + (sum2 + sum3));
+}
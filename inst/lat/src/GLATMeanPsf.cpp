@@ -37,10 +37,19 @@
 #include "GLATObservation.hpp"
 #include "GLATEventCube.hpp"
 #include "GLATException.hpp"
+#include "GFits.hpp"
+#include "GFitsBinTable.hpp"
+#include "GFitsTableDoubleCol.hpp"
 
 /* __ Method name definitions ____________________________________________ */
-#define G_SET                  "GLATMeanPsf::set(GSkyDir&, GLATObservation&)"
+#define G_SET_WEIGHTS            "GLATMeanPsf::set(GSkyDir&, GLATObservation&,"\
+                                         " std::vector<std::vector<double> >&,"\
+                                          " std::vector<std::vector<double> >&)"
+#define G_WEIGHTS                      "GLATMeanPsf::weights(GLATObservation&,"\
+                                         " std::vector<std::vector<double> >&,"\
+                                          " std::vector<std::vector<double> >&)"
 #define G_EXPOSURE                              "GLATMeanPsf::exposure(int&)"
+#define G_READ                                  "GLATMeanPsf::read(GFits*)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -178,58 +187,46 @@ double GLATMeanPsf::operator() (const double& offset, const double& logE)
     // Continue only if arguments are within valid range
     if (offset < 70.0 && logE > 0.0) {
 
-        // Flag no change of values
-        //bool change = false;
-
-        // Set offset interpolation
-        //if (offset != m_last_offset) {
-            m_offset.set_value(offset);
-        //    m_last_offset = offset;
-        //    change        = true;
-        //}
-
-        // Set energy interpolation
-        //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
-        //    m_last_energy = logE;
-        //    change        = true;
-        //}
-
-        // If change occured then update interpolation indices and weighting
-        // factors
-        //if (change) {
-
-            // Set energy indices for exposure computation
-            m_inx1_exp = m_energy.inx_left();
-            m_inx2_exp = m_energy.inx_right();
-
-            // Set energy indices for PSF computation
-            int inx_energy_left  = m_inx1_exp  * noffsets();
-            int inx_energy_right = m_inx2_exp * noffsets();
-            
-            // Set array indices for bi-linear interpolation
-            m_inx1 = m_offset.inx_left()  + inx_energy_left;
-            m_inx2 = m_offset.inx_left()  + inx_energy_right;
-            m_inx3 = m_offset.inx_right() + inx_energy_left;
-            m_inx4 = m_offset.inx_right() + inx_energy_right;
-
-            // Set weighting factors for bi-linear interpolation
-            m_wgt1 = m_offset.wgt_left()  * m_energy.wgt_left();
-            m_wgt2 = m_offset.wgt_left()  * m_energy.wgt_right();
-            m_wgt3 = m_offset.wgt_right() * m_energy.wgt_left();
-            m_wgt4 = m_offset.wgt_right() * m_energy.wgt_right();
-
-        //} // endif: logE or ctheta changed
+        // Get interpolation indices and weighting factors. Local variables
+        // are used so that the method can be called concurrently.
+        int    inx_off_left;
+        int    inx_off_right;
+        int    inx_eng_left;
+        int    inx_eng_right;
+        double wgt_off_left;
+        double wgt_off_right;
+        double wgt_eng_left;
+        double wgt_eng_right;
+        m_offset.weights(offset, inx_off_left, inx_off_right,
+                         wgt_off_left, wgt_off_right);
+        m_energy.weights(logE, inx_eng_left, inx_eng_right,
+                         wgt_eng_left, wgt_eng_right);
+
+        // Set energy indices for PSF computation
+        int inx_energy_left  = inx_eng_left  * noffsets();
+        int inx_energy_right = inx_eng_right * noffsets();
+
+        // Set array indices for bi-linear interpolation
+        int inx1 = inx_off_left  + inx_energy_left;
+        int inx2 = inx_off_left  + inx_energy_right;
+        int inx3 = inx_off_right + inx_energy_left;
+        int inx4 = inx_off_right + inx_energy_right;
+
+        // Set weighting factors for bi-linear interpolation
+        double wgt1 = wgt_off_left  * wgt_eng_left;
+        double wgt2 = wgt_off_left  * wgt_eng_right;
+        double wgt3 = wgt_off_right * wgt_eng_left;
+        double wgt4 = wgt_off_right * wgt_eng_right;
 
         // Compute energy dependent exposure and map corrections
-        double fac_left  = m_exposure[m_inx1_exp] * m_mapcorr[m_inx1_exp];
-        double fac_right = m_exposure[m_inx2_exp] * m_mapcorr[m_inx2_exp];
+        double fac_left  = m_exposure[inx_eng_left]  * m_mapcorr[inx_eng_left];
+        double fac_right = m_exposure[inx_eng_right] * m_mapcorr[inx_eng_right];
 
         // Perform bi-linear interpolation
-        value = m_wgt1 * m_psf[m_inx1] * fac_left  +
-                m_wgt2 * m_psf[m_inx2] * fac_right +
-                m_wgt3 * m_psf[m_inx3] * fac_left  +
-                m_wgt4 * m_psf[m_inx4] * fac_right;
+        value = wgt1 * m_psf[inx1] * fac_left  +
+                wgt2 * m_psf[inx2] * fac_right +
+                wgt3 * m_psf[inx3] * fac_left  +
+                wgt4 * m_psf[inx4] * fac_right;
 
         // Optionally check for negative values
         #if G_SIGNAL_NEGATIVE_MEAN_PSF
@@ -309,6 +306,47 @@ int GLATMeanPsf::size(void) const
  * at which the mean PSF is computed.
  ***************************************************************************/
 void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
+{
+    // Compute zenith angle weights
+    std::vector<std::vector<double> > aeff_weights;
+    std::vector<std::vector<double> > psf_weights;
+    weights(obs, aeff_weights, psf_weights);
+
+    // Compute mean PSF and exposure
+    set(dir, obs, aeff_weights, psf_weights);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute mean PSF and exposure from zenith angle weights
+ *
+ * @param[in] dir Source location.
+ * @param[in] obs LAT observation.
+ * @param[in] aeff_weights Effective area zenith angle weights.
+ * @param[in] psf_weights PSF zenith angle weights.
+ *
+ * @exception GException::no_response
+ *            Response has not been defined.
+ * @exception GLATException::no_ltcube
+ *            Livetime cube has not been defined.
+ * @exception GException::invalid_argument
+ *            Weights are incompatible with observation.
+ *
+ * Computes the mean PSF and the energy dependent exposure for a source at
+ * a given sky location using zenith angle weights that have been computed
+ * beforehand by the weights() method. The weights do not depend on the
+ * source location, hence they can be shared between all sources of an
+ * observation. Besides reading the observation this method does not
+ * modify any shared state, so that it can be called concurrently for
+ * different mean PSFs.
+ ***************************************************************************/
+void GLATMeanPsf::set(const GSkyDir&                           dir,
+                      const GLATObservation&                   obs,
+                      const std::vector<std::vector<double> >& aeff_weights,
+                      const std::vector<std::vector<double> >& psf_weights)
 {
     // Clear PSF, exposure and energy arrays
     m_psf.clear();
@@ -318,29 +356,31 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
     // Get pointers on response, livetime cube and energy boundaries
     GLATResponse* rsp = obs.response();
     if (rsp == NULL)
-        throw GException::no_response(G_SET);
+        throw GException::no_response(G_SET_WEIGHTS);
 
     // Get pointer on livetime cube
     GLATLtCube* ltcube = obs.ltcube();
     if (ltcube == NULL)
-        throw GLATException::no_ltcube(G_SET);
+        throw GLATException::no_ltcube(G_SET_WEIGHTS);
     
     // Get energy boundaries
     GEbounds ebds = obs.events()->ebounds();
 
+    // Check that weights are compatible with observation
+    int nrsp = rsp->size();
+    int neng = ebds.size()+1;
+    int noff = m_offset.size();
+    if (int(aeff_weights.size()) != neng*nrsp ||
+        int(psf_weights.size())  != neng*nrsp*noff) {
+        std::string msg = "Zenith angle weights are incompatible with the"
+                          " observation. Please compute the weights using"
+                          " the weights() method.";
+        throw GException::invalid_argument(G_SET_WEIGHTS, msg);
+    }
+
     // Store source direction
     m_dir = dir;
 
-    // Limit computation to zenith angles < m_theta_max (typically 70
-    // degrees - this is the hardwired value in the ST). For this purpose
-    // set the costhetamin parameter of Aeff to m_theta_max. Store also the
-    // original values in a vector for later restoration.
-    std::vector<double> save_costhetamin;
-    for (int i = 0; i < rsp->size(); ++i) {
-        save_costhetamin.push_back(rsp->aeff(i)->costhetamin());
-        rsp->aeff(i)->costhetamin(cos(m_theta_max*gammalib::deg2rad));
-    }
-    
     // Allocate room for arrays
     m_psf.reserve(size());
     m_exposure.reserve(m_energy.size());
@@ -349,7 +389,7 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
     // boundaries. Store the energy nodes locally as GEnergy objects and
     // save them also in the class as log10 of energy in MeV.
     std::vector<GEnergy> energy;
-    energy.reserve(ebds.size()+1);
+    energy.reserve(neng);
     energy.push_back(ebds.emin(0));
     m_energy.append(ebds.emin(0).log10MeV());
     for (int i = 0; i < ebds.size(); ++i) {
@@ -358,12 +398,13 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
     }
 
     // Loop over energies
-    for (int ieng = 0; ieng < energy.size(); ++ieng) {
+    for (int ieng = 0, iaeff = 0, ipsf = 0; ieng < neng; ++ieng) {
 
         // Compute exposure by looping over the responses
         double exposure = 0.0;
-        for (int i = 0; i < rsp->size(); ++i)
-            exposure += (*ltcube)(dir, energy[ieng], *rsp->aeff(i));
+        for (int i = 0; i < nrsp; ++i, ++iaeff)
+            exposure += (*ltcube)(dir, energy[ieng], aeff_weights[iaeff],
+                                  *rsp->aeff(i));
 
         // Set exposure
         m_exposure.push_back(exposure);
@@ -373,9 +414,9 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
 
             // Compute point spread function by looping over the responses
             double psf = 0.0;
-            for (int i = 0; i < rsp->size(); ++i)
-                psf += (*ltcube)(dir, energy[ieng], m_offset[ioffset],
-                                 *rsp->psf(i), *rsp->aeff(i));
+            for (int i = 0; i < nrsp; ++i, ++ipsf)
+                psf += (*ltcube)(dir, energy[ieng], psf_weights[ipsf],
+                                 *rsp->aeff(i));
 
             // Normalize PSF by exposure and clip when exposure drops to 0
             psf = (exposure > 0.0) ? psf/exposure : 0.0;
@@ -386,10 +427,6 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
         } // endfor: looped over offsets
     } // endfor: looped over energies
 
-    // Restore initial Aeff zenith angle restriction
-    for (int i = 0; i < rsp->size(); ++i)
-        rsp->aeff(i)->costhetamin(save_costhetamin[i]);
-
     // Compute map corrections
     set_map_corrections(obs);
 
@@ -398,6 +435,99 @@ void GLATMeanPsf::set(const GSkyDir& dir, const GLATObservation& obs)
 }
 
 
+/***********************************************************************//**
+ * @brief Compute zenith angle weights for mean PSF and exposure
+ *
+ * @param[in] obs LAT observation.
+ * @param[out] aeff_weights Effective area zenith angle weights.
+ * @param[out] psf_weights PSF zenith angle weights.
+ *
+ * @exception GException::no_response
+ *            Response has not been defined.
+ * @exception GLATException::no_ltcube
+ *            Livetime cube has not been defined.
+ *
+ * Computes for all energies, responses and offset angles the vectors of
+ * effective area and of PSF times effective area values as function of
+ * the zenith (and optionally azimuth) angle bins of the livetime cube.
+ * Effective area weights are stored with index ieng*nrsp+irsp, PSF weights
+ * with index (ieng*noffsets+ioffset)*nrsp+irsp.
+ *
+ * The weights do not depend on the source location and can be passed to
+ * the set() method for any number of sources. The zenith angle restriction
+ * is applied to copies of the effective areas, hence the response is not
+ * modified and the method can be called concurrently.
+ ***************************************************************************/
+void GLATMeanPsf::weights(const GLATObservation&             obs,
+                          std::vector<std::vector<double> >& aeff_weights,
+                          std::vector<std::vector<double> >& psf_weights) const
+{
+    // Clear weights
+    aeff_weights.clear();
+    psf_weights.clear();
+
+    // Get pointers on response, livetime cube and energy boundaries
+    GLATResponse* rsp = obs.response();
+    if (rsp == NULL)
+        throw GException::no_response(G_WEIGHTS);
+
+    // Get pointer on livetime cube
+    GLATLtCube* ltcube = obs.ltcube();
+    if (ltcube == NULL)
+        throw GLATException::no_ltcube(G_WEIGHTS);
+    
+    // Get energy boundaries
+    GEbounds ebds = obs.events()->ebounds();
+
+    // Limit computation to zenith angles < m_theta_max (typically 70
+    // degrees - this is the hardwired value in the ST). For this purpose
+    // set the costhetamin parameter of copies of the effective areas to
+    // m_theta_max, so that the response is not modified.
+    std::vector<GLATAeff> aeff;
+    aeff.reserve(rsp->size());
+    for (int i = 0; i < rsp->size(); ++i) {
+        aeff.push_back(*rsp->aeff(i));
+        aeff.back().costhetamin(cos(m_theta_max*gammalib::deg2rad));
+    }
+
+    // Set energy nodes from the bin boundaries of the observations energy
+    // boundaries
+    std::vector<GEnergy> energy;
+    energy.reserve(ebds.size()+1);
+    energy.push_back(ebds.emin(0));
+    for (int i = 0; i < ebds.size(); ++i)
+        energy.push_back(ebds.emax(i));
+
+    // Allocate room for weights
+    aeff_weights.reserve(energy.size()*rsp->size());
+    psf_weights.reserve(energy.size()*m_offset.size()*rsp->size());
+
+    // Loop over energies
+    int neng = energy.size();
+    for (int ieng = 0; ieng < neng; ++ieng) {
+
+        // Set effective area weights
+        for (int i = 0; i < rsp->size(); ++i) {
+            aeff_weights.push_back(std::vector<double>());
+            ltcube->weights(energy[ieng], aeff[i], aeff_weights.back());
+        }
+
+        // Set PSF weights for all offset angles
+        for (int ioffset = 0; ioffset < m_offset.size(); ++ioffset) {
+            for (int i = 0; i < rsp->size(); ++i) {
+                psf_weights.push_back(std::vector<double>());
+                ltcube->weights(energy[ieng], m_offset[ioffset],
+                                *rsp->psf(i), aeff[i], psf_weights.back());
+            }
+        }
+
+    } // endfor: looped over energies
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return mean PSF value
  *
@@ -420,58 +550,46 @@ double GLATMeanPsf::psf(const double& offset, const double& logE)
     // Continue only if arguments are within valid range
     if (offset < 70.0 && logE > 0.0) {
 
-        // Flag no change of values
-        //bool change = false;
-
-        // Set offset interpolation
-        //if (offset != m_last_offset) {
-            m_offset.set_value(offset);
-        //    m_last_offset = offset;
-        //    change        = true;
-        //}
-
-        // Set energy interpolation
-        //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
-        //    m_last_energy = logE;
-        //    change        = true;
-        //}
-
-        // If change occured then update interpolation indices and weighting
-        // factors
-        //if (change) {
-
-            // Set energy indices for exposure computation
-            m_inx1_exp = m_energy.inx_left();
-            m_inx2_exp = m_energy.inx_right();
-
-            // Set energy indices
-            int inx_energy_left  = m_energy.inx_left()  * noffsets();
-            int inx_energy_right = m_energy.inx_right() * noffsets();
-            
-            // Set array indices for bi-linear interpolation
-            m_inx1 = m_offset.inx_left()  + inx_energy_left;
-            m_inx2 = m_offset.inx_left()  + inx_energy_right;
-            m_inx3 = m_offset.inx_right() + inx_energy_left;
-            m_inx4 = m_offset.inx_right() + inx_energy_right;
-
-            // Set weighting factors for bi-linear interpolation
-            m_wgt1 = m_offset.wgt_left()  * m_energy.wgt_left();
-            m_wgt2 = m_offset.wgt_left()  * m_energy.wgt_right();
-            m_wgt3 = m_offset.wgt_right() * m_energy.wgt_left();
-            m_wgt4 = m_offset.wgt_right() * m_energy.wgt_right();
-
-        //} // endif: logE or ctheta changed
-
-        // Compute energy dependentmap corrections
-        double fac_left  = m_mapcorr[m_inx1_exp];
-        double fac_right = m_mapcorr[m_inx2_exp];
+        // Get interpolation indices and weighting factors. Local variables
+        // are used so that the method can be called concurrently.
+        int    inx_off_left;
+        int    inx_off_right;
+        int    inx_eng_left;
+        int    inx_eng_right;
+        double wgt_off_left;
+        double wgt_off_right;
+        double wgt_eng_left;
+        double wgt_eng_right;
+        m_offset.weights(offset, inx_off_left, inx_off_right,
+                         wgt_off_left, wgt_off_right);
+        m_energy.weights(logE, inx_eng_left, inx_eng_right,
+                         wgt_eng_left, wgt_eng_right);
+
+        // Set energy indices for PSF computation
+        int inx_energy_left  = inx_eng_left  * noffsets();
+        int inx_energy_right = inx_eng_right * noffsets();
+
+        // Set array indices for bi-linear interpolation
+        int inx1 = inx_off_left  + inx_energy_left;
+        int inx2 = inx_off_left  + inx_energy_right;
+        int inx3 = inx_off_right + inx_energy_left;
+        int inx4 = inx_off_right + inx_energy_right;
+
+        // Set weighting factors for bi-linear interpolation
+        double wgt1 = wgt_off_left  * wgt_eng_left;
+        double wgt2 = wgt_off_left  * wgt_eng_right;
+        double wgt3 = wgt_off_right * wgt_eng_left;
+        double wgt4 = wgt_off_right * wgt_eng_right;
+
+        // Compute energy dependent map corrections
+        double fac_left  = m_mapcorr[inx_eng_left];
+        double fac_right = m_mapcorr[inx_eng_right];
 
         // Perform bi-linear interpolation
-        value = m_wgt1 * m_psf[m_inx1] * fac_left  +
-                m_wgt2 * m_psf[m_inx2] * fac_right +
-                m_wgt3 * m_psf[m_inx3] * fac_left  +
-                m_wgt4 * m_psf[m_inx4] * fac_right;
+        value = wgt1 * m_psf[inx1] * fac_left  +
+                wgt2 * m_psf[inx2] * fac_right +
+                wgt3 * m_psf[inx3] * fac_left  +
+                wgt4 * m_psf[inx4] * fac_right;
 
         // Optionally check for negative values
         #if G_SIGNAL_NEGATIVE_MEAN_PSF
@@ -507,17 +625,16 @@ double GLATMeanPsf::exposure(const double& logE)
     // Continue only if arguments are within valid range
     if (logE > 0.0) {
 
-        // Set energy interpolation
-        //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
-        //    m_last_energy = logE;
-            m_inx1_exp    = m_energy.inx_left();
-            m_inx2_exp    = m_energy.inx_right();
-        //}
+        // Get energy interpolation indices and weighting factors
+        int    inx_left;
+        int    inx_right;
+        double wgt_left;
+        double wgt_right;
+        m_energy.weights(logE, inx_left, inx_right, wgt_left, wgt_right);
 
         // Perform linear interpolation
-        value = m_energy.wgt_left()  * m_exposure[m_inx1_exp] +
-                m_energy.wgt_right() * m_exposure[m_inx2_exp];
+        value = wgt_left  * m_exposure[inx_left] +
+                wgt_right * m_exposure[inx_right];
 
     } // endif: arguments were in valid range
 
@@ -526,6 +643,275 @@ double GLATMeanPsf::exposure(const double& logE)
 }
 
 
+/***********************************************************************//**
+ * @brief Return fraction of mean PSF contained in a circular region
+ *
+ * @param[in] centre Centre of circular region.
+ * @param[in] radius Radius of circular region (degrees).
+ * @param[in] logE log10 of energy in MeV.
+ * @return Fraction of the mean PSF that falls into the region.
+ *
+ * Computes the integral of the mean PSF over a circular region, such as the
+ * region of interest of an event list. The integration is done over the
+ * offset angle nodes of the mean PSF using the trapezoidal rule, where for
+ * each offset angle \f$\theta\f$ the fraction of the circle around the
+ * source direction that lies within the region is computed analytically.
+ * A zero value is returned if the @p radius or \f$\log E\f$ is not
+ * positive.
+ ***************************************************************************/
+double GLATMeanPsf::containment(const GSkyDir& centre, const double& radius,
+                                const double& logE)
+{
+    // Initialise containment
+    double value = 0.0;
+
+    // Continue only if arguments are within valid range
+    if (radius > 0.0 && logE > 0.0 && noffsets() > 1) {
+
+        // Compute distance between source and region centre and cosine
+        // of region radius
+        double dist     = m_dir.dist(centre);
+        double cos_dist = std::cos(dist);
+        double sin_dist = std::sin(dist);
+        double cos_rad  = std::cos(radius * gammalib::deg2rad);
+
+        // Integrate over offset angles
+        double theta_last = 0.0;
+        double value_last = 0.0;
+        for (int i = 0; i < noffsets(); ++i) {
+
+            // Get offset angle in radians
+            double theta     = m_offset[i] * gammalib::deg2rad;
+            double sin_theta = std::sin(theta);
+            double cos_theta = std::cos(theta);
+
+            // Compute fraction of circle within region
+            double fraction = 0.0;
+            double norm     = sin_theta * sin_dist;
+            if (norm > 0.0) {
+                double arg = (cos_rad - cos_theta * cos_dist) / norm;
+                if (arg <= -1.0) {
+                    fraction = 1.0;
+                }
+                else if (arg < 1.0) {
+                    fraction = std::acos(arg) / gammalib::pi;
+                }
+            }
+            else if (cos_theta * cos_dist >= cos_rad) {
+                fraction = 1.0;
+            }
+
+            // Accumulate trapezoidal integral
+            double value_this = psf(m_offset[i], logE) * sin_theta * fraction;
+            if (i > 0) {
+                value += 0.5 * (value_last + value_this) * (theta - theta_last);
+            }
+
+            // Store values for next offset angle
+            theta_last = theta;
+            value_last = value_this;
+
+        } // endfor: looped over offset angles
+
+        // Multiply by azimuth integral
+        value *= gammalib::twopi;
+
+    } // endif: arguments were valid
+
+    // Return containment
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Load mean PSF from FITS file
+ *
+ * @param[in] filename FITS file name.
+ *
+ * Loads a mean PSF that has been saved using the save() method. See the
+ * read() method for details.
+ ***************************************************************************/
+void GLATMeanPsf::load(const std::string& filename)
+{
+    // Open FITS file
+    GFits fits(filename);
+
+    // Read mean PSF from file
+    read(&fits);
+
+    // Close FITS file
+    fits.close();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Save mean PSF into FITS file
+ *
+ * @param[in] filename FITS file name.
+ * @param[in] clobber Overwrite existing file?
+ *
+ * Saves the mean PSF into a FITS file. See the write() method for details.
+ ***************************************************************************/
+void GLATMeanPsf::save(const std::string& filename, bool clobber) const
+{
+    // Open FITS file
+    GFits fits(filename, true);
+
+    // Write mean PSF into file
+    write(fits);
+
+    // Save FITS file
+    fits.save(clobber);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read mean PSF from FITS file
+ *
+ * @param[in] file FITS file.
+ *
+ * @exception GException::invalid_value
+ *            Inconsistent mean PSF extensions.
+ *
+ * Reads the mean PSF from the extensions "MEANPSF" and "OFFSETS". See the
+ * write() method for the format. The source name is not read; it should
+ * be set using the name() method.
+ ***************************************************************************/
+void GLATMeanPsf::read(const GFits* file)
+{
+    // Clear PSF, exposure, map correction and node arrays
+    m_psf.clear();
+    m_exposure.clear();
+    m_mapcorr.clear();
+    m_energy.clear();
+    m_offset.clear();
+
+    // Get pointers to HDUs
+    const GFitsTable* hdu_psf    = file->table("MEANPSF");
+    const GFitsTable* hdu_offset = file->table("OFFSETS");
+
+    // Get pointers to columns
+    const GFitsTableCol* col_energy   = &(*hdu_psf)["LOGE"];
+    const GFitsTableCol* col_exposure = &(*hdu_psf)["EXPOSURE"];
+    const GFitsTableCol* col_mapcorr  = &(*hdu_psf)["MAPCORR"];
+    const GFitsTableCol* col_psf      = &(*hdu_psf)["PSF"];
+    const GFitsTableCol* col_offset   = &(*hdu_offset)["OFFSET"];
+
+    // Check that PSF vector size matches number of offsets
+    int noffsets  = hdu_offset->nrows();
+    int nenergies = hdu_psf->nrows();
+    if (col_psf->number() != noffsets) {
+        std::string msg = "PSF vector size "+gammalib::str(col_psf->number())+
+                          " differs from number of offsets "+
+                          gammalib::str(noffsets)+".";
+        throw GException::invalid_value(G_READ, msg);
+    }
+
+    // Read source direction and maximum zenith angle
+    m_dir.radec_deg(hdu_psf->real("RA"), hdu_psf->real("DEC"));
+    m_theta_max = hdu_psf->real("THETAMAX");
+
+    // Read offsets
+    for (int i = 0; i < noffsets; ++i) {
+        m_offset.append(col_offset->real(i));
+    }
+
+    // Read energies, exposure, map corrections and PSF values
+    m_psf.reserve(nenergies*noffsets);
+    for (int ieng = 0; ieng < nenergies; ++ieng) {
+        m_energy.append(col_energy->real(ieng));
+        m_exposure.push_back(col_exposure->real(ieng));
+        m_mapcorr.push_back(col_mapcorr->real(ieng));
+        for (int i = 0; i < noffsets; ++i) {
+            m_psf.push_back(col_psf->real(ieng, i));
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Write mean PSF into FITS file
+ *
+ * @param[in] file FITS file.
+ *
+ * Writes the mean PSF into the binary table extension "MEANPSF", with one
+ * row per energy node. The columns "LOGE", "EXPOSURE" and "MAPCORR" hold
+ * the log10 of the energy in MeV, the exposure and the map correction,
+ * and the vector column "PSF" holds the mean PSF values for all offsets.
+ * The source direction and the maximum zenith angle are written as header
+ * keywords. The offsets are written into the column "OFFSET" of the
+ * binary table extension "OFFSETS".
+ ***************************************************************************/
+void GLATMeanPsf::write(GFits& file) const
+{
+    // Get dimensions
+    int nenergies = m_energy.size();
+    int noffsets  = m_offset.size();
+
+    // Create new binary tables
+    GFitsBinTable* hdu_psf    = new GFitsBinTable(nenergies);
+    GFitsBinTable* hdu_offset = new GFitsBinTable(noffsets);
+
+    // Set table attributes
+    hdu_psf->extname("MEANPSF");
+    hdu_offset->extname("OFFSETS");
+
+    // Allocate columns
+    GFitsTableDoubleCol col_energy   = GFitsTableDoubleCol("LOGE", nenergies);
+    GFitsTableDoubleCol col_exposure = GFitsTableDoubleCol("EXPOSURE", nenergies);
+    GFitsTableDoubleCol col_mapcorr  = GFitsTableDoubleCol("MAPCORR", nenergies);
+    GFitsTableDoubleCol col_psf      = GFitsTableDoubleCol("PSF", nenergies, noffsets);
+    GFitsTableDoubleCol col_offset   = GFitsTableDoubleCol("OFFSET", noffsets);
+
+    // Fill energy dependent columns
+    for (int ieng = 0, inx = 0; ieng < nenergies; ++ieng) {
+        col_energy(ieng)   = m_energy[ieng];
+        col_exposure(ieng) = m_exposure[ieng];
+        col_mapcorr(ieng)  = m_mapcorr[ieng];
+        for (int i = 0; i < noffsets; ++i, ++inx) {
+            col_psf(ieng, i) = m_psf[inx];
+        }
+    }
+
+    // Fill offset column
+    for (int i = 0; i < noffsets; ++i) {
+        col_offset(i) = m_offset[i];
+    }
+
+    // Append columns to tables
+    hdu_psf->append_column(col_energy);
+    hdu_psf->append_column(col_exposure);
+    hdu_psf->append_column(col_mapcorr);
+    hdu_psf->append_column(col_psf);
+    hdu_offset->append_column(col_offset);
+
+    // Write header keywords
+    hdu_psf->card("RA",       m_dir.ra_deg(),  "[deg] Right Ascension of source");
+    hdu_psf->card("DEC",      m_dir.dec_deg(), "[deg] Declination of source");
+    hdu_psf->card("THETAMAX", m_theta_max,     "[deg] Maximum zenith angle");
+
+    // Append HDUs to FITS file
+    file.append(*hdu_psf);
+    file.append(*hdu_offset);
+
+    // Free binary tables
+    delete hdu_psf;
+    delete hdu_offset;
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print lifetime cube information
  *
@@ -610,16 +996,6 @@ void GLATMeanPsf::init_members(void)
     m_theta_max   = 70.0;  //!< Maximum zenith angle
     m_last_energy = -1.0;
     m_last_offset = -1.0;
-    m_inx1_exp    = 0;
-    m_inx2_exp    = 0;
-    m_inx1        = 0;
-    m_inx2        = 0;
-    m_inx3        = 0;
-    m_inx4        = 0;
-    m_wgt1        = 0.0;
-    m_wgt2        = 0.0;
-    m_wgt3        = 0.0;
-    m_wgt4        = 0.0;
 
     // Set offset array
     set_offsets();
@@ -647,16 +1023,6 @@ void GLATMeanPsf::copy_members(const GLATMeanPsf& psf)
     m_theta_max   = psf.m_theta_max;
     m_last_energy = psf.m_last_energy;
     m_last_offset = psf.m_last_offset;
-    m_inx1_exp    = psf.m_inx1_exp;
-    m_inx2_exp    = psf.m_inx2_exp;
-    m_inx1        = psf.m_inx1;
-    m_inx2        = psf.m_inx2;
-    m_inx3        = psf.m_inx3;
-    m_inx4        = psf.m_inx4;
-    m_wgt1        = psf.m_wgt1;
-    m_wgt2        = psf.m_wgt2;
-    m_wgt3        = psf.m_wgt3;
-    m_wgt4        = psf.m_wgt4;
 
     // Return
     return;
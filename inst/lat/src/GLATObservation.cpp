@@ -584,6 +584,30 @@ std::string GLATObservation::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Prepare observation for model evaluation
+ *
+ * @param[in] models Models.
+ *
+ * Computes the mean PSFs for all point sources of the @p models, so that
+ * they are not computed on first use during the likelihood evaluation,
+ * and the ROI exposure that is needed to compute Npred for the diffuse
+ * models of an event list. Nothing is done if the observation has no
+ * response, livetime cube or events.
+ ***************************************************************************/
+void GLATObservation::prepare(const GModels& models)
+{
+    // Compute mean PSFs and ROI exposure if the observation is complete
+    if (m_response != NULL && m_ltcube != NULL && m_events != NULL) {
+        m_response->set_mean_psfs(models, *this);
+        m_response->set_roi_exposure(models, *this);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Load data for unbinned analysis
  *
@@ -30,23 +30,32 @@
 #endif
 #include <unistd.h>           // access() function
 #include <cstdlib>            // std::getenv() function
+#include <cstdio>             // std::rename() and std::remove() functions
 #include <string>
+#include <cmath>
 #include "GException.hpp"
 #include "GFits.hpp"
 #include "GTools.hpp"
+#include "GMath.hpp"
 #include "GCaldb.hpp"
+#include "GModels.hpp"
+#include "GModelSky.hpp"
 #include "GModelSpatialPointSource.hpp"
+#include "GModelSpatialDiffuse.hpp"
+#include "GWcslib.hpp"
 #include "GLATInstDir.hpp"
 #include "GLATResponse.hpp"
 #include "GLATObservation.hpp"
 #include "GLATEventAtom.hpp"
 #include "GLATEventBin.hpp"
 #include "GLATEventCube.hpp"
+#include "GLATEventList.hpp"
 #include "GLATException.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 #define G_CALDB                           "GLATResponse::caldb(std::string&)"
 #define G_LOAD                             "GLATResponse::load(std::string&)"
+#define G_MEANPSF_CACHE           "GLATResponse::meanpsf_cache(std::string&)"
 #define G_IRF      "GLATResponse::irf(GInstDir&, GEnergy&, GTime&, GSkyDir&,"\
                                           " GEnergy&, GTime&, GObservation&)"
 #define G_AEFF                                     "GLATResponse::aeff(int&)"
@@ -56,12 +65,19 @@
                                                      "GTime&, GObservation&)"
 #define G_IRF_BIN       "GLATResponse::irf(GLATEventBin&, GModel&, GEnergy&,"\
                                                      "GTime&, GObservation&)"
-#define G_NPRED             "GLATResponse::npred(GSkyDir&, GEnergy&, GTime&,"\
-                                                            " GObservation&)"
+#define G_SET_MEAN_PSFS            "GLATResponse::set_mean_psfs(GModels&,"\
+                                                        " GLATObservation&)"
+#define G_NPRED_DIFFUSE           "GLATResponse::npred_diffuse(GSource&,"\
+                                                           " GObservation&)"
+#define G_COMPUTE_ROI_EXPOSURE                "GLATResponse::compute_roi_"\
+                                               "exposure(GLATObservation&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_ROI_BINSZ 0.25           //!< ROI exposure integration step (deg)
+#define G_PTSRC_MEMO 16            //!< Size of mean PSF handle table
+#define G_DIFFINDEX_MEMO 16        //!< Size of diffuse model index table
 
 /* __ Debug definitions __________________________________________________ */
 #define G_DUMP_MEAN_PSF  0                    //!< Dump mean PSF allocation
@@ -214,6 +230,44 @@ void GLATResponse::caldb(const std::string& caldb)
 }
 
 
+/***********************************************************************//**
+ * @brief Set mean PSF cache directory
+ *
+ * @param[in] dirname Mean PSF cache directory (empty to disable cache).
+ *
+ * @exception GException::invalid_argument
+ *            Directory does not exist or is not writable.
+ *
+ * Sets the directory in which mean PSFs are cached. Mean PSFs are stored
+ * in this directory once they have been computed, and are loaded from the
+ * directory instead of being recomputed when the same source is analysed
+ * again with the same livetime cube, response and binning. The cache file
+ * names are derived from a checksum over these quantities, hence the same
+ * directory can be used for any number of analyses.
+ ***************************************************************************/
+void GLATResponse::meanpsf_cache(const std::string& dirname)
+{
+    // Expand environment variables and strip trailing slashes
+    std::string dir = gammalib::expand_env(dirname);
+    while (dir.length() > 1 && dir[dir.length()-1] == '/') {
+        dir.erase(dir.length()-1);
+    }
+
+    // Check that directory is writable
+    if (!dir.empty() && access(dir.c_str(), W_OK) != 0) {
+        std::string msg = "Mean PSF cache directory \""+dir+"\" does not"
+                          " exist or is not writable.";
+        throw GException::invalid_argument(G_MEANPSF_CACHE, msg);
+    }
+
+    // Store mean PSF cache directory
+    m_meanpsf_cache = dir;
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return value of point source IRF
  *
@@ -241,44 +295,12 @@ double GLATResponse::irf(const GEvent&       event,
     const GSkyDir& srcDir = photon.dir();
     const GEnergy& srcEng = photon.energy();
 
-    // Search for mean PSF
-    int ipsf = -1;
-    for (int i = 0; i < m_ptsrc.size(); ++i) {
-        if (m_ptsrc[i]->dir() == srcDir) {
-            ipsf = i;
-            break;
-        }
-    }
-
-    // If mean PSF has not been found then create it now
-    if (ipsf == -1) {
-
-        // Allocate new mean PSF
-        GLATMeanPsf* psf = new GLATMeanPsf(srcDir, static_cast<const GLATObservation&>(obs));
-
-        // Set source name
-        std::string name = "SRC("+gammalib::str(srcDir.ra_deg()) +
-                                "," +
-                                gammalib::str(srcDir.dec_deg())+")";
-        psf->name(name);
-
-        // Push mean PSF on stack
-        const_cast<GLATResponse*>(this)->m_ptsrc.push_back(psf);
-
-        // Set index of mean PSF
-        ipsf = m_ptsrc.size()-1;
-
-        // Debug option: dump mean PSF
-        #if G_DUMP_MEAN_PSF
-        std::cout << "Added new mean PSF \""+name+"\"" << std::endl;
-        std::cout << *psf << std::endl;
-        #endif
-
-    } // endif: created new mean PSF
+    // Get mean PSF, and create it if it does not yet exist
+    GLATMeanPsf* psf = mean_psf(srcDir, obs);
 
     // Get IRF value
     double offset = dir->dist_deg(srcDir);
-    double irf    = (*m_ptsrc[ipsf])(offset, srcEng.log10MeV());
+    double irf    = (*psf)(offset, srcEng.log10MeV());
 
     // Return IRF value
     return irf;
@@ -320,23 +342,69 @@ double GLATResponse::irf(const GEvent&       event,
  * @param[in] source Source.
  * @param[in] obs Observations.
  *
- * @exception GException::feature_not_implemented
- *            Method not yet implemented.
+ * @exception GLATException::diffuse_not_found
+ *            Diffuse model not found.
  *
- * @todo Not yet implemented.
+ * This method first searches for a diffuse response component of the
+ * source in the event list. Diffuse responses are precomputed for each
+ * event and stored in the DIFRSPx columns of the event list (e.g. by the
+ * gtdiffrsp tool of the Fermi Science Tools), hence the response is simply
+ * the value stored with the event. If no diffuse response is present it
+ * checks if the source is a point source. If this is the case a mean PSF
+ * is allocated for the source and the response is computed from the mean
+ * PSF, divided by the ontime of the event list. Otherwise an
+ * GLATException::diffuse_not_found exception is thrown.
  ***************************************************************************/
 double GLATResponse::irf(const GLATEventAtom& event,
                          const GSource&       source,
                          const GObservation&  obs) const
 {
-    // Initialise IRF with "no response"
-    double irf = 0.0;
+    // Initialise response value
+    double rsp = 0.0;
+
+    // Get pointer to event list
+    const GLATEventList* list = static_cast<const GLATEventList*>(obs.events());
+
+    // Get pointer on point source spatial model
+    const GModelSpatialPointSource* ptsrc =
+          dynamic_cast<const GModelSpatialPointSource*>(source.model());
+
+    // Search for diffuse response in event list
+    int idiff = diffindex(*list, source);
+
+    // If diffuse response has been found then get response from event
+    if (idiff != -1 && (!m_force_mean || ptsrc == NULL)) {
+        rsp = event.diffrsp(idiff);
+    }
+
+    // ... otherwise if model is a point source then return response from
+    // mean PSF
+    else if (ptsrc != NULL) {
+
+        // Get ontime of event list
+        double ontime = list->gti().ontime();
+
+        // Continue only if ontime is positive
+        if (ontime > 0.0) {
 
-    // Dump warning that integration is not yet implemented
-    throw GException::feature_not_implemented(G_IRF_ATOM);
+            // Get mean PSF, and create it if it does not yet exist
+            GLATMeanPsf* psf = mean_psf(source, obs);
+
+            // Get PSF value
+            double offset = event.dir().dist_deg(psf->dir());
+            rsp           = (*psf)(offset, source.energy().log10MeV()) / ontime;
+
+        } // endif: ontime was positive
+
+    } // endelse: model was point source
+
+    // ... otherwise throw an exception
+    else {
+        throw GLATException::diffuse_not_found(G_IRF_ATOM, source.name());
+    }
 
     // Return IRF value
-    return irf;
+    return rsp;
 }
 
 
@@ -359,8 +427,6 @@ double GLATResponse::irf(const GLATEventAtom& event,
  *
  * @todo Extract event cube from observation. We do not need the cube
  *       pointer in the event anymore.
- * @todo Implement more efficient method for response search (name search is
- *       not very rapid).
  * @todo Instead of calling "offset = event.dir().dist_deg(srcDir)" we can
  *       precompute and store for each PSF the offsets. This should save
  *       quite some time since the distance computation is time
@@ -384,26 +450,33 @@ double GLATResponse::irf(const GLATEventBin& event,
     GEnergy srcEng = source.energy();
 
     // Search for diffuse response in event cube
-    int idiff = -1;
-    for (int i = 0; i < cube->ndiffrsp(); ++i) {
-        if (cube->diffname(i) == source.name()) {
-            idiff = i;
-            break;
-        }
-    }
+    int idiff = diffindex(*cube, source);
 
     // If diffuse response has been found then get response from source map
     if (idiff != -1) {
 
-        // Get srcmap indices and weighting factors
-        GNodeArray nodes = cube->enodes();
-        nodes.set_value(srcEng.log10MeV());
+        // If the source energy is the event energy then use the
+        // precomputed interpolation weights of the event cube ...
+        if (srcEng == event.energy()) {
+            rsp = cube->diffrsp(idiff, event.ipix(), event.ieng());
+        }
 
-        // Compute diffuse response
-        GSkymap* map    = cube->diffrsp(idiff);
-        double*  pixels = map->pixels() + event.ipix();
-        rsp             = nodes.wgt_left()  * pixels[nodes.inx_left()  * map->npix()] +
-                          nodes.wgt_right() * pixels[nodes.inx_right() * map->npix()];
+        // ... otherwise compute srcmap indices and weighting factors. The
+        // node array is not modified, hence this can be done concurrently.
+        // The event cube has at least two energy nodes as the weights of
+        // the energy bins are computed when the source maps are read.
+        else {
+            int    inx_left;
+            int    inx_right;
+            double wgt_left;
+            double wgt_right;
+            cube->enodes().weights(srcEng.log10MeV(), inx_left, inx_right,
+                                   wgt_left, wgt_right);
+            const GSkymap* map    = cube->diffrsp(idiff);
+            const double*  pixels = map->pixels() + event.ipix();
+            rsp = wgt_left  * pixels[inx_left  * map->npix()] +
+                  wgt_right * pixels[inx_right * map->npix()];
+        }
 
         // Divide by solid angle and ontime since source maps are given in units of
         // counts/pixel/MeV.
@@ -415,43 +488,13 @@ double GLATResponse::irf(const GLATEventBin& event,
     // then return response from mean PSF
     if ((idiff == -1 || m_force_mean) && ptsrc != NULL) {
 
-        // Search for mean PSF
-        int ipsf = -1;
-        for (int i = 0; i < m_ptsrc.size(); ++i) {
-            if (m_ptsrc[i]->name() == source.name()) {
-                ipsf = i;
-                break;
-            }
-        }
-
-        // If mean PSF has not been found then create it now
-        if (ipsf == -1) {
-
-            // Allocate new mean PSF
-            GLATMeanPsf* psf = 
-                new GLATMeanPsf(ptsrc->dir(), static_cast<const GLATObservation&>(obs));
-
-            // Set source name
-            psf->name(source.name());
-
-            // Push mean PSF on stack
-            const_cast<GLATResponse*>(this)->m_ptsrc.push_back(psf);
-
-            // Set index of mean PSF
-            ipsf = m_ptsrc.size()-1;
-
-            // Debug option: dump mean PSF
-            #if G_DUMP_MEAN_PSF 
-            std::cout << "Added new mean PSF \""+source.name() << "\"" << std::endl;
-            std::cout << *psf << std::endl;
-            #endif
-
-        } // endif: created new mean PSF
+        // Get mean PSF, and create it if it does not yet exist
+        GLATMeanPsf* psf = mean_psf(source, obs);
 
         // Get PSF value
-        GSkyDir srcDir   = m_ptsrc[ipsf]->dir();
+        GSkyDir srcDir   = psf->dir();
         double  offset   = event.dir().dist_deg(srcDir);
-        double  mean_psf = (*m_ptsrc[ipsf])(offset, srcEng.log10MeV()) / (event.ontime());
+        double  mean_psf = (*psf)(offset, srcEng.log10MeV()) / (event.ontime());
 
         // Debug option: compare mean PSF to diffuse response
         #if G_DEBUG_MEAN_PSF
@@ -489,22 +532,156 @@ double GLATResponse::irf(const GLATEventBin& event,
  * @param[in] photon Incident photon.
  * @param[in] obs Observation.
  *
- * @todo Not yet implemented.
+ * Returns the integral of the instrument response function over the
+ * region of interest of the event list, divided by the ontime. The
+ * integral is computed from the mean PSF for the photon direction, which
+ * is allocated if it does not yet exist.
  ***************************************************************************/
 double GLATResponse::npred(const GPhoton&      photon,
                            const GObservation& obs) const
 {
-    // Initialise
-    double npred = 0.0;
+    // Get mean PSF, and create it if it does not yet exist
+    GLATMeanPsf* psf = mean_psf(photon.dir(), obs);
 
-    // Notify that method is not yet implemented
-    throw GException::feature_not_implemented(G_NPRED);
+    // Compute integrated IRF value
+    double npred = npred_mean_psf(*psf, photon.energy(), obs);
 
     // Return integrated IRF value
     return npred;
 }
 
 
+/***********************************************************************//**
+ * @brief Return ROI integral of point source model
+ *
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @return Integral of point source model over ROI.
+ *
+ * Returns the integral of a point source model over the region of interest
+ * of the event list, divided by the ontime. The integral is computed from
+ * the mean PSF of the source, which is looked up using the source handle
+ * and allocated if it does not yet exist. If the source is not a point
+ * source, the method returns 0.
+ ***************************************************************************/
+double GLATResponse::npred_ptsrc(const GSource&      source,
+                                 const GObservation& obs) const
+{
+    // Initialise Npred
+    double npred = 0.0;
+
+    // Continue only if model is a point source
+    if (dynamic_cast<const GModelSpatialPointSource*>(source.model()) != NULL) {
+
+        // Get mean PSF, and create it if it does not yet exist
+        GLATMeanPsf* psf = mean_psf(source, obs);
+
+        // Compute Npred
+        npred = npred_mean_psf(*psf, source.energy(), obs);
+
+    }
+
+    // Return Npred
+    return npred;
+}
+
+
+/***********************************************************************//**
+ * @brief Return ROI integral of diffuse source model
+ *
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @return Integral of diffuse source model over ROI.
+ *
+ * @exception GLATException::no_ltcube
+ *            Observation has no livetime cube.
+ * @exception GLATException::bad_roi_type
+ *            Observation has no event list with a valid region of interest.
+ * @exception GLATException::no_ebds
+ *            Event list has no energy boundaries.
+ * @exception GException::invalid_value
+ *            No ROI exposure has been computed for the observation.
+ *
+ * Returns the integral of a diffuse source model times the exposure over
+ * the region of interest of the event list, divided by the ontime. The
+ * integration is done over a grid of sky directions that covers the
+ * region of interest. The exposure of the grid is computed by
+ * set_roi_exposure(), which is called by GLATObservation::prepare(), so
+ * that only the model needs to be evaluated on the grid. The spill-over
+ * of the emission over the region of interest boundary due to the PSF is
+ * neglected. If the model is not a diffuse model, the method returns 0.
+ ***************************************************************************/
+double GLATResponse::npred_diffuse(const GSource&      source,
+                                   const GObservation& obs) const
+{
+    // Initialise Npred
+    double npred = 0.0;
+
+    // Get diffuse spatial model
+    const GModelSpatialDiffuse* spatial =
+          dynamic_cast<const GModelSpatialDiffuse*>(source.model());
+
+    // Get ontime of events
+    double ontime = obs.events()->gti().ontime();
+
+    // Continue only if model is diffuse and ontime is positive
+    if (spatial != NULL && ontime > 0.0) {
+
+        // Check observation
+        const GLATObservation& lat = static_cast<const GLATObservation&>(obs);
+        if (lat.ltcube() == NULL) {
+            throw GLATException::no_ltcube(G_NPRED_DIFFUSE);
+        }
+        const GLATEventList* list =
+              dynamic_cast<const GLATEventList*>(obs.events());
+        if (list == NULL || list->roi().radius() <= 0.0) {
+            throw GLATException::bad_roi_type(G_NPRED_DIFFUSE,
+                  "Observation has no event list with a valid region of"
+                  " interest.");
+        }
+        if (list->ebounds().size() < 1) {
+            throw GLATException::no_ebds(G_NPRED_DIFFUSE);
+        }
+
+        // Check that the ROI exposure applies to the observation
+        if (!has_roi_exposure(lat)) {
+            std::string msg = "No ROI exposure has been computed for the"
+                              " observation. Please call the prepare()"
+                              " method of the observation before computing"
+                              " Npred for diffuse models.";
+            throw GException::invalid_value(G_NPRED_DIFFUSE, msg);
+        }
+
+        // Get energy interpolation indices and weights
+        int    inx_left;
+        int    inx_right;
+        double wgt_left;
+        double wgt_right;
+        m_roi_energies.weights(source.energy().log10MeV(),
+                               inx_left, inx_right, wgt_left, wgt_right);
+
+        // Integrate model times exposure over ROI
+        int neng = m_roi_energies.size();
+        int npix = m_roi_dirs.size();
+        for (int i = 0, inx = 0; i < npix; ++i, inx += neng) {
+            double exposure = wgt_left  * m_roi_exposure[inx+inx_left] +
+                              wgt_right * m_roi_exposure[inx+inx_right];
+            if (exposure > 0.0) {
+                GPhoton photon(m_roi_dirs[i], source.energy(), source.time());
+                npred += spatial->eval(photon) * exposure * m_roi_omega[i];
+            }
+        }
+
+        // Divide by ontime
+        npred /= ontime;
+
+    } // endif: model was diffuse and ontime was positive
+
+    // Return Npred
+    return npred;
+}
+
+
 /***********************************************************************//**
  * @brief Load Fermi LAT response from calibration database
  *
@@ -706,6 +883,10 @@ std::string GLATResponse::print(const GChatter& chatter) const
         // Append information
         result.append("\n"+gammalib::parformat("Calibration database")+m_caldb);
         result.append("\n"+gammalib::parformat("Response name")+m_rspname);
+        if (!m_meanpsf_cache.empty()) {
+            result.append("\n"+gammalib::parformat("Mean PSF cache") +
+                          m_meanpsf_cache);
+        }
         result.append("\n"+gammalib::parformat("Section(s)"));
         if (m_hasfront && m_hasback) {
             result.append("front & back");
@@ -735,6 +916,200 @@ std::string GLATResponse::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Compute mean PSFs for all point sources of a model container
+ *
+ * @param[in] models Model container.
+ * @param[in] obs LAT observation.
+ *
+ * @exception GException::no_response
+ *            Observation has no response.
+ * @exception GLATException::no_ltcube
+ *            Observation has no livetime cube.
+ * @exception GException::invalid_value
+ *            Mean PSF computation failed.
+ *
+ * Computes the mean PSFs for all point sources in the model container that
+ * apply to the observation and for which no mean PSF exists yet. Point
+ * sources for which the events hold a diffuse response are skipped unless
+ * the use of mean PSFs is forced. The method is called by
+ * GLATObservation::prepare() before the models are fitted, as the mean
+ * PSFs would otherwise be computed on first use in the likelihood
+ * evaluation.
+ *
+ * The zenith angle weights of the effective area and of the PSF are
+ * computed only once and are shared by all sources, and the mean PSFs are
+ * then computed in parallel. The method should not be called from within
+ * a parallel region.
+ *
+ * If a mean PSF cache directory has been set, mean PSFs that are found in
+ * the cache are loaded instead of being computed, and the computed mean
+ * PSFs are stored in the cache.
+ ***************************************************************************/
+void GLATResponse::set_mean_psfs(const GModels&         models,
+                                 const GLATObservation& obs)
+{
+    // Get pointer on event cube (NULL for event lists) and on event list
+    // (NULL for event cubes)
+    const GLATEventCube* cube = dynamic_cast<const GLATEventCube*>(obs.events());
+    const GLATEventList* list = dynamic_cast<const GLATEventList*>(obs.events());
+
+    // Collect names and directions of point sources without mean PSF
+    std::vector<std::string> names;
+    std::vector<GSkyDir>     dirs;
+    for (int i = 0; i < models.size(); ++i) {
+
+        // Continue only for point source sky models that apply to the
+        // observation
+        const GModelSky* model = dynamic_cast<const GModelSky*>(models[i]);
+        if (model == NULL || !model->isvalid(obs.instrument(), obs.id())) {
+            continue;
+        }
+        const GModelSpatialPointSource* ptsrc =
+              dynamic_cast<const GModelSpatialPointSource*>(model->spatial());
+        if (ptsrc == NULL) {
+            continue;
+        }
+
+        // Skip sources that already have a mean PSF
+        if (m_ptsrc_handles.find(model->name()) != m_ptsrc_handles.end()) {
+            continue;
+        }
+
+        // Skip sources with a diffuse response unless mean PSFs are forced
+        if (cube != NULL && !m_force_mean &&
+            cube->diffindex(model->name()) != -1) {
+            continue;
+        }
+        if (list != NULL && !m_force_mean &&
+            list->diffindex(model->name()) != -1) {
+            continue;
+        }
+
+        // Load mean PSF from cache if it exists there
+        GLATMeanPsf* psf = new GLATMeanPsf;
+        if (meanpsf_cache_load(*psf, ptsrc->dir(), obs)) {
+            psf->name(model->name());
+            m_ptsrc_handles[model->name()] = m_ptsrc.size();
+            m_ptsrc.push_back(psf);
+            continue;
+        }
+        delete psf;
+
+        // Collect source
+        names.push_back(model->name());
+        dirs.push_back(ptsrc->dir());
+
+    } // endfor: looped over models
+
+    // Continue only if there are mean PSFs to compute
+    int num = names.size();
+    if (num > 0) {
+
+        // Allocate mean PSFs
+        std::vector<GLATMeanPsf*> psfs;
+        for (int i = 0; i < num; ++i) {
+            GLATMeanPsf* psf = new GLATMeanPsf;
+            psf->name(names[i]);
+            psfs.push_back(psf);
+        }
+
+        // Compute zenith angle weights that are shared by all sources
+        std::vector<std::vector<double> > aeff_weights;
+        std::vector<std::vector<double> > psf_weights;
+        psfs[0]->weights(obs, aeff_weights, psf_weights);
+
+        // Compute mean PSFs in parallel. Exceptions must not leave the
+        // parallel region, hence they are caught for each source and the
+        // first error is thrown once all mean PSFs have been computed.
+        std::vector<std::string> errors(num);
+        #pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < num; ++i) {
+            try {
+                psfs[i]->set(dirs[i], obs, aeff_weights, psf_weights);
+            }
+            catch (std::exception &e) {
+                errors[i] = e.what();
+                if (errors[i].empty()) {
+                    errors[i] = "Unknown error.";
+                }
+            }
+        }
+
+        // Throw an exception if a mean PSF could not be computed
+        for (int i = 0; i < num; ++i) {
+            if (!errors[i].empty()) {
+                std::string msg = "Mean PSF computation for source \""+
+                                  names[i]+"\" failed: "+errors[i];
+                for (int k = 0; k < num; ++k) {
+                    delete psfs[k];
+                }
+                throw GException::invalid_value(G_SET_MEAN_PSFS, msg);
+            }
+        }
+
+        // Push mean PSFs on stack and store them in the cache
+        for (int i = 0; i < num; ++i) {
+            m_ptsrc_handles[names[i]] = m_ptsrc.size();
+            m_ptsrc.push_back(psfs[i]);
+            meanpsf_cache_save(*psfs[i], obs);
+        }
+
+    } // endif: there were mean PSFs to compute
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set ROI exposure for diffuse models
+ *
+ * @param[in] models Models.
+ * @param[in] obs LAT observation.
+ *
+ * Computes the exposure grid that is used by npred_diffuse() if the model
+ * container holds a diffuse sky model that applies to the observation.
+ * Nothing is done if the observation has no livetime cube or no event list
+ * with a valid region of interest and energy boundaries, or if the ROI
+ * exposure already applies to the observation. The method is called by
+ * GLATObservation::prepare() before the models are fitted, so that
+ * npred_diffuse() only needs to read the exposure. The exposure is
+ * computed in parallel, hence the method should not be called from within
+ * a parallel region.
+ ***************************************************************************/
+void GLATResponse::set_roi_exposure(const GModels&         models,
+                                    const GLATObservation& obs)
+{
+    // Continue only if the observation has a livetime cube and an event
+    // list with a valid region of interest and energy boundaries
+    const GLATEventList* list = dynamic_cast<const GLATEventList*>(obs.events());
+    if (obs.ltcube() != NULL && list != NULL &&
+        list->roi().radius() > 0.0 && list->ebounds().size() > 0) {
+
+        // Check whether there is a diffuse model that applies to the
+        // observation
+        bool diffuse = false;
+        for (int i = 0; i < models.size() && !diffuse; ++i) {
+            const GModelSky* model = dynamic_cast<const GModelSky*>(models[i]);
+            if (model != NULL && model->isvalid(obs.instrument(), obs.id()) &&
+                dynamic_cast<const GModelSpatialDiffuse*>(model->spatial()) != NULL) {
+                diffuse = true;
+            }
+        }
+
+        // Compute ROI exposure if it does not yet apply to the observation
+        if (diffuse && !has_roi_exposure(obs)) {
+            compute_roi_exposure(obs);
+        }
+
+    } // endif: observation had livetime cube and event list
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -758,6 +1133,17 @@ void GLATResponse::init_members(void)
     m_psf.clear();
     m_edisp.clear();
     m_ptsrc.clear();
+    m_ptsrc_handles.clear();
+    m_ptsrc_instance = ptsrc_instance();
+    m_meanpsf_cache.clear();
+    m_diffnames.clear();
+    m_roi_dirs.clear();
+    m_roi_omega.clear();
+    m_roi_energies.clear();
+    m_roi_exposure.clear();
+    m_roi_centre.clear();
+    m_roi_radius = 0.0;
+    m_roi_ltcube = 0;
     
     // By default use HANDOFF response database.
     char* handoff = std::getenv("HANDOFF_IRF_DIR");
@@ -787,6 +1173,15 @@ void GLATResponse::copy_members(const GLATResponse& rsp)
     m_psf        = rsp.m_psf;
     m_edisp      = rsp.m_edisp;
     m_ptsrc      = rsp.m_ptsrc;
+    m_ptsrc_handles = rsp.m_ptsrc_handles;
+    m_meanpsf_cache = rsp.m_meanpsf_cache;
+    m_roi_dirs      = rsp.m_roi_dirs;
+    m_roi_omega     = rsp.m_roi_omega;
+    m_roi_energies  = rsp.m_roi_energies;
+    m_roi_exposure  = rsp.m_roi_exposure;
+    m_roi_centre    = rsp.m_roi_centre;
+    m_roi_radius    = rsp.m_roi_radius;
+    m_roi_ltcube    = rsp.m_roi_ltcube;
 
     // Return
     return;
@@ -803,6 +1198,774 @@ void GLATResponse::free_members(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Return mean PSF for a point source
+ *
+ * @param[in] source Point source.
+ * @param[in] obs Observation.
+ * @return Pointer to mean PSF.
+ *
+ * Returns the mean PSF for a point source. The mean PSF is looked up by the
+ * source handle only once per thread and spatial model. Subsequent calls
+ * for the same spatial model return the mean PSF from a thread-private
+ * table, without locking and without any map lookup.
+ *
+ * If no mean PSF exists for the source, it is loaded from the mean PSF
+ * cache or computed, which normally has been done beforehand by
+ * set_mean_psfs(). The mean PSF is computed outside the critical zone that
+ * protects the mean PSF stack, so that other threads can continue to look
+ * up their mean PSFs.
+ ***************************************************************************/
+GLATMeanPsf* GLATResponse::mean_psf(const GSource&      source,
+                                    const GObservation& obs) const
+{
+    // Thread-private table of resolved mean PSFs
+    static ptsrc_memo memo[G_PTSRC_MEMO];
+    static int        memo_next = 0;
+    #pragma omp threadprivate(memo, memo_next)
+
+    // Search mean PSF in table. The source name is checked in case that the
+    // spatial model has been replaced by another one at the same address.
+    for (int i = 0; i < G_PTSRC_MEMO; ++i) {
+        if (memo[i].instance == m_ptsrc_instance &&
+            memo[i].model    == source.model()   &&
+            *(memo[i].name)  == source.name()) {
+            return memo[i].psf;
+        }
+    }
+
+    // Initialise mean PSF and source name
+    GLATMeanPsf*       psf  = NULL;
+    const std::string* name = NULL;
+
+    // Search mean PSF. This is done in a critical zone as other threads may
+    // append to the mean PSF stack at the same time.
+    #pragma omp critical(GLATResponse_ptsrc)
+    {
+        std::map<std::string,int>::const_iterator it =
+            m_ptsrc_handles.find(source.name());
+        if (it != m_ptsrc_handles.end()) {
+            psf  = m_ptsrc[it->second];
+            name = &(it->first);
+        }
+    }
+
+    // If mean PSF has not been found then create it now
+    if (psf == NULL) {
+
+        // Get point source spatial model
+        const GModelSpatialPointSource* ptsrc =
+              static_cast<const GModelSpatialPointSource*>(source.model());
+
+        // Load or compute mean PSF
+        GLATMeanPsf* created =
+            new_mean_psf(ptsrc->dir(), static_cast<const GLATObservation&>(obs));
+        created->name(source.name());
+
+        // Push mean PSF on stack unless another thread has created it in
+        // the meantime
+        #pragma omp critical(GLATResponse_ptsrc)
+        {
+            GLATResponse* rsp = const_cast<GLATResponse*>(this);
+            std::map<std::string,int>::iterator it =
+                rsp->m_ptsrc_handles.find(source.name());
+            if (it == rsp->m_ptsrc_handles.end()) {
+                it = rsp->m_ptsrc_handles.insert(std::make_pair(source.name(),
+                                                 int(m_ptsrc.size()))).first;
+                rsp->m_ptsrc.push_back(created);
+                created = NULL;
+            }
+            psf  = m_ptsrc[it->second];
+            name = &(it->first);
+        }
+
+        // Delete mean PSF if it was not used
+        if (created != NULL) {
+            delete created;
+        }
+
+        // Debug option: dump mean PSF
+        #if G_DUMP_MEAN_PSF
+        std::cout << "Added new mean PSF \""+source.name() << "\"" << std::endl;
+        std::cout << *psf << std::endl;
+        #endif
+
+    } // endif: created new mean PSF
+
+    // Store mean PSF in table
+    memo[memo_next].instance = m_ptsrc_instance;
+    memo[memo_next].model    = source.model();
+    memo[memo_next].name     = name;
+    memo[memo_next].psf      = psf;
+    memo_next                = (memo_next + 1) % G_PTSRC_MEMO;
+
+    // Return mean PSF
+    return psf;
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of diffuse model in event cube
+ *
+ * @param[in] cube Event cube.
+ * @param[in] source Source.
+ * @return Diffuse model index (-1 if the event cube has no source map for
+ *         the source).
+ *
+ * Returns the index of the source map for a source in the event cube. The
+ * index is looked up by source name only once per thread, event cube and
+ * spatial model. Subsequent calls return the index from a thread-private
+ * table, without locking and without any map lookup. Table entries are
+ * invalidated when the source map handles of the event cube change.
+ ***************************************************************************/
+int GLATResponse::diffindex(const GLATEventCube& cube,
+                            const GSource&       source) const
+{
+    // Thread-private table of resolved diffuse model indices
+    static diffindex_memo memo[G_DIFFINDEX_MEMO];
+    static int            memo_next = 0;
+    #pragma omp threadprivate(memo, memo_next)
+
+    // Search diffuse model index in table
+    unsigned long srcmap = cube.srcmap_instance();
+    for (int i = 0; i < G_DIFFINDEX_MEMO; ++i) {
+        if (memo[i].instance == m_ptsrc_instance &&
+            memo[i].events   == srcmap           &&
+            memo[i].model    == source.model()   &&
+            *(memo[i].name)  == source.name()) {
+            return memo[i].index;
+        }
+    }
+
+    // Search diffuse model index and store source name. This is done in a
+    // critical zone as other threads may add source names at the same time.
+    int                index;
+    const std::string* name;
+    #pragma omp critical(GLATResponse_diffindex)
+    {
+        GLATResponse* rsp = const_cast<GLATResponse*>(this);
+        index = cube.diffindex(source.name());
+        name  = &(*(rsp->m_diffnames.insert(source.name()).first));
+    }
+
+    // Store diffuse model index in table
+    memo[memo_next].instance = m_ptsrc_instance;
+    memo[memo_next].events   = srcmap;
+    memo[memo_next].model    = source.model();
+    memo[memo_next].name     = name;
+    memo[memo_next].index    = index;
+    memo_next                = (memo_next + 1) % G_DIFFINDEX_MEMO;
+
+    // Return diffuse model index
+    return index;
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of diffuse model in event list
+ *
+ * @param[in] list Event list.
+ * @param[in] source Source.
+ * @return Diffuse model index (-1 if the event list has no diffuse response
+ *         for the source).
+ *
+ * Returns the index of the diffuse response for a source in the event
+ * list. The index is looked up by source name only once per thread, event
+ * list and spatial model. Subsequent calls return the index from a
+ * thread-private table, without locking and without any map lookup. Table
+ * entries are invalidated when the diffuse response handles of the event
+ * list change.
+ ***************************************************************************/
+int GLATResponse::diffindex(const GLATEventList& list,
+                            const GSource&       source) const
+{
+    // Thread-private table of resolved diffuse model indices
+    static diffindex_memo memo[G_DIFFINDEX_MEMO];
+    static int            memo_next = 0;
+    #pragma omp threadprivate(memo, memo_next)
+
+    // Search diffuse model index in table
+    unsigned long diffrsp = list.diffrsp_instance();
+    for (int i = 0; i < G_DIFFINDEX_MEMO; ++i) {
+        if (memo[i].instance == m_ptsrc_instance &&
+            memo[i].events   == diffrsp          &&
+            memo[i].model    == source.model()   &&
+            *(memo[i].name)  == source.name()) {
+            return memo[i].index;
+        }
+    }
+
+    // Search diffuse model index and store source name. This is done in a
+    // critical zone as other threads may add source names at the same time.
+    int                index;
+    const std::string* name;
+    #pragma omp critical(GLATResponse_diffindex)
+    {
+        GLATResponse* rsp = const_cast<GLATResponse*>(this);
+        index = list.diffindex(source.name());
+        name  = &(*(rsp->m_diffnames.insert(source.name()).first));
+    }
+
+    // Store diffuse model index in table
+    memo[memo_next].instance = m_ptsrc_instance;
+    memo[memo_next].events   = diffrsp;
+    memo[memo_next].model    = source.model();
+    memo[memo_next].name     = name;
+    memo[memo_next].index    = index;
+    memo_next                = (memo_next + 1) % G_DIFFINDEX_MEMO;
+
+    // Return diffuse model index
+    return index;
+}
+
+
+/***********************************************************************//**
+ * @brief Return mean PSF for a sky direction
+ *
+ * @param[in] dir Sky direction.
+ * @param[in] obs Observation.
+ * @return Pointer to mean PSF.
+ *
+ * Returns the mean PSF for a sky direction. The mean PSF is searched by
+ * direction in a critical zone as other threads may append to the mean PSF
+ * stack at the same time. If the mean PSF does not yet exist, it is
+ * computed outside of the critical zone.
+ ***************************************************************************/
+GLATMeanPsf* GLATResponse::mean_psf(const GSkyDir&      dir,
+                                    const GObservation& obs) const
+{
+    // Initialise mean PSF
+    GLATMeanPsf* psf = NULL;
+
+    // Search for mean PSF
+    #pragma omp critical(GLATResponse_ptsrc)
+    {
+        int num = m_ptsrc.size();
+        for (int i = 0; i < num; ++i) {
+            if (m_ptsrc[i]->dir() == dir) {
+                psf = m_ptsrc[i];
+                break;
+            }
+        }
+    }
+
+    // If mean PSF has not been found then create it now
+    if (psf == NULL) {
+
+        // Allocate new mean PSF
+        GLATMeanPsf* created = new_mean_psf(dir,
+                               static_cast<const GLATObservation&>(obs));
+
+        // Set source name
+        std::string name = "SRC("+gammalib::str(dir.ra_deg()) +
+                                "," +
+                                gammalib::str(dir.dec_deg())+")";
+        created->name(name);
+
+        // Push mean PSF on stack unless another thread has created it in
+        // the meantime
+        #pragma omp critical(GLATResponse_ptsrc)
+        {
+            int num = m_ptsrc.size();
+            for (int i = 0; i < num; ++i) {
+                if (m_ptsrc[i]->dir() == dir) {
+                    psf = m_ptsrc[i];
+                    break;
+                }
+            }
+            if (psf == NULL) {
+                const_cast<GLATResponse*>(this)->m_ptsrc.push_back(created);
+                psf     = created;
+                created = NULL;
+            }
+        }
+
+        // Delete mean PSF if it was not used
+        if (created != NULL) {
+            delete created;
+        }
+
+        // Debug option: dump mean PSF
+        #if G_DUMP_MEAN_PSF
+        std::cout << "Added new mean PSF \""+name+"\"" << std::endl;
+        std::cout << *psf << std::endl;
+        #endif
+
+    } // endif: created new mean PSF
+
+    // Return mean PSF
+    return psf;
+}
+
+
+/***********************************************************************//**
+ * @brief Allocate mean PSF for a sky direction
+ *
+ * @param[in] dir Sky direction.
+ * @param[in] obs LAT observation.
+ * @return Pointer to new mean PSF.
+ *
+ * Loads the mean PSF for a sky direction from the mean PSF cache if it
+ * exists there, otherwise computes the mean PSF and stores it in the
+ * cache. A cache file that cannot be read is ignored and the mean PSF is
+ * recomputed. The computation is done in a critical zone as the response tables
+ * keep interpolation state, but it does not block the lookup of existing
+ * mean PSFs.
+ ***************************************************************************/
+GLATMeanPsf* GLATResponse::new_mean_psf(const GSkyDir&         dir,
+                                        const GLATObservation& obs) const
+{
+    // Allocate mean PSF
+    GLATMeanPsf* psf = new GLATMeanPsf;
+
+    // Load mean PSF from cache if it exists there, otherwise compute mean
+    // PSF and store it in the cache
+    #pragma omp critical(GLATResponse_new_mean_psf)
+    {
+        if (!meanpsf_cache_load(*psf, dir, obs)) {
+            psf->set(dir, obs);
+            meanpsf_cache_save(*psf, obs);
+        }
+    }
+
+    // Return mean PSF
+    return psf;
+}
+
+
+/***********************************************************************//**
+ * @brief Return new mean PSF stack instance identifier
+ *
+ * @return Unique mean PSF stack instance identifier (>0).
+ *
+ * Returns an identifier that has not been used before. The identifier is
+ * used to check whether entries of the thread-private mean PSF table belong
+ * to a given response.
+ ***************************************************************************/
+unsigned long GLATResponse::ptsrc_instance(void)
+{
+    // Identifier counter
+    static unsigned long last_instance = 0;
+
+    // Get new identifier
+    unsigned long instance;
+    #pragma omp critical(GLATResponse_ptsrc_instance)
+    {
+        instance = ++last_instance;
+    }
+
+    // Return identifier
+    return instance;
+}
+
+
+/***********************************************************************//**
+ * @brief Return ROI integral of mean PSF
+ *
+ * @param[in] psf Mean PSF.
+ * @param[in] energy Energy.
+ * @param[in] obs Observation.
+ * @return Integral of mean PSF over ROI divided by ontime.
+ *
+ * Returns the exposure of the mean PSF times the fraction of the mean PSF
+ * that is contained in the region of interest of the event list, divided
+ * by the ontime. For event cubes the mean PSF is assumed to be fully
+ * contained in the region of interest.
+ ***************************************************************************/
+double GLATResponse::npred_mean_psf(GLATMeanPsf&        psf,
+                                    const GEnergy&      energy,
+                                    const GObservation& obs) const
+{
+    // Initialise Npred
+    double npred = 0.0;
+
+    // Get ontime of events
+    double ontime = obs.events()->gti().ontime();
+
+    // Continue only if ontime is positive
+    if (ontime > 0.0) {
+
+        // Get log10 of energy in MeV
+        double logE = energy.log10MeV();
+
+        // Get exposure
+        npred = psf.exposure(logE) / ontime;
+
+        // Multiply by PSF fraction contained in ROI of event list
+        const GLATEventList* list =
+              dynamic_cast<const GLATEventList*>(obs.events());
+        if (list != NULL && list->roi().radius() > 0.0) {
+            npred *= psf.containment(list->roi().centre().skydir(),
+                                     list->roi().radius(), logE);
+        }
+
+    } // endif: ontime was positive
+
+    // Return Npred
+    return npred;
+}
+
+
+/***********************************************************************//**
+ * @brief Check whether ROI exposure applies to an observation
+ *
+ * @param[in] obs LAT observation.
+ * @return True if ROI exposure applies to the observation.
+ *
+ * Checks whether the ROI exposure has been computed for the region of
+ * interest and the energy boundaries of the event list and for the
+ * livetime cube of the observation.
+ ***************************************************************************/
+bool GLATResponse::has_roi_exposure(const GLATObservation& obs) const
+{
+    // Get event list and livetime cube
+    const GLATEventList* list   = dynamic_cast<const GLATEventList*>(obs.events());
+    const GLATLtCube*    ltcube = obs.ltcube();
+
+    // Check that ROI exposure exists and that region of interest and
+    // livetime cube are the same
+    bool valid = (!m_roi_exposure.empty() && list != NULL && ltcube != NULL &&
+                  m_roi_radius == list->roi().radius()          &&
+                  m_roi_centre == list->roi().centre().skydir() &&
+                  m_roi_ltcube == ltcube->checksum());
+
+    // Check that energy boundaries are the same
+    if (valid) {
+        GEbounds ebds = list->ebounds();
+        if (m_roi_energies.size() != ebds.size()+1 ||
+            m_roi_energies[0] != ebds.emin(0).log10MeV()) {
+            valid = false;
+        }
+        for (int i = 0; valid && i < ebds.size(); ++i) {
+            if (m_roi_energies[i+1] != ebds.emax(i).log10MeV()) {
+                valid = false;
+            }
+        }
+    }
+
+    // Return
+    return valid;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute ROI exposure
+ *
+ * @param[in] obs LAT observation.
+ *
+ * @exception GLATException::no_ltcube
+ *            Observation has no livetime cube.
+ * @exception GLATException::bad_roi_type
+ *            Observation has no event list with a valid region of interest.
+ * @exception GLATException::no_ebds
+ *            Event list has no energy boundaries.
+ *
+ * Sets up the grid of sky directions and solid angles that covers the
+ * region of interest of the event list, and computes the exposure for all
+ * grid directions at the energy boundaries of the event list. The region
+ * of interest and the livetime cube checksum are stored with the grid, so
+ * that has_roi_exposure() can tell whether the grid applies to an
+ * observation. The grid
+ * consists of rings around the ROI centre with a width of about
+ * G_ROI_BINSZ degrees, each ring being divided into pixels of about the
+ * same length in azimuth. The exposure is stored in pixel-major order.
+ *
+ * The effective area weights of the livetime cube are computed once for
+ * each energy and response, and the exposure for the grid directions is
+ * then computed in parallel.
+ ***************************************************************************/
+void GLATResponse::compute_roi_exposure(const GLATObservation& obs)
+{
+    // Clear ROI exposure
+    m_roi_dirs.clear();
+    m_roi_omega.clear();
+    m_roi_energies.clear();
+    m_roi_exposure.clear();
+    m_roi_centre.clear();
+    m_roi_radius = 0.0;
+    m_roi_ltcube = 0;
+
+    // Get pointer on livetime cube
+    GLATLtCube* ltcube = obs.ltcube();
+    if (ltcube == NULL) {
+        throw GLATException::no_ltcube(G_COMPUTE_ROI_EXPOSURE);
+    }
+
+    // Get region of interest of event list
+    const GLATEventList* list = dynamic_cast<const GLATEventList*>(obs.events());
+    if (list == NULL || list->roi().radius() <= 0.0) {
+        throw GLATException::bad_roi_type(G_COMPUTE_ROI_EXPOSURE,
+              "Observation has no event list with a valid region of interest.");
+    }
+    GSkyDir centre = list->roi().centre().skydir();
+    double  radius = list->roi().radius();
+
+    // Store region of interest and livetime cube checksum
+    m_roi_centre = centre;
+    m_roi_radius = radius;
+    m_roi_ltcube = ltcube->checksum();
+
+    // Setup grid of rings around ROI centre
+    int    nrings = int(std::ceil(radius / G_ROI_BINSZ));
+    double dtheta = radius / double(nrings);
+    for (int iring = 0; iring < nrings; ++iring) {
+
+        // Compute ring offset angle and number of azimuth pixels
+        double theta     = (double(iring) + 0.5) * dtheta;
+        double theta_min = (theta - 0.5 * dtheta) * gammalib::deg2rad;
+        double theta_max = (theta + 0.5 * dtheta) * gammalib::deg2rad;
+        double length    = 360.0 * std::sin(theta * gammalib::deg2rad);
+        int    nphi      = int(std::ceil(length / dtheta));
+        if (nphi < 4) {
+            nphi = 4;
+        }
+
+        // Compute azimuth step and pixel solid angle
+        double dphi  = 360.0 / double(nphi);
+        double omega = gammalib::twopi *
+                       (std::cos(theta_min) - std::cos(theta_max)) /
+                       double(nphi);
+
+        // Append grid pixels
+        for (int iphi = 0; iphi < nphi; ++iphi) {
+            GSkyDir dir = centre;
+            dir.rotate_deg((double(iphi) + 0.5) * dphi, theta);
+            m_roi_dirs.push_back(dir);
+            m_roi_omega.push_back(omega);
+        }
+
+    } // endfor: looped over rings
+
+    // Get energy boundaries of the event list
+    GEbounds ebds = list->ebounds();
+    if (ebds.size() < 1) {
+        throw GLATException::no_ebds(G_COMPUTE_ROI_EXPOSURE);
+    }
+
+    // Set energy nodes from the energy boundaries of the event list
+    std::vector<GEnergy> energies;
+    energies.push_back(ebds.emin(0));
+    for (int i = 0; i < ebds.size(); ++i) {
+        energies.push_back(ebds.emax(i));
+    }
+    int neng = energies.size();
+    for (int i = 0; i < neng; ++i) {
+        m_roi_energies.append(energies[i].log10MeV());
+    }
+
+    // Compute effective area weights for all energies and responses
+    int nrsp = size();
+    std::vector<std::vector<double> > weights;
+    weights.reserve(neng*nrsp);
+    for (int ieng = 0; ieng < neng; ++ieng) {
+        for (int i = 0; i < nrsp; ++i) {
+            weights.push_back(std::vector<double>());
+            ltcube->weights(energies[ieng], *m_aeff[i], weights.back());
+        }
+    }
+
+    // Compute exposure for all grid pixels and energies
+    int npix = m_roi_dirs.size();
+    m_roi_exposure.assign(npix*neng, 0.0);
+    #pragma omp parallel for
+    for (int ipix = 0; ipix < npix; ++ipix) {
+        for (int ieng = 0, iaeff = 0; ieng < neng; ++ieng) {
+            double exposure = 0.0;
+            for (int i = 0; i < nrsp; ++i, ++iaeff) {
+                exposure += (*ltcube)(m_roi_dirs[ipix], energies[ieng],
+                                      weights[iaeff], *m_aeff[i]);
+            }
+            m_roi_exposure[ipix*neng+ieng] = exposure;
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return mean PSF cache file name
+ *
+ * @param[in] dir Source direction.
+ * @param[in] obs LAT observation.
+ * @return Cache file name (empty if no cache is used).
+ *
+ * Returns the name of the file in the mean PSF cache directory that holds
+ * the mean PSF for a source direction and an observation. The file name
+ * is derived from a checksum over all quantities that determine the mean
+ * PSF: the livetime cube content, the calibration database and response
+ * name, the source direction, the energy boundaries of the observation
+ * and, for event cubes, the dimension and projection of the counts map
+ * that enter the map corrections. A mean PSF that has been computed for
+ * another livetime cube, response or binning is hence never picked up.
+ *
+ * An empty string is returned if no cache directory has been set or if
+ * the observation has no livetime cube or events.
+ ***************************************************************************/
+std::string GLATResponse::meanpsf_cache_file(const GSkyDir&         dir,
+                                             const GLATObservation& obs) const
+{
+    // Initialise file name
+    std::string filename;
+
+    // Continue only if a cache is used and the observation is complete
+    GLATLtCube* ltcube = obs.ltcube();
+    if (!m_meanpsf_cache.empty() && ltcube != NULL && obs.events() != NULL) {
+
+        // Initialise checksum with format version and livetime cube content
+        std::string version = "GLATMeanPsf:1";
+        unsigned long long hash = gammalib::checksum(version.c_str(),
+                                                     version.length(),
+                                                     ltcube->checksum());
+
+        // Add response
+        hash = gammalib::checksum(m_caldb.c_str(), m_caldb.length()+1, hash);
+        hash = gammalib::checksum(m_rspname.c_str(), m_rspname.length()+1,
+                                  hash);
+
+        // Add source direction
+        double radec[2] = {dir.ra_deg(), dir.dec_deg()};
+        hash = gammalib::checksum((const char*)radec, sizeof(radec), hash);
+
+        // Add energy boundaries
+        GEbounds ebds = obs.events()->ebounds();
+        for (int i = 0; i < ebds.size(); ++i) {
+            double bounds[2] = {ebds.emin(i).MeV(), ebds.emax(i).MeV()};
+            hash = gammalib::checksum((const char*)bounds, sizeof(bounds),
+                                      hash);
+        }
+
+        // Add counts map dimension and projection for event cubes
+        const GLATEventCube* cube =
+              dynamic_cast<const GLATEventCube*>(obs.events());
+        if (cube != NULL) {
+            double dimension[2] = {double(cube->nx()), double(cube->ny())};
+            hash = gammalib::checksum((const char*)dimension,
+                                      sizeof(dimension), hash);
+            const GWcslib* wcs =
+                  dynamic_cast<const GWcslib*>(cube->map().wcs());
+            if (wcs != NULL) {
+                std::string proj = wcs->code()+":"+wcs->coordsys();
+                double      geometry[6] = {wcs->crval(0), wcs->crval(1),
+                                           wcs->crpix(0), wcs->crpix(1),
+                                           wcs->cdelt(0), wcs->cdelt(1)};
+                hash = gammalib::checksum(proj.c_str(), proj.length()+1,
+                                          hash);
+                hash = gammalib::checksum((const char*)geometry,
+                                          sizeof(geometry), hash);
+            }
+        }
+
+        // Set file name
+        filename = m_meanpsf_cache + "/meanpsf_" + gammalib::str(hash) +
+                   ".fits";
+
+    } // endif: cache was used
+
+    // Return file name
+    return filename;
+}
+
+
+/***********************************************************************//**
+ * @brief Load mean PSF from cache
+ *
+ * @param[out] psf Mean PSF.
+ * @param[in] dir Sky direction.
+ * @param[in] obs LAT observation.
+ * @return True if mean PSF was loaded from cache.
+ *
+ * Loads the mean PSF for a sky direction from the mean PSF cache directory.
+ * False is returned if no cache directory has been set, if no cache file
+ * exists for the sky direction, or if the cache file could not be read or
+ * does not match the energy binning of the observation, as is the case
+ * for corrupt or truncated files. In that case @p psf is left unchanged
+ * and the mean PSF should be recomputed.
+ ***************************************************************************/
+bool GLATResponse::meanpsf_cache_load(GLATMeanPsf&           psf,
+                                      const GSkyDir&         dir,
+                                      const GLATObservation& obs) const
+{
+    // Initialise status
+    bool loaded = false;
+
+    // Get cache file name
+    std::string filename = meanpsf_cache_file(dir, obs);
+
+    // Load mean PSF if the cache file exists
+    if (!filename.empty() && gammalib::file_exists(filename)) {
+        try {
+            GLATMeanPsf cached;
+            cached.load(filename);
+            if (cached.nenergies() == obs.events()->ebounds().size()+1 &&
+                cached.noffsets()  > 0) {
+                psf    = cached;
+                loaded = true;
+            }
+        }
+        catch (std::exception &e) {
+            loaded = false;
+        }
+    }
+
+    // Return status
+    return loaded;
+}
+
+
+/***********************************************************************//**
+ * @brief Store mean PSF in cache
+ *
+ * @param[in] psf Mean PSF.
+ * @param[in] obs LAT observation.
+ * @return True if mean PSF was stored in cache.
+ *
+ * Stores a mean PSF in the mean PSF cache directory. The mean PSF is
+ * written into a temporary file that is renamed into the cache file once
+ * it is complete, so that a concurrent or interrupted analysis never sees
+ * a partially written cache file. As the cache only serves to speed up
+ * later analyses, false is returned and the temporary file is removed if
+ * the cache file could not be written. Nothing is done if no cache
+ * directory has been set.
+ ***************************************************************************/
+bool GLATResponse::meanpsf_cache_save(const GLATMeanPsf&     psf,
+                                      const GLATObservation& obs) const
+{
+    // Initialise status
+    bool saved = false;
+
+    // Get cache file name
+    std::string filename = meanpsf_cache_file(psf.dir(), obs);
+
+    // Save mean PSF if a cache is used
+    if (!filename.empty()) {
+
+        // Set temporary file name that is unique for this process
+        std::string tmpname = filename + "." + gammalib::str(int(getpid())) +
+                              ".tmp";
+
+        // Write temporary file and move it into the cache
+        try {
+            psf.save(tmpname, true);
+            saved = (std::rename(tmpname.c_str(), filename.c_str()) == 0);
+        }
+        catch (std::exception &e) {
+            saved = false;
+        }
+
+        // Remove temporary file if the mean PSF was not stored
+        if (!saved) {
+            std::remove(tmpname.c_str());
+        }
+
+    } // endif: cache was used
+
+    // Return status
+    return saved;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                                 Friends                                 =
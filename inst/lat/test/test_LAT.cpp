@@ -30,6 +30,8 @@
 #endif
 #include <stdlib.h>
 #include <iostream>
+#include <cmath>
+#include <vector>
 #include <unistd.h>
 #include "GLATLib.hpp"
 #include "GTools.hpp"
@@ -58,6 +60,14 @@ double test_fct2(const double& ctheta, const double& phi)
     //std::cout << "(" << ctheta << "," << phi << ")" << " ";
     return 1.0;
 }
+double test_fct3(const double& ctheta)
+{
+    return ctheta;
+}
+double test_fct4(const double& ctheta, const double& phi)
+{
+    return ctheta * (1.0 + phi);
+}
 
 
 /***********************************************************************//**
@@ -88,6 +98,7 @@ void TestGLATLtCube::set(void)
     // Append tests to test suite
     append(static_cast<pfunction>(&TestGLATLtCube::test_ltcube_p6), "Test P6 livetime cube");
     append(static_cast<pfunction>(&TestGLATLtCube::test_ltcube_p7), "Test P7 livetime cube");
+    append(static_cast<pfunction>(&TestGLATLtCube::test_ltcube_map), "Test livetime cube map");
 
     // Return
     return;
@@ -237,6 +248,80 @@ void TestGLATLtCube::test_ltcube_p7(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test livetime cube map sums
+ *
+ * Verifies that the livetime sums of a livetime cube map that stores the
+ * livetimes in pixel-major order agree with the sums computed from the
+ * map-major layout of the original skymap. The azimuth dependent sum uses
+ * a function of cos theta to verify that the zenith angle bin index, and
+ * not the map index, is used for cos theta.
+ ***************************************************************************/
+void TestGLATLtCube::test_ltcube_map(void)
+{
+    // Set binning
+    const int nctheta = 4;
+    const int nphi    = 3;
+    const int nmaps   = nctheta * (nphi + 1);
+
+    // Create map-major livetime skymap
+    GSkymap map("HPX", "GAL", 1, "RING", nmaps);
+    for (int pixel = 0; pixel < map.npix(); ++pixel) {
+        for (int i = 0; i < nmaps; ++i)
+            map(pixel, i) = 1.0 + pixel + 0.01 * i;
+    }
+
+    // Write skymap into FITS table and set livetime cube keywords
+    GFits fits;
+    map.write(&fits);
+    GFitsTable* hdu = fits.table(fits.size()-1);
+    hdu->card("THETABIN", "SQRT(1-COSTHETA)", "Costheta binning scheme");
+    hdu->card("NBRBINS", nctheta, "Number of costheta bins");
+    hdu->card("PHIBINS", nphi, "Number of phi bins");
+    hdu->card("COSMIN", 0.0, "Minimum costheta value");
+
+    // Read livetime cube map
+    GLATLtCubeMap cube;
+    cube.read(hdu);
+    test_value(cube.ncostheta(), nctheta, "Number of cos theta bins");
+    test_value(cube.nphi(), nphi, "Number of phi bins");
+
+    // Loop over pixels
+    for (int pixel = 0; pixel < map.npix(); ++pixel) {
+
+        // Get sky direction of pixel
+        GSkyDir dir = map.pix2dir(pixel);
+
+        // Compute reference sums from original layout
+        double ref_ctheta = 0.0;
+        double ref_phi    = 0.0;
+        std::vector<double> weights(nctheta);
+        for (int i = 0; i < nctheta; ++i) {
+            weights[i]  = test_fct3(cube.costheta(i));
+            ref_ctheta += map(pixel, i) * weights[i];
+        }
+        for (int iphi = 0, i = nctheta; iphi < nphi; ++iphi) {
+            for (int itheta = 0; itheta < nctheta; ++itheta, ++i) {
+                ref_phi += map(pixel, i) *
+                           test_fct4(cube.costheta(itheta), cube.phi(iphi));
+            }
+        }
+
+        // Test sums
+        test_value(cube(dir, test_fct3), ref_ctheta, 1.0e-10,
+                   "Livetime cube map cos theta sum");
+        test_value(cube(dir, test_fct4), ref_phi, 1.0e-10,
+                   "Livetime cube map cos theta and phi sum");
+        test_value(cube(dir, weights, GLATAeff()), ref_ctheta, 1.0e-10,
+                   "Livetime cube map weighted sum");
+
+    } // endfor: looped over pixels
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test livetime cube handling for a specific dataset
  *
@@ -327,7 +412,7 @@ void TestGLATLtCube::test_one_ltcube(const std::string& datadir, const double& r
 void TestGLATObservation::test_unbinned_obs_p6(void)
 {
     // Test various datasets
-    test_one_unbinned_obs(dirPass6);
+    test_one_unbinned_obs(dirPass6, "P6_v3_diff");
 
     // Exit test
     return;
@@ -342,7 +427,7 @@ void TestGLATObservation::test_unbinned_obs_p6(void)
 void TestGLATObservation::test_unbinned_obs_p7(void)
 {
     // Test various datasets
-    test_one_unbinned_obs(dirPass7);
+    test_one_unbinned_obs(dirPass7, "P7SOURCE_V6");
 
     // Exit test
     return;
@@ -385,14 +470,16 @@ void TestGLATObservation::test_binned_obs_p7(void)
  * @brief Test unbinned observation handling for a specific dataset
  *
  * @param[in] datadir Directory of test data.
+ * @param[in] irf Instrument response function.
  *
  * Verifies the ability to handle unbinned Fermi/LAT data.
  ***************************************************************************/
-void TestGLATObservation::test_one_unbinned_obs(const std::string& datadir)
+void TestGLATObservation::test_one_unbinned_obs(const std::string& datadir, const std::string& irf)
 {
     // Set filenames
     std::string lat_ft1       = datadir+"/ft1.fits";
     std::string lat_ft2       = datadir+"/ft2.fits";
+    std::string lat_ltcube    = datadir+"/ltcube.fits";
     std::string lat_unbin_xml = datadir+"/obs_unbinned.xml";
     std::string file1         = "test_lat_obs_unbinned.xml";
 
@@ -436,6 +523,150 @@ void TestGLATObservation::test_one_unbinned_obs(const std::string& datadir)
     }
     test_value(num, nevents, 1.0e-20, "Test event iterator");
 
+    // Test unbinned response
+    test_try("Test unbinned response");
+    try {
+        run.load_unbinned(lat_ft1, lat_ft2, lat_ltcube);
+        run.response(irf, lat_caldb);
+        const GLATEventList* list = static_cast<const GLATEventList*>(run.events());
+        const GLATEventAtom* atom = (*list)[0];
+        GModelSpatialPointSource ptsrc(list->roi().centre().skydir());
+        GSource source("Point source", &ptsrc, atom->energy(), atom->time());
+        const GResponse* rsp = run.response();
+        double npred = rsp->npred(source, run);
+        double value = rsp->irf(*atom, source, run);
+        test_assert(npred > 0.0, "Test point source Npred");
+        test_assert(value >= 0.0, "Test point source IRF");
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Test point source response against the PSF containment computed by
+    // direct integration of the mean PSF
+    test_try("Test unbinned point source response");
+    try {
+        const GLATEventList* list   = static_cast<const GLATEventList*>(run.events());
+        GSkyDir              centre = list->roi().centre().skydir();
+        double               radius = list->roi().radius();
+        GEnergy              energy = list->ebounds().emin(0);
+        double               logE   = energy.log10MeV();
+        double               ontime = list->gti().ontime();
+        GLATMeanPsf          psf(centre, run);
+
+        // Integrate mean PSF over ROI using the trapezoidal rule
+        int    nsteps   = 20000;
+        double dtheta   = radius * gammalib::deg2rad / double(nsteps);
+        double integral = 0.0;
+        for (int i = 0; i <= nsteps; ++i) {
+            double theta = double(i) * dtheta;
+            double value = psf.psf(theta * gammalib::rad2deg, logE) *
+                           std::sin(theta);
+            integral    += (i == 0 || i == nsteps) ? 0.5 * value : value;
+        }
+        integral *= gammalib::twopi * dtheta;
+
+        // Test containment for a region centred on the source and for a
+        // region that does not overlap with the PSF
+        double containment = psf.containment(centre, radius, logE);
+        test_value(containment, integral, 1.0e-2*integral,
+                   "Test mean PSF containment");
+        GSkyDir far = centre;
+        far.rotate_deg(0.0, radius+80.0);
+        test_value(psf.containment(far, radius, logE), 0.0, 1.0e-20,
+                   "Test mean PSF containment outside PSF");
+
+        // Test point source Npred
+        GModelSpatialPointSource ptsrc(centre);
+        GSource source("Point source", &ptsrc, energy, list->gti().tstart());
+        double npred = run.response()->npred_ptsrc(source, run);
+        double ref   = psf.exposure(logE) * containment / ontime;
+        test_value(npred, ref, 1.0e-6*ref, "Test point source Npred");
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Test diffuse source response against the DIFRSP columns of the events
+    // and against the exposure integrated over the ROI
+    test_try("Test unbinned diffuse response");
+    try {
+        const GLATEventList* list   = static_cast<const GLATEventList*>(run.events());
+        const GLATEventAtom* atom   = (*list)[0];
+        const GResponse*     rsp    = run.response();
+        GLATResponse*        latrsp = run.response();
+        GLATLtCube*          ltcube = run.ltcube();
+        GSkyDir              centre = list->roi().centre().skydir();
+        double               radius = list->roi().radius();
+        GEnergy              energy = list->ebounds().emin(0);
+        double               ontime = list->gti().ontime();
+
+        // Test that diffuse response is taken from the DIFRSP columns
+        GModelSpatialDiffuseConst diffuse(1.0);
+        for (int i = 0; i < list->ndiffrsp(); ++i) {
+            GSource source(list->diffname(i), &diffuse, atom->energy(),
+                           atom->time());
+            test_value(rsp->irf(*atom, source, run), atom->diffrsp(i),
+                       1.0e-10*std::abs(atom->diffrsp(i)),
+                       "Test diffuse response "+list->diffname(i));
+        }
+
+        // Test that a copy of the event list has its own diffuse response
+        // instance, so that memorised diffuse model indices do not apply
+        // to it
+        GLATEventList copy(*list);
+        test_assert(copy.diffrsp_instance() != list->diffrsp_instance(),
+                    "Test diffuse response instance of event list copy");
+
+        // Integrate exposure over ROI on a polar grid of 0.5 deg
+        int    nrings   = int(std::ceil(radius / 0.5));
+        double dtheta   = radius / double(nrings);
+        double integral = 0.0;
+        for (int iring = 0; iring < nrings; ++iring) {
+            double theta = (double(iring) + 0.5) * dtheta;
+            double cmin  = std::cos(double(iring)   * dtheta * gammalib::deg2rad);
+            double cmax  = std::cos(double(iring+1) * dtheta * gammalib::deg2rad);
+            int    nphi  = 8 * (iring + 1);
+            double omega = gammalib::twopi * (cmin - cmax) / double(nphi);
+            for (int iphi = 0; iphi < nphi; ++iphi) {
+                GSkyDir dir = centre;
+                dir.rotate_deg((double(iphi) + 0.5) * 360.0 / double(nphi), theta);
+                for (int k = 0; k < latrsp->size(); ++k) {
+                    integral += (*ltcube)(dir, energy, *latrsp->aeff(k)) * omega;
+                }
+            }
+        }
+        integral /= ontime;
+
+        // Test that Npred of diffuse source requires the ROI exposure
+        GSource source("Isotropic", &diffuse, energy, list->gti().tstart());
+        bool    thrown = false;
+        try {
+            rsp->npred_diffuse(source, run);
+        }
+        catch (GException::invalid_value &e) {
+            thrown = true;
+        }
+        test_assert(thrown, "Test diffuse Npred without ROI exposure");
+
+        // Prepare observation for isotropic diffuse source
+        GModels   models;
+        GModelSky sky(diffuse, GModelSpectralConst());
+        sky.name("Isotropic");
+        models.append(sky);
+        run.prepare(models);
+
+        // Test Npred of isotropic diffuse source
+        double npred = rsp->npred_diffuse(source, run);
+        test_value(npred, integral, 1.0e-2*integral, "Test diffuse Npred");
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
     // Test XML loading
     test_try("Test XML loading");
     try {
@@ -472,6 +703,7 @@ void TestGLATObservation::test_one_binned_obs(const std::string& datadir, const
     std::string lat_ltcube  = datadir+"/ltcube.fits";
     std::string lat_bin_xml = datadir+"/obs_binned.xml";
     std::string file1       = "test_lat_obs_binned.xml";
+    std::string file2       = "test_lat_meanpsf.fits";
 
     // Declare observations
     GObservations   obs;
@@ -531,6 +763,27 @@ void TestGLATObservation::test_one_binned_obs(const std::string& datadir, const
     test_value(sum, nevents, 1.0e-20, "Test event iterator (counts)");
     test_value(num, nsize, 1.0e-20, "Test event iterator (bins)");
 
+    // Test diffuse response lookup
+    test_assert(ptr->diffindex("__unknown__") == -1,
+                "Test diffuse response index of unknown model");
+    for (int i = 0; i < ptr->ndiffrsp(); ++i) {
+        test_assert(ptr->diffindex(ptr->diffname(i)) == i,
+                    "Test diffuse response index of \""+ptr->diffname(i)+"\"");
+        const GSkymap* map = ptr->diffrsp(i);
+        for (int ieng = 0; ieng < ptr->ebins(); ++ieng) {
+            GNodeArray nodes = ptr->enodes();
+            nodes.set_value(ptr->ebounds().elogmean(ieng).log10MeV());
+            int    ipix     = ptr->npix() / 2;
+            double expected = nodes.wgt_left()  *
+                              map->pixels()[ipix+nodes.inx_left()*map->npix()] +
+                              nodes.wgt_right() *
+                              map->pixels()[ipix+nodes.inx_right()*map->npix()];
+            double value    = ptr->diffrsp(i, ipix, ieng);
+            test_value(value, expected, 1.0e-10*std::abs(expected),
+                       "Test diffuse response value");
+        }
+    }
+
     // Test mean PSF
     test_try("Test mean PSF");
     try {
@@ -544,6 +797,80 @@ void TestGLATObservation::test_one_binned_obs(const std::string& datadir, const
         test_try_failure(e);
     }
 
+    // Test mean PSF from shared zenith angle weights against the direct
+    // livetime cube integration. PSF values are compared relative to the
+    // on-axis value, which cancels the map corrections.
+    test_try("Test mean PSF from zenith angle weights");
+    try {
+        GSkyDir     dir;
+        GLATMeanPsf psf(dir, run);
+        GLATResponse*         rsp    = run.response();
+        GLATLtCube*           ltcube = run.ltcube();
+        GEbounds              ebds   = run.events()->ebounds();
+        std::vector<GLATAeff> aeff;
+        for (int k = 0; k < rsp->size(); ++k) {
+            aeff.push_back(*rsp->aeff(k));
+            aeff.back().costhetamin(std::cos(psf.thetamax()*gammalib::deg2rad));
+        }
+        for (int i = 0; i < psf.nenergies(); ++i) {
+            GEnergy energy   = (i == 0) ? ebds.emin(0) : ebds.emax(i-1);
+            double  logE     = psf.energy(i);
+            double  exposure = 0.0;
+            for (int k = 0; k < rsp->size(); ++k) {
+                exposure += (*ltcube)(dir, energy, aeff[k]);
+            }
+            test_value(psf.exposure(logE), exposure, 1.0e-6*exposure,
+                       "Test mean PSF exposure");
+            double psf0 = 0.0;
+            for (int k = 0; k < rsp->size(); ++k) {
+                psf0 += (*ltcube)(dir, energy, psf.offset(0), *rsp->psf(k),
+                                  aeff[k]);
+            }
+            double value0 = psf.psf(psf.offset(0), logE);
+            for (int j = 1; j < psf.noffsets(); j += 10) {
+                double psfj = 0.0;
+                for (int k = 0; k < rsp->size(); ++k) {
+                    psfj += (*ltcube)(dir, energy, psf.offset(j), *rsp->psf(k),
+                                      aeff[k]);
+                }
+                double ratio = (psf0 > 0.0) ? psfj/psf0 : 0.0;
+                double value = (value0 > 0.0)
+                               ? psf.psf(psf.offset(j), logE)/value0 : 0.0;
+                test_value(value, ratio, 1.0e-6*ratio+1.0e-20,
+                           "Test mean PSF value");
+            }
+        }
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Test mean PSF saving and loading
+    test_try("Test mean PSF saving and loading");
+    try {
+        GSkyDir     dir;
+        GLATMeanPsf psf1(dir, run);
+        psf1.save(file2, true);
+        GLATMeanPsf psf2;
+        psf2.load(file2);
+        test_value(psf2.nenergies(), psf1.nenergies(), 1.0e-20,
+                   "Test number of energies");
+        test_value(psf2.noffsets(), psf1.noffsets(), 1.0e-20,
+                   "Test number of offsets");
+        for (int i = 0; i < psf1.nenergies(); ++i) {
+            double logE   = psf1.energy(i);
+            double value1 = psf1(1.0, logE);
+            double value2 = psf2(1.0, logE);
+            test_value(value2, value1, 1.0e-6*std::abs(value1),
+                       "Test mean PSF value");
+        }
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
     // Test XML loading
     test_try("Test XML loading");
     try {
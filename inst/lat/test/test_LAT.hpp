@@ -67,6 +67,7 @@ public:
     virtual void set(void);
     void         test_ltcube_p6(void);
     void         test_ltcube_p7(void);
+    void         test_ltcube_map(void);
     void         test_one_ltcube(const std::string& datadir, const double& reference);
 };
 
@@ -90,7 +91,7 @@ public:
     void         test_unbinned_obs_p7(void);
     void         test_binned_obs_p6(void);
     void         test_binned_obs_p7(void);
-    void         test_one_unbinned_obs(const std::string& datadir);
+    void         test_one_unbinned_obs(const std::string& datadir, const std::string& irf);
     void         test_one_binned_obs(const std::string& datadir, const std::string& irf);
 };
 
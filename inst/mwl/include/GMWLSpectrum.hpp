@@ -70,6 +70,8 @@ public:
     virtual void          write(GFits& file) const;
     virtual int           number(void) const;
     virtual std::string   print(const GChatter& chatter = NORMAL) const;
+    virtual GMWLDatum*    new_bin(void) const { return NULL; }
+    virtual const GMWLDatum* bin(const int& index, GEventBin* buffer) const;
 
     // Other methods
     void                  load(const std::string& filename, const std::string& extname);
@@ -213,6 +213,24 @@ const GMWLDatum* GMWLSpectrum::operator[](const int& index) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Return spectral point without modifying the spectrum
+ *
+ * @param[in] index Spectral point index [0,...,size()-1].
+ * @param[in] buffer Event bin buffer (not used).
+ * @return Pointer to spectral point.
+ *
+ * Returns a pointer to the spectral point with the specified @p index. As
+ * the spectrum holds distinct spectral points no bin buffer is needed and
+ * the method can be called concurrently by several threads.
+ ***************************************************************************/
+const GMWLDatum* GMWLSpectrum::bin(const int& index, GEventBin*) const
+{
+    // Return pointer to spectral point
+    return ((*this)[index]);
+}
+
+
 /***********************************************************************//**
  * @brief Clear object
  *
@@ -151,7 +151,8 @@ class GFits : public GBase {
 public:
     // Constructors and destructors
     GFits(void);
-    explicit GFits(const std::string& filename, bool create = false);
+    explicit GFits(const std::string& filename, bool create = false,
+                   bool mmap = false);
     GFits(const GFits& fits);
     virtual ~GFits(void);
 
@@ -159,7 +160,8 @@ public:
     void        clear(void);
     GFits*      clone(void) const;
     int         size(void) const;
-    void        open(const std::string& filename, bool create = false);
+    void        open(const std::string& filename, bool create = false,
+                     bool mmap = false);
     void        save(bool clobber = false);
     void        saveto(const std::string& filename, bool clobber = false);
     void        close(void);
@@ -173,6 +175,7 @@ public:
     GFitsTable* table(const std::string& extname) const;
     GFitsTable* table(int extno) const;
     std::string name(void) const;
+    bool        ismapped(void) const;
 };
 
 
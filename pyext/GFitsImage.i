@@ -124,6 +124,7 @@ public:
     int   anynul(void) const;
     void  nulval(const void* value);
     void* nulval(void);
+    bool  ismapped(void) const;
 };
 
 
@@ -127,6 +127,7 @@ public:
     bool hascolumn(const std::string& colname) const;
     int  nrows(void) const;
     int  ncols(void) const;
+    int  optimal_rows(void) const;
 };
 
 
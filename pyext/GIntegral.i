@@ -51,16 +51,21 @@ public:
     void             clear(void);
     GIntegral*       clone(void) const;
     void             max_iter(const int& max_iter);
+    void             max_calls(const int& max_calls);
     void             eps(const double& eps);
     void             silent(const bool& silent);
     const int&       iter(void) const;
     const int&       max_iter(void) const;
+    const int&       max_calls(void) const;
+    const int&       calls(void) const;
     const double&    eps(void) const;
     const bool&      silent(void) const;
     void             kernel(GFunction* kernel);
     const GFunction* kernel(void) const;
     double           romb(double a, double b, int k = 5);
     double           trapzd(double a, double b, int n = 1, double result = 0.0);
+    double           gauss_kronrod(double a, double b);
+    double           gauss_legendre(double a, double b, int n = 16);
 };
 
 
@@ -0,0 +1,86 @@
+/***************************************************************************
+ *                 GMatrix3.i - Fixed-size 3x3 matrix class                *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GMatrix3.i
+ * @brief Fixed-size 3x3 matrix class Python interface definition
+ * @author Juergen Knoedlseder
+ */
+
+%{
+/* Put headers and other declarations here that are needed for compilation */
+#include "GMatrix3.hpp"
+#include "GTools.hpp"
+%}
+
+/* __ Includes ___________________________________________________________ */
+%include "GTypemaps.i"
+
+
+/***********************************************************************//**
+ * @class GMatrix3
+ *
+ * @brief Fixed-size 3x3 matrix class
+ ***************************************************************************/
+class GMatrix3 : public GBase {
+public:
+    // Constructors and destructors
+    GMatrix3(void);
+    explicit GMatrix3(const GMatrix& matrix);
+    GMatrix3(const GMatrix3& matrix);
+    virtual ~GMatrix3(void);
+
+    // Matrix operators
+    bool      operator==(const GMatrix3& matrix) const;
+    bool      operator!=(const GMatrix3& matrix) const;
+
+    // Matrix methods
+    void      clear(void);
+    GMatrix3* clone(void) const;
+    int       rows(void) const;
+    int       columns(void) const;
+    GMatrix3  transpose(void) const;
+    GMatrix   matrix(void) const;
+    void      eulerx(const double& angle);
+    void      eulery(const double& angle);
+    void      eulerz(const double& angle);
+};
+
+
+/***********************************************************************//**
+ * @brief GMatrix3 class extension
+ ***************************************************************************/
+%extend GMatrix3 {
+    double __getitem__(int GTuple[2]) {
+        return (*self)(GTuple[0], GTuple[1]);
+    }
+    void __setitem__(int GTuple[2], double value) {
+        (*self)(GTuple[0], GTuple[1]) = value;
+    }
+    GVector3 __mul__(const GVector3& vector) {
+        return ((*self) * vector);
+    }
+    GMatrix3 __mul__(const GMatrix3& matrix) {
+        return ((*self) * matrix);
+    }
+    GMatrix3 copy() {
+        return (*self);
+    }
+};
@@ -91,7 +91,10 @@ public:
     GVector       solve(const GVector& vector) const;
     GMatrixSparse abs(void) const;
     GMatrixSparse cholesky_decompose(bool compress = true);
+    GMatrixSparse cholesky_decompose(const GMatrixSparse& decomposition,
+                                     bool compress = true);
     GVector       cholesky_solver(const GVector& vector, bool compress = true);
+    GVector       cholesky_inverse_diagonal(bool compress = true);
     GMatrixSparse cholesky_invert(bool compress = true);
     void          set_mem_block(const int& block);
     void          stack_init(const int& size = 0, const int& entries = 0);
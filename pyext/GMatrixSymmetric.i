@@ -85,6 +85,7 @@ public:
     GMatrixSymmetric cholesky_decompose(bool compress = true) const;
     GVector          cholesky_solver(const GVector& vector, bool compress = true) const;
     GMatrixSymmetric cholesky_invert(bool compress = true) const;
+    void             rank1_update(const double& alpha, const GVector& vector);
 };
 
 
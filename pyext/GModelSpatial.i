@@ -55,8 +55,9 @@ public:
     virtual void           write(GXmlElement& xml) const = 0;
 
     // Methods
-    int  size(void) const;
-    void autoscale(void);
+    int           size(void) const;
+    void          autoscale(void);
+    unsigned long instance(void) const;
 };
 
 
@@ -75,6 +75,7 @@ public:
     virtual double        model(const GModels& models, const GEvent& event,
                                 GVector* gradient = NULL) const;
     virtual double        npred(const GModels& models, GVector* gradient = NULL) const;
+    virtual void          prepare(const GModels& models);
 
     // Implemented methods
     void                  name(const std::string& name);
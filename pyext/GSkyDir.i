@@ -51,6 +51,7 @@ public:
     void          lb(const double& l, const double& b);
     void          lb_deg(const double& l, const double& b);
     void          celvector(const GVector& vector);
+    void          celvector(const GVector3& vector);
     void          rotate_deg(const double& phi, const double& theta);
     const double& l(void) const;
     const double& b(void) const;
@@ -60,7 +61,7 @@ public:
     double        b_deg(void) const;
     double        ra_deg(void) const;
     double        dec_deg(void) const;
-    GVector       celvector(void) const;
+    GVector3      celvector(void) const;
     double        dist(const GSkyDir& dir) const;
     double        dist_deg(const GSkyDir& dir) const;
     double        posang(const GSkyDir& dir) const;
@@ -139,6 +139,7 @@ public:
     int       nmaps(void) const;
     int       xy2pix(const GSkyPixel& pix) const;
     GSkyPixel pix2xy(const int& pix) const;
+    void      reorder(const std::string& ordering);
     GWcs*     wcs(void) const;
     void      wcs(const GWcs& wcs);
     double*   pixels(void) const;
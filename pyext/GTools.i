@@ -83,6 +83,8 @@ namespace gammalib {
                                               const double& epivot,
                                               const double& gamma);
     bool                     file_exists(const std::string& filename);
+    int                      thread_id(void);
+    int                      max_threads(void);
     bool                     isinfinite(const double& x);
     bool                     isnotanumber(const double& x);
 }
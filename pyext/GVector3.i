@@ -0,0 +1,98 @@
+/***************************************************************************
+ *                  GVector3.i - Fixed-size 3-vector class                 *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GVector3.i
+ * @brief Fixed-size 3-vector class Python interface definition
+ * @author Juergen Knoedlseder
+ */
+
+%{
+/* Put headers and other declarations here that are needed for compilation */
+#include "GVector3.hpp"
+#include "GTools.hpp"
+%}
+
+
+/***********************************************************************//**
+ * @class GVector3
+ *
+ * @brief Fixed-size 3-vector class
+ ***************************************************************************/
+class GVector3 : public GBase {
+public:
+    // Constructors and destructors
+    GVector3(void);
+    GVector3(const double& x, const double& y, const double& z);
+    explicit GVector3(const GVector& vector);
+    GVector3(const GVector3& vector);
+    virtual ~GVector3(void);
+
+    // Vector operators
+    bool      operator==(const GVector3& vector) const;
+    bool      operator!=(const GVector3& vector) const;
+    GVector3& operator+=(const GVector3& vector);
+    GVector3& operator-=(const GVector3& vector);
+    GVector3& operator*=(const double& scalar);
+
+    // Vector methods
+    void      clear(void);
+    GVector3* clone(void) const;
+    int       size(void) const;
+    GVector   vector(void) const;
+};
+
+
+/***********************************************************************//**
+ * @brief GVector3 class extension
+ ***************************************************************************/
+%extend GVector3 {
+    double __getitem__(const int& index) {
+        if (index >= 0 && index < 3) {
+            return (*self)[index];
+        }
+        else {
+            throw GException::out_of_range("__getitem__(int)", index, 3);
+        }
+    }
+    void __setitem__(const int& index, const double& val) {
+        if (index >= 0 && index < 3) {
+            (*self)[index] = val;
+        }
+        else {
+            throw GException::out_of_range("__setitem__(int)", index, 3);
+        }
+    }
+    double __mul__(const GVector3& a) {
+        return (*self) * a;
+    }
+    GVector3 __mul__(const double& a) {
+        return (*self) * a;
+    }
+    GVector3 copy() {
+        return (*self);
+    }
+    GVector3 cross(const GVector3& a) {
+        return cross(*self, a);
+    }
+    double norm() {
+        return norm(*self);
+    }
+};
@@ -63,6 +63,8 @@ public:
     int          nside(void) const;
     std::string  ordering(void) const;
     void         ordering(const std::string& ordering);
+    int          ring2nest(const int& pix) const;
+    int          nest2ring(const int& pix) const;
 };
 
 
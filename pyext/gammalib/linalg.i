@@ -47,7 +47,9 @@
 
 /* __ Linear Algebra _____________________________________________________ */
 %include "GVector.i"
+%include "GVector3.i"
 %include "GMatrixBase.i"
 %include "GMatrix.i"
 %include "GMatrixSparse.i"
 %include "GMatrixSymmetric.i"
+%include "GMatrix3.i"
@@ -31,6 +31,7 @@
 #include <cstdio>
 #include "GException.hpp"
 #include "GFitsCfitsio.hpp"
+#include "GFitsMmap.hpp"
 #include "GFits.hpp"
 #include "GFitsImageByte.hpp"
 #include "GFitsImageSByte.hpp"
@@ -91,17 +92,18 @@ GFits::GFits(void)
  *
  * @param[in] filename FITS file name.
  * @param[in] create Create FITS file if it does not exist (default=false)
+ * @param[in] mmap Memory map uncompressed FITS file (default=false)
  *
  * Construct an object by opening a FITS file. If the file does not exist it
- * will (optionally) be created.
+ * will (optionally) be created. See open() for the memory mapping option.
  ***************************************************************************/
-GFits::GFits(const std::string& filename, bool create)
+GFits::GFits(const std::string& filename, bool create, bool mmap)
 {
     // Initialise class members
     init_members();
 
     // Open specified FITS file
-    open(filename, create);
+    open(filename, create, mmap);
 
     // Return
     return;
@@ -217,6 +219,7 @@ int GFits::size(void) const
  *
  * @param[in] filename Name of FITS file to be opened.
  * @param[in] create Create FITS file if it does not exist (default=false)
+ * @param[in] mmap Memory map uncompressed FITS file (default=false)
  *
  * @exception GException::fits_already_opened
  *            Class instance contains already an opened FITS file.
@@ -234,8 +237,18 @@ int GFits::size(void) const
  * The HDUs can then be accessed using the hdu(const std::string&) or
  * hdu(int extno) method.
  * Any environment variable present in the filename will be expanded.
+ *
+ * If mmap=true, the file is opened read-only and, if it is an uncompressed
+ * FITS file on disk, it is mapped into memory. Image pixels and fixed-width
+ * numerical table columns are then loaded from the memory mapping instead
+ * of being read through cfitsio. Image pixels that are accessed by value
+ * through GFitsImage::pixel() are read directly from the mapping, without
+ * copying the image into memory. Only the pages of the file that are
+ * accessed are read from disk, and they are shared with all other
+ * processes that map the same file. Data that need scaling or null value
+ * handling, as well as compressed files, are still read through cfitsio.
  ***************************************************************************/
-void GFits::open(const std::string& filename, bool create)
+void GFits::open(const std::string& filename, bool create, bool mmap)
 {
     // Remove any HDUs
     m_hdu.clear();
@@ -251,12 +264,16 @@ void GFits::open(const std::string& filename, bool create)
     m_readwrite = true;
     m_created   = false;
 
-    // Try opening FITS file with readwrite access
+    // Try opening FITS file with readwrite access. Memory mapped files are
+    // opened readonly.
     int status = 0;
-    status     = __ffopen(FHANDLE(m_fitsfile), fname.c_str(), 1, &status);
+    if (!mmap) {
+        status = __ffopen(FHANDLE(m_fitsfile), fname.c_str(), 1, &status);
+    }
 
-    // If failed then try opening as readonly
-    if (status == 104 || status == 112) {
+    // If failed (or if memory mapping is requested) then try opening as
+    // readonly
+    if (mmap || status == 104 || status == 112) {
         status      = 0;
         status      = __ffopen(FHANDLE(m_fitsfile), fname.c_str(), 0, &status);
         m_readwrite = false;
@@ -293,6 +310,12 @@ void GFits::open(const std::string& filename, bool create)
         throw GException::fits_error(G_OPEN, status);
     }
 
+    // Optionally attach memory mapping before the HDUs are opened, so that
+    // images can use the mapping
+    if (mmap && !m_created) {
+        m_mapped = gammalib::fits_mmap_attach(m_fitsfile, fname);
+    }
+
     // Open and append all HDUs
     for (int i = 0; i < num_hdu; ++i) {
 
@@ -880,6 +903,7 @@ void GFits::init_members(void)
     m_fitsfile  = NULL;
     m_readwrite = true;
     m_created   = true;
+    m_mapped    = false;
 
     // Return
     return;
@@ -904,6 +928,7 @@ void GFits::copy_members(const GFits& fits)
     m_fitsfile  = NULL;
     m_readwrite = true;
     m_created   = true;
+    m_mapped    = false;
 
     // Clone HDUs
     m_hdu.clear();
@@ -930,6 +955,11 @@ void GFits::free_members(void)
     // If FITS file has been opened then close it now
     if (m_fitsfile != NULL) {
 
+        // Detach memory mapping
+        if (m_mapped) {
+            gammalib::fits_mmap_detach(m_fitsfile);
+        }
+
         // Compile option: If there are no HDUs then delete the file (don't
         // worry about error)
         #if DELETE_EMPTY_FITS_FILES
@@ -60,6 +60,7 @@
 #define __ffgcvb(A, B, C, D, E, F, G, H, I) ffgcvb(A, B, C, D, E, F, G, H, I)
 #define __ffgcvs(A, B, C, D, E, F, G, H, I) ffgcvs(A, B, C, D, E, F, G, H, I)
 #define __ffgerr(A, B) ffgerr(A, B)
+#define __ffghadll(A, B, C, D, E) ffghadll(A, B, C, D, E)
 #define __ffghdt(A, B, C) ffghdt(A, B, C)
 #define __ffghsp(A, B, C, D) ffghsp(A, B, C, D)
 #define __ffgidm(A, B, C) ffgidm(A, B, C)
@@ -71,7 +72,9 @@
 #define __ffgkey(A, B, C, D, E) ffgkey(A, B, C, D, E)
 #define __ffgkyn(A, B, C, D, E, F) ffgkyn(A, B, C, D, E, F)
 #define __ffgnrw(A, B, C) ffgnrw(A, B, C)
+#define __ffgnrwll(A, B, C) ffgnrwll(A, B, C)
 #define __ffgncl(A, B, C) ffgncl(A, B, C)
+#define __ffgrsz(A, B, C) ffgrsz(A, B, C)
 #define __ffgsv(A, B, C, D, E, F, G, H, I) ffgsv(A, B, C, D, E, F, G, H, I)
 #define __ffgtcl(A, B, C, D, E, F) ffgtcl(A, B, C, D, E, F)
 #define __fficol(A, B, C, D, E) fficol(A, B, C, D, E)
@@ -127,6 +130,7 @@ typedef fitsfile __fitsfile;
 #define __ffgcvb(A, B, C, D, E, F, G, H, I) __dummy()
 #define __ffgcvs(A, B, C, D, E, F, G, H, I) __dummy()
 #define __ffgerr(A, B) __error(A, B)
+#define __ffghadll(A, B, C, D, E) __dummy()
 #define __ffghdt(A, B, C) __dummy()
 #define __ffghsp(A, B, C, D) __dummy()
 #define __ffgidm(A, B, C) __dummy()
@@ -138,7 +142,9 @@ typedef fitsfile __fitsfile;
 #define __ffgkey(A, B, C, D, E) __dummy()
 #define __ffgkyn(A, B, C, D, E, F) __dummy()
 #define __ffgnrw(A, B, C) __dummy()
+#define __ffgnrwll(A, B, C) __dummy()
 #define __ffgncl(A, B, C) __dummy()
+#define __ffgrsz(A, B, C) __dummy()
 #define __ffgsv(A, B, C, D, E, F, G, H, I) __dummy()
 #define __ffgtcl(A, B, C, D, E, F) __dummy()
 #define __fficol(A, B, C, D, E) __dummy()
@@ -183,7 +189,7 @@ typedef struct {
 
 /* __ Dummy function _____________________________________________________ */
 inline
-void __error(int status, char* err_text)
+void __error(int, char* err_text)
 {
     std::strcpy(err_text, "CFITSIO not available");
 }
@@ -28,8 +28,10 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <cstdlib>
 #include "GException.hpp"
 #include "GFitsCfitsio.hpp"
+#include "GFitsMmap.hpp"
 #include "GFitsImage.hpp"
 #include "GTools.hpp"
 
@@ -410,6 +412,13 @@ void GFitsImage::nulval(const void* value)
     // Allocate nul value
     alloc_nulval(value);
 
+    // Release memory mapped pixels as nul values need to be handled by
+    // cfitsio
+    if (value != NULL && m_mmap != NULL) {
+        gammalib::fits_mmap_release(m_mmap);
+        m_mmap = NULL;
+    }
+
     // Update column
 
     // Return
@@ -494,6 +503,111 @@ void GFitsImage::data_open(void* vptr)
 }
 
 
+/***********************************************************************//**
+ * @brief Load FITS image from memory mapped FITS file
+ *
+ * @param[in] datatype Datatype of pixels to be loaded.
+ * @param[in] pixels Pixel array to be loaded.
+ * @param[in] nulval Pointer to pixel nul value.
+ * @param[out] anynul Number of nul values encountered during loading.
+ * @return True if the pixels were loaded.
+ *
+ * Loads the image pixels from the memory mapping of the FITS file. This is
+ * only done if the image pixels are memory mapped (see open_image_mmap()),
+ * if the pixel type in the file corresponds to the datatype of the pixel
+ * array and if no nul value is requested. Otherwise false is returned and
+ * the pixels need to be loaded through cfitsio.
+ ***************************************************************************/
+bool GFitsImage::load_image_mmap(int datatype, const void* pixels,
+                                 const void* nulval, int* anynul)
+{
+    // Determine element size of pixels for types that have the same
+    // representation in memory and in the FITS file
+    int elsize = 0;
+    if      (datatype == __TBYTE     && m_bitpix ==   8) elsize = 1;
+    else if (datatype == __TSHORT    && m_bitpix ==  16) elsize = 2;
+    else if (datatype == __TLONGLONG && m_bitpix ==  64) elsize = 8;
+    else if (datatype == __TFLOAT    && m_bitpix == -32) elsize = 4;
+    else if (datatype == __TDOUBLE   && m_bitpix == -64) elsize = 8;
+
+    // Load pixels from memory mapping
+    bool loaded = false;
+    if (elsize > 0 && nulval == NULL && m_mmap != NULL) {
+        gammalib::fits_mmap_copy(m_mmap, elsize, m_num_pixels, 1, 0,
+                                 (void*)pixels);
+        if (anynul != NULL) {
+            *anynul = 0;
+        }
+        loaded = true;
+    }
+
+    // Return
+    return loaded;
+}
+
+
+/***********************************************************************//**
+ * @brief Open image pixels in memory mapped FITS file
+ *
+ * Acquires the image pixels in the memory mapping of the FITS file, so
+ * that they can be read directly from the mapping. This is only done if
+ * the FITS file is memory mapped, if the pixels need no scaling, if no
+ * nul value is set and if the image is not compressed. The method
+ * assumes that the FITS file pointer has been moved to the HDU.
+ ***************************************************************************/
+void GFitsImage::open_image_mmap(void)
+{
+    // Release any memory mapped pixels
+    gammalib::fits_mmap_release(m_mmap);
+    m_mmap = NULL;
+
+    // Check that pixels need no scaling, no nul value handling and that
+    // the image is not compressed
+    if (m_num_pixels > 0 && ptr_nulval() == NULL &&
+        !(hascard("BSCALE") && real("BSCALE") != 1.0) &&
+        !(hascard("BZERO")  && real("BZERO")  != 0.0) &&
+        !hascard("ZIMAGE")) {
+
+        // Get start of data in FITS file
+        long long datastart = 0;
+        int       status    = 0;
+        status = __ffghadll(FPTR(m_fitsfile), NULL, &datastart, NULL, &status);
+
+        // Acquire pixels in memory mapping
+        if (status == 0 && datastart > 0) {
+            long long nbytes = (long long)m_num_pixels *
+                               (long long)(std::abs(m_bitpix) / 8);
+            m_mmap = gammalib::fits_mmap_acquire(m_fitsfile, datastart, nbytes);
+        }
+
+    } // endif: pixels could be memory mapped
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return pixel value from memory mapped FITS file
+ *
+ * @param[in] offset Pixel offset.
+ * @return Pixel value.
+ *
+ * Returns the value of a memory mapped image pixel as double precision
+ * value. The method assumes that the pixels are memory mapped.
+ ***************************************************************************/
+double GFitsImage::mmap_pixel(const int& offset) const
+{
+    // Get element size and pointer to pixel
+    int                  elsize = std::abs(m_bitpix) / 8;
+    const unsigned char* ptr    = m_mmap + (long long)offset * elsize;
+
+    // Return pixel value
+    return ((m_bitpix < 0) ? gammalib::fits_mmap_real(ptr, elsize)
+                           : double(gammalib::fits_mmap_integer(ptr, elsize)));
+}
+
+
 /***********************************************************************//**
  * @brief Save FITS image
  *
@@ -636,6 +750,9 @@ void GFitsImage::open_image(void* vptr)
 
     } // endif: there is an image
 
+    // Use memory mapped pixels if possible
+    open_image_mmap();
+
     // Return
     return;
 }
@@ -770,10 +887,12 @@ void GFitsImage::save_image(int datatype, const void* pixels)
  * values should be read or written yet no pixel array is allocated. In case
  * that pixels existed already before they will be deleted before fetching
  * new ones.
- * There are two possibilities to fetch the pixels:
- * (1) In case that a FITS file is attached to the image, the pixel array
+ * There are three possibilities to fetch the pixels:
+ * (1) In case that the pixels are memory mapped, the pixel array will be
+ * loaded from the mapping using the load_image_mmap() method.
+ * (2) In case that a FITS file is attached to the image, the pixel array
  * will be loaded from the FITS file using the load_image() method.
- * (2) In case that no FITS file is attached, a new pixel array will be
+ * (3) In case that no FITS file is attached, a new pixel array will be
  * allocated that is initalised to zero.
  ***************************************************************************/
 void GFitsImage::fetch_data(void)
@@ -785,8 +904,10 @@ void GFitsImage::fetch_data(void)
         alloc_data();
         init_data();
 
-        // If a FITS file is attached then load pixels from FITS file.
-        if (FPTR(m_fitsfile)->Fptr != NULL) {
+        // Load pixels from the memory mapping or, if this is not possible
+        // and a FITS file is attached, from the FITS file
+        if (!load_image_mmap(type(), ptr_data(), ptr_nulval(), &m_anynul) &&
+            FPTR(m_fitsfile)->Fptr != NULL) {
             load_image(type(), ptr_data(), ptr_nulval(), &m_anynul);
         }
 
@@ -957,6 +1078,7 @@ void GFitsImage::init_members(void)
     m_naxes      = NULL;
     m_num_pixels = 0;
     m_anynul     = 0;
+    m_mmap       = NULL;
 
     // Return
     return;
@@ -976,6 +1098,10 @@ void GFitsImage::copy_members(const GFitsImage& image)
     m_num_pixels = image.m_num_pixels;
     m_anynul     = image.m_anynul;
 
+    // Acquire memory mapped pixels
+    m_mmap = image.m_mmap;
+    gammalib::fits_mmap_acquire(m_mmap);
+
     // Copy axes
     m_naxes = NULL;
     if (image.m_naxes != NULL && m_naxis > 0) {
@@ -998,8 +1124,12 @@ void GFitsImage::free_members(void)
     // Free memory
     if (m_naxes != NULL) delete [] m_naxes;
 
+    // Release memory mapped pixels
+    gammalib::fits_mmap_release(m_mmap);
+
     // Mark memory as free
     m_naxes = NULL;
+    m_mmap  = NULL;
 
     // Return
     return;
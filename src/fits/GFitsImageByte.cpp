@@ -639,8 +639,9 @@ const unsigned char& GFitsImageByte::at(const int& ix, const int& iy,
  ***************************************************************************/
 double GFitsImageByte::pixel(const int& ix) const
 {
-    // Return pixel value
-    return (double(this->at(ix)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix)) : double(this->at(ix)));
 }
 
 
@@ -655,8 +656,9 @@ double GFitsImageByte::pixel(const int& ix) const
  ***************************************************************************/
 double GFitsImageByte::pixel(const int& ix, const int& iy) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy)) : double(this->at(ix,iy)));
 }
 
 
@@ -672,8 +674,9 @@ double GFitsImageByte::pixel(const int& ix, const int& iy) const
  ***************************************************************************/
 double GFitsImageByte::pixel(const int& ix, const int& iy, const int& iz) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy,iz)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy,iz)) : double(this->at(ix,iy,iz)));
 }
 
 
@@ -691,8 +694,9 @@ double GFitsImageByte::pixel(const int& ix, const int& iy, const int& iz) const
 double GFitsImageByte::pixel(const int& ix, const int& iy, const int& iz,
                               const int& it) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy,iz,it)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy,iz,it)) : double(this->at(ix,iy,iz,it)));
 }
 
 
@@ -750,9 +754,10 @@ void GFitsImageByte::init_members(void)
  ***************************************************************************/
 void GFitsImageByte::copy_members(const GFitsImageByte& image)
 {
-    // Fetch column data if not yet fetched. The casting circumvents the
-    // const correctness
-    bool not_loaded = (image.m_pixels == NULL);
+    // Fetch column data if not yet fetched, unless the pixels are memory
+    // mapped, in which case the copy reads them from the mapping. The
+    // casting circumvents the const correctness
+    bool not_loaded = (image.m_pixels == NULL && image.m_mmap == NULL);
     if (not_loaded) {
         const_cast<GFitsImageByte*>(&image)->fetch_data();
     }
@@ -640,8 +640,9 @@ const long long& GFitsImageLongLong::at(const int& ix, const int& iy,
  ***************************************************************************/
 double GFitsImageLongLong::pixel(const int& ix) const
 {
-    // Return pixel value
-    return (double(this->at(ix)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix)) : double(this->at(ix)));
 }
 
 
@@ -656,8 +657,9 @@ double GFitsImageLongLong::pixel(const int& ix) const
  ***************************************************************************/
 double GFitsImageLongLong::pixel(const int& ix, const int& iy) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy)) : double(this->at(ix,iy)));
 }
 
 
@@ -673,8 +675,9 @@ double GFitsImageLongLong::pixel(const int& ix, const int& iy) const
  ***************************************************************************/
 double GFitsImageLongLong::pixel(const int& ix, const int& iy, const int& iz) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy,iz)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy,iz)) : double(this->at(ix,iy,iz)));
 }
 
 
@@ -692,8 +695,9 @@ double GFitsImageLongLong::pixel(const int& ix, const int& iy, const int& iz) co
 double GFitsImageLongLong::pixel(const int& ix, const int& iy, const int& iz,
                               const int& it) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy,iz,it)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy,iz,it)) : double(this->at(ix,iy,iz,it)));
 }
 
 
@@ -751,9 +755,10 @@ void GFitsImageLongLong::init_members(void)
  ***************************************************************************/
 void GFitsImageLongLong::copy_members(const GFitsImageLongLong& image)
 {
-    // Fetch column data if not yet fetched. The casting circumvents the
-    // const correctness
-    bool not_loaded = (image.m_pixels == NULL);
+    // Fetch column data if not yet fetched, unless the pixels are memory
+    // mapped, in which case the copy reads them from the mapping. The
+    // casting circumvents the const correctness
+    bool not_loaded = (image.m_pixels == NULL && image.m_mmap == NULL);
     if (not_loaded) {
         const_cast<GFitsImageLongLong*>(&image)->fetch_data();
     }
@@ -638,8 +638,9 @@ const char& GFitsImageSByte::at(const int& ix, const int& iy,
  ***************************************************************************/
 double GFitsImageSByte::pixel(const int& ix) const
 {
-    // Return pixel value
-    return (double(this->at(ix)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix)) : double(this->at(ix)));
 }
 
 
@@ -654,8 +655,9 @@ double GFitsImageSByte::pixel(const int& ix) const
  ***************************************************************************/
 double GFitsImageSByte::pixel(const int& ix, const int& iy) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy)) : double(this->at(ix,iy)));
 }
 
 
@@ -671,8 +673,9 @@ double GFitsImageSByte::pixel(const int& ix, const int& iy) const
  ***************************************************************************/
 double GFitsImageSByte::pixel(const int& ix, const int& iy, const int& iz) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy,iz)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy,iz)) : double(this->at(ix,iy,iz)));
 }
 
 
@@ -690,8 +693,9 @@ double GFitsImageSByte::pixel(const int& ix, const int& iy, const int& iz) const
 double GFitsImageSByte::pixel(const int& ix, const int& iy, const int& iz,
                               const int& it) const
 {
-    // Return pixel value
-    return (double(this->at(ix,iy,iz,it)));
+    // Return pixel value, reading memory mapped pixels directly
+    return ((m_pixels == NULL && m_mmap != NULL)
+            ? mmap_pixel(offset(ix,iy,iz,it)) : double(this->at(ix,iy,iz,it)));
 }
 
 
@@ -749,9 +753,10 @@ void GFitsImageSByte::init_members(void)
  ***************************************************************************/
 void GFitsImageSByte::copy_members(const GFitsImageSByte& image)
 {
-    // Fetch column data if not yet fetched. The casting circumvents the
-    // const correctness
-    bool not_loaded = (image.m_pixels == NULL);
+    // Fetch column data if not yet fetched, unless the pixels are memory
+    // mapped, in which case the copy reads them from the mapping. The
+    // casting circumvents the const correctness
+    bool not_loaded = (image.m_pixels == NULL && image.m_mmap == NULL);
     if (not_loaded) {
         const_cast<GFitsImageSByte*>(&image)->fetch_data();
     }
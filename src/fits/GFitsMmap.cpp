@@ -0,0 +1,510 @@
+/***************************************************************************
+ *          GFitsMmap.cpp - Memory mapped access to FITS files             *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GFitsMmap.cpp
+ * @brief Memory mapped access to FITS files implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <map>
+#include <vector>
+#include <cstring>
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "GFitsCfitsio.hpp"
+#include "GFitsMmap.hpp"
+
+/* __ Method name definitions ____________________________________________ */
+
+/* __ Macros _____________________________________________________________ */
+
+/* __ Coding definitions _________________________________________________ */
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) && defined(HAVE_UNISTD_H)
+#define G_USE_MMAP                    //!< Memory mapping is supported
+#endif
+
+/* __ Debug definitions __________________________________________________ */
+
+/* __ Local types ________________________________________________________ */
+namespace {
+    struct fits_mapping {
+        const unsigned char* addr;    //!< Start of mapping
+        long long            length;  //!< Length of mapping (bytes)
+        int                  files;   //!< Number of attached FITS files
+        int                  users;   //!< Number of data users
+    };
+    std::map<const void*, fits_mapping*> fits_files;    //!< Mappings of files
+    std::vector<fits_mapping*>           fits_mappings; //!< All mappings
+}
+
+/* __ Local prototypes ___________________________________________________ */
+namespace {
+    fits_mapping* fits_mmap_find(const unsigned char* data);
+    void          fits_mmap_free(fits_mapping* mapping);
+}
+
+
+/***********************************************************************//**
+ * @brief Attach memory mapping to FITS file
+ *
+ * @param[in] vptr FITS file pointer.
+ * @param[in] filename FITS file name.
+ * @return True if the file has been mapped.
+ *
+ * Maps the FITS file read-only into memory. The file is only mapped if
+ * it is a plain uncompressed FITS file on disk, which is verified by the
+ * "SIMPLE" keyword at the start of the file. The mapping is shared, hence
+ * pages of the file are shared by all processes that map the file.
+ *
+ * If the file has already been mapped for another opening of the same
+ * file, which shares the cfitsio file structure, the existing mapping is
+ * attached again. Each successful attachment needs to be balanced by a
+ * call to fits_mmap_detach().
+ *
+ * On systems without memory mapping support the method does nothing and
+ * returns false.
+ ***************************************************************************/
+bool gammalib::fits_mmap_attach(void* vptr, const std::string& filename)
+{
+    // Initialise result
+    bool mapped = false;
+
+    // Continue only if memory mapping is supported and FITS file is open
+    #if defined(G_USE_MMAP)
+    if (vptr != NULL && FPTR(vptr)->Fptr != NULL) {
+
+        // Attach existing mapping of the file
+        #pragma omp critical(GFitsMmap)
+        {
+        std::map<const void*, fits_mapping*>::iterator it =
+                                        fits_files.find(FPTR(vptr)->Fptr);
+        if (it != fits_files.end()) {
+            it->second->files++;
+            mapped = true;
+        }
+        } // end of critical zone
+
+        // ... otherwise map the file
+        int fd = (mapped) ? -1 : ::open(filename.c_str(), O_RDONLY);
+        if (fd != -1) {
+
+            // Get file length and map file
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && info.st_size >= 2880) {
+                void* addr = ::mmap(NULL, info.st_size, PROT_READ,
+                                    MAP_SHARED, fd, 0);
+
+                // Keep the mapping if the file is an uncompressed FITS file
+                if (addr != MAP_FAILED) {
+                    if (std::strncmp((const char*)addr, "SIMPLE  =", 9) == 0) {
+                        #pragma omp critical(GFitsMmap)
+                        {
+                        std::map<const void*, fits_mapping*>::iterator it =
+                                        fits_files.find(FPTR(vptr)->Fptr);
+                        if (it != fits_files.end()) {
+                            it->second->files++;
+                            ::munmap(addr, info.st_size);
+                        }
+                        else {
+                            fits_mapping* mapping = new fits_mapping;
+                            mapping->addr   = (const unsigned char*)addr;
+                            mapping->length = info.st_size;
+                            mapping->files  = 1;
+                            mapping->users  = 0;
+                            fits_files[FPTR(vptr)->Fptr] = mapping;
+                            fits_mappings.push_back(mapping);
+                        }
+                        } // end of critical zone
+                        mapped = true;
+                    }
+                    else {
+                        ::munmap(addr, info.st_size);
+                    }
+                }
+
+            } // endif: file length was determined
+
+            // Close file (the mapping remains valid)
+            ::close(fd);
+
+        } // endif: file was opened
+
+    } // endif: FITS file was open
+    #endif
+
+    // Return
+    return mapped;
+}
+
+
+/***********************************************************************//**
+ * @brief Detach memory mapping from FITS file
+ *
+ * @param[in] vptr FITS file pointer.
+ *
+ * Detaches the memory mapping from a FITS file. Once the last attachment
+ * of the file has been detached, the mapping can no longer be found from
+ * the file, and it is removed as soon as no data use it anymore. The
+ * method does nothing if no mapping was attached.
+ ***************************************************************************/
+void gammalib::fits_mmap_detach(void* vptr)
+{
+    // Continue only if FITS file is open
+    if (vptr != NULL && FPTR(vptr)->Fptr != NULL) {
+
+        #pragma omp critical(GFitsMmap)
+        {
+        std::map<const void*, fits_mapping*>::iterator it =
+                                        fits_files.find(FPTR(vptr)->Fptr);
+        if (it != fits_files.end()) {
+            fits_mapping* mapping = it->second;
+            if (--(mapping->files) == 0) {
+                fits_files.erase(it);
+                fits_mmap_free(mapping);
+            }
+        }
+        } // end of critical zone
+
+    } // endif: FITS file was open
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Signals if memory mapping is attached to FITS file
+ *
+ * @param[in] vptr FITS file pointer.
+ * @return True if a memory mapping is attached to the FITS file.
+ ***************************************************************************/
+bool gammalib::fits_mmap_isattached(void* vptr)
+{
+    // Initialise result
+    bool attached = false;
+
+    // Search mapping
+    if (vptr != NULL && FPTR(vptr)->Fptr != NULL) {
+        #pragma omp critical(GFitsMmap)
+        attached = (fits_files.find(FPTR(vptr)->Fptr) != fits_files.end());
+    }
+
+    // Return result
+    return attached;
+}
+
+
+/***********************************************************************//**
+ * @brief Acquire data in memory mapped FITS file
+ *
+ * @param[in] vptr FITS file pointer.
+ * @param[in] offset Byte offset of data in file.
+ * @param[in] nbytes Number of data bytes.
+ * @return Pointer to data in mapping (NULL if data are not mapped).
+ *
+ * Returns a pointer to the data in the memory mapping of the FITS file
+ * and keeps the mapping valid until the data are released using
+ * fits_mmap_release(). NULL is returned if the FITS file has no memory
+ * mapping attached or if the data are not within the mapping.
+ ***************************************************************************/
+const unsigned char* gammalib::fits_mmap_acquire(void*            vptr,
+                                                 const long long& offset,
+                                                 const long long& nbytes)
+{
+    // Initialise result
+    const unsigned char* data = NULL;
+
+    // Continue only if FITS file is open and data range is valid
+    if (vptr != NULL && FPTR(vptr)->Fptr != NULL && offset >= 0 &&
+        nbytes >= 0) {
+
+        #pragma omp critical(GFitsMmap)
+        {
+        std::map<const void*, fits_mapping*>::iterator it =
+                                        fits_files.find(FPTR(vptr)->Fptr);
+        if (it != fits_files.end() && offset + nbytes <= it->second->length) {
+            it->second->users++;
+            data = it->second->addr + offset;
+        }
+        } // end of critical zone
+
+    } // endif: FITS file was open and data range was valid
+
+    // Return data
+    return data;
+}
+
+
+/***********************************************************************//**
+ * @brief Acquire data in memory mapping again
+ *
+ * @param[in] data Pointer to data in mapping.
+ *
+ * Acquires data that have already been acquired, for example by the copy
+ * of an object. The data need to be released by an additional call to
+ * fits_mmap_release().
+ ***************************************************************************/
+void gammalib::fits_mmap_acquire(const unsigned char* data)
+{
+    // Continue only if data are valid
+    if (data != NULL) {
+        #pragma omp critical(GFitsMmap)
+        {
+        fits_mapping* mapping = fits_mmap_find(data);
+        if (mapping != NULL) {
+            mapping->users++;
+        }
+        } // end of critical zone
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Release data in memory mapping
+ *
+ * @param[in] data Pointer to data in mapping.
+ *
+ * Releases data that were acquired using fits_mmap_acquire(). The mapping
+ * is removed once it is neither attached to a FITS file nor used by any
+ * data.
+ ***************************************************************************/
+void gammalib::fits_mmap_release(const unsigned char* data)
+{
+    // Continue only if data are valid
+    if (data != NULL) {
+        #pragma omp critical(GFitsMmap)
+        {
+        fits_mapping* mapping = fits_mmap_find(data);
+        if (mapping != NULL && mapping->users > 0) {
+            mapping->users--;
+            fits_mmap_free(mapping);
+        }
+        } // end of critical zone
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy data from memory mapping
+ *
+ * @param[in] src Pointer to first element in mapping.
+ * @param[in] elsize Size of an element (bytes).
+ * @param[in] count Number of contiguous elements per block.
+ * @param[in] nblocks Number of blocks.
+ * @param[in] stride Byte distance between the start of two blocks.
+ * @param[out] dst Destination array receiving count*nblocks elements.
+ *
+ * Copies @p nblocks blocks of @p count contiguous big-endian elements from
+ * the memory mapping into @p dst, converting the elements into the byte
+ * order of the host.
+ ***************************************************************************/
+void gammalib::fits_mmap_copy(const unsigned char* src,
+                              const int&           elsize,
+                              const long long&     count,
+                              const long long&     nblocks,
+                              const long long&     stride,
+                              void*                dst)
+{
+    // Determine whether the host is little-endian
+    const unsigned short probe = 1;
+    bool                 swap  = (*((const unsigned char*)&probe) == 1);
+
+    // Copy blocks
+    long long      nbytes = count * elsize;
+    unsigned char* out    = (unsigned char*)dst;
+    for (long long block = 0; block < nblocks; ++block) {
+        const unsigned char* in = src + block*stride;
+        if (!swap || elsize == 1) {
+            std::memcpy(out, in, nbytes);
+            out += nbytes;
+        }
+        else {
+            for (long long i = 0; i < count; ++i, in += elsize) {
+                for (int k = elsize-1; k >= 0; --k) {
+                    *out++ = in[k];
+                }
+            }
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return integer value from memory mapping
+ *
+ * @param[in] src Pointer to value in mapping.
+ * @param[in] elsize Size of value (1, 2, 4 or 8 bytes).
+ * @return Integer value.
+ *
+ * Returns the big-endian integer value at @p src. Following the FITS
+ * standard, single byte values are unsigned while all other values are
+ * signed two's complement integers.
+ ***************************************************************************/
+long long gammalib::fits_mmap_integer(const unsigned char* src,
+                                      const int&           elsize)
+{
+    // Initialise value
+    long long value = 0;
+
+    // Get value
+    switch (elsize) {
+    case 1:
+        value = src[0];
+        break;
+    case 2:
+        value = (short)((src[0] << 8) | src[1]);
+        break;
+    case 4:
+        value = (int)(((unsigned int)src[0] << 24) |
+                      ((unsigned int)src[1] << 16) |
+                      ((unsigned int)src[2] <<  8) |
+                       (unsigned int)src[3]);
+        break;
+    case 8:
+        {
+        unsigned long long bits = 0;
+        for (int k = 0; k < 8; ++k) {
+            bits = (bits << 8) | src[k];
+        }
+        value = (long long)bits;
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Return value
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Return floating point value from memory mapping
+ *
+ * @param[in] src Pointer to value in mapping.
+ * @param[in] elsize Size of value (4 or 8 bytes).
+ * @return Floating point value.
+ *
+ * Returns the big-endian IEEE single (@p elsize=4) or double (@p elsize=8)
+ * precision value at @p src.
+ ***************************************************************************/
+double gammalib::fits_mmap_real(const unsigned char* src, const int& elsize)
+{
+    // Initialise value
+    double value = 0.0;
+
+    // Get value
+    if (elsize == 4) {
+        float real;
+        fits_mmap_copy(src, 4, 1, 1, 0, &real);
+        value = real;
+    }
+    else if (elsize == 8) {
+        fits_mmap_copy(src, 8, 1, 1, 0, &value);
+    }
+
+    // Return value
+    return value;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Local functions                             =
+ =                                                                         =
+ ==========================================================================*/
+
+namespace {
+
+/***********************************************************************//**
+ * @brief Return mapping that holds data
+ *
+ * @param[in] data Pointer to data in mapping.
+ * @return Mapping (NULL if data are not in any mapping).
+ *
+ * Must be called within the GFitsMmap critical zone.
+ ***************************************************************************/
+fits_mapping* fits_mmap_find(const unsigned char* data)
+{
+    // Initialise result
+    fits_mapping* result = NULL;
+
+    // Search mapping
+    for (std::vector<fits_mapping*>::iterator it = fits_mappings.begin();
+         it != fits_mappings.end(); ++it) {
+        if (data >= (*it)->addr && data < (*it)->addr + (*it)->length) {
+            result = *it;
+            break;
+        }
+    }
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Free mapping if it is no longer used
+ *
+ * @param[in] mapping Mapping.
+ *
+ * Unmaps and deletes the mapping if it is neither attached to a FITS file
+ * nor used by any data. Must be called within the GFitsMmap critical zone.
+ ***************************************************************************/
+void fits_mmap_free(fits_mapping* mapping)
+{
+    // Free mapping if it is no longer used
+    if (mapping->files == 0 && mapping->users == 0) {
+        for (std::vector<fits_mapping*>::iterator it = fits_mappings.begin();
+             it != fits_mappings.end(); ++it) {
+            if (*it == mapping) {
+                fits_mappings.erase(it);
+                break;
+            }
+        }
+        #if defined(G_USE_MMAP)
+        ::munmap((void*)mapping->addr, mapping->length);
+        #endif
+        delete mapping;
+    }
+
+    // Return
+    return;
+}
+
+} // end of anonymous namespace
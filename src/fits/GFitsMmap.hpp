@@ -0,0 +1,71 @@
+/***************************************************************************
+ *          GFitsMmap.hpp - Memory mapped access to FITS files             *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GFitsMmap.hpp
+ * @brief Memory mapped access to FITS files
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GFITSMMAP_HPP
+#define GFITSMMAP_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <string>
+
+
+/***********************************************************************//**
+ * @brief Memory mapped access to FITS files
+ *
+ * These functions maintain read-only memory mappings of uncompressed FITS
+ * files. A mapping is attached to an open cfitsio file and is shared by
+ * all HDUs and table columns of that file. As cfitsio shares its file
+ * structure between all openings of the same file, a mapping counts the
+ * FITS files that attached it and is only removed when the last of them
+ * detaches it. Data may in addition acquire a mapping, which keeps it
+ * valid until they release it, also after the FITS file was closed.
+ *
+ * Data are read from the mapping with conversion from the big-endian FITS
+ * byte order, hence the file is only paged in for the parts that are
+ * actually read and the pages are shared with all other processes mapping
+ * the same file.
+ ***************************************************************************/
+namespace gammalib {
+    bool                 fits_mmap_attach(void* vptr,
+                                          const std::string& filename);
+    void                 fits_mmap_detach(void* vptr);
+    bool                 fits_mmap_isattached(void* vptr);
+    const unsigned char* fits_mmap_acquire(void* vptr,
+                                           const long long& offset,
+                                           const long long& nbytes);
+    void                 fits_mmap_acquire(const unsigned char* data);
+    void                 fits_mmap_release(const unsigned char* data);
+    void                 fits_mmap_copy(const unsigned char* src,
+                                        const int& elsize,
+                                        const long long& count,
+                                        const long long& nblocks,
+                                        const long long& stride, void* dst);
+    long long            fits_mmap_integer(const unsigned char* src,
+                                           const int& elsize);
+    double               fits_mmap_real(const unsigned char* src,
+                                        const int& elsize);
+}
+
+#endif /* GFITSMMAP_HPP */
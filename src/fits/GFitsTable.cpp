@@ -528,6 +528,46 @@ int GFitsTable::nrows(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return optimal number of rows for chunked reading
+ *
+ * @return Optimal number of rows.
+ *
+ * Returns the number of rows that should be read at once from the FITS
+ * file when streaming through the table using GFitsTableCol::read_rows().
+ * The number is determined by cfitsio so that the rows fit into its
+ * internal buffers. If the table is not attached to a FITS file, the
+ * number of rows in the table is returned.
+ ***************************************************************************/
+int GFitsTable::optimal_rows(void) const
+{
+    // Initialise optimal number of rows
+    long nrows = 0;
+
+    // Get optimal number of rows from FITS file
+    if (FPTR(m_fitsfile)->Fptr != NULL) {
+        int status = 0;
+        status     = __ffmahd(FPTR(m_fitsfile),
+                              (FPTR(m_fitsfile)->HDUposition)+1,
+                              NULL, &status);
+        if (status == 0) {
+            status = __ffgrsz(FPTR(m_fitsfile), &nrows, &status);
+        }
+        if (status != 0) {
+            nrows = 0;
+        }
+    }
+
+    // Fall back to the default number of rows
+    if (nrows < 1) {
+        nrows = (m_rows > 0) ? m_rows : 1;
+    }
+
+    // Return number of rows
+    return int(nrows);
+}
+
+
 /***********************************************************************//**
  * @brief Return number of columns in table
  ***************************************************************************/
@@ -679,6 +719,8 @@ void GFitsTable::data_open(void* vptr)
     int  typecode = 0;
     long repeat   = 0;
     long width    = 0;
+    int  tbcol    = 0;
+    bool tbvalid  = (m_type == 2);
     for (int i = 0; i < m_cols; ++i) {
 
         // Get column name
@@ -803,8 +845,69 @@ void GFitsTable::data_open(void* vptr)
                 
         } // endif: Valid TDIM information was found
 
+        // Determine the byte offset of the column in a binary table row.
+        // The offset is only used for columns that need no scaling and have
+        // no undefined value; it is needed for reading the column from a
+        // memory mapped FITS file.
+        int nbytes = 0;
+        switch (typecode) {
+        case __TBIT:
+            nbytes = (repeat + 7) / 8;
+            break;
+        case __TSTRING:
+        case __TLOGICAL:
+        case __TBYTE:
+        case __TSBYTE:
+            nbytes = repeat;
+            break;
+        case __TUSHORT:
+        case __TSHORT:
+            nbytes = 2 * repeat;
+            break;
+        case __TUINT:
+        case __TINT:
+        case __TULONG:
+        case __TLONG:
+        case __TFLOAT:
+            nbytes = 4 * repeat;
+            break;
+        case __TLONGLONG:
+        case __TDOUBLE:
+        case __TCOMPLEX:
+            nbytes = 8 * repeat;
+            break;
+        case __TDBLCOMPLEX:
+            nbytes = 16 * repeat;
+            break;
+        default:
+            tbvalid = false;
+            break;
+        }
+        sprintf(keyname, "TSCAL%d", i+1);
+        bool scaled = m_header.hascard(keyname);
+        sprintf(keyname, "TZERO%d", i+1);
+        scaled      = scaled || m_header.hascard(keyname);
+        sprintf(keyname, "TNULL%d", i+1);
+        scaled      = scaled || m_header.hascard(keyname);
+        m_columns[i]->m_tbcol = (scaled) ? -1 : tbcol;
+        tbcol                += nbytes;
+
     } // endfor: looped over all columns
 
+    // Set the row length of the columns if the byte offsets are valid,
+    // otherwise invalidate the byte offsets
+    tbvalid = (tbvalid && m_header.hascard("NAXIS1") &&
+               m_header.integer("NAXIS1") == tbcol);
+    for (int i = 0; i < m_cols; ++i) {
+        if (tbvalid) {
+            m_columns[i]->m_rowlen = tbcol;
+        }
+        else {
+            m_columns[i]->m_tbcol  = -1;
+            m_columns[i]->m_rowlen = 0;
+        }
+    }
+
     // Return
     return;
 }
@@ -28,8 +28,11 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <vector>
+#include <cstring>
 #include "GException.hpp"
 #include "GFitsCfitsio.hpp"
+#include "GFitsMmap.hpp"
 #include "GFitsTableCol.hpp"
 #include "GTools.hpp"
 
@@ -37,6 +40,10 @@
 #define G_LOAD_COLUMN                          "GFitsTableCol::load_column()"
 #define G_SAVE_COLUMN                          "GFitsTableCol::save_column()"
 #define G_OFFSET                           "GFitsTableCol::offset(int&,int&)"
+#define G_READ_ROWS_DBL  "GFitsTableCol::read_rows(long long&, long long&,"\
+                                                                   " double*)"
+#define G_READ_ROWS_LL   "GFitsTableCol::read_rows(long long&, long long&,"\
+                                                                " long long*)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -407,12 +414,185 @@ std::string GFitsTableCol::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Read a range of column rows
+ *
+ * @param[in] row First row to read (starting from 0).
+ * @param[in] nrows Number of rows to read.
+ * @param[out] values Array receiving nrows*number() values.
+ *
+ * @exception GException::invalid_argument
+ *            Row range outside the column.
+ * @exception GException::fits_hdu_not_found
+ *            Specified HDU not found in FITS file.
+ * @exception GException::fits_error
+ *            An error occured while reading the rows from the FITS file.
+ *
+ * Reads @p nrows rows starting from @p row into the @p values array,
+ * converting all elements into double precision values. Vector columns
+ * are stored row by row.
+ *
+ * If the column data are already in memory they are copied from memory.
+ * Otherwise the rows are read directly from the FITS file, without loading
+ * the column into memory. This allows to stream through columns that do
+ * not fit into memory, reading a window of rows at a time. The number of
+ * rows that should be read at once is given by GFitsTable::optimal_rows().
+ * Row numbers are 64 bit, hence columns with more than 2^31 rows can be
+ * read.
+ *
+ * If the column is neither in memory nor attached to a FITS file all
+ * values are set to 0.
+ ***************************************************************************/
+void GFitsTableCol::read_rows(const long long& row, const long long& nrows,
+                              double* values) const
+{
+    // Read values from FITS file if the column is not in memory
+    if (!read_rows_file(G_READ_ROWS_DBL, row, nrows, __TDOUBLE, values)) {
+
+        // Get pointer to column data (non-NULL if data are in memory)
+        GFitsTableCol* ptr = const_cast<GFitsTableCol*>(this);
+
+        // Case A: Copy values from memory
+        if (ptr->ptr_data() != NULL) {
+            double* dst = values;
+            for (int i = int(row); i < int(row+nrows); ++i) {
+                for (int k = 0; k < m_number; ++k) {
+                    *dst++ = real(i, k);
+                }
+            }
+        }
+
+        // Case B: Neither memory nor FITS file
+        else {
+            long long nvalues = nrows * m_number;
+            for (long long i = 0; i < nvalues; ++i) {
+                values[i] = 0.0;
+            }
+        }
+
+    } // endif: values were not read from FITS file
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read a range of column rows as integers
+ *
+ * @param[in] row First row to read (starting from 0).
+ * @param[in] nrows Number of rows to read.
+ * @param[out] values Array receiving nrows*number() values.
+ *
+ * @exception GException::invalid_argument
+ *            Row range outside the column.
+ * @exception GException::fits_hdu_not_found
+ *            Specified HDU not found in FITS file.
+ * @exception GException::fits_error
+ *            An error occured while reading the rows from the FITS file.
+ *
+ * Reads @p nrows rows starting from @p row into the @p values array,
+ * converting all elements into 64 bit integer values. This method should
+ * be used for integer columns, such as identifiers, that can not be
+ * represented exactly in double precision. See
+ * read_rows(const long long&, const long long&, double*) for details.
+ ***************************************************************************/
+void GFitsTableCol::read_rows(const long long& row, const long long& nrows,
+                              long long* values) const
+{
+    // Read values from FITS file if the column is not in memory
+    if (!read_rows_file(G_READ_ROWS_LL, row, nrows, __TLONGLONG, values)) {
+
+        // Get pointer to column data (non-NULL if data are in memory)
+        GFitsTableCol* ptr = const_cast<GFitsTableCol*>(this);
+
+        // Case A: Copy values from memory
+        if (ptr->ptr_data() != NULL) {
+            long long* dst = values;
+            for (int i = int(row); i < int(row+nrows); ++i) {
+                for (int k = 0; k < m_number; ++k) {
+                    *dst++ = integer(i, k);
+                }
+            }
+        }
+
+        // Case B: Neither memory nor FITS file
+        else {
+            long long nvalues = nrows * m_number;
+            for (long long i = 0; i < nvalues; ++i) {
+                values[i] = 0;
+            }
+        }
+
+    } // endif: values were not read from FITS file
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Protected methods                            =
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Load table column from memory mapped FITS file
+ *
+ * @return True if the column data were loaded.
+ *
+ * Loads the column data from the memory mapping of the FITS file. This is
+ * only done for numerical columns that have the same representation in
+ * memory and in the FITS file, that need no scaling and for which no nul
+ * value is requested. Otherwise, or if the FITS file is not memory mapped,
+ * false is returned and the column needs to be loaded through cfitsio. The
+ * method assumes that the FITS file pointer has been moved to the HDU and
+ * that the column data have been allocated.
+ ***************************************************************************/
+bool GFitsTableCol::load_column_mmap(void)
+{
+    // Determine element size for types that have the same representation
+    // in memory and in the FITS file
+    int elsize = 0;
+    if      (m_type == __TBYTE     && m_width == 1) elsize = 1;
+    else if (m_type == __TSHORT    && m_width == 2) elsize = 2;
+    else if (m_type == __TLONGLONG && m_width == 8) elsize = 8;
+    else if (m_type == __TFLOAT    && m_width == 4) elsize = 4;
+    else if (m_type == __TDOUBLE   && m_width == 8) elsize = 8;
+
+    // Continue only if column can be memory mapped
+    bool loaded = false;
+    if (elsize > 0 && m_tbcol >= 0 && m_rowlen > 0 && ptr_nulval() == NULL) {
+
+        // Get start of data in FITS file
+        long long datastart = 0;
+        int       status    = 0;
+        status = __ffghadll(FPTR(m_fitsfile), NULL, &datastart, NULL, &status);
+
+        // Load column from memory mapping
+        if (status == 0 && datastart > 0 && m_length > 0) {
+            long long            nbytes = (long long)(m_length-1) * m_rowlen +
+                                          (long long)m_number * elsize;
+            const unsigned char* data   =
+                gammalib::fits_mmap_acquire(m_fitsfile, datastart+m_tbcol,
+                                            nbytes);
+            if (data != NULL) {
+                gammalib::fits_mmap_copy(data, elsize, m_number, m_length,
+                                         m_rowlen, ptr_data());
+                gammalib::fits_mmap_release(data);
+                m_anynul = 0;
+                loaded   = true;
+            }
+        }
+
+    } // endif: column could be memory mapped
+
+    // Return
+    return loaded;
+}
+
+
 /***********************************************************************//**
  * @brief Save table column into FITS file
  *
@@ -508,12 +688,16 @@ void GFitsTableCol::load_column(void)
                                   status);
                 }
 
-                // Load data
-                status = __ffgcv(FPTR(m_fitsfile), m_type, m_colnum, 1, 1, m_size,
-                                 ptr_nulval(), ptr_data(), &m_anynul, &status);
-                if (status != 0) {
-                    throw GException::fits_error(G_LOAD_COLUMN, status,
-                                      "for column \""+m_name+"\".");
+                // Load data from memory mapping or, if this is not
+                // possible, through cfitsio
+                if (!load_column_mmap()) {
+                    status = __ffgcv(FPTR(m_fitsfile), m_type, m_colnum, 1, 1,
+                                     m_size, ptr_nulval(), ptr_data(),
+                                     &m_anynul, &status);
+                    if (status != 0) {
+                        throw GException::fits_error(G_LOAD_COLUMN, status,
+                                          "for column \""+m_name+"\".");
+                    }
                 }
         
             } // endif: no primary HDU found
@@ -638,6 +822,8 @@ void GFitsTableCol::init_members(void)
     m_number = 0;
     m_length = 0;
     m_size   = 0;
+    m_tbcol  = -1;
+    m_rowlen = 0;
     m_anynul = 0;
 
     // Return
@@ -663,6 +849,8 @@ void GFitsTableCol::copy_members(const GFitsTableCol& column)
     m_number   = column.m_number;
     m_length   = column.m_length;
     m_size     = column.m_size;
+    m_tbcol    = column.m_tbcol;
+    m_rowlen   = column.m_rowlen;
     m_anynul   = column.m_anynul;
     FPTR_COPY(m_fitsfile, column.m_fitsfile);
 
@@ -691,12 +879,191 @@ void GFitsTableCol::free_members(void)
  * @brief Connect table column to FITS file
  *
  * @param[in] vptr Column file void pointer.
+ *
+ * Connecting the column invalidates the byte offset of the column in the
+ * table row, which is set by GFitsTable::data_open() for opened files.
  ***************************************************************************/
 void GFitsTableCol::connect(void* vptr)
 {
     // Connect table column by copying the column file pointer
     FPTR_COPY(m_fitsfile, vptr);
 
+    // Invalidate byte offset of column in table row
+    m_tbcol  = -1;
+    m_rowlen = 0;
+
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Read a range of column rows from FITS file
+ *
+ * @param[in] method Name of calling method.
+ * @param[in] row First row to read (starting from 0).
+ * @param[in] nrows Number of rows to read.
+ * @param[in] type cfitsio data type of @p values.
+ * @param[out] values Array receiving nrows*number() values.
+ * @return True if values were read from the FITS file.
+ *
+ * @exception GException::invalid_argument
+ *            Row range outside the column.
+ * @exception GException::fits_hdu_not_found
+ *            Specified HDU not found in FITS file.
+ * @exception GException::fits_error
+ *            An error occured while reading the rows from the FITS file.
+ *
+ * Checks the row range and reads the rows from the FITS file if the column
+ * data are not in memory and the column is attached to a FITS file.
+ * Otherwise nothing is read and false is returned.
+ ***************************************************************************/
+bool GFitsTableCol::read_rows_file(const std::string& method,
+                                   const long long&   row,
+                                   const long long&   nrows,
+                                   const int&         type,
+                                   void*              values) const
+{
+    // Get pointer to column data (non-NULL if data are in memory)
+    GFitsTableCol* ptr    = const_cast<GFitsTableCol*>(this);
+    bool           memory = (ptr->ptr_data() != NULL);
+    bool           file   = (!memory && FPTR(m_fitsfile)->Fptr != NULL &&
+                             m_colnum > 0);
+
+    // Determine the number of rows in the column
+    long long length = m_length;
+    if (file) {
+        int status = 0;
+        status     = __ffmahd(FPTR(m_fitsfile),
+                              (FPTR(m_fitsfile)->HDUposition)+1,
+                              NULL, &status);
+        if (status == 0) {
+            status = __ffgnrwll(FPTR(m_fitsfile), &length, &status);
+        }
+        if (status != 0 || length < m_length) {
+            length = m_length;
+        }
+    }
+
+    // Check row range
+    if (row < 0 || nrows < 0 || row+nrows > length) {
+        std::string msg = "Row range ["+gammalib::str(double(row))+","+
+                          gammalib::str(double(row+nrows))+"[ outside "
+                          "column range [0,"+gammalib::str(double(length))+
+                          "[.";
+        throw GException::invalid_argument(method, msg);
+    }
+
+    // Read values from FITS file if there is something to read
+    long long nvalues = nrows * m_number;
+    if (file && nvalues > 0) {
+
+        // Move to the HDU
+        int status = 0;
+        status     = __ffmahd(FPTR(m_fitsfile),
+                              (FPTR(m_fitsfile)->HDUposition)+1,
+                              NULL, &status);
+        if (status != 0) {
+            throw GException::fits_hdu_not_found(method,
+                              (FPTR(m_fitsfile)->HDUposition)+1,
+                              status);
+        }
+
+        // Read values from memory mapping or, if this is not possible,
+        // through cfitsio. No nul value is given, hence cfitsio does not
+        // check for undefined values.
+        if (!read_rows_mmap(row, nrows, type, values)) {
+            status = __ffgcv(FPTR(m_fitsfile), type, m_colnum, row+1, 1,
+                             nvalues, NULL, values, NULL, &status);
+            if (status != 0) {
+                throw GException::fits_error(method, status,
+                                  "for column \""+m_name+"\".");
+            }
+        }
+
+    } // endif: values were read from FITS file
+
+    // Return
+    return file;
+}
+
+
+/***********************************************************************//**
+ * @brief Read a range of column rows from memory mapped FITS file
+ *
+ * @param[in] row First row to read (starting from 0).
+ * @param[in] nrows Number of rows to read.
+ * @param[in] type cfitsio data type of @p values (__TDOUBLE or __TLONGLONG).
+ * @param[out] values Array receiving nrows*number() values.
+ * @return True if the values were read.
+ *
+ * Reads the requested rows of a numerical column from the memory mapping
+ * of the FITS file, converting the values into the requested type. Only
+ * the requested rows are accessed, hence only the corresponding pages of
+ * the file are read and the column is never copied as a whole. If the
+ * FITS file is not memory mapped, or if the column needs scaling or may
+ * hold undefined values, false is returned and the rows need to be read
+ * through cfitsio. The method assumes that the FITS file pointer has been
+ * moved to the HDU.
+ ***************************************************************************/
+bool GFitsTableCol::read_rows_mmap(const long long& row,
+                                   const long long& nrows,
+                                   const int&       type,
+                                   void*            values) const
+{
+    // Determine element size of numerical column
+    int elsize = 0;
+    if      (m_type == __TBYTE     && m_width == 1) elsize = 1;
+    else if (m_type == __TSHORT    && m_width == 2) elsize = 2;
+    else if (m_type == __TLONG     && m_width == 4) elsize = 4;
+    else if (m_type == __TLONGLONG && m_width == 8) elsize = 8;
+    else if (m_type == __TFLOAT    && m_width == 4) elsize = 4;
+    else if (m_type == __TDOUBLE   && m_width == 8) elsize = 8;
+
+    // Continue only if rows can be read from memory mapping
+    bool loaded = false;
+    if (elsize > 0 && m_tbcol >= 0 && m_rowlen > 0 &&
+        (type == __TDOUBLE || type == __TLONGLONG)) {
+
+        // Get start of data in FITS file
+        long long datastart = 0;
+        int       status    = 0;
+        status = __ffghadll(FPTR(m_fitsfile), NULL, &datastart, NULL, &status);
+
+        // Acquire rows in memory mapping
+        const unsigned char* data = NULL;
+        if (status == 0 && datastart > 0 && nrows > 0) {
+            long long nbytes = (nrows-1) * m_rowlen + (long long)m_number * elsize;
+            data = gammalib::fits_mmap_acquire(m_fitsfile,
+                                               datastart + row*m_rowlen + m_tbcol,
+                                               nbytes);
+        }
+
+        // Convert values from the mapping into the requested type
+        if (data != NULL) {
+            bool      isreal = (m_type == __TFLOAT || m_type == __TDOUBLE);
+            long long i      = 0;
+            for (long long irow = 0; irow < nrows; ++irow) {
+                const unsigned char* ptr = data + irow*m_rowlen;
+                for (int k = 0; k < m_number; ++k, ++i, ptr += elsize) {
+                    if (type == __TDOUBLE) {
+                        ((double*)values)[i] = (isreal)
+                            ? gammalib::fits_mmap_real(ptr, elsize)
+                            : double(gammalib::fits_mmap_integer(ptr, elsize));
+                    }
+                    else {
+                        ((long long*)values)[i] = (isreal)
+                            ? (long long)gammalib::fits_mmap_real(ptr, elsize)
+                            : gammalib::fits_mmap_integer(ptr, elsize);
+                    }
+                }
+            }
+            gammalib::fits_mmap_release(data);
+            loaded = true;
+        }
+
+    } // endif: rows could be read from memory mapping
+
+    // Return
+    return loaded;
+}
@@ -34,6 +34,7 @@
 #include "GMath.hpp"
 #include "GVector.hpp"
 #include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 #include "GMatrixSparse.hpp"
 #include "GMatrixSymmetric.hpp"
 
@@ -42,6 +43,7 @@
 #define G_OP_MUL_VEC                           "GMatrix::operator*(GVector&)"
 #define G_OP_ADD                              "GMatrix::operator+=(GMatrix&)"
 #define G_OP_SUB                              "GMatrix::operator-=(GMatrix&)"
+#define G_OP_MUL                               "GMatrix::operator*(GMatrix&)"
 #define G_OP_MAT_MUL                          "GMatrix::operator*=(GMatrix&)"
 #define G_AT                                        "GMatrix::at(int&, int&)"
 #define G_EXTRACT_ROW                                    "GMatrix::row(int&)"
@@ -55,6 +57,12 @@
 #define G_EXTRACT_LOWER                   "GMatrix::extract_lower_triangle()"
 #define G_EXTRACT_UPPER                   "GMatrix::extract_upper_triangle()"
 
+/* __ Coding definitions _________________________________________________ */
+#define G_GEMM_BLOCK_ROWS     128   //!< Row block size of matrix product
+#define G_GEMM_BLOCK_INNER    128   //!< Inner block size of matrix product
+#define G_GEMM_BLOCK_COLS      32   //!< Column block size of matrix product
+#define G_GEMM_OMP_MIN     100000   //!< Min. operations for parallel product
+
 
 /*==========================================================================
  =                                                                         =
@@ -393,6 +401,38 @@ GMatrix& GMatrix::operator-=(const GMatrix& matrix)
 }
 
 
+/***********************************************************************//**
+ * @brief Binary matrix multiplication operator
+ *
+ * @param[in] matrix Matrix.
+ * @return Result of matrix multiplication.
+ *
+ * @exception GException::matrix_mismatch
+ *            Incompatible matrix size.
+ *
+ * Returns the product of two matrices. The operation can only succeed when
+ * the dimensions of both matrices are compatible.
+ ***************************************************************************/
+GMatrix GMatrix::operator*(const GMatrix& matrix) const
+{
+    // Raise an exception if the matrix dimensions are not compatible
+    if (m_cols != matrix.m_rows) {
+        throw GException::matrix_mismatch(G_OP_MUL,
+                                          m_rows, m_cols,
+                                          matrix.m_rows, matrix.m_cols);
+    }
+
+    // Allocate result matrix
+    GMatrix result(m_rows, matrix.m_cols);
+
+    // Compute product
+    result.multiply(*this, matrix);
+
+    // Return result
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Unary matrix multiplication operator
  *
@@ -404,10 +444,8 @@ GMatrix& GMatrix::operator-=(const GMatrix& matrix)
  * This method performs a matrix multiplication. The operation can only
  * succeed when the dimensions of both matrices are compatible.
  *
- * In case of rectangular matrices the result matrix does not change and
- * the operation is performed inplace. For the general case the result
- * matrix changes in size and for simplicity a new matrix is allocated to
- * hold the result.
+ * The product is computed into a newly allocated matrix which is then
+ * assigned to the actual matrix.
  ***************************************************************************/
 GMatrix& GMatrix::operator*=(const GMatrix& matrix)
 {
@@ -418,41 +456,14 @@ GMatrix& GMatrix::operator*=(const GMatrix& matrix)
                                           matrix.m_rows, matrix.m_cols);
     }
 
-    // Case A: Matrices are rectangular, so perform 'inplace' multiplication
-    if (m_rows == m_cols) {
-        for (int row = 0; row < m_rows; ++row) {
-            GVector v_row = this->row(row);
-            for (int col = 0; col < m_cols; ++col) {
-                double sum = 0.0;
-                for (int i = 0; i < m_cols; ++i) {
-                    sum += v_row[i] * matrix(i,col);
-                }
-                (*this)(row,col) = sum;
-            }
-        }
-    }
-
-    // Case B: Matrices are not rectangular, so we cannot work inplace
-    else {
-
-        // Allocate result matrix
-        GMatrix result(m_rows, matrix.m_cols);
-
-        // Loop over all elements of result matrix
-        for (int row = 0; row < m_rows; ++row) {
-            for (int col = 0; col < matrix.m_cols; ++col) {
-                double sum = 0.0;
-                for (int i = 0; i < m_cols; ++i) {
-                    sum += (*this)(row,i) * matrix(i,col);
-                }
-                result(row,col) = sum;
-            }
-        }
+    // Allocate result matrix
+    GMatrix result(m_rows, matrix.m_cols);
 
-        // Assign result
-        *this = result;
+    // Compute product
+    result.multiply(*this, matrix);
 
-    } // endelse: matrices were not rectangular
+    // Assign result
+    *this = result;
 
     // Return result
     return *this;
@@ -1024,21 +1035,14 @@ void GMatrix::eulerx(const double& angle)
     // Construct 3*3 matrix
     alloc_members(3,3);
 
-    // Compute angles
-    double arg      = angle * gammalib::deg2rad;
-    double cosangle = std::cos(arg);
-    double sinangle = std::sin(arg);
-
-    // Set matrix elements
-    (*this)(0,0) =       1.0;
-    (*this)(0,1) =       0.0;
-    (*this)(0,2) =       0.0;
-    (*this)(1,0) =       0.0;
-    (*this)(1,1) =  cosangle;
-    (*this)(1,2) = -sinangle;
-    (*this)(2,0) =       0.0;
-    (*this)(2,1) =  sinangle;
-    (*this)(2,2) =  cosangle;
+    // Set Euler rotation matrix elements
+    GMatrix3 rot;
+    rot.eulerx(angle);
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            (*this)(row,col) = rot(row,col);
+        }
+    }
 
     // Return
     return;
@@ -1061,21 +1065,14 @@ void GMatrix::eulery(const double& angle)
     // Construct 3*3 matrix
     alloc_members(3,3);
 
-    // Compute angles
-    double arg      = angle * gammalib::deg2rad;
-    double cosangle = std::cos(arg);
-    double sinangle = std::sin(arg);
-
-    // Set matrix elements
-    (*this)(0,0) =  cosangle;
-    (*this)(0,1) =       0.0;
-    (*this)(0,2) =  sinangle;
-    (*this)(1,0) =       0.0;
-    (*this)(1,1) =       1.0;
-    (*this)(1,2) =       0.0;
-    (*this)(2,0) = -sinangle;
-    (*this)(2,1) =       0.0;
-    (*this)(2,2) =  cosangle;
+    // Set Euler rotation matrix elements
+    GMatrix3 rot;
+    rot.eulery(angle);
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            (*this)(row,col) = rot(row,col);
+        }
+    }
 
     // Return
     return;
@@ -1098,21 +1095,14 @@ void GMatrix::eulerz(const double& angle)
     // Construct 3*3 matrix
     alloc_members(3,3);
 
-    // Compute angles
-    double arg      = angle * gammalib::deg2rad;
-    double cosangle = std::cos(arg);
-    double sinangle = std::sin(arg);
-
-    // Set matrix elements
-    (*this)(0,0) =  cosangle;
-    (*this)(0,1) = -sinangle;
-    (*this)(0,2) =       0.0;
-    (*this)(1,0) =  sinangle;
-    (*this)(1,1) =  cosangle;
-    (*this)(1,2) =       0.0;
-    (*this)(2,0) =       0.0;
-    (*this)(2,1) =       0.0;
-    (*this)(2,2) =       1.0;
+    // Set Euler rotation matrix elements
+    GMatrix3 rot;
+    rot.eulerz(angle);
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            (*this)(row,col) = rot(row,col);
+        }
+    }
 
     // Return
     return;
@@ -1250,3 +1240,101 @@ void GMatrix::alloc_members(const int& rows, const int& columns)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Compute matrix product
+ *
+ * @param[in] a First matrix.
+ * @param[in] b Second matrix.
+ *
+ * Adds the product \f$a \times b\f$ to the matrix. The matrix needs to be
+ * allocated with a.rows() rows and b.columns() columns, and a.columns() needs
+ * to equal b.rows(); no checking is performed. Neither @p a nor @p b may
+ * be the matrix itself.
+ *
+ * Since matrices are stored column-wise, each column j of the result is
+ * accumulated as the sum of columns k of @p a scaled by the elements
+ * b(k,j), which gives unit stride memory access in the innermost loop
+ * that the compiler can vectorise. The loops are blocked so that the
+ * working set of @p a stays in cache, and blocks of result columns are
+ * distributed over OpenMP threads for large matrices.
+ ***************************************************************************/
+void GMatrix::multiply(const GMatrix& a, const GMatrix& b)
+{
+    // Get dimensions
+    const int rows  = a.m_rows;
+    const int inner = a.m_cols;
+    const int cols  = b.m_cols;
+
+    // Get data pointers
+    const double* a_data = a.m_data;
+    const double* b_data = b.m_data;
+    double*       c_data = m_data;
+
+    // Determine number of column blocks and whether parallel computation
+    // is worth it
+    const int  nblocks  = (cols + G_GEMM_BLOCK_COLS - 1) / G_GEMM_BLOCK_COLS;
+    const bool parallel = (double(rows) * double(inner) * double(cols) >
+                           G_GEMM_OMP_MIN) && (nblocks > 1);
+
+    // Loop over blocks of result columns. Each thread writes to its own
+    // columns, hence no synchronisation is needed.
+    #pragma omp parallel for schedule(dynamic) if(parallel)
+    for (int jblock = 0; jblock < nblocks; ++jblock) {
+
+        // Set column range
+        int j_start = jblock * G_GEMM_BLOCK_COLS;
+        int j_stop  = j_start + G_GEMM_BLOCK_COLS;
+        if (j_stop > cols) {
+            j_stop = cols;
+        }
+
+        // Loop over blocks of the inner dimension
+        for (int k_start = 0; k_start < inner; k_start += G_GEMM_BLOCK_INNER) {
+
+            // Set inner range
+            int k_stop = k_start + G_GEMM_BLOCK_INNER;
+            if (k_stop > inner) {
+                k_stop = inner;
+            }
+
+            // Loop over blocks of rows
+            for (int i_start = 0; i_start < rows; i_start += G_GEMM_BLOCK_ROWS) {
+
+                // Set row range
+                int i_stop = i_start + G_GEMM_BLOCK_ROWS;
+                if (i_stop > rows) {
+                    i_stop = rows;
+                }
+                int num = i_stop - i_start;
+
+                // Loop over columns of block
+                for (int j = j_start; j < j_stop; ++j) {
+
+                    // Get pointers to result column and column of b
+                    double*       c_col = c_data + j * rows + i_start;
+                    const double* b_col = b_data + j * inner;
+
+                    // Add scaled columns of a
+                    for (int k = k_start; k < k_stop; ++k) {
+                        const double  b_kj  = b_col[k];
+                        if (b_kj != 0.0) {
+                            const double* a_col = a_data + k * rows + i_start;
+                            for (int i = 0; i < num; ++i) {
+                                c_col[i] += a_col[i] * b_kj;
+                            }
+                        }
+                    }
+
+                } // endfor: looped over columns of block
+
+            } // endfor: looped over row blocks
+
+        } // endfor: looped over inner blocks
+
+    } // endfor: looped over column blocks
+
+    // Return
+    return;
+}
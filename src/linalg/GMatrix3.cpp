@@ -0,0 +1,441 @@
+/***************************************************************************
+ *                GMatrix3.cpp - Fixed-size 3x3 matrix class               *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GMatrix3.cpp
+ * @brief Fixed-size 3x3 matrix class implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include <cmath>
+#include "GMatrix3.hpp"
+#include "GException.hpp"
+#include "GTools.hpp"
+#include "GMath.hpp"
+
+
+/* __ Method name definitions ____________________________________________ */
+#define G_CONSTRUCTOR                             "GMatrix3::GMatrix3(GMatrix&)"
+
+
+/*==========================================================================
+ =                                                                         =
+ =                         Constructors/destructors                        =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Void matrix constructor
+ *
+ * Constructs a 3x3 matrix with all elements set to zero.
+ ***************************************************************************/
+GMatrix3::GMatrix3(void)
+{
+    // Initialise class members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Matrix constructor
+ *
+ * @param[in] matrix Matrix.
+ *
+ * @exception GException::matrix_mismatch
+ *            Matrix is not a 3x3 matrix.
+ ***************************************************************************/
+GMatrix3::GMatrix3(const GMatrix& matrix)
+{
+    // Raise exception if matrix is not a 3x3 matrix
+    if (matrix.rows() != 3 || matrix.columns() != 3) {
+        throw GException::matrix_mismatch(G_CONSTRUCTOR, 3, 3,
+                                          matrix.rows(), matrix.columns());
+    }
+
+    // Set elements
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            (*this)(row,col) = matrix(row,col);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy constructor
+ *
+ * @param[in] matrix Matrix.
+ ***************************************************************************/
+GMatrix3::GMatrix3(const GMatrix3& matrix)
+{
+    // Copy members
+    copy_members(matrix);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Destructor
+ ***************************************************************************/
+GMatrix3::~GMatrix3(void)
+{
+    // Free members
+    free_members();
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                               Operators                                 =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Equality operator
+ *
+ * @param[in] matrix Matrix.
+ * @return True if matrices are identical.
+ ***************************************************************************/
+bool GMatrix3::operator==(const GMatrix3& matrix) const
+{
+    // Compare elements
+    bool result = true;
+    for (int i = 0; i < 9; ++i) {
+        if (m_data[i] != matrix.m_data[i]) {
+            result = false;
+            break;
+        }
+    }
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Non-equality operator
+ *
+ * @param[in] matrix Matrix.
+ * @return True if matrices are not identical.
+ ***************************************************************************/
+bool GMatrix3::operator!=(const GMatrix3& matrix) const
+{
+    // Return result
+    return !(*this == matrix);
+}
+
+
+/***********************************************************************//**
+ * @brief Assignment operator
+ *
+ * @param[in] matrix Matrix.
+ * @return Matrix.
+ ***************************************************************************/
+GMatrix3& GMatrix3::operator=(const GMatrix3& matrix)
+{
+    // Execute only if object is not identical
+    if (this != &matrix) {
+
+        // Copy members
+        copy_members(matrix);
+
+    } // endif: object was not identical
+
+    // Return this object
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Matrix multiplication
+ *
+ * @param[in] matrix Matrix.
+ * @return Product of matrix and @p matrix.
+ ***************************************************************************/
+GMatrix3 GMatrix3::operator*(const GMatrix3& matrix) const
+{
+    // Compute product
+    GMatrix3 result;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            result(row,col) = (*this)(row,0) * matrix(0,col) +
+                              (*this)(row,1) * matrix(1,col) +
+                              (*this)(row,2) * matrix(2,col);
+        }
+    }
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Public methods                              =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Clear matrix
+ *
+ * Sets all matrix elements to zero.
+ ***************************************************************************/
+void GMatrix3::clear(void)
+{
+    // Free members
+    free_members();
+
+    // Initialise private members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clone matrix
+ *
+ * @return Pointer to deep copy of matrix.
+ ***************************************************************************/
+GMatrix3* GMatrix3::clone(void) const
+{
+    // Clone matrix
+    return new GMatrix3(*this);
+}
+
+
+/***********************************************************************//**
+ * @brief Return transposed matrix
+ *
+ * @return Transposed matrix.
+ ***************************************************************************/
+GMatrix3 GMatrix3::transpose(void) const
+{
+    // Transpose matrix
+    GMatrix3 result;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            result(col,row) = (*this)(row,col);
+        }
+    }
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Return matrix as GMatrix
+ *
+ * @return 3x3 matrix.
+ ***************************************************************************/
+GMatrix GMatrix3::matrix(void) const
+{
+    // Set matrix elements
+    GMatrix result(3,3);
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            result(row,col) = (*this)(row,col);
+        }
+    }
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Euler rotation matrix around x axis
+ *
+ * @param[in] angle Rotation angle (degrees)
+ ***************************************************************************/
+void GMatrix3::eulerx(const double& angle)
+{
+    // Compute angles
+    double arg      = angle * gammalib::deg2rad;
+    double cosangle = std::cos(arg);
+    double sinangle = std::sin(arg);
+
+    // Set matrix elements
+    m_data[0] =       1.0;
+    m_data[1] =       0.0;
+    m_data[2] =       0.0;
+    m_data[3] =       0.0;
+    m_data[4] =  cosangle;
+    m_data[5] = -sinangle;
+    m_data[6] =       0.0;
+    m_data[7] =  sinangle;
+    m_data[8] =  cosangle;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Euler rotation matrix around y axis
+ *
+ * @param[in] angle Rotation angle (degrees)
+ ***************************************************************************/
+void GMatrix3::eulery(const double& angle)
+{
+    // Compute angles
+    double arg      = angle * gammalib::deg2rad;
+    double cosangle = std::cos(arg);
+    double sinangle = std::sin(arg);
+
+    // Set matrix elements
+    m_data[0] =  cosangle;
+    m_data[1] =       0.0;
+    m_data[2] =  sinangle;
+    m_data[3] =       0.0;
+    m_data[4] =       1.0;
+    m_data[5] =       0.0;
+    m_data[6] = -sinangle;
+    m_data[7] =       0.0;
+    m_data[8] =  cosangle;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Euler rotation matrix around z axis
+ *
+ * @param[in] angle Rotation angle (degrees)
+ ***************************************************************************/
+void GMatrix3::eulerz(const double& angle)
+{
+    // Compute angles
+    double arg      = angle * gammalib::deg2rad;
+    double cosangle = std::cos(arg);
+    double sinangle = std::sin(arg);
+
+    // Set matrix elements
+    m_data[0] =  cosangle;
+    m_data[1] = -sinangle;
+    m_data[2] =       0.0;
+    m_data[3] =  sinangle;
+    m_data[4] =  cosangle;
+    m_data[5] =       0.0;
+    m_data[6] =       0.0;
+    m_data[7] =       0.0;
+    m_data[8] =       1.0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Print matrix
+ *
+ * @param[in] chatter Chattiness (defaults to NORMAL).
+ * @return String containing matrix information.
+ ***************************************************************************/
+std::string GMatrix3::print(const GChatter& chatter) const
+{
+    // Initialise result string
+    std::string result;
+
+    // Continue only if chatter is not silent
+    if (chatter != SILENT) {
+
+        // Append header
+        result.append("=== GMatrix3 ===");
+
+        // Append elements
+        for (int row = 0; row < 3; ++row) {
+            result.append("\n ");
+            for (int col = 0; col < 3; ++col) {
+                result.append(" "+gammalib::str((*this)(row,col)));
+            }
+        }
+
+    } // endif: chatter was not silent
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Private methods                             =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GMatrix3::init_members(void)
+{
+    // Initialise members
+    for (int i = 0; i < 9; ++i) {
+        m_data[i] = 0.0;
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] matrix Matrix.
+ ***************************************************************************/
+void GMatrix3::copy_members(const GMatrix3& matrix)
+{
+    // Copy members
+    for (int i = 0; i < 9; ++i) {
+        m_data[i] = matrix.m_data[i];
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GMatrix3::free_members(void)
+{
+    // Return
+    return;
+}
@@ -29,6 +29,8 @@
 #include <config.h>
 #endif
 #include <cmath>
+#include <vector>
+#include <algorithm>
 #include "GException.hpp"
 #include "GTools.hpp"
 #include "GVector.hpp"
@@ -56,6 +58,7 @@
                                                                 " int*, int)"
 #define G_CHOL_DECOMP               "GMatrixSparse::cholesky_decompose(bool)"
 #define G_CHOL_SOLVE         "GMatrixSparse::cholesky_solver(GVector&, bool)"
+#define G_CHOL_INV_DIAG    "GMatrixSparse::cholesky_inverse_diagonal(bool)"
 #define G_STACK_INIT                  "GMatrixSparse::stack_init(int&, int&)"
 #define G_STACK_PUSH  "GMatrixSparse::stack_push_column(double*, int*, int&,"\
                                                                      " int&)"
@@ -1616,6 +1619,34 @@ double GMatrixSparse::sum(void) const
  * is stored within a GMatrixSparse object.
  ***************************************************************************/
 GMatrixSparse GMatrixSparse::cholesky_decompose(bool compress) const
+{
+    // Compute decomposition without previous decomposition
+    GMatrixSparse matrix = cholesky_decompose(GMatrixSparse(), compress);
+
+    // Return matrix
+    return matrix;
+}
+
+
+/***********************************************************************//**
+ * @brief Return Cholesky decomposition reusing a previous decomposition
+ *
+ * @param[in] decomposition Previous Cholesky decomposition.
+ * @param[in] compress Use zero-row/column compression (defaults to true).
+ * @return Cholesky decomposition of matrix
+ *
+ * Returns the Cholesky decomposition of a sparse matrix. If the (compressed)
+ * matrix has the same sparsity pattern as the matrix from which the
+ * previous @p decomposition has been computed, the fill-reducing ordering
+ * and the symbolic analysis of the previous decomposition are reused and
+ * only the numeric factorisation is performed. Otherwise, a full
+ * decomposition is computed.
+ *
+ * This is useful for iterative algorithms that repeatedly factorise
+ * matrices with an unchanged sparsity pattern.
+ ***************************************************************************/
+GMatrixSparse GMatrixSparse::cholesky_decompose(const GMatrixSparse& decomposition,
+                                                bool                 compress) const
 {
     // Create copy of matrix
     GMatrixSparse matrix = *this;
@@ -1648,9 +1679,17 @@ GMatrixSparse GMatrixSparse::cholesky_decompose(bool compress) const
         matrix.remove_zero_row_col();
     }
 
-    // Ordering an symbolic analysis of matrix. This sets up an array 'pinv'
-    // which contains the fill-in reducing permutations
-    symbolic->cholesky_symbolic_analysis(1, matrix);
+    // Reuse symbolic analysis of previous decomposition if the sparsity
+    // pattern is unchanged. Otherwise perform ordering and symbolic analysis
+    // of matrix. This sets up an array 'pinv' which contains the fill-in
+    // reducing permutations
+    if (decomposition.m_symbolic != NULL &&
+        decomposition.m_symbolic->matches(matrix)) {
+        *symbolic = *decomposition.m_symbolic;
+    }
+    else {
+        symbolic->cholesky_symbolic_analysis(1, matrix);
+    }
 
     // Store symbolic pointer in sparse matrix object
     matrix.m_symbolic = symbolic;
@@ -1912,6 +1951,160 @@ GVector GMatrixSparse::cholesky_solver(const GVector& vector,
 }
 
 
+/***********************************************************************//**
+ * @brief Return diagonal of inverse matrix from Cholesky decomposition
+ *
+ * @param[in] compress Request matrix compression (defaults to true).
+ * @return Diagonal elements of inverse matrix.
+ *
+ * @exception GException::matrix_not_factorised
+ *            Matrix has not been factorised.
+ *
+ * Computes the diagonal elements of the inverse of a matrix for which a
+ * Cholesky decomposition has been produced using cholesky_decompose().
+ * The method uses a selected inversion that computes the elements
+ * \f$Z=A^{-1}\f$ on the sparsity pattern of the Cholesky factor \f$L\f$
+ * using the recurrence
+ *
+ * \f[
+ *    Z_{ij} = -\frac{1}{L_{jj}} \sum_{k>j} Z_{ik} L_{kj}, \quad
+ *    Z_{jj} = \frac{1}{L_{jj}^2} - \frac{1}{L_{jj}} \sum_{k>j} Z_{kj} L_{kj}
+ * \f]
+ *
+ * starting from the last column. This is considerably faster than solving
+ * the linear equation for all unit vectors. Diagonal elements of rows and
+ * columns that were removed by the compression are set to zero.
+ ***************************************************************************/
+GVector GMatrixSparse::cholesky_inverse_diagonal(bool compress) const
+{
+    // Raise an exception if there is no symbolic analysis or permutation
+    if (!m_symbolic || !m_symbolic->m_pinv) {
+        throw GException::matrix_not_factorised(G_CHOL_INV_DIAG, 
+                                                "Cholesky decomposition");
+    }
+
+    // Flag row and column compression
+    bool row_compressed = (compress && m_rowsel != NULL && m_num_rowsel < m_rows);
+    bool col_compressed = (compress && m_colsel != NULL && m_num_colsel < m_cols);
+
+    // Setup row and column mapping arrays that map the matrix rows and
+    // columns into compressed rows and columns. An entry of -1 indicates
+    // that the row or column has been dropped.
+    std::vector<int> row_map(m_rows, -1);
+    std::vector<int> col_map(m_cols, -1);
+    int              n = 0;
+    if (row_compressed) {
+        for (int c_row = 0; c_row < m_num_rowsel; ++c_row) {
+            row_map[m_rowsel[c_row]] = c_row;
+        }
+    }
+    else {
+        for (int row = 0; row < m_rows; ++row) {
+            row_map[row] = row;
+        }
+    }
+    if (col_compressed) {
+        for (int c_col = 0; c_col < m_num_colsel; ++c_col) {
+            col_map[m_colsel[c_col]] = c_col;
+        }
+        n = m_num_colsel;
+    }
+    else {
+        for (int col = 0; col < m_cols; ++col) {
+            col_map[col] = col;
+        }
+        n = m_cols;
+    }
+
+    // Setup Cholesky factor in compressed indices. The first element of
+    // each column is the diagonal element, followed by the elements below
+    // the diagonal in ascending row order.
+    std::vector<int>    Lp(n+1, 0);
+    std::vector<int>    Li;
+    std::vector<double> Lx;
+    Li.reserve(m_elements);
+    Lx.reserve(m_elements);
+    for (int col = 0; col < m_cols; ++col) {
+        int c_col = col_map[col];
+        if (c_col >= 0) {
+            for (int p = m_colstart[col]; p < m_colstart[col+1]; ++p) {
+                int c_row = row_map[m_rowinx[p]];
+                if (c_row >= 0) {
+                    Li.push_back(c_row);
+                    Lx.push_back(m_data[p]);
+                }
+            }
+            Lp[c_col+1] = int(Li.size());
+        }
+    }
+
+    // Allocate selected inverse on the pattern of the Cholesky factor
+    std::vector<double> Z(Lx.size(), 0.0);
+
+    // Compute selected inverse from the last to the first column
+    for (int j = n-1; j >= 0; --j) {
+
+        // Get inverse of diagonal element
+        int    start = Lp[j];
+        int    stop  = Lp[j+1];
+        double inv   = 1.0 / Lx[start];
+
+        // Compute off-diagonal elements Z(i,j) of column j
+        for (int q = start+1; q < stop; ++q) {
+            int    i   = Li[q];
+            double sum = 0.0;
+            for (int p = start+1; p < stop; ++p) {
+
+                // Get Z(i,k) from the lower triangle of column min(i,k)
+                int k     = Li[p];
+                int z_col = (i < k) ? i : k;
+                int z_row = (i < k) ? k : i;
+                int first = Lp[z_col];
+                int last  = Lp[z_col+1];
+                int pos   = int(std::lower_bound(Li.begin()+first+1,
+                                                 Li.begin()+last, z_row) -
+                                Li.begin());
+                if (z_row == z_col) {
+                    pos = first;
+                }
+                sum += Z[pos] * Lx[p];
+
+            }
+            Z[q] = -inv * sum;
+        }
+
+        // Compute diagonal element Z(j,j)
+        double sum = 0.0;
+        for (int p = start+1; p < stop; ++p) {
+            sum += Z[p] * Lx[p];
+        }
+        Z[start] = inv * inv - inv * sum;
+
+    } // endfor: looped over columns
+
+    // Extract diagonal and undo permutation
+    GVector diag(n);
+    for (int j = 0; j < n; ++j) {
+        diag[j] = Z[Lp[j]];
+    }
+    diag = perm(diag, m_symbolic->m_pinv);
+
+    // Expand result vector if columns have been compressed
+    GVector result(m_cols);
+    if (col_compressed) {
+        for (int c_col = 0; c_col < m_num_colsel; ++c_col) {
+            result[m_colsel[c_col]] = diag[c_col];
+        }
+    }
+    else {
+        result = diag;
+    }
+
+    // Return result vector
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Invert matrix using a Cholesky decomposition
  *
@@ -54,6 +54,7 @@
 #define G_CHOL_DECOMP            "GMatrixSymmetric::cholesky_decompose(int&)"
 #define G_CHOL_SOLVE      "GMatrixSymmetric::cholesky_solver(GVector&, int&)"
 #define G_CHOL_INVERT               "GMatrixSymmetric::cholesky_invert(int&)"
+#define G_RANK1_UPDATE     "GMatrixSymmetric::rank1_update(double&, GVector&)"
 #define G_COPY_MEMBERS    "GMatrixSymmetric::copy_members(GMatrixSymmetric&)"
 #define G_ALLOC_MEMBERS         "GMatrixSymmetric::alloc_members(int&, int&)"
 
@@ -1234,6 +1235,100 @@ GMatrixSymmetric GMatrixSymmetric::cholesky_invert(bool compress) const
 }
 
 
+/***********************************************************************//**
+ * @brief Add scaled outer product of vector to matrix
+ *
+ * @param[in] alpha Scale factor.
+ * @param[in] vector Vector.
+ *
+ * @exception GException::matrix_vector_mismatch
+ *            Matrix dimension mismatches the vector size.
+ *
+ * Performs the symmetric rank-1 update
+ *
+ * \f[
+ *    M = M + \alpha v v^T
+ * \f]
+ *
+ * As only the lower triangle is stored, the update operates on contiguous
+ * column segments of the matrix.
+ ***************************************************************************/
+void GMatrixSymmetric::rank1_update(const double& alpha, const GVector& vector)
+{
+    // Raise an exception if the matrix and vector dimensions are not
+    // compatible
+    if (m_rows != vector.size()) {
+        throw GException::matrix_vector_mismatch(G_RANK1_UPDATE, vector.size(),
+                                                 m_rows, m_cols);
+    }
+
+    // Loop over all columns
+    for (int col = 0; col < m_cols; ++col) {
+
+        // Skip column if the vector element is zero
+        double scale = alpha * vector[col];
+        if (scale == 0.0) {
+            continue;
+        }
+
+        // Update column segment M(col:rows,col)
+        double*       ptr = m_data + m_colstart[col];
+        const double* v   = &(vector[col]);
+        int           num = m_rows - col;
+        for (int k = 0; k < num; ++k) {
+            ptr[k] += scale * v[k];
+        }
+
+    } // endfor: looped over columns
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Add scaled outer product of sparse vector to matrix
+ *
+ * @param[in] alpha Scale factor.
+ * @param[in] values Non-zero vector elements.
+ * @param[in] inx Row/column indices of non-zero vector elements.
+ * @param[in] num Number of non-zero vector elements.
+ *
+ * Performs the symmetric rank-1 update
+ *
+ * \f[
+ *    M = M + \alpha v v^T
+ * \f]
+ *
+ * for a vector \f$v\f$ that is given by its @p num non-zero elements
+ * @p values at the indices @p inx. The indices need to be sorted in
+ * ascending order. No range checking is performed.
+ ***************************************************************************/
+void GMatrixSymmetric::rank1_update(const double& alpha,
+                                    const double* values,
+                                    const int*    inx,
+                                    const int&    num)
+{
+    // Loop over all non-zero columns
+    for (int k = 0; k < num; ++k) {
+
+        // Get column pointer such that ptr[row] = M(row,col) for row >= col
+        int     col   = inx[k];
+        double  scale = alpha * values[k];
+        double* ptr   = m_data + m_colstart[col] - col;
+
+        // Update all non-zero rows with row >= col
+        for (int l = k; l < num; ++l) {
+            ptr[inx[l]] += scale * values[l];
+        }
+
+    } // endfor: looped over columns
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print matrix
  *
@@ -1478,20 +1573,10 @@ GMatrix GMatrixSymmetric::operator*(const GMatrixSymmetric& matrix) const
                                           matrix.m_rows, matrix.m_cols);
     }
 
-    // Allocate result matrix
-    GMatrix result(m_rows, matrix.m_cols);
+    // Expand both matrices into general matrices and compute their
+    // product using the blocked general matrix multiplication
+    GMatrix result = GMatrix(*this) * GMatrix(matrix);
 
-    // Loop over all elements of result matrix
-    for (int row = 0; row < m_rows; ++row) {
-        for (int col = 0; col < matrix.m_cols; ++col) {
-            double sum = 0.0;
-            for (int i = 0; i < m_cols; ++i) {
-                sum += (*this)(row,i) * matrix(i,col);
-            }
-            result(row,col) = sum;
-        }
-    }
-    
     // Return result
     return result;
 }
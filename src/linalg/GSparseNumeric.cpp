@@ -28,12 +28,18 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <cmath>
+#include <vector>
 #include "GSparseNumeric.hpp"
 
+/* __ Method name definitions ____________________________________________ */
+#define G_CHOLESKY  "GSparseNumeric::cholesky_numeric_analysis(GMatrixSparse&,"\
+                                                        " GSparseSymbolic&)"
+
 /* __ Macros _____________________________________________________________ */
-#define CS_FLIP(i) (-(i)-2)
-#define CS_MARK(w,j) { w [j] = CS_FLIP (w [j]) ; }
-#define CS_MARKED(w,j) (w [j] < 0)
+
+/* __ Coding definitions _________________________________________________ */
+#define G_CHOL_OMP_MIN_NNZ 10000  //!< Min. elements in L for parallel factor
 
 
 /*==========================================================================
@@ -141,134 +147,222 @@ GSparseNumeric& GSparseNumeric::operator= (const GSparseNumeric& n)
  =                                                                         =
  ==========================================================================*/
 
-/***************************************************************************
- *                        cholesky_numeric_analysis                        *
- * ----------------------------------------------------------------------- *
- * L = chol (A, [pinv parent cp]), pinv is optional. This function         *
- * allocates the memory to hold the information.                           *
- * ----------------------------------------------------------------------- *
- * Input:   A                    Sparse matrix                             *
- *          S                    Symbolic analysis of sparse matrix        *
+/***********************************************************************//**
+ * @brief Numeric Cholesky factorisation
+ *
+ * @param[in] A Sparse matrix.
+ * @param[in] S Symbolic analysis of sparse matrix.
+ *
+ * @exception GException::matrix_not_pos_definite
+ *            Matrix is not positive definite.
+ *
+ * Computes L = chol(A(p,p)) using the multifrontal method on the
+ * supernodes determined by the symbolic analysis @p S. For each supernode,
+ * a dense frontal matrix is assembled from the matrix elements of the
+ * supernode columns and from the update matrices of the child supernodes.
+ * The supernode columns of the frontal matrix are then factorised using
+ * dense kernels, and the Schur complement of the remaining rows forms the
+ * update matrix that is passed to the parent supernode.
+ *
+ * Supernodes are processed level by level in the supernodal elimination
+ * tree. Supernodes of the same level are independent of each other and
+ * are distributed over OpenMP threads.
+ *
+ * The symbolic analysis only depends on the sparsity pattern of @p A,
+ * hence it may be reused for the factorisation of any matrix with the
+ * same pattern.
  ***************************************************************************/
 void GSparseNumeric::cholesky_numeric_analysis(const GMatrixSparse& A, 
                                                const GSparseSymbolic& S)
 {
-  // De-allocate memory that has indeed been previously allocated
-  if (m_L    != NULL) delete m_L;
-  if (m_U    != NULL) delete m_U;
-  if (m_pinv != NULL) delete [] m_pinv;
-  if (m_B    != NULL) delete [] m_B;
-
-  // Initialise members
-  m_L      = NULL;
-  m_U      = NULL;
-  m_pinv   = NULL;
-  m_B      = NULL;
-  m_n_pinv = 0;
-  m_n_B    = 0;
-
-  // Return if arrays in the symbolic analysis have not been allocated
-  if (!S.m_cp || !S.m_parent) return;
-  
-  // Declare
-  double lki;
-  int top, i, p, k;
-
-  // Assign input matrix attributes
-  int n = A.m_cols;
-
-    // Allocate int workspace
-    int  wrk_size = 2*n;
-    int* wrk_int  = new int[wrk_size];
-
-    // Allocate double workspace
-    wrk_size = n;
-    double* wrk_double = new double[wrk_size];
-
-  // Assign pointers
-  int* cp     = S.m_cp;
-  int* pinv   = S.m_pinv;
-  int* parent = S.m_parent;
-
-  // Assign C = A(p,p) where A and C are symmetric and the upper part stored
-  GMatrixSparse C = (pinv) ? cs_symperm(A, pinv) : (A);
-
-  // Assign workspace pointer
-  int*    c = wrk_int;
-  int*    s = wrk_int + n;
-  double* x = wrk_double;
-  
-  // Assign C matrix pointers 
-  int*    Cp = C.m_colstart;
-  int*    Ci = C.m_rowinx; 
-  double* Cx = C.m_data;
-  
-    // Allocate L matrix
-    m_L = new GMatrixSparse(n, n, cp[n]);
-
-  // Assign L matrix pointers 
-  int*    Lp = m_L->m_colstart;
-  int*    Li = m_L->m_rowinx; 
-  double* Lx = m_L->m_data;
+    // De-allocate memory that has indeed been previously allocated
+    if (m_L    != NULL) delete m_L;
+    if (m_U    != NULL) delete m_U;
+    if (m_pinv != NULL) delete [] m_pinv;
+    if (m_B    != NULL) delete [] m_B;
+
+    // Initialise members
+    m_L      = NULL;
+    m_U      = NULL;
+    m_pinv   = NULL;
+    m_B      = NULL;
+    m_n_pinv = 0;
+    m_n_B    = 0;
+
+    // Return if arrays in the symbolic analysis have not been allocated
+    if (!S.m_cp || !S.m_parent || S.m_super.empty()) {
+        return;
+    }
+
+    // Get matrix dimension and number of supernodes
+    int n      = A.m_cols;
+    int nsuper = int(S.m_super.size()) - 1;
+
+    // Assign C = A(p,p) where A and C are symmetric and the upper part
+    // stored, and get the lower part by transposing C
+    GMatrixSparse C  = (S.m_pinv) ? cs_symperm(A, S.m_pinv) : (A);
+    GMatrixSparse CT = cs_transpose(C, 1);
+
+    // Allocate L matrix and set column pointers
+    m_L = new GMatrixSparse(n, n, S.m_cp[n]);
+    for (int k = 0; k <= n; ++k) {
+        m_L->m_colstart[k] = S.m_cp[k];
+    }
+
+    // Allocate update matrices of supernodes
+    std::vector<std::vector<double> > updates(nsuper);
+
+    // Initialise failure information
+    int    fail_col   = -1;
+    double fail_value = 0.0;
+
+    // Decide on parallel computation
+    bool parallel = (S.m_lnz > G_CHOL_OMP_MIN_NNZ);
+
+    // Factorise supernodes level by level
+    #pragma omp parallel if(parallel)
+    {
+        // Allocate thread private workspace for relative row indices
+        std::vector<int>    map(n);
+        std::vector<double> front;
+
+        // Loop over levels of supernodal elimination tree
+        for (int level = 0; level < int(S.m_slevelstart.size())-1; ++level) {
+
+            // Loop over supernodes of level. There is an implicit barrier
+            // at the end of the loop, hence all update matrices of a level
+            // are available for the next level.
+            #pragma omp for schedule(dynamic)
+            for (int k = S.m_slevelstart[level];
+                 k < S.m_slevelstart[level+1]; ++k) {
+
+                // Get supernode
+                int        s     = S.m_sorder[k];
+                int        first = S.m_super[s];
+                int        width = S.m_super[s+1] - first;
+                const int* rows  = &(S.m_srowinx[S.m_srowstart[s]]);
+                int        m     = S.m_srowstart[s+1] - S.m_srowstart[s];
+
+                // Set relative row indices
+                for (int r = 0; r < m; ++r) {
+                    map[rows[r]] = r;
+                }
+
+                // Allocate and clear frontal matrix
+                front.assign(m * m, 0.0);
+                double* F = &(front[0]);
+
+                // Assemble lower triangle of matrix elements of supernode
+                // columns
+                for (int j = 0; j < width; ++j) {
+                    int col = first + j;
+                    for (int p = CT.m_colstart[col]; p < CT.m_colstart[col+1]; ++p) {
+                        F[map[CT.m_rowinx[p]] + j*m] += CT.m_data[p];
+                    }
+                }
+
+                // Add update matrices of children
+                for (int c = S.m_schildstart[s]; c < S.m_schildstart[s+1]; ++c) {
+                    int        child   = S.m_schild[c];
+                    int        cwidth  = S.m_super[child+1] - S.m_super[child];
+                    int        mu      = S.m_srowstart[child+1] -
+                                         S.m_srowstart[child] - cwidth;
+                    if (mu < 1) {
+                        continue;
+                    }
+                    const int* crows   = &(S.m_srowinx[S.m_srowstart[child]+cwidth]);
+                    const double* U    = &(updates[child][0]);
+                    for (int jj = 0; jj < mu; ++jj) {
+                        double* F_col = F + map[crows[jj]] * m;
+                        for (int ii = jj; ii < mu; ++ii) {
+                            F_col[map[crows[ii]]] += U[ii + jj*mu];
+                        }
+                    }
+                    std::vector<double>().swap(updates[child]);
+                }
+
+                // Factorise supernode columns of frontal matrix
+                for (int j = 0; j < width; ++j) {
+
+                    // Update column j using all previous columns
+                    double* F_j = F + j*m;
+                    for (int l = 0; l < j; ++l) {
+                        const double* F_l  = F + l*m;
+                        double        l_jl = F_l[j];
+                        for (int i = j; i < m; ++i) {
+                            F_j[i] -= F_l[i] * l_jl;
+                        }
+                    }
+
+                    // Check for positive definiteness. In case of failure
+                    // record the smallest failing column
+                    double d = F_j[j];
+                    if (d <= 0.0) {
+                        #pragma omp critical(GSparseNumeric_cholesky)
+                        {
+                            if (fail_col < 0 || first + j < fail_col) {
+                                fail_col   = first + j;
+                                fail_value = d;
+                            }
+                        }
+                        d = 1.0;
+                    }
+
+                    // Scale column
+                    d      = std::sqrt(d);
+                    F_j[j] = d;
+                    for (int i = j+1; i < m; ++i) {
+                        F_j[i] /= d;
+                    }
+
+                } // endfor: looped over supernode columns
+
+                // Store supernode columns in L
+                for (int j = 0; j < width; ++j) {
+                    int     p   = S.m_cp[first + j];
+                    double* F_j = F + j*m;
+                    for (int r = j; r < m; ++r, ++p) {
+                        m_L->m_rowinx[p] = rows[r];
+                        m_L->m_data[p]   = F_j[r];
+                    }
+                }
+
+                // Compute update matrix for parent supernode as the Schur
+                // complement of the remaining rows
+                int mu = m - width;
+                if (S.m_sparent[s] >= 0 && mu > 0) {
+                    updates[s].assign(mu * mu, 0.0);
+                    double* U = &(updates[s][0]);
+                    for (int jj = 0; jj < mu; ++jj) {
+                        double*       U_jj = U + jj*mu;
+                        const double* F_jj = F + (jj+width)*m + width;
+                        for (int ii = jj; ii < mu; ++ii) {
+                            U_jj[ii] = F_jj[ii];
+                        }
+                        for (int l = 0; l < width; ++l) {
+                            const double* F_l  = F + l*m + width;
+                            double        l_jl = F_l[jj];
+                            for (int ii = jj; ii < mu; ++ii) {
+                                U_jj[ii] -= F_l[ii] * l_jl;
+                            }
+                        }
+                    }
+                }
+
+            } // endfor: looped over supernodes of level
+
+        } // endfor: looped over levels
+
+    } // end pragma omp parallel
+
+    // Throw exception if matrix is not positive definite
+    if (fail_col >= 0) {
+        throw GException::matrix_not_pos_definite(G_CHOLESKY, fail_col,
+                                                  fail_value);
+    }
 
-  // Initialise column pointers of L and c
-  for (k = 0; k < n; ++k) 
-    Lp[k] = c[k] = cp[k];
-	
-  // Compute L(:,k) for L*L' = C
-  for (k = 0; k < n; k++) {
-  
-	// Nonzero pattern of L(k,:). 
-	// Returns -1 if parent = NULL, s = NULL or c = NULL
-    top  = cs_ereach(&C, k, parent, s, c);      // find pattern of L(k,:)
-	x[k] = 0;                                   // x (0:k) is now zero
-	
-	// x = full(triu(C(:,k)))
-	for (p = Cp[k]; p < Cp[k+1]; p++) {
-      if (Ci[p] <= k) 
-	    x[Ci[p]] = Cx[p];
-	}
-	
-	// d = C(k,k)
-	double d = x[k];
-	
-	// Clear x for k+1st iteration
-	x[k] = 0;
-	
-	// Triangular solve: Solve L(0:k-1,0:k-1) * x = C(:,k)
-	for ( ; top < n; top++) {
-      i    = s[top];                            // s [top..n-1] is pattern of L(k,:)
-      lki  = x[i]/Lx[Lp[i]];                    // L(k,i) = x (i) / L(i,i)
-      x[i] = 0;                                 // clear x for k+1st iteration
-	  for (p = Lp[i]+1; p < c[i]; p++)
-		x[Li[p]] -= Lx[p] * lki;
-	  d    -= lki * lki;                        // d = d - L(k,i)*L(k,i)
-	  p     = c[i]++;
-	  Li[p] = k;                                // store L(k,i) in column i
-	  Lx[p] = lki;
-	}
-	
-	// Compute L(k,k)
-	if (d <= 0)
-	  throw GException::matrix_not_pos_definite(
-	        "GSparseNumeric::cholesky_numeric_analysis(GMatrixSparse&, const GSparseSymbolic&)",
-			k, d);
-
-    // Store L(k,k) = sqrt (d) in column k
-	p     = c[k]++;
-	Li[p] = k;
-	Lx[p] = sqrt(d);
-  }
-  
-  // Finalize L
-  Lp[n] = cp[n];
-  
-  // Free workspace
-  delete [] wrk_int;
-  delete [] wrk_double;
-
-  // Return void
-  return; 
+    // Return
+    return;
 }
 
 
@@ -278,66 +372,6 @@ void GSparseNumeric::cholesky_numeric_analysis(const GMatrixSparse& A,
  =                                                                         =
  ==========================================================================*/
 
-/***************************************************************************
- *                                 cs_ereach                               *
- * ----------------------------------------------------------------------- *
- * Find nonzero pattern of Cholesky L(k,1:k-1) using etree and             *
- * triu(A(:,k))                                                            *
- * ----------------------------------------------------------------------- *
- * Input:   A                    Sparse matrix                             *
- *          k                    Node                                      *
- *          parent               ...                                       *
- *          s                    ...                                       *
- *          w                    ...                                       *
- * Input:   top                  Index, where s[top..n-1] contains pattern *
- *                               of L(k,:); -1 if arrays have not been     *
- *                               allocated                                 *
- ***************************************************************************/
-int GSparseNumeric::cs_ereach(const GMatrixSparse* A, int k, 
-                                          const int* parent, int* s, int* w)
-{
-  // Return -1 if arrays have not been allocated
-  if (!parent || !s || !w) return (-1);
-
-  // Assign A matrix attributes and pointers 
-  int  n   = A->m_cols;
-  int  top = n;
-  int* Ap  = A->m_colstart;
-  int* Ai  = A->m_rowinx; 
-    
-  // Mark node k as visited
-  CS_MARK(w, k);
-  
-  // Loop over elements of node
-  int i;
-  for (int p = Ap[k]; p < Ap[k+1]; ++p) {
-	i = Ai[p];                  // A(i,k) is nonzero
-	if (i > k) continue;        // only use upper triangular part of A
-
-    // Traverse up etree
-	int len;
-	for (len = 0; !CS_MARKED(w,i); i = parent[i]) {
-      s[len++] = i;             // L(k,i) is nonzero
-	  CS_MARK(w, i);            // mark i as visited
-	}
-	
-	// Push path onto stack
-	while (len > 0) 
-	  s[--top] = s[--len];
-  }
-  
-  // Unmark all nodes
-  for (int p = top; p < n; ++p) 
-    CS_MARK(w, s[p]);
-	
-  // Unmark node k
-  CS_MARK(w, k);
-  
-  // Return index top, where s[top..n-1] contains pattern of L(k,:)
-  return top;
-}
-
-
 /*==========================================================================
  =                                                                         =
  =                   GSparseNumeric static member functions                =
@@ -68,9 +68,6 @@ public:
   void cholesky_numeric_analysis(const GMatrixSparse& m, const GSparseSymbolic& s);
 
 private:
-  // Functions
-  int cs_ereach(const GMatrixSparse* A, int k, const int* parent, int* s, int* w);
-
   // Data
   GMatrixSparse* m_L;        // L for LU and Cholesky, V for QR
   GMatrixSparse* m_U;        // U for LU, R for QR, not used for Cholesky
@@ -28,6 +28,7 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <algorithm>
 #include "GMatrixSparse.hpp"
 #include "GSparseSymbolic.hpp"
 
@@ -126,9 +127,21 @@ GSparseSymbolic& GSparseSymbolic::operator= (const GSparseSymbolic& s)
       m_unz        = 0.0;
 
       // Copy data members
-      m_m2  = s.m_m2;
-      m_lnz = s.m_lnz;
-      m_unz = s.m_unz;
+      m_m2          = s.m_m2;
+      m_lnz         = s.m_lnz;
+      m_unz         = s.m_unz;
+      m_super       = s.m_super;
+      m_sparent     = s.m_sparent;
+      m_srowstart   = s.m_srowstart;
+      m_srowinx     = s.m_srowinx;
+      m_schildstart = s.m_schildstart;
+      m_schild      = s.m_schild;
+      m_slevelstart = s.m_slevelstart;
+      m_sorder      = s.m_sorder;
+
+      // Copy sparsity pattern
+      m_pattern_colstart = s.m_pattern_colstart;
+      m_pattern_rowinx   = s.m_pattern_rowinx;
 	
 	  // Copy m_pinv array if it exists
 	  if (s.m_pinv != NULL && s.m_n_pinv > 0) {
@@ -226,6 +239,16 @@ void GSparseSymbolic::cholesky_symbolic_analysis(int order,
   m_m2         = 0;
   m_lnz        = 0.0;
   m_unz        = 0.0;
+  m_super.clear();
+  m_sparent.clear();
+  m_srowstart.clear();
+  m_srowinx.clear();
+  m_schildstart.clear();
+  m_schild.clear();
+  m_slevelstart.clear();
+  m_sorder.clear();
+  m_pattern_colstart.clear();
+  m_pattern_rowinx.clear();
 
   // Check if order type is valid
   if (order < 0 || order > 1)
@@ -324,6 +347,14 @@ void GSparseSymbolic::cholesky_symbolic_analysis(int order,
   cout << " Number of non-zero elements in L: " << m_lnz << endl;
   #endif
 
+  // Determine supernodal structure of L and store the sparsity pattern
+  // of the analysed matrix
+  if (c != NULL && m_lnz >= 0) {
+    supernodes(C, c);
+    m_pattern_colstart.assign(m.m_colstart, m.m_colstart + n + 1);
+    m_pattern_rowinx.assign(m.m_rowinx, m.m_rowinx + m.m_colstart[n]);
+  }
+
   // Delete workspace
   if (c != NULL) delete [] c;
   
@@ -363,6 +394,43 @@ void GSparseSymbolic::cholesky_symbolic_analysis(int order,
 }
 
 
+/***********************************************************************//**
+ * @brief Check whether symbolic analysis applies to a matrix
+ *
+ * @param[in] m Sparse matrix.
+ * @return True if @p m has the sparsity pattern of the analysed matrix.
+ *
+ * Checks whether the sparse matrix @p m has the same sparsity pattern as
+ * the matrix for which the symbolic analysis has been performed. If this
+ * is the case, the symbolic analysis can be reused for a numeric
+ * factorisation of @p m. The pending element of @p m is not considered,
+ * hence it should be filled before calling the method.
+ ***************************************************************************/
+bool GSparseSymbolic::matches(const GMatrixSparse& m) const
+{
+    // Initialise result
+    bool result = false;
+
+    // Compare pattern only if a valid analysis exists and if the number of
+    // columns and elements agree
+    int n = m.m_cols;
+    if (!m_pattern_colstart.empty() && m.m_rows == n &&
+        int(m_pattern_colstart.size()) == n + 1 &&
+        int(m_pattern_rowinx.size()) == m.m_colstart[n]) {
+
+        // Compare column start indices and row indices
+        result = std::equal(m_pattern_colstart.begin(),
+                            m_pattern_colstart.end(), m.m_colstart) &&
+                 std::equal(m_pattern_rowinx.begin(),
+                            m_pattern_rowinx.end(), m.m_rowinx);
+
+    }
+
+    // Return result
+    return result;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                     GSparseSymbolic private functions                   =
@@ -1348,6 +1416,159 @@ int GSparseSymbolic::cs_tdfs(int j, int k, int* head, const int* next,
 }
 
 
+/***********************************************************************//**
+ * @brief Determine supernodal structure of Cholesky factor
+ *
+ * @param[in] C Permuted matrix (upper triangle).
+ * @param[in] counts Column counts of Cholesky factor.
+ *
+ * Partitions the columns of the Cholesky factor L of @p C into supernodes.
+ * Column j+1 is merged into the supernode of column j if it is the parent
+ * of column j in the elimination tree and if its column count is smaller
+ * by one, which implies that both columns have the same row structure
+ * below the diagonal.
+ *
+ * For each supernode, the sorted row indices of L are determined from the
+ * lower triangle of @p C and the row indices of the child supernodes.
+ * Finally, the supernodes are sorted by their level in the supernodal
+ * elimination tree, where leaves have level 0 and each supernode has a
+ * level larger than all its children.
+ ***************************************************************************/
+void GSparseSymbolic::supernodes(const GMatrixSparse& C, const int* counts)
+{
+    // Get number of columns
+    int n = C.m_cols;
+
+    // Continue only if there are columns
+    if (n < 1) {
+        return;
+    }
+
+    // Partition columns into supernodes
+    std::vector<int> snode(n);
+    m_super.push_back(0);
+    snode[0] = 0;
+    for (int j = 1; j < n; ++j) {
+        if (m_parent[j-1] != j || counts[j-1] != counts[j]+1) {
+            m_super.push_back(j);
+        }
+        snode[j] = int(m_super.size()) - 1;
+    }
+    m_super.push_back(n);
+    int nsuper = int(m_super.size()) - 1;
+
+    // Determine parent supernodes
+    m_sparent.assign(nsuper, -1);
+    for (int s = 0; s < nsuper; ++s) {
+        int parent = m_parent[m_super[s+1]-1];
+        if (parent >= 0) {
+            m_sparent[s] = snode[parent];
+        }
+    }
+
+    // Determine children of supernodes. Since parents have larger indices
+    // than their children, the children of each supernode are sorted.
+    m_schildstart.assign(nsuper+1, 0);
+    for (int s = 0; s < nsuper; ++s) {
+        if (m_sparent[s] >= 0) {
+            m_schildstart[m_sparent[s]+1]++;
+        }
+    }
+    for (int s = 0; s < nsuper; ++s) {
+        m_schildstart[s+1] += m_schildstart[s];
+    }
+    m_schild.assign(m_schildstart[nsuper], 0);
+    std::vector<int> next(m_schildstart.begin(), m_schildstart.end()-1);
+    for (int s = 0; s < nsuper; ++s) {
+        if (m_sparent[s] >= 0) {
+            m_schild[next[m_sparent[s]]++] = s;
+        }
+    }
+
+    // Get lower triangle of C
+    GMatrixSparse CT = cs_transpose(C, 0);
+
+    // Determine row indices of supernodes. The row structure of a supernode
+    // is the union of the lower triangle of its columns and of the rows of
+    // its children that lie below the child columns.
+    std::vector<int> mark(n, -1);
+    m_srowstart.assign(nsuper+1, 0);
+    m_srowinx.reserve(int(m_lnz));
+    for (int s = 0; s < nsuper; ++s) {
+
+        // Get column range
+        int first = m_super[s];
+        int last  = m_super[s+1];
+        int start = int(m_srowinx.size());
+
+        // Add diagonal block rows and lower triangle of C
+        for (int j = first; j < last; ++j) {
+            if (mark[j] != s) {
+                mark[j] = s;
+                m_srowinx.push_back(j);
+            }
+            for (int p = CT.m_colstart[j]; p < CT.m_colstart[j+1]; ++p) {
+                int i = CT.m_rowinx[p];
+                if (i >= first && mark[i] != s) {
+                    mark[i] = s;
+                    m_srowinx.push_back(i);
+                }
+            }
+        }
+
+        // Add rows of children
+        for (int k = m_schildstart[s]; k < m_schildstart[s+1]; ++k) {
+            int child  = m_schild[k];
+            int width  = m_super[child+1] - m_super[child];
+            for (int p = m_srowstart[child] + width;
+                 p < m_srowstart[child+1]; ++p) {
+                int i = m_srowinx[p];
+                if (mark[i] != s) {
+                    mark[i] = s;
+                    m_srowinx.push_back(i);
+                }
+            }
+        }
+
+        // Sort row indices
+        std::sort(m_srowinx.begin()+start, m_srowinx.end());
+
+        // Set end of row indices
+        m_srowstart[s+1] = int(m_srowinx.size());
+
+    } // endfor: looped over supernodes
+
+    // Determine level of each supernode
+    std::vector<int> level(nsuper, 0);
+    int              nlevels = 0;
+    for (int s = 0; s < nsuper; ++s) {
+        if (level[s] >= nlevels) {
+            nlevels = level[s] + 1;
+        }
+        if (m_sparent[s] >= 0 && level[m_sparent[s]] < level[s] + 1) {
+            level[m_sparent[s]] = level[s] + 1;
+        }
+    }
+
+    // Order supernodes by level
+    m_slevelstart.assign(nlevels+1, 0);
+    for (int s = 0; s < nsuper; ++s) {
+        m_slevelstart[level[s]+1]++;
+    }
+    for (int l = 0; l < nlevels; ++l) {
+        m_slevelstart[l+1] += m_slevelstart[l];
+    }
+    m_sorder.assign(nsuper, 0);
+    next.assign(m_slevelstart.begin(), m_slevelstart.end()-1);
+    for (int s = 0; s < nsuper; ++s) {
+        m_sorder[next[level[s]]++] = s;
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                  GSparseSymbolic static member functions                =
@@ -28,6 +28,7 @@
 #define GSPARSESYMBOLIC_HPP
 
 /* __ Includes ___________________________________________________________ */
+#include <vector>
 
 /* __ Definitions ________________________________________________________ */
 
@@ -47,6 +48,14 @@ double        cs_cumsum(int* p, int* c, int n);
  * @brief Sparse matrix symbolic analysis class
  *
  * This class implements the symbolic analysis of a sparse matrix.
+ *
+ * For a Cholesky factorisation, the symbolic analysis also partitions the
+ * columns of the Cholesky factor into supernodes. A supernode is a set of
+ * contiguous columns that share the same row structure below the diagonal
+ * block, and can therefore be factorised using dense matrix kernels. The
+ * supernodes form an elimination tree that is organised in levels, where
+ * all supernodes of a given level are independent of each other and may
+ * be factorised in parallel.
  ***************************************************************************/
 class GSparseSymbolic {
 
@@ -67,6 +76,7 @@ public:
 
     // Methods
     void cholesky_symbolic_analysis(int order, const GMatrixSparse& m);
+    bool matches(const GMatrixSparse& m) const;
 
 private:
     // Private methods
@@ -81,6 +91,7 @@ private:
     static void init_ata(const GMatrixSparse* AT, const int* post, int* wrk_int, int** head, int** next);
     static int  cs_diag(int i, int j, double aij, void* other);
     static int  cs_wclear(int mark, int lemax, int* w, int n);
+    void        supernodes(const GMatrixSparse& C, const int* counts);
 
     // Data
     int*   m_pinv;        //!< Inverse row permutation for QR, fill reduce permutation for Cholesky
@@ -96,6 +107,20 @@ private:
     int    m_n_parent;    //!< Number of elements in m_parent
     int    m_n_cp;        //!< Number of elements in m_cp
     int    m_n_leftmost;  //!< Number of elements in m_leftmost
+
+    // Supernodal structure for Cholesky
+    std::vector<int> m_super;       //!< First column of supernodes (+end)
+    std::vector<int> m_sparent;     //!< Parent supernode (-1 for roots)
+    std::vector<int> m_srowstart;   //!< Start of supernode rows (+end)
+    std::vector<int> m_srowinx;     //!< Sorted row indices of supernodes
+    std::vector<int> m_schildstart; //!< Start of supernode children (+end)
+    std::vector<int> m_schild;      //!< Child supernodes
+    std::vector<int> m_slevelstart; //!< Start of tree levels (+end)
+    std::vector<int> m_sorder;      //!< Supernodes ordered by tree level
+
+    // Sparsity pattern of analysed matrix
+    std::vector<int> m_pattern_colstart; //!< Column start indices
+    std::vector<int> m_pattern_rowinx;   //!< Row indices
 };
 
 #endif /* GSPARSESYMBOLIC_HPP */
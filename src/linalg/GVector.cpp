@@ -215,14 +215,27 @@ GVector& GVector::operator=(const GVector& vector)
     // Execute only if object is not identical
     if (this != &vector) {
 
-        // Free members
-        free_members();
+        // If vectors have the same size then copy elements into the
+        // existing storage
+        if (m_num == vector.m_num) {
+            for (int i = 0; i < m_num; ++i) {
+                m_data[i] = vector.m_data[i];
+            }
+        }
+
+        // ... otherwise reallocate the vector
+        else {
+
+            // Free members
+            free_members();
+
+            // Initialise private members
+            init_members();
 
-        // Initialise private members
-        init_members();
+            // Copy members
+            copy_members(vector);
 
-        // Copy members
-        copy_members(vector);
+        }
 
     } // endif: object was not identical
 
@@ -885,382 +898,3 @@ GVector iperm(const GVector& vector, const int* p)
     // Return vector
     return result;
 }
-
-
-/***********************************************************************//**
- * @brief Computes arccos of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the arccos of every element.
- ***************************************************************************/
-GVector acos(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::acos(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes acosh of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the acosh of every element.
- ***************************************************************************/
-GVector acosh(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = acosh(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes arcsin of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the arcsin of every element.
- ***************************************************************************/
-GVector asin(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::asin(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes asinh of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the asinh of every element.
- ***************************************************************************/
-GVector asinh(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = asinh(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes arctan of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the arctan of every element.
- ***************************************************************************/
-GVector atan(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::atan(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes atanh of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the atanh of every element.
- ***************************************************************************/
-GVector atanh(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = atanh(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes cosine of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the cosine of every element.
- ***************************************************************************/
-GVector cos(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::cos(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes cosh of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the cosh of every element.
- ***************************************************************************/
-GVector cosh(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::cosh(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes exponential of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the exponential of every element.
- ***************************************************************************/
-GVector exp(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::exp(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes absolute of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the absolute of every element.
- ***************************************************************************/
-GVector abs(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::abs(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes natural logarithm of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the natural logarithm of every element.
- ***************************************************************************/
-GVector log(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::log(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes base10 logarithm of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the base10 logarithm of every element.
- ***************************************************************************/
-GVector log10(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::log10(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes sine of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the sine of every element.
- ***************************************************************************/
-GVector sin(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::sin(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes sinh of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the sinh of every element.
- ***************************************************************************/
-GVector sinh(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::sinh(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes square root of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the square root of every element.
- ***************************************************************************/
-GVector sqrt(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::sqrt(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes tangens of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the tangens of every element.
- ***************************************************************************/
-GVector tan(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::tan(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes tanh of vector elements
- *
- * @param[in] vector Vector.
- * @return Vector containing the tanh of every element.
- ***************************************************************************/
-GVector tanh(const GVector& vector)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::tanh(vector.m_data[i]);
-    }
-
-    // Return vector
-    return result;
-}
-
-
-/***********************************************************************//**
- * @brief Computes tanh of vector elements
- *
- * @param[in] vector Vector.
- * @param[in] power Power.
- * @return Vector containing the power of every element.
- ***************************************************************************/
-GVector pow(const GVector& vector, const double& power)
-{
-    // Initialise result vector
-    GVector result(vector.m_num);
-
-    // Evaluate each vector element
-    for (int i = 0; i < vector.m_num; ++i) {
-        result.m_data[i] = std::pow(vector.m_data[i], power);
-    }
-
-    // Return vector
-    return result;
-}
@@ -0,0 +1,361 @@
+/***************************************************************************
+ *                 GVector3.cpp - Fixed-size 3-vector class                *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2013 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GVector3.cpp
+ * @brief Fixed-size 3-vector class implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+#include "GVector3.hpp"
+#include "GException.hpp"
+#include "GTools.hpp"
+
+
+/* __ Method name definitions ____________________________________________ */
+#define G_CONSTRUCTOR                             "GVector3::GVector3(GVector&)"
+
+
+/*==========================================================================
+ =                                                                         =
+ =                         Constructors/destructors                        =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Void vector constructor
+ *
+ * Constructs a null vector.
+ ***************************************************************************/
+GVector3::GVector3(void)
+{
+    // Initialise class members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Element constructor
+ *
+ * @param[in] x First vector element.
+ * @param[in] y Second vector element.
+ * @param[in] z Third vector element.
+ ***************************************************************************/
+GVector3::GVector3(const double& x, const double& y, const double& z)
+{
+    // Set elements
+    m_data[0] = x;
+    m_data[1] = y;
+    m_data[2] = z;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Vector constructor
+ *
+ * @param[in] vector Vector.
+ *
+ * @exception GException::vector_mismatch
+ *            Vector has not 3 elements.
+ ***************************************************************************/
+GVector3::GVector3(const GVector& vector)
+{
+    // Raise exception if vector has not 3 elements
+    if (vector.size() != 3) {
+        throw GException::vector_mismatch(G_CONSTRUCTOR, 3, vector.size());
+    }
+
+    // Set elements
+    m_data[0] = vector[0];
+    m_data[1] = vector[1];
+    m_data[2] = vector[2];
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy constructor
+ *
+ * @param[in] vector Vector.
+ ***************************************************************************/
+GVector3::GVector3(const GVector3& vector)
+{
+    // Copy members
+    copy_members(vector);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Destructor
+ ***************************************************************************/
+GVector3::~GVector3(void)
+{
+    // Free members
+    free_members();
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                               Operators                                 =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Equality operator
+ *
+ * @param[in] vector Vector.
+ * @return True if vectors are identical.
+ ***************************************************************************/
+bool GVector3::operator==(const GVector3& vector) const
+{
+    // Return result
+    return (m_data[0] == vector.m_data[0] &&
+            m_data[1] == vector.m_data[1] &&
+            m_data[2] == vector.m_data[2]);
+}
+
+
+/***********************************************************************//**
+ * @brief Non-equality operator
+ *
+ * @param[in] vector Vector.
+ * @return True if vectors are not identical.
+ ***************************************************************************/
+bool GVector3::operator!=(const GVector3& vector) const
+{
+    // Return result
+    return !(*this == vector);
+}
+
+
+/***********************************************************************//**
+ * @brief Assignment operator
+ *
+ * @param[in] vector Vector.
+ * @return Vector.
+ ***************************************************************************/
+GVector3& GVector3::operator=(const GVector3& vector)
+{
+    // Execute only if object is not identical
+    if (this != &vector) {
+
+        // Copy members
+        copy_members(vector);
+
+    } // endif: object was not identical
+
+    // Return this object
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Unary addition operator
+ *
+ * @param[in] vector Vector.
+ * @return Vector.
+ ***************************************************************************/
+GVector3& GVector3::operator+=(const GVector3& vector)
+{
+    // Add vector
+    m_data[0] += vector.m_data[0];
+    m_data[1] += vector.m_data[1];
+    m_data[2] += vector.m_data[2];
+
+    // Return vector
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Unary subtraction operator
+ *
+ * @param[in] vector Vector.
+ * @return Vector.
+ ***************************************************************************/
+GVector3& GVector3::operator-=(const GVector3& vector)
+{
+    // Subtract vector
+    m_data[0] -= vector.m_data[0];
+    m_data[1] -= vector.m_data[1];
+    m_data[2] -= vector.m_data[2];
+
+    // Return vector
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Scalar multiplication operator
+ *
+ * @param[in] scalar Scalar.
+ * @return Vector.
+ ***************************************************************************/
+GVector3& GVector3::operator*=(const double& scalar)
+{
+    // Multiply elements
+    m_data[0] *= scalar;
+    m_data[1] *= scalar;
+    m_data[2] *= scalar;
+
+    // Return vector
+    return *this;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Public methods                              =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Clear vector
+ *
+ * Sets all vector elements to zero.
+ ***************************************************************************/
+void GVector3::clear(void)
+{
+    // Free members
+    free_members();
+
+    // Initialise private members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clone vector
+ *
+ * @return Pointer to deep copy of vector.
+ ***************************************************************************/
+GVector3* GVector3::clone(void) const
+{
+    // Clone vector
+    return new GVector3(*this);
+}
+
+
+/***********************************************************************//**
+ * @brief Return vector as GVector
+ *
+ * @return Vector with 3 elements.
+ ***************************************************************************/
+GVector GVector3::vector(void) const
+{
+    // Return vector
+    return (GVector(m_data[0], m_data[1], m_data[2]));
+}
+
+
+/***********************************************************************//**
+ * @brief Print vector information
+ *
+ * @param[in] chatter Chattiness (defaults to NORMAL).
+ * @return String containing vector information.
+ ***************************************************************************/
+std::string GVector3::print(const GChatter& chatter) const
+{
+    // Initialise result string
+    std::string result;
+
+    // Continue only if chatter is not silent
+    if (chatter != SILENT) {
+
+        // Put all elements in string
+        result = "(" + gammalib::str(m_data[0]) + ", " +
+                       gammalib::str(m_data[1]) + ", " +
+                       gammalib::str(m_data[2]) + ")";
+
+    } // endif: chatter was not silent
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Private methods                             =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GVector3::init_members(void)
+{
+    // Initialise members
+    m_data[0] = 0.0;
+    m_data[1] = 0.0;
+    m_data[2] = 0.0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] vector Vector.
+ ***************************************************************************/
+void GVector3::copy_members(const GVector3& vector)
+{
+    // Copy members
+    m_data[0] = vector.m_data[0];
+    m_data[1] = vector.m_data[1];
+    m_data[2] = vector.m_data[2];
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GVector3::free_members(void)
+{
+    // Return
+    return;
+}
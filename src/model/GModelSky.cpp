@@ -51,6 +51,8 @@ const GModelRegistry    g_diffusesource_registry(&g_diffusesource_seed);
 
 /* __ Method name definitions ____________________________________________ */
 #define G_NPRED           "GModelSky::npred(GEnergy&, GTime&, GObservation&)"
+#define G_NPRED_GRADIENTS                "GModelSky::npred_gradients(GEnergy&,"\
+                                                    " GTime&, GObservation&)"
 #define G_XML_SPATIAL                  "GModelSky::xml_spatial(GXmlElement&)"
 #define G_XML_SPECTRAL                "GModelSky::xml_spectral(GXmlElement&)"
 #define G_XML_TEMPORAL                "GModelSky::xml_temporal(GXmlElement&)"
@@ -610,6 +612,90 @@ double GModelSky::npred(const GEnergy& obsEng, const GTime& obsTime,
 }
 
 
+/***********************************************************************//**
+ * @brief Return spatially integrated sky model and parameter gradients
+ *
+ * @param[in] obsEng Measured photon energy.
+ * @param[in] obsTime Measured photon arrival time.
+ * @param[in] obs Observation.
+ * @return Spatially integrated sky model.
+ *
+ * @exception GException::no_response
+ *            No valid instrument response function defined.
+ *
+ * Computes the same quantity as npred(), and in addition sets the
+ * gradients of the spectral and temporal model parameters as GModelPar
+ * members. The gradients are the derivatives of the spatially integrated
+ * sky model with respect to the parameters, hence they include the
+ * spatial response integral, the other model components and any
+ * instrument dependent scale factor. They can be integrated over energy
+ * and time in the same way as the model value.
+ *
+ * Spatial model parameters are not affected by this method since the
+ * spatial response integral has no analytical parameter derivatives.
+ ***************************************************************************/
+double GModelSky::npred_gradients(const GEnergy&      obsEng,
+                                  const GTime&        obsTime,
+                                  const GObservation& obs) const
+{
+    // Initialise result
+    double npred = 0.0;
+
+    // Continue only if model is valid)
+    if (valid_model()) {
+
+        // Get response function
+        GResponse* rsp = obs.response();
+        if (rsp == NULL) {
+            throw GException::no_response(G_NPRED_GRADIENTS);
+        }
+
+        // Here we make the simplifying approximations
+        // srcEng=obsEng and srcTime=obsTime (see npred())
+        GEnergy srcEng  = obsEng;
+        GTime   srcTime = obsTime;
+
+        // Set source
+        GSource source(this->name(), m_spatial, srcEng, srcTime);
+
+        // Compute response components
+        double npred_spatial  = rsp->npred(source, obs);
+        double npred_spectral = spectral()->eval_gradients(srcEng, srcTime);
+        double npred_temporal = temporal()->eval_gradients(srcTime);
+
+        // Compute response
+        npred = npred_spatial * npred_spectral * npred_temporal;
+
+        // If required, apply instrument specific model scaling
+        double npred_scale = 1.0;
+        if (!m_scales.empty()) {
+            npred_scale = scale(obs.instrument()).value();
+            npred      *= npred_scale;
+        }
+
+        // Multiply factors to spectral gradients
+        double fact = npred_spatial * npred_temporal * npred_scale;
+        if (fact != 1.0) {
+            for (int i = 0; i < spectral()->size(); ++i) {
+                (*spectral())[i].factor_gradient((*spectral())[i].factor_gradient() * fact);
+            }
+        }
+
+        // Multiply factors to temporal gradients
+        fact = npred_spatial * npred_spectral * npred_scale;
+        if (fact != 1.0) {
+            for (int i = 0; i < temporal()->size(); ++i) {
+                (*temporal())[i].factor_gradient((*temporal())[i].factor_gradient() * fact);
+            }
+        }
+
+    } // endif: model was valid
+
+    // Return npred
+    return npred;
+}
+
+
 /***********************************************************************//**
  * @brief Read sky model from XML element
  *
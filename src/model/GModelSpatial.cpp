@@ -275,6 +275,7 @@ void GModelSpatial::init_members(void)
 {
     // Initialise members
     m_pars.clear();
+    m_instance = new_instance();
 
     // Return
     return;
@@ -304,3 +305,29 @@ void GModelSpatial::free_members(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Return new instance identifier
+ *
+ * @return New instance identifier.
+ *
+ * Returns a new unique instance identifier. The identifier counter is
+ * incremented within a critical zone as spatial models may be constructed
+ * by several threads at the same time.
+ ***************************************************************************/
+unsigned long GModelSpatial::new_instance(void)
+{
+    // Identifier counter
+    static unsigned long last_instance = 0;
+
+    // Get new identifier
+    unsigned long instance;
+    #pragma omp critical(GModelSpatial_new_instance)
+    {
+        instance = ++last_instance;
+    }
+
+    // Return identifier
+    return instance;
+}
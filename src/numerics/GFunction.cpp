@@ -124,6 +124,29 @@ GFunction& GFunction::operator= (const GFunction& func)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Evaluate function for an array of values
+ *
+ * @param[in] x Array of n function arguments.
+ * @param[out] y Array of n function values.
+ * @param[in] n Number of function arguments.
+ *
+ * Evaluates the function for n arguments by calling eval(x) for each of
+ * them. Derived classes may override this method by a more efficient
+ * implementation.
+ ***************************************************************************/
+void GFunction::eval(const double* x, double* y, int n)
+{
+    // Evaluate function for all arguments
+    for (int i = 0; i < n; ++i) {
+        y[i] = eval(x[i]);
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -27,17 +27,79 @@
 /* __ Includes ___________________________________________________________ */
 #include <cmath>            // For std::abs()
 #include <vector>
+#include <limits>           // For std::numeric_limits
 #include "GIntegral.hpp"
 #include "GTools.hpp"
+#include "GException.hpp"
 
 /* __ Method name definitions ____________________________________________ */
+#define G_GAUSS_LEGENDRE         "GIntegral::gauss_legendre(double,double,int)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_GK_MAX_INTERVALS       64   //!< Maximum number of GK intervals
+#define G_EVAL_BATCH             64   //!< Abscissae per batch evaluation
 
 /* __ Debug definitions __________________________________________________ */
 
+/* __ Constants __________________________________________________________ */
+// Abscissae and weights of the 15-point Kronrod rule and of the embedded
+// 7-point Gauss rule (QUADPACK qk15). The Gauss abscissae are the odd
+// Kronrod abscissae.
+const double gk15_x[8] = {0.991455371120812639206854697526329,
+                          0.949107912342758524526189684047851,
+                          0.864864423359769072789712788640926,
+                          0.741531185599394439863864773280788,
+                          0.586087235467691130294144845693013,
+                          0.405845151377397166906606412076961,
+                          0.207784955007898467600689403773245,
+                          0.000000000000000000000000000000000};
+const double gk15_wk[8] = {0.022935322010529224963732008058970,
+                           0.063092092629978553290700663189204,
+                           0.104790010322250183839876322541518,
+                           0.140653259715525918745189590510238,
+                           0.169004726639267902826583426598550,
+                           0.190350578064785409913256402421014,
+                           0.204432940075298892414161999234649,
+                           0.209482141084727828012999174891714};
+const double gk15_wg[4] = {0.129484966168869693270611432679082,
+                           0.279705391489276667901467771423780,
+                           0.381830050505118944950369775488975,
+                           0.417959183673469387755102040816327};
+
+// Positive abscissae and weights of the Gauss-Legendre rules
+const double gl4_x[2] = {8.6113631159405257e-01, 3.3998104358485626e-01};
+const double gl4_w[2] = {3.4785484513745385e-01, 6.5214515486254609e-01};
+const double gl8_x[4] = {9.6028985649753629e-01, 7.9666647741362673e-01,
+                         5.2553240991632899e-01, 1.8343464249564981e-01};
+const double gl8_w[4] = {1.0122853629037626e-01, 2.2238103445337448e-01,
+                         3.1370664587788727e-01, 3.6268378337836199e-01};
+const double gl16_x[8] = {9.8940093499164994e-01, 9.4457502307323260e-01,
+                          8.6563120238783176e-01, 7.5540440835500300e-01,
+                          6.1787624440264377e-01, 4.5801677765722737e-01,
+                          2.8160355077925892e-01, 9.5012509837637441e-02};
+const double gl16_w[8] = {2.7152459411754096e-02, 6.2253523938647894e-02,
+                          9.5158511682492786e-02, 1.2462897125553388e-01,
+                          1.4959598881657674e-01, 1.6915651939500254e-01,
+                          1.8260341504492358e-01, 1.8945061045506850e-01};
+const double gl32_x[16] = {9.9726386184948157e-01, 9.8561151154526838e-01,
+                           9.6476225558750639e-01, 9.3490607593773967e-01,
+                           8.9632115576605209e-01, 8.4936761373256997e-01,
+                           7.9448379596794239e-01, 7.3218211874028971e-01,
+                           6.6304426693021523e-01, 5.8771575724076230e-01,
+                           5.0689990893222936e-01, 4.2135127613063533e-01,
+                           3.3186860228212767e-01, 2.3928736225213706e-01,
+                           1.4447196158279649e-01, 4.8307665687738317e-02};
+const double gl32_w[16] = {7.0186100094700964e-03, 1.6274394730905670e-02,
+                           2.5392065309262059e-02, 3.4273862913021431e-02,
+                           4.2835898022226683e-02, 5.0998059262376175e-02,
+                           5.8684093478535544e-02, 6.5822222776361849e-02,
+                           7.2345794108848505e-02, 7.8193895787070311e-02,
+                           8.3311924226946749e-02, 8.7652093004403811e-02,
+                           9.1173878695763891e-02, 9.3844399080804566e-02,
+                           9.5638720079274861e-02, 9.6540088514727798e-02};
+
 
 /*==========================================================================
  =                                                                         =
@@ -79,6 +141,28 @@ GIntegral::GIntegral(GFunction* kernel)
 }
 
 
+/***********************************************************************//**
+ * @brief Vector function kernel constructor
+ *
+ * @param[in] kernels Pointer to vector function kernel.
+ *
+ * The vector function kernel constructor assigns the vector function
+ * kernel pointer in constructing the object. The kernel is integrated
+ * using romb_vector().
+ ***************************************************************************/
+GIntegral::GIntegral(GFunctions* kernels)
+{
+    // Initialise members
+    init_members();
+
+    // Set vector function kernel
+    m_kernels = kernels;
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Copy constructor
  *
@@ -195,6 +279,9 @@ double GIntegral::romb(double a, double b, int k)
 {
     // Initialise result
     double result = 0.0;
+
+    // Initialise number of function evaluations
+    m_calls = 0;
     
     // Continue only if integration range is valid
     if (b > a) {
@@ -269,6 +356,103 @@ double GIntegral::romb(double a, double b, int k)
 }
 
 
+/***********************************************************************//**
+ * @brief Perform Romberg integration of a vector function kernel
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] k Integration order (default: k=5)
+ * @return Integrals of all kernel functions.
+ *
+ * Returns the integrals of all functions of the vector function kernel
+ * from a to b, using the same Romberg scheme as romb(). All functions are
+ * integrated with the same nodes, hence the kernel is evaluated only once
+ * per node. The integration is considered as converged when the error
+ * estimate of every function is smaller than m_eps times the norm of the
+ * vector of integrals. Scaling the tolerance by the norm avoids that
+ * functions which integrate to about zero prevent convergence.
+ ***************************************************************************/
+GVector GIntegral::romb_vector(double a, double b, int k)
+{
+    // Get number of kernel functions
+    int n = m_kernels->size();
+
+    // Initialise result
+    GVector result(n);
+
+    // Initialise number of function evaluations
+    m_calls = 0;
+
+    // Continue only if integration range is valid
+    if (b > a) {
+
+        // Initialise variables
+        bool    converged = false;
+        GVector ss(n);
+        GVector dss(n);
+
+        // Allocate temporal storage
+        std::vector<GVector> s(m_max_iter+2, GVector(n));
+        std::vector<double>  h(m_max_iter+2, 0.0);
+        std::vector<double>  y(k+1, 0.0);
+
+        // Initialise step size
+        h[1] = 1.0;
+
+        // Iterative loop
+        for (m_iter = 1; m_iter <= m_max_iter; ++m_iter) {
+
+            // Integration using Trapezoid rule
+            s[m_iter] = trapzd_vector(a, b, m_iter, s[m_iter-1]);
+
+            // Starting from iteration k on, use polynomial interpolation
+            // for all functions and check for convergence
+            if (m_iter >= k) {
+                for (int i = 0; i < n; ++i) {
+                    for (int j = 1; j <= k; ++j) {
+                        y[j] = s[m_iter-k+j][i];
+                    }
+                    ss[i] = polint(&h[m_iter-k], &y[0], k, 0.0, &dss[i]);
+                }
+                double tol = m_eps * norm(ss);
+                converged  = true;
+                for (int i = 0; i < n; ++i) {
+                    if (std::abs(dss[i]) > tol) {
+                        converged = false;
+                        break;
+                    }
+                }
+                if (converged) {
+                    result = ss;
+                    break;
+                }
+            }
+
+            // Reduce step size
+            h[m_iter+1]= 0.25 * h[m_iter];
+
+        } // endfor: iterative loop
+
+        // Dump warning
+        if (!m_silent) {
+            if (!converged) {
+                std::cout << "*** WARNING: GIntegral::romb_vector: ";
+                std::cout << "Integration did not converge ";
+                std::cout << "(iter=" << m_iter;
+                std::cout << ", result=" << ss;
+                std::cout << ", d=" << dss;
+                std::cout << " > " << m_eps * norm(ss) << ")";
+                std::cout << std::endl;
+            }
+        }
+
+    } // endif: integration range was valid
+
+    // Return result
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Perform Trapezoidal integration
  *
@@ -296,11 +480,13 @@ double GIntegral::trapzd(double a, double b, int n, double result)
         if (n == 1) {
         
             // Evaluate integrand at boundaries
-            double y_a = m_kernel->eval(a);
-            double y_b = m_kernel->eval(b);
+            double x[2] = {a, b};
+            double y[2];
+            m_kernel->eval(x, y, 2);
+            m_calls += 2;
             
             // Compute result
-            result = 0.5*(b-a)*(y_a + y_b);
+            result = 0.5*(b-a)*(y[0] + y[1]);
             
         } // endif: only a single step was requested
 
@@ -335,18 +521,29 @@ double GIntegral::trapzd(double a, double b, int n, double result)
                 std::cout << std::endl;
             }
 
-            // Sum up values
-            double x   = a + 0.5*del;
+            // Sum up values. The integrand is evaluated in batches of
+            // abscissae.
+            double x[G_EVAL_BATCH];
+            double y[G_EVAL_BATCH];
             double sum = 0.0;
-            for (int j = 0; j < it; ++j, x+=del) {
-                
+            for (int j = 0; j < it; j += G_EVAL_BATCH) {
+
+                // Set abscissae of batch
+                int num = (it - j < G_EVAL_BATCH) ? it - j : G_EVAL_BATCH;
+                for (int i = 0; i < num; ++i) {
+                    x[i] = a + (j + i + 0.5) * del;
+                }
+
                 // Evaluate integrand
-                double y = m_kernel->eval(x);
+                m_kernel->eval(x, y, num);
 
                 // Add integrand
-                sum += y;
+                for (int i = 0; i < num; ++i) {
+                    sum += y[i];
+                }
                 
             } // endfor: looped over steps
+            m_calls += it;
 
             // Set result
             result = 0.5*(result + (b-a)*sum/tnm);
@@ -359,6 +556,204 @@ double GIntegral::trapzd(double a, double b, int n, double result)
 }
 
 
+/***********************************************************************//**
+ * @brief Perform adaptive Gauss-Kronrod integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @return Integral of the kernel from a to b.
+ *
+ * Returns the integral of the integrand from a to b using globally adaptive
+ * 15-point Gauss-Kronrod quadrature. The interval with the largest error
+ * estimate is bisected until the summed error estimate drops below m_eps
+ * times the absolute value of the integral. Subdivision also stops if the
+ * next bisection would exceed the evaluation budget m_max_calls, or if the
+ * fixed number of G_GK_MAX_INTERVALS intervals has been reached. All
+ * interval information is kept on the stack.
+ *
+ * Since the rule does not evaluate the integrand at the interval
+ * boundaries and converges quickly for smooth integrands, also very small
+ * integration intervals are handled without special treatment.
+ *
+ * On return, iter() gives the number of intervals that were used and
+ * calls() the number of integrand evaluations.
+ ***************************************************************************/
+double GIntegral::gauss_kronrod(double a, double b)
+{
+    // Initialise result
+    double result = 0.0;
+
+    // Initialise number of iterations and function evaluations
+    m_iter  = 0;
+    m_calls = 0;
+
+    // Continue only if integration range is valid
+    if (b > a) {
+
+        // Allocate interval workspace
+        double lower[G_GK_MAX_INTERVALS];
+        double upper[G_GK_MAX_INTERVALS];
+        double value[G_GK_MAX_INTERVALS];
+        double error[G_GK_MAX_INTERVALS];
+
+        // Integrate over full interval
+        lower[0] = a;
+        upper[0] = b;
+        value[0] = gk15(a, b, &error[0]);
+        m_iter   = 1;
+        result   = value[0];
+
+        // Initialise total error
+        double total_error = error[0];
+
+        // Bisect interval with largest error until convergence
+        while (total_error > m_eps * std::abs(result) &&
+               m_iter      < G_GK_MAX_INTERVALS      &&
+               m_calls + 30 <= m_max_calls) {
+
+            // Find interval with largest error
+            int imax = 0;
+            for (int i = 1; i < m_iter; ++i) {
+                if (error[i] > error[imax]) {
+                    imax = i;
+                }
+            }
+
+            // Bisect interval
+            double a1 = lower[imax];
+            double b2 = upper[imax];
+            double m  = 0.5 * (a1 + b2);
+
+            // Stop if the interval can no longer be bisected
+            if (m <= a1 || m >= b2) {
+                break;
+            }
+
+            // Integrate both halves
+            double error1;
+            double error2;
+            double value1 = gk15(a1, m,  &error1);
+            double value2 = gk15(m,  b2, &error2);
+
+            // Store left half in place of the bisected interval and right
+            // half as new interval
+            upper[imax]     = m;
+            value[imax]     = value1;
+            error[imax]     = error1;
+            lower[m_iter]   = m;
+            upper[m_iter]   = b2;
+            value[m_iter]   = value2;
+            error[m_iter]   = error2;
+            m_iter++;
+
+            // Sum up integral and error
+            result      = 0.0;
+            total_error = 0.0;
+            for (int i = 0; i < m_iter; ++i) {
+                result      += value[i];
+                total_error += error[i];
+            }
+
+        } // endwhile: bisected intervals
+
+        // Dump warning
+        if (!m_silent) {
+            if (total_error > m_eps * std::abs(result)) {
+                std::cout << "*** WARNING: GIntegral::gauss_kronrod: ";
+                std::cout << "Integration did not converge ";
+                std::cout << "(intervals=" << m_iter;
+                std::cout << ", calls=" << m_calls;
+                std::cout << ", result=" << result;
+                std::cout << ", d=" << total_error;
+                std::cout << " > " << m_eps * std::abs(result) << ")";
+                std::cout << std::endl;
+            }
+        }
+
+    } // endif: integration range was valid
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform fixed-order Gauss-Legendre integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] n Number of abscissae (4, 8, 16 or 32; default: n=16).
+ * @return Integral of the kernel from a to b.
+ *
+ * @exception GException::invalid_argument
+ *            Unsupported number of abscissae.
+ *
+ * Returns the integral of the integrand from a to b using an n-point
+ * Gauss-Legendre rule. The rule is exact for polynomials up to degree
+ * 2n-1 and requires exactly n integrand evaluations. No error estimate is
+ * computed, hence the method is suited for smooth integrands for which
+ * the required order is known.
+ ***************************************************************************/
+double GIntegral::gauss_legendre(double a, double b, int n)
+{
+    // Select abscissae and weights
+    const double* x = NULL;
+    const double* w = NULL;
+    switch (n) {
+    case 4:
+        x = gl4_x;
+        w = gl4_w;
+        break;
+    case 8:
+        x = gl8_x;
+        w = gl8_w;
+        break;
+    case 16:
+        x = gl16_x;
+        w = gl16_w;
+        break;
+    case 32:
+        x = gl32_x;
+        w = gl32_w;
+        break;
+    default:
+        throw GException::invalid_argument(G_GAUSS_LEGENDRE,
+              "Number of abscissae "+gammalib::str(n)+" not supported. "
+              "Specify 4, 8, 16 or 32.");
+        break;
+    }
+
+    // Compute half length and centre of interval
+    double half   = 0.5 * (b - a);
+    double centre = 0.5 * (b + a);
+
+    // Set symmetric pairs of abscissae
+    int    m = n/2;
+    double xa[32];
+    double ya[32];
+    for (int i = 0; i < m; ++i) {
+        double dx = half * x[i];
+        xa[i]     = centre - dx;
+        xa[i+m]   = centre + dx;
+    }
+
+    // Evaluate integrand
+    m_kernel->eval(xa, ya, n);
+
+    // Sum up symmetric pairs of abscissae
+    double sum = 0.0;
+    for (int i = 0; i < m; ++i) {
+        sum += w[i] * (ya[i] + ya[i+m]);
+    }
+
+    // Set number of function evaluations
+    m_calls = n;
+
+    // Return result
+    return sum * half;
+}
+
+
 /***********************************************************************//**
  * @brief Print integral information
  *
@@ -381,6 +776,8 @@ std::string GIntegral::print(const GChatter& chatter) const
         result.append(gammalib::str(eps()));
         result.append("\n"+gammalib::parformat("Max. number of iterations"));
         result.append(gammalib::str(max_iter()));
+        result.append("\n"+gammalib::parformat("Max. number of evaluations"));
+        result.append(gammalib::str(max_calls()));
         if (silent()) {
             result.append("\n"+gammalib::parformat("Warnings")+"suppressed");
         }
@@ -409,9 +806,12 @@ void GIntegral::init_members(void)
 {
     // Initialise members
     m_kernel    = NULL;
+    m_kernels   = NULL;
     m_eps       = 1.0e-6;
     m_max_iter  = 20;
     m_iter      = 0;
+    m_max_calls = 15 * G_GK_MAX_INTERVALS;
+    m_calls     = 0;
     m_silent    = false;
 
     // Return
@@ -427,11 +827,14 @@ void GIntegral::init_members(void)
 void GIntegral::copy_members(const GIntegral& integral)
 {
     // Copy attributes
-    m_kernel   = integral.m_kernel;
-    m_eps      = integral.m_eps;
-    m_max_iter = integral.m_max_iter;
-    m_iter     = integral.m_iter;
-    m_silent   = integral.m_silent;
+    m_kernel    = integral.m_kernel;
+    m_kernels   = integral.m_kernels;
+    m_eps       = integral.m_eps;
+    m_max_iter  = integral.m_max_iter;
+    m_iter      = integral.m_iter;
+    m_max_calls = integral.m_max_calls;
+    m_calls     = integral.m_calls;
+    m_silent    = integral.m_silent;
 
     // Return
     return;
@@ -522,3 +925,152 @@ double GIntegral::polint(double* xa, double* ya, int n, double x, double *dy)
     // Return
     return y;
 }
+
+
+/***********************************************************************//**
+ * @brief Perform Trapezoidal integration of a vector function kernel
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] n Number of steps.
+ * @param[in] result Result from a previous trapezoidal integration step.
+ * @return Refined trapezoidal integration result.
+ *
+ * Implements trapzd() for the vector function kernel.
+ ***************************************************************************/
+GVector GIntegral::trapzd_vector(double a, double b, int n,
+                                 const GVector& result)
+{
+    // Initialise refined result
+    GVector refined(result.size());
+
+    // Continue only if boundaries differ
+    if (a != b) {
+
+        // Case A: Only a single step is requested
+        if (n == 1) {
+
+            // Evaluate integrand at boundaries
+            GVector y_a = m_kernels->eval(a);
+            GVector y_b = m_kernels->eval(b);
+            m_calls += 2;
+
+            // Compute result
+            refined = 0.5*(b-a)*(y_a + y_b);
+
+        } // endif: only a single step was requested
+
+        // Case B: More than a single step is requested
+        else {
+
+            // Compute step level 2^(n-1)
+            int it = 1;
+            for (int j = 1; j < n-1; ++j) {
+                it <<= 1;
+            }
+
+            // Set step size
+            double tnm = double(it);
+            double del = (b-a)/tnm;
+
+            // Sum up values
+            double  x = a + 0.5*del;
+            GVector sum(result.size());
+            for (int j = 0; j < it; ++j, x+=del) {
+                sum += m_kernels->eval(x);
+            }
+            m_calls += it;
+
+            // Set result
+            refined = 0.5*(result + (b-a)*sum/tnm);
+
+        } // endelse: more than a single step was requested
+
+    } // endif: boundaries differed
+
+    // Return refined result
+    return refined;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform 15-point Gauss-Kronrod integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[out] error Absolute error estimate.
+ * @return Integral of the kernel from a to b.
+ *
+ * Computes the integral using the 15-point Kronrod rule. The error is
+ * estimated from the difference to the embedded 7-point Gauss rule,
+ * following the QUADPACK qk15 algorithm.
+ ***************************************************************************/
+double GIntegral::gk15(double a, double b, double* error)
+{
+    // Compute half length and centre of interval
+    double half   = 0.5 * (b - a);
+    double centre = 0.5 * (b + a);
+
+    // Evaluate integrand at the centre and at the symmetric pairs of
+    // abscissae
+    double x[15];
+    double y[15];
+    for (int j = 0; j < 7; ++j) {
+        double dx = half * gk15_x[j];
+        x[j]      = centre - dx;
+        x[j+7]    = centre + dx;
+    }
+    x[14] = centre;
+    m_kernel->eval(x, y, 15);
+    const double* fv1 = y;
+    const double* fv2 = y + 7;
+
+    // Sum up Gauss and Kronrod rules
+    double fc     = y[14];
+    double resg   = fc * gk15_wg[3];
+    double resk   = fc * gk15_wk[7];
+    double resabs = std::abs(resk);
+    for (int j = 0; j < 7; ++j) {
+        double fs = fv1[j] + fv2[j];
+        resk     += gk15_wk[j] * fs;
+        resabs   += gk15_wk[j] * (std::abs(fv1[j]) + std::abs(fv2[j]));
+        if (j % 2 == 1) {
+            resg += gk15_wg[j/2] * fs;
+        }
+    }
+    m_calls += 15;
+
+    // Compute integral of absolute deviation from mean
+    double reskh  = resk * 0.5;
+    double resasc = gk15_wk[7] * std::abs(fc - reskh);
+    for (int j = 0; j < 7; ++j) {
+        resasc += gk15_wk[j] * (std::abs(fv1[j] - reskh) +
+                                std::abs(fv2[j] - reskh));
+    }
+
+    // Scale results to integration interval
+    double result = resk * half;
+    resabs       *= std::abs(half);
+    resasc       *= std::abs(half);
+
+    // Estimate error
+    double err = std::abs((resk - resg) * half);
+    if (resasc != 0.0 && err != 0.0) {
+        double scale = std::pow(200.0 * err / resasc, 1.5);
+        err          = (scale < 1.0) ? resasc * scale : resasc;
+    }
+    double epmach = std::numeric_limits<double>::epsilon();
+    double uflow  = std::numeric_limits<double>::min();
+    if (resabs > uflow / (50.0 * epmach)) {
+        double min_err = 50.0 * epmach * resabs;
+        if (min_err > err) {
+            err = min_err;
+        }
+    }
+
+    // Store error
+    *error = err;
+
+    // Return result
+    return result;
+}
@@ -46,9 +46,10 @@
                                                                    " GTime&)"
 #define G_NPRED_KERN            "GObservation::npred_kern(GModel&, GSkyDir&,"\
                                              " GEnergy&, GTime&, GPointing&)"
-#define G_NPRED_GRAD_TEMP       "GObservation::npred_grad_temp(GModel&, int)"
-#define G_NPRED_GRAD_SPEC       "GObservation::npred_grad_spec(GModel&, int,"\
-                                                                   " GTime&)"
+#define G_NPRED_GRAD_TEMP  "GObservation::npred_grad_temp(GModelSky&, "\
+                                                        "std::vector<int>&)"
+#define G_NPRED_GRAD_SPEC  "GObservation::npred_grad_spec(GModelSky&, "\
+                                                "std::vector<int>&, GTime&)"
 #define G_NPRED_GRAD_SPAT       "GObservation::npred_grad_spat(GModel&, int,"\
                                                          " GEnergy&, GTime&)"
 #define G_NPRED_GRAD_KERN       "GObservation::npred_grad_kern(GModel&, int,"\
@@ -250,6 +251,11 @@ double GObservation::model(const GModels& models, const GEvent& event,
  * The method will only operate on models for which the list of instruments
  * and observation identifiers matches those of the observation. Models that
  * do not match will be skipped.
+ *
+ * For sky models, Npred and the gradients of all free spectral and temporal
+ * parameters that provide analytical gradients are computed in a single
+ * integration pass using npred_grad_temp(). Gradients of all other free
+ * parameters are computed numerically using npred_grad().
  ***************************************************************************/
 double GObservation::npred(const GModels& models, GVector* gradient) const
 {
@@ -284,15 +290,60 @@ double GObservation::npred(const GModels& models, GVector* gradient) const
             // observation identifier
             if (mptr->isvalid(instrument(), id())) {
 
-                // Determine Npred for model
-                npred += npred_temp(*mptr);
+                // Get sky model pointer if gradients are requested
+                const GModelSky* sky = (gradient != NULL)
+                                       ? dynamic_cast<const GModelSky*>(mptr)
+                                       : NULL;
+
+                // Case A: Sky model gradients are requested. Determine Npred
+                // and analytical gradients in one integration pass, and
+                // compute the remaining gradients numerically
+                if (sky != NULL) {
+
+                    // Collect free spectral and temporal parameters that
+                    // have analytical gradients
+                    int               nspat = (sky->spatial() != NULL)
+                                              ? sky->spatial()->size() : 0;
+                    std::vector<int>  ipars;
+                    std::vector<bool> analytic(mptr->size(), false);
+                    for (int k = nspat; k < mptr->size(); ++k) {
+                        if ((*mptr)[k].isfree() && (*mptr)[k].hasgrad()) {
+                            ipars.push_back(k);
+                            analytic[k] = true;
+                        }
+                    }
 
-                // Optionally determine Npred gradients
-                if (gradient != NULL) {
+                    // Determine Npred and analytical gradients
+                    GVector values = npred_grad_temp(*sky, ipars);
+                    npred += values[0];
+                    int nipars = ipars.size();
+                    for (int k = 0; k < nipars; ++k) {
+                        (*gradient)[igrad+ipars[k]] = values[k+1];
+                    }
+
+                    // Determine numerical gradients
                     for (int k = 0; k < mptr->size(); ++k) {
-                        (*gradient)[igrad+k] = npred_grad(*mptr, k);
+                        if (!analytic[k]) {
+                            (*gradient)[igrad+k] = npred_grad(*mptr, k);
+                        }
                     }
-                }
+
+                } // endif: sky model gradients were requested
+
+                // Case B: Determine Npred and optionally numerical gradients
+                else {
+
+                    // Determine Npred for model
+                    npred += npred_temp(*mptr);
+
+                    // Optionally determine Npred gradients
+                    if (gradient != NULL) {
+                        for (int k = 0; k < mptr->size(); ++k) {
+                            (*gradient)[igrad+k] = npred_grad(*mptr, k);
+                        }
+                    }
+
+                } // endelse: no sky model gradients were requested
 
             } // endif: model component was valid for instrument
 
@@ -308,6 +359,24 @@ double GObservation::npred(const GModels& models, GVector* gradient) const
 }
 
 
+/***********************************************************************//**
+ * @brief Prepare observation for model evaluation
+ *
+ * @param[in] models Models.
+ *
+ * Prepares the observation for the evaluation of the @p models. The method
+ * is called before the models are fitted to the observation, outside of
+ * any parallel region. Derived classes may implement the method to set up
+ * model dependent data that would otherwise be computed on first use
+ * during the likelihood evaluation. The base class method does nothing.
+ ***************************************************************************/
+void GObservation::prepare(const GModels&)
+{
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Set observation name
  *
@@ -996,3 +1065,180 @@ double GObservation::npred_spec_kern::eval(double x)
     // Return value
     return value;
 }
+
+
+/***********************************************************************//**
+ * @brief Temporally integrates Npred and analytical parameter gradients
+ *
+ * @param[in] model Sky model.
+ * @param[in] ipars Indices of model parameters with analytical gradients.
+ * @return Vector of Npred (element 0) and gradients (elements 1,...).
+ *
+ * @exception GException::gti_invalid
+ *            Good Time Interval is invalid.
+ *
+ * Computes the same integral as npred_temp(), but integrates in addition
+ * the parameter gradients that are returned by
+ * GModelSky::npred_gradients() for all parameters with indices @p ipars.
+ * The integration is done in a single pass, so that the expensive
+ * response integration is only performed once for Npred and all gradients.
+ * The Npred value is identical to the one returned by npred_temp().
+ ***************************************************************************/
+GVector GObservation::npred_grad_temp(const GModelSky&        model,
+                                      const std::vector<int>& ipars) const
+{
+    // Set dimension of result vector
+    int n = ipars.size() + 1;
+
+    // Initialise result
+    GVector result(n);
+
+    // Case A: If the model is constant then integrate analytically
+    if (model.temporal()->type() == "Constant") {
+
+        // Evaluate model at first start time and multiply by ontime
+        double ontime = events()->gti().ontime();
+
+        // Integrate only if ontime is positive
+        if (ontime > 0.0) {
+
+            // Integration is a simple multiplication by the time
+            result = npred_grad_spec(model, ipars, events()->gti().tstart()) *
+                     ontime;
+
+        }
+
+    } // endif: model was constant
+
+    // ... otherwise integrate temporally
+    else {
+
+        // Loop over GTIs
+        for (int i = 0; i < events()->gti().size(); ++i) {
+
+            // Set integration interval in seconds
+            double tstart = events()->gti().tstart(i).secs();
+            double tstop  = events()->gti().tstop(i).secs();
+
+            // Throw exception if time interval is not valid
+            if (tstop <= tstart) {
+                throw GException::gti_invalid(G_NPRED_GRAD_TEMP,
+                                              events()->gti().tstart(i),
+                                              events()->gti().tstop(i));
+            }
+
+            // Setup integration function
+            GObservation::npred_grad_temp_kern integrand(this, &model, &ipars);
+            GIntegral                          integral(&integrand);
+
+            // Do Romberg integration
+            result += integral.romb_vector(tstart, tstop);
+
+        } // endfor: looped over GTIs
+
+    } // endelse: integrated temporally
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Integration kernel for npred_grad_temp() method
+ *
+ * @param[in] x Function value.
+ ***************************************************************************/
+GVector GObservation::npred_grad_temp_kern::eval(double x)
+{
+    // Convert argument in native reference in seconds
+    GTime time;
+    time.secs(x);
+
+    // Return value
+    return (m_parent->npred_grad_spec(*m_model, *m_ipars, time));
+}
+
+
+/***********************************************************************//**
+ * @brief Spectrally integrates Npred and analytical parameter gradients
+ *
+ * @param[in] model Sky model.
+ * @param[in] ipars Indices of model parameters with analytical gradients.
+ * @param[in] obsTime Measured photon arrival time.
+ * @return Vector of Npred (element 0) and gradients (elements 1,...).
+ *
+ * @exception GException::erange_invalid
+ *            Energy range is invalid.
+ *
+ * Computes the same integral as npred_spec(), but integrates in addition
+ * the parameter gradients with indices @p ipars.
+ ***************************************************************************/
+GVector GObservation::npred_grad_spec(const GModelSky&        model,
+                                      const std::vector<int>& ipars,
+                                      const GTime&            obsTime) const
+{
+    // Set integration energy interval in MeV
+    double emin = events()->ebounds().emin().MeV();
+    double emax = events()->ebounds().emax().MeV();
+
+    // Throw exception if energy range is not valid
+    if (emax <= emin) {
+        throw GException::erange_invalid(G_NPRED_GRAD_SPEC, emin, emax);
+    }
+
+    // Setup integration function
+    GObservation::npred_grad_spec_kern integrand(this, &model, &ipars,
+                                                 &obsTime);
+    GIntegral                          integral(&integrand);
+
+    // Set integration precision
+    integral.eps(1.0e-5);
+
+    // Do Romberg integration
+    #if defined(G_LN_ENERGY_INT)
+    emin = log(emin);
+    emax = log(emax);
+    #endif
+    GVector result = integral.romb_vector(emin, emax);
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Integration kernel for npred_grad_spec() method
+ *
+ * @param[in] x Function value.
+ *
+ * Returns a vector that holds the spatially integrated sky model in the
+ * first element, followed by the parameter gradients. If G_LN_ENERGY_INT
+ * is defined the energy integration is done logarithmically.
+ ***************************************************************************/
+GVector GObservation::npred_grad_spec_kern::eval(double x)
+{
+    #if defined(G_LN_ENERGY_INT)
+    // Variable substitution
+    x = exp(x);
+    #endif
+
+    // Set energy in MeV
+    GEnergy eng;
+    eng.MeV(x);
+
+    // Get function value and parameter gradients
+    int     npars = m_ipars->size();
+    GVector values(npars+1);
+    values[0] = m_model->npred_gradients(eng, *m_time, *m_parent);
+    for (int i = 0; i < npars; ++i) {
+        values[i+1] = (*m_model)[(*m_ipars)[i]].factor_gradient();
+    }
+
+    #if defined(G_LN_ENERGY_INT)
+    // Correct for variable substitution
+    values *= x;
+    #endif
+
+    // Return values
+    return values;
+}
@@ -703,10 +703,16 @@ void GObservations::models(const std::string& filename)
  * @param[in] opt Optimizer.
  *
  * Optimizes the free parameters of the models by using the optimizer
- * that has been provided by the @p opt argument.
+ * that has been provided by the @p opt argument. All observations are
+ * prepared for the evaluation of the models before the optimization.
  ***************************************************************************/
 void GObservations::optimize(GOptimizer& opt)
 {
+    // Prepare observations for model evaluation
+    for (int i = 0; i < size(); ++i) {
+        m_obs[i]->prepare(m_models);
+    }
+
     // Optimize model parameters
     opt.optimize(m_fct, m_models);
 
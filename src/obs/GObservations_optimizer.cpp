@@ -34,6 +34,7 @@
 #include "GEventList.hpp"
 #include "GEventCube.hpp"
 #include "GEventBin.hpp"
+#include "GMatrixSymmetric.hpp"
 
 /* __ OpenMP section _____________________________________________________ */
 #ifdef _OPENMP
@@ -42,10 +43,20 @@
 
 /* __ Method name definitions ____________________________________________ */
 #define G_EVAL              "GObservations::optimizer::eval(GOptimizerPars&)"
+#define G_POISSON_UNBINNED  "GObservations::optimizer::poisson_unbinned("\
+        "GObservation&, GOptimizerPars&, GMatrixBase&, GVector&, double&,"\
+                                                                " GVector&)"
+#define G_POISSON_BINNED      "GObservations::optimizer::poisson_binned("\
+        "GObservation&, GOptimizerPars&, GMatrixBase&, GVector&, double&,"\
+                                                       " double&, GVector&)"
+#define G_GAUSSIAN_BINNED    "GObservations::optimizer::gaussian_binned("\
+        "GObservation&, GOptimizerPars&, GMatrixBase&, GVector&, double&,"\
+                                                       " double&, GVector&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_DENSE_MAX_NPARS 500  //!< Max. parameters for dense curvature matrix
 
 /* __ Debug definitions __________________________________________________ */
 #define G_EVAL_TIMING   0 //!< Perform optimizer timing (0=no, 1=yes)
@@ -184,6 +195,15 @@ GObservations::optimizer& GObservations::optimizer::operator= (const optimizer&
  * Poisson and Gaussian statistics. 
  * Note that different statistics and different analysis methods
  * (binned/unbinned) may be combined.
+ *
+ * If OpenMP is enabled, the events or bins of each observation are
+ * distributed using a static schedule over all threads. Each thread
+ * accumulates the function value, gradient and curvature matrix in private
+ * working variables that are stored by thread number, while the Npred
+ * value and gradient of each unbinned observation are stored by
+ * observation index. All contributions are summed in a fixed order at the
+ * end of the computation, so that for a given number of threads the
+ * result does not depend on the thread scheduling.
  ***************************************************************************/
 void GObservations::optimizer::eval(const GOptimizerPars& pars) 
 {
@@ -219,52 +239,86 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
         m_covar    = new GMatrixSparse(npars,npars);
         m_wrk_grad = new GVector(npars);
 
+        // Decide on the curvature matrix storage. Unless the number of
+        // parameters is very large, each thread accumulates the curvature
+        // matrix in dense symmetric storage using rank-1 updates, which
+        // avoids the overhead of the sparse matrix stack.
+        bool dense = (npars <= G_DENSE_MAX_NPARS);
+
         // Set stack size and number of entries
         int stack_size  = (2*npars > 100000) ? 2*npars : 100000;
         int max_entries =  2*npars;
-        m_covar->stack_init(stack_size, max_entries);
+        if (!dense) {
+            m_covar->stack_init(stack_size, max_entries);
+        }
+
+        // Determine the maximum number of threads
+        #ifdef _OPENMP
+        int nthreads = omp_get_max_threads();
+        #else
+        int nthreads = 1;
+        #endif
 
         // Allocate vectors to save working variables of each thread
-        std::vector<GVector*>       vect_cpy_grad;
-        std::vector<GMatrixSparse*> vect_cpy_covar;
-        std::vector<double*>        vect_cpy_value;
-        std::vector<double*>        vect_cpy_npred;
+        std::vector<GVector*>       vect_cpy_grad(nthreads, NULL);
+        std::vector<GMatrixBase*>   vect_cpy_covar(nthreads, NULL);
+        std::vector<double>         vect_cpy_value(nthreads, 0.0);
+        std::vector<double>         vect_cpy_npred(nthreads, 0.0);
+
+        // Allocate vectors to save the Npred value and gradient of each
+        // unbinned observation
+        int                  nobs = m_this->size();
+        std::vector<double>  obs_npred(nobs, 0.0);
+        std::vector<GVector> obs_npred_grad(nobs);
 
         // Here OpenMP will paralellize the execution. The following code will
         // be executed by the differents threads. In order to avoid protecting
         // attributes ( m_value,m_npred, m_gradient and m_covar), each thread
-        // works with its own working variables (cpy_*). When a thread starts,
-        // we add working variables in a vector (vect_cpy_*). When computation
-        // is finished we just add all elements contain in the vector to the
+        // works with its own working variables (cpy_*) that are stored in
+        // the vectors (vect_cpy_*) at the index of the thread number. When
+        // computation is finished we add all elements in thread order to the
         // attributes value.
+        //
+        // All threads loop over all observations, while the events or bins
+        // of each observation are distributed over the threads by the
+        // orphaned "omp for" directives in the poisson_unbinned(),
+        // poisson_binned() and gaussian_binned() methods. This allows
+        // using all threads also for a single observation with a large
+        // number of events.
         #pragma omp parallel
         {
+            // Get thread number
+            #ifdef _OPENMP
+            int ithread = omp_get_thread_num();
+            #else
+            int ithread = 0;
+            #endif
+
             // Allocate and initialize variable copies for multi-threading
             GModels        cpy_model((GModels&)pars);
             GVector        cpy_wrk_grad(npars);
             GVector*       cpy_gradient = new GVector(npars);
-            GMatrixSparse* cpy_covar    = new GMatrixSparse(npars,npars);
-            double*        cpy_npred    = new double(0.0);
-            double*        cpy_value    = new double(0.0);
-
-            // Set stack size and number of entries
-            cpy_covar->stack_init(stack_size, max_entries);
-
-            // Push variable copies into vector. This is a critical zone to
-            // avoid multiple thread pushing simultaneously.
-            #pragma omp critical
-            {
-                vect_cpy_grad.push_back(cpy_gradient);
-                vect_cpy_covar.push_back(cpy_covar); 
-                vect_cpy_value.push_back(cpy_value);
-                vect_cpy_npred.push_back(cpy_npred);
+            GMatrixBase*   cpy_covar    = NULL;
+            double         cpy_npred    = 0.0;
+            double         cpy_value    = 0.0;
+
+            // Allocate curvature matrix. For sparse storage set the stack
+            // size and number of entries
+            if (dense) {
+                cpy_covar = new GMatrixSymmetric(npars,npars);
+            }
+            else {
+                GMatrixSparse* sparse = new GMatrixSparse(npars,npars);
+                sparse->stack_init(stack_size, max_entries);
+                cpy_covar = sparse;
             }
 
-            // The omp for directive will deal the iterations on the differents
-            // threads.
-            #pragma omp for
+            // Store variable copies at the index of the thread number
+            vect_cpy_grad[ithread]  = cpy_gradient;
+            vect_cpy_covar[ithread] = cpy_covar;
+
             // Loop over all observations
-            for (int i = 0; i < m_this->size(); ++i) {
+            for (int i = 0; i < nobs; ++i) {
 
                 // Extract statistics for this observation
                 std::string statistics = m_this->m_obs[i]->statistics();
@@ -275,37 +329,33 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
                     // Poisson statistics
                     if (gammalib::toupper(statistics) == "POISSON") {
 
-                        // Determine Npred value and gradient for this observation
-                        double npred = m_this->m_obs[i]->npred(cpy_model, &cpy_wrk_grad);
-
-                        // Update the Npred value, gradient.
-                        *cpy_npred    += npred;
-                        *cpy_gradient += cpy_wrk_grad;
-
-                        // Optionally show debug information
-                        #if G_EVAL_DEBUG
-                        #pragma omp critial single
+                        // Determine Npred value and gradient for this
+                        // observation. This is done by a single thread
+                        // while the other threads start with the events.
+                        // The result is stored by observation index as
+                        // the executing thread is not known in advance.
+                        #pragma omp single nowait
                         {
+                            // Determine Npred value and gradient
+                            obs_npred[i]      = m_this->m_obs[i]->npred(cpy_model, &cpy_wrk_grad);
+                            obs_npred_grad[i] = cpy_wrk_grad;
+
+                            // Optionally show debug information
+                            #if G_EVAL_DEBUG
                             std::cout << "Unbinned Poisson (" << i << "):";
-                            std::cout << " Npred=" << npred;
+                            std::cout << " Npred=" << obs_npred[i];
                             std::cout << " Grad="<< cpy_wrk_grad << std::endl;
-                            std::cout << "Sum:";
-                            std::cout << " Npred=" << *cpy_npred;
-                            std::cout << " Grad=" << *cpy_gradient << std::endl;
+                            #endif
                         }
-                        #endif
 
                         // Update the log-likelihood
                         poisson_unbinned(*(m_this->m_obs[i]), 
                                           cpy_model,
                                          *cpy_covar,
                                          *cpy_gradient,
-                                         *cpy_value,
+                                          cpy_value,
                                           cpy_wrk_grad);
 
-                        // Add the Npred value to the log-likelihood
-                        *cpy_value += npred;
-
                     } // endif: Poisson statistics
 
                     // ... otherwise throw an exception
@@ -328,8 +378,8 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
                                         cpy_model,
                                        *cpy_covar,
                                        *cpy_gradient,
-                                       *cpy_value,
-                                       *cpy_npred,
+                                        cpy_value,
+                                        cpy_npred,
                                         cpy_wrk_grad);
                     }
 
@@ -342,8 +392,8 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
                                          cpy_model,
                                         *cpy_covar,
                                         *cpy_gradient,
-                                        *cpy_value,
-                                        *cpy_npred,
+                                         cpy_value,
+                                         cpy_npred,
                                          cpy_wrk_grad);
                     }
 
@@ -359,49 +409,62 @@ void GObservations::optimizer::eval(const GOptimizerPars& pars)
             } // endfor: looped over observations
 
             // Release stack
-            cpy_covar->stack_destroy();
+            if (!dense) {
+                static_cast<GMatrixSparse*>(cpy_covar)->stack_destroy();
+            }
+
+            // Store value and Npred at the index of the thread number
+            vect_cpy_value[ithread] = cpy_value;
+            vect_cpy_npred[ithread] = cpy_npred;
 
         } // end pragma omp parallel
 
-        // Now the computation is finished, update attributes.
-        // For each omp section, a thread will be created.
-        #pragma omp sections
-        {
-            #pragma omp section
-            {
-                for (int i = 0; i < vect_cpy_covar.size() ; ++i) {
-                    *m_covar += *(vect_cpy_covar.at(i));
-                    delete vect_cpy_covar.at(i);
-                }
+        // Now the computation is finished, update attributes. The Npred
+        // values and gradients are added in observation order and the
+        // working variables in thread order, so that the summation order
+        // does not depend on the thread scheduling.
+        for (int i = 0; i < nobs; ++i) {
+            if (obs_npred_grad[i].size() > 0) {
+                m_value     += obs_npred[i];
+                m_npred     += obs_npred[i];
+                *m_gradient += obs_npred_grad[i];
             }
-
-            #pragma omp section
-            {
-                for (int i = 0; i < vect_cpy_grad.size(); ++i){
-                    *m_gradient += *(vect_cpy_grad.at(i));
-                    delete vect_cpy_grad.at(i);
-                }
+        }
+        for (int i = 0; i < nthreads; ++i) {
+            m_value += vect_cpy_value[i];
+            m_npred += vect_cpy_npred[i];
+            if (vect_cpy_grad[i] != NULL) {
+                *m_gradient += *(vect_cpy_grad[i]);
+                delete vect_cpy_grad[i];
             }
+        }
 
-            #pragma omp section
-            {
-                for(int i = 0; i < vect_cpy_npred.size(); ++i){
-                    m_npred += *(vect_cpy_npred.at(i));
-                    delete vect_cpy_npred.at(i);
+        // Sum dense matrices and convert the sum into sparse storage
+        if (dense) {
+            GMatrixSymmetric sum(npars,npars);
+            for (int i = 0; i < nthreads; ++i) {
+                if (vect_cpy_covar[i] != NULL) {
+                    sum += *static_cast<GMatrixSymmetric*>(vect_cpy_covar[i]);
+                    delete vect_cpy_covar[i];
                 }
             }
+            *m_covar = GMatrixSparse(sum);
+        }
 
-            #pragma omp section
-            {
-                for (int i = 0; i < vect_cpy_value.size(); ++i){
-                    m_value += *(vect_cpy_value.at(i));
-                    delete vect_cpy_value.at(i);
+        // ... or sum sparse matrices
+        else {
+            for (int i = 0; i < nthreads; ++i) {
+                if (vect_cpy_covar[i] != NULL) {
+                    *m_covar += *static_cast<GMatrixSparse*>(vect_cpy_covar[i]);
+                    delete vect_cpy_covar[i];
                 }
             }
-        } // end of pragma omp sections
+        }
 
         // Release stack
-        m_covar->stack_destroy();
+        if (!dense) {
+            m_covar->stack_destroy();
+        }
 
     } while(0); // endwhile: main loop
 
@@ -475,14 +538,26 @@ void GObservations::optimizer::poisson_unbinned(const GObservation& obs,
  *
  * @param[in] obs Observation.
  * @param[in] pars Optimizer parameters.
- * @param[in,out] covar Covariance matrix.
+ * @param[in,out] covar Covariance matrix (GMatrixSymmetric or GMatrixSparse).
  * @param[in,out] gradient Gradient.
  * @param[in,out] value Likelihood value.
  * @param[in,out] wrk_grad Gradient working array.
+ *
+ * If the method is called within an OpenMP parallel region, the loop over
+ * the events is shared among the threads of the team. In that case each
+ * thread needs to provide its own working arrays, and the caller is
+ * responsible for summing up the results of all threads.
+ *
+ * If @p covar is a GMatrixSymmetric, the curvature contribution of each
+ * event is added as a dense rank-1 update, otherwise the sparse matrix
+ * stack is used.
+ *
+ * @exception GException::invalid_argument
+ *            Curvature matrix is neither symmetric nor sparse.
  ***************************************************************************/
 void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
                                                 const GOptimizerPars& pars,
-                                                GMatrixSparse&        covar,
+                                                GMatrixBase&          covar,
                                                 GVector&              gradient,
                                                 double&               value,
                                                 GVector&              wrk_grad)
@@ -499,12 +574,26 @@ void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
     // Get number of parameters
     int npars = pars.npars();
 
+    // Get number of events
+    int nevents = obs.events()->size();
+
     // Allocate some working arrays
     int*    inx    = new int[npars];
     double* values = new double[npars];
 
-    // Iterate over all events
-    for (int i = 0; i < obs.events()->size(); ++i) {
+    // Get curvature matrix storage
+    GMatrixSymmetric* dense  = dynamic_cast<GMatrixSymmetric*>(&covar);
+    GMatrixSparse*    sparse = dynamic_cast<GMatrixSparse*>(&covar);
+    if (dense == NULL && sparse == NULL) {
+        throw GException::invalid_argument(G_POISSON_UNBINNED,
+              "Curvature matrix needs to be a symmetric or sparse matrix.");
+    }
+
+    // Iterate over all events. If called within a parallel region the
+    // events are distributed in fixed contiguous blocks over all threads
+    // of the team, so that each thread always sums the same events.
+    #pragma omp for schedule(static) nowait
+    for (int i = 0; i < nevents; ++i) {
 
         // Get event pointer
         const GEvent* event = (*obs.events())[i];
@@ -540,6 +629,18 @@ void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
         // Update gradient vector and curvature matrix.
         double fb = 1.0 / model;
         double fa = fb / model;
+
+        // Dense curvature matrix: update gradient and add rank-1 update
+        if (dense != NULL) {
+            for (int idev = 0; idev < ndev; ++idev) {
+                values[idev]         = wrk_grad[inx[idev]];
+                gradient[inx[idev]] -= fb * values[idev];
+            }
+            dense->rank1_update(fa, values, inx, ndev);
+            continue;
+        }
+
+        // Sparse curvature matrix: loop over columns
         for (int jdev = 0; jdev < ndev; ++jdev) {
 
             // Initialise computation
@@ -558,7 +659,7 @@ void GObservations::optimizer::poisson_unbinned(const GObservation&   obs,
             }
 
             // Add column to matrix
-            covar.add_to_column(jpar, values, inx, ndev);
+            sparse->add_to_column(jpar, values, inx, ndev);
 
         } // endfor: looped over columns
 
@@ -626,15 +727,27 @@ void GObservations::optimizer::poisson_binned(const GObservation& obs,
  *
  * @param[in] obs Observation.
  * @param[in] pars Optimizer parameters.
- * @param[in,out] covar Covariance matrix.
+ * @param[in,out] covar Covariance matrix (GMatrixSymmetric or GMatrixSparse).
  * @param[in,out] gradient Gradient.
  * @param[in,out] value Likelihood value.
  * @param[in,out] npred Number of predicted events.
  * @param[in,out] wrk_grad Gradient working array.
+ *
+ * If the method is called within an OpenMP parallel region, the loop over
+ * the bins is shared among the threads of the team. In that case each
+ * thread needs to provide its own working arrays, and the caller is
+ * responsible for summing up the results of all threads.
+ *
+ * If @p covar is a GMatrixSymmetric, the curvature contribution of each
+ * bin is added as a dense rank-1 update, otherwise the sparse matrix
+ * stack is used.
+ *
+ * @exception GException::invalid_argument
+ *            Curvature matrix is neither symmetric nor sparse.
  ***************************************************************************/
 void GObservations::optimizer::poisson_binned(const GObservation&   obs,
                                               const GOptimizerPars& pars,
-                                              GMatrixSparse&        covar,
+                                              GMatrixBase&          covar,
                                               GVector&              gradient,
                                               double&               value,
                                               double&               npred,
@@ -667,132 +780,168 @@ void GObservations::optimizer::poisson_binned(const GObservation&   obs,
     int*    inx    = new int[npars];
     double* values = new double[npars];
 
-    // Iterate over all bins
-    for (int i = 0; i < obs.events()->size(); ++i) {
+    // Get curvature matrix storage
+    GMatrixSymmetric* dense  = dynamic_cast<GMatrixSymmetric*>(&covar);
+    GMatrixSparse*    sparse = dynamic_cast<GMatrixSparse*>(&covar);
+    if (dense == NULL && sparse == NULL) {
+        throw GException::invalid_argument(G_POISSON_BINNED,
+              "Curvature matrix needs to be a symmetric or sparse matrix.");
+    }
 
-        // Update number of bins
-        #if G_OPT_DEBUG
-        n_bins++;
-        #endif
+    // Get number of bins and pointer to event cube
+    int               nbins = obs.events()->size();
+    const GEventCube* cube  = static_cast<const GEventCube*>(obs.events());
 
-        // Get event pointer
-        const GEventBin* bin =
-            (*(static_cast<GEventCube*>(const_cast<GEvents*>(obs.events()))))[i];
+    // Allocate private event bin buffer. The buffer is allocated without
+    // accessing the event cube, and each thread then accesses the cube
+    // through its own buffer.
+    GEventBin* buffer = cube->new_bin();
 
-        // Get number of counts in bin
-        double data = bin->counts();
+    // Iterate over all bins. If called within a parallel region the bins
+    // are distributed in fixed contiguous blocks over all threads of the
+    // team, so that each thread always sums the same bins.
+    #pragma omp for schedule(static) nowait
+    for (int i = 0; i < nbins; ++i) {
 
-        // Get model and derivative
-        double model = obs.model((GModels&)pars, *bin, &wrk_grad);
+        // Get event bin
+        const GEventBin* bin = cube->bin(i, buffer);
 
-        // Multiply model by bin size
-        model *= bin->size();
+        // Single loop for common exit point
+        do {
 
-        // Skip bin if model is too small (avoids -Inf or NaN gradients)
-        if (model <= m_minmod) {
+            // Update number of bins
             #if G_OPT_DEBUG
-            n_small_model++;
+            n_bins++;
             #endif
-            continue;
-        }
 
-        // Update statistics
-        #if G_OPT_DEBUG
-        n_used++;
-        sum_data  += data;
-        sum_model += model;
-        #endif
+            // Get number of counts in bin
+            double data = bin->counts();
 
-        // Update Npred
-        npred += model;
+            // Get model and derivative
+            double model = obs.model((GModels&)pars, *bin, &wrk_grad);
 
-        // Multiply gradient by bin size
-        wrk_grad *= bin->size();
+            // Multiply model by bin size
+            model *= bin->size();
 
-        // Create index array of non-zero derivatives and initialise working
-        // array
-        int ndev = 0;
-        for (int i = 0; i < npars; ++i) {
-            values[i] = 0.0;
-            if (wrk_grad[i] != 0.0 && !gammalib::isinfinite(wrk_grad[i])) {
-                inx[ndev] = i;
-                ndev++;
+            // Skip bin if model is too small (avoids -Inf or NaN gradients)
+            if (model <= m_minmod) {
+                #if G_OPT_DEBUG
+                n_small_model++;
+                #endif
+                continue;
             }
-        }
 
-        // Update gradient vector and curvature matrix. To avoid
-        // unneccessary computations we distinguish the case where
-        // data>0 and data=0. The second case requires much less
-        // computation since it does not contribute to the covariance
-        // matrix ...
-        if (data > 0.0) {
+            // Update statistics
+            #if G_OPT_DEBUG
+            n_used++;
+            sum_data  += data;
+            sum_model += model;
+            #endif
 
-            // Update Poissonian statistics (excluding factorial term for
-            // faster computation)
-            value -= data * log(model) - model;
+            // Update Npred
+            npred += model;
 
-            // Skip bin now if there are no non-zero derivatives
-            if (ndev < 1) {
-                continue;
+            // Multiply gradient by bin size
+            wrk_grad *= bin->size();
+
+            // Create index array of non-zero derivatives and initialise working
+            // array
+            int ndev = 0;
+            for (int i = 0; i < npars; ++i) {
+                values[i] = 0.0;
+                if (wrk_grad[i] != 0.0 && !gammalib::isinfinite(wrk_grad[i])) {
+                    inx[ndev] = i;
+                    ndev++;
+                }
             }
 
-            // Pre computation
-            double fb = data / model;
-            double fc = (1.0 - fb);
-            double fa = fb / model;
+            // Update gradient vector and curvature matrix. To avoid
+            // unneccessary computations we distinguish the case where
+            // data>0 and data=0. The second case requires much less
+            // computation since it does not contribute to the covariance
+            // matrix ...
+            if (data > 0.0) {
 
-            // Loop over columns
-            for (int jdev = 0; jdev < ndev; ++jdev) {
-
-                // Initialise computation
-                register int jpar    = inx[jdev];
-                double       g       = wrk_grad[jpar];
-                double       fa_i    = fa * g;
+                // Update Poissonian statistics (excluding factorial term for
+                // faster computation)
+                value -= data * log(model) - model;
 
-                // Update gradient
-                gradient[jpar] += fc * g;
+                // Skip bin now if there are no non-zero derivatives
+                if (ndev < 1) {
+                    continue;
+                }
 
-                // Loop over rows
-                register int* ipar = inx;
-                for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                    values[idev] = fa_i * wrk_grad[*ipar];
+                // Pre computation
+                double fb = data / model;
+                double fc = (1.0 - fb);
+                double fa = fb / model;
+
+                // Dense curvature matrix: update gradient and add rank-1
+                // update
+                if (dense != NULL) {
+                    for (int idev = 0; idev < ndev; ++idev) {
+                        values[idev]         = wrk_grad[inx[idev]];
+                        gradient[inx[idev]] += fc * values[idev];
+                    }
+                    dense->rank1_update(fa, values, inx, ndev);
+                    continue;
                 }
 
-                // Add column to matrix
-                covar.add_to_column(jpar, values, inx, ndev);
+                // Sparse curvature matrix: loop over columns
+                for (int jdev = 0; jdev < ndev; ++jdev) {
 
-            } // endfor: looped over columns
+                    // Initialise computation
+                    register int jpar    = inx[jdev];
+                    double       g       = wrk_grad[jpar];
+                    double       fa_i    = fa * g;
 
-        } // endif: data was > 0
+                    // Update gradient
+                    gradient[jpar] += fc * g;
 
-        // ... handle now data=0
-        else {
+                    // Loop over rows
+                    register int* ipar = inx;
+                    for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
+                        values[idev] = fa_i * wrk_grad[*ipar];
+                    }
 
-            // Update statistics
-            #if G_OPT_DEBUG
-            n_zero_data++;
-            #endif
+                    // Add column to matrix
+                    sparse->add_to_column(jpar, values, inx, ndev);
 
-            // Update Poissonian statistics (excluding factorial term for
-            // faster computation)
-            value += model;
+                } // endfor: looped over columns
 
-            // Skip bin now if there are no non-zero derivatives
-            if (ndev < 1) {
-                continue;
-            }
+            } // endif: data was > 0
 
-            // Update gradient
-            register int* ipar = inx;
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                gradient[*ipar] += wrk_grad[*ipar];
-            }
+            // ... handle now data=0
+            else {
+
+                // Update statistics
+                #if G_OPT_DEBUG
+                n_zero_data++;
+                #endif
+
+                // Update Poissonian statistics (excluding factorial term for
+                // faster computation)
+                value += model;
+
+                // Skip bin now if there are no non-zero derivatives
+                if (ndev < 1) {
+                    continue;
+                }
+
+                // Update gradient
+                register int* ipar = inx;
+                for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
+                    gradient[*ipar] += wrk_grad[*ipar];
+                }
+
+            } // endif: data was 0
 
-        } // endif: data was 0
+        } while (0); // endwhile: single loop
 
     } // endfor: iterated over all events
 
     // Free temporary memory
+    if (buffer != NULL) delete buffer;
     if (values != NULL) delete [] values;
     if (inx    != NULL) delete [] inx;
 
@@ -867,15 +1016,27 @@ void GObservations::optimizer::gaussian_binned(const GObservation& obs,
  *
  * @param[in] obs Observation.
  * @param[in] pars Optimizer parameters.
- * @param[in,out] covar Covariance matrix.
+ * @param[in,out] covar Covariance matrix (GMatrixSymmetric or GMatrixSparse).
  * @param[in,out] gradient Gradient.
  * @param[in,out] npred Number of predicted events.
  * @param[in,out] value Likelihood value.
  * @param[in,out] wrk_grad Gradient working array.
+ *
+ * If the method is called within an OpenMP parallel region, the loop over
+ * the bins is shared among the threads of the team. In that case each
+ * thread needs to provide its own working arrays, and the caller is
+ * responsible for summing up the results of all threads.
+ *
+ * If @p covar is a GMatrixSymmetric, the curvature contribution of each
+ * bin is added as a dense rank-1 update, otherwise the sparse matrix
+ * stack is used.
+ *
+ * @exception GException::invalid_argument
+ *            Curvature matrix is neither symmetric nor sparse.
  ***************************************************************************/
 void GObservations::optimizer::gaussian_binned(const GObservation&   obs,
                                                const GOptimizerPars& pars,
-                                               GMatrixSparse&        covar,
+                                               GMatrixBase&          covar,
                                                GVector&              gradient,
                                                double&               value,
                                                double&               npred,
@@ -897,88 +1058,123 @@ void GObservations::optimizer::gaussian_binned(const GObservation&   obs,
     int*    inx    = new int[npars];
     double* values = new double[npars];
 
-    // Iterate over all bins
-    for (int i = 0; i < obs.events()->size(); ++i) {
+    // Get curvature matrix storage
+    GMatrixSymmetric* dense  = dynamic_cast<GMatrixSymmetric*>(&covar);
+    GMatrixSparse*    sparse = dynamic_cast<GMatrixSparse*>(&covar);
+    if (dense == NULL && sparse == NULL) {
+        throw GException::invalid_argument(G_GAUSSIAN_BINNED,
+              "Curvature matrix needs to be a symmetric or sparse matrix.");
+    }
 
-        // Get event pointer
-        const GEventBin* bin =
-            (*(static_cast<GEventCube*>(const_cast<GEvents*>(obs.events()))))[i];
+    // Get number of bins and pointer to event cube
+    int               nbins = obs.events()->size();
+    const GEventCube* cube  = static_cast<const GEventCube*>(obs.events());
 
-        // Get number of counts in bin
-        double data = bin->counts();
+    // Allocate private event bin buffer. The buffer is allocated without
+    // accessing the event cube, and each thread then accesses the cube
+    // through its own buffer.
+    GEventBin* buffer = cube->new_bin();
 
-        // Get statistical uncertainty
-        double sigma = bin->error();
+    // Iterate over all bins. If called within a parallel region the bins
+    // are distributed in fixed contiguous blocks over all threads of the
+    // team, so that each thread always sums the same bins.
+    #pragma omp for schedule(static) nowait
+    for (int i = 0; i < nbins; ++i) {
 
-        // Skip bin if statistical uncertainty is too small
-        if (sigma <= m_minerr) {
-            continue;
-        }
+        // Get event bin
+        const GEventBin* bin = cube->bin(i, buffer);
 
-        // Get model and derivative
-        double model = obs.model((GModels&)pars, *bin, &wrk_grad);
+        // Single loop for common exit point
+        do {
 
-        // Multiply model by bin size
-        model *= bin->size();
+            // Get number of counts in bin
+            double data = bin->counts();
 
-        // Skip bin if model is too small (avoids -Inf or NaN gradients)
-        if (model <= m_minmod) {
-            continue;
-        }
+            // Get statistical uncertainty
+            double sigma = bin->error();
 
-        // Update Npred
-        npred += model;
+            // Skip bin if statistical uncertainty is too small
+            if (sigma <= m_minerr) {
+                continue;
+            }
 
-        // Multiply gradient by bin size
-        wrk_grad *= bin->size();
+            // Get model and derivative
+            double model = obs.model((GModels&)pars, *bin, &wrk_grad);
 
-        // Create index array of non-zero derivatives and initialise working
-        // array
-        int ndev = 0;
-        for (int i = 0; i < npars; ++i) {
-            values[i] = 0.0;
-            if (wrk_grad[i] != 0.0 && !gammalib::isinfinite(wrk_grad[i])) {
-                inx[ndev] = i;
-                ndev++;
+            // Multiply model by bin size
+            model *= bin->size();
+
+            // Skip bin if model is too small (avoids -Inf or NaN gradients)
+            if (model <= m_minmod) {
+                continue;
             }
-        }
 
-        // Set weight
-        double weight = 1.0 / (sigma * sigma);
+            // Update Npred
+            npred += model;
 
-        // Update Gaussian statistics
-        double fa = data - model;
-        value  += 0.5 * (fa * fa * weight);
+            // Multiply gradient by bin size
+            wrk_grad *= bin->size();
 
-        // Skip bin now if there are no non-zero derivatives
-        if (ndev < 1) {
-            continue;
-        }
+            // Create index array of non-zero derivatives and initialise working
+            // array
+            int ndev = 0;
+            for (int i = 0; i < npars; ++i) {
+                values[i] = 0.0;
+                if (wrk_grad[i] != 0.0 && !gammalib::isinfinite(wrk_grad[i])) {
+                    inx[ndev] = i;
+                    ndev++;
+                }
+            }
 
-        // Loop over columns
-        for (int jdev = 0; jdev < ndev; ++jdev) {
+            // Set weight
+            double weight = 1.0 / (sigma * sigma);
 
-            // Initialise computation
-            register int jpar = inx[jdev];
-            double       fa_i = wrk_grad[jpar] * weight;
+            // Update Gaussian statistics
+            double fa = data - model;
+            value  += 0.5 * (fa * fa * weight);
 
-            // Update gradient
-            gradient[jpar] -= fa * fa_i;
+            // Skip bin now if there are no non-zero derivatives
+            if (ndev < 1) {
+                continue;
+            }
 
-            // Loop over rows
-            register int* ipar = inx;
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                values[idev] = fa_i * wrk_grad[*ipar];
+            // Dense curvature matrix: update gradient and add rank-1 update
+            if (dense != NULL) {
+                for (int idev = 0; idev < ndev; ++idev) {
+                    values[idev]         = wrk_grad[inx[idev]];
+                    gradient[inx[idev]] -= fa * weight * values[idev];
+                }
+                dense->rank1_update(weight, values, inx, ndev);
+                continue;
             }
 
-            // Add column to matrix
-            covar.add_to_column(jpar, values, inx, ndev);
+            // Sparse curvature matrix: loop over columns
+            for (int jdev = 0; jdev < ndev; ++jdev) {
 
-        } // endfor: looped over columns
+                // Initialise computation
+                register int jpar = inx[jdev];
+                double       fa_i = wrk_grad[jpar] * weight;
+
+                // Update gradient
+                gradient[jpar] -= fa * fa_i;
+
+                // Loop over rows
+                register int* ipar = inx;
+                for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
+                    values[idev] = fa_i * wrk_grad[*ipar];
+                }
+
+                // Add column to matrix
+                sparse->add_to_column(jpar, values, inx, ndev);
+
+            } // endfor: looped over columns
+
+        } while (0); // endwhile: single loop
 
     } // endfor: iterated over all events
 
     // Free temporary memory
+    if (buffer != NULL) delete buffer;
     if (values != NULL) delete [] values;
     if (inx    != NULL) delete [] inx;
 
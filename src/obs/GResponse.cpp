@@ -33,7 +33,7 @@
 #include "GResponse.hpp"
 #include "GObservation.hpp"
 #include "GIntegral.hpp"
-#include "GVector.hpp"
+#include "GVector3.hpp"
 #include "GSkyDir.hpp"
 #include "GException.hpp"
 #include "GTools.hpp"
@@ -416,11 +416,11 @@ double GResponse::npred_radial(const GSource& source,
     
         // Compute rotation matrix to convert from native coordinates given
         // by (theta,phi) into celestial coordinates.
-        GMatrix ry;
-        GMatrix rz;
+        GMatrix3 ry;
+        GMatrix3 rz;
         ry.eulery(spatial->dec() - 90.0);
         rz.eulerz(-spatial->ra());
-        GMatrix rot = (ry * rz).transpose();
+        GMatrix3 rot = (ry * rz).transpose();
 
         // Set offset angle integration range
         double theta_min = 0.0;
@@ -491,11 +491,11 @@ double GResponse::npred_elliptical(const GSource& source,
     
         // Compute rotation matrix to convert from native coordinates given
         // by (theta,phi) into celestial coordinates.
-        GMatrix ry;
-        GMatrix rz;
+        GMatrix3 ry;
+        GMatrix3 rz;
         ry.eulery(spatial->dec() - 90.0);
         rz.eulerz(-spatial->ra());
-        GMatrix rot = (ry * rz).transpose();
+        GMatrix3 rot = (ry * rz).transpose();
 
         // Set offset angle integration range
         double theta_min = 0.0;
@@ -661,10 +661,10 @@ double GResponse::npred_radial_kern_phi::eval(double phi)
     // Compute sky direction vector in native coordinates
     double  cos_phi = std::cos(phi);
     double  sin_phi = std::sin(phi);
-    GVector native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
+    GVector3 native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -748,10 +748,10 @@ double GResponse::npred_elliptical_kern_phi::eval(double phi)
     // Compute sky direction vector in native coordinates
     double  cos_phi = std::cos(phi);
     double  sin_phi = std::sin(phi);
-    GVector native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
+    GVector3 native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -527,6 +527,9 @@ void GOptimizerLM::init_members(void)
     // Initialise pointer to logger
     m_logger = NULL;
 
+    // Initialise decomposition
+    m_decomposition.clear();
+
     // Return
     return;
 }
@@ -558,6 +561,7 @@ void GOptimizerLM::copy_members(const GOptimizerLM& opt)
     m_status       = opt.m_status;
     m_iter         = opt.m_iter;
     m_logger       = opt.m_logger;
+    m_decomposition = opt.m_decomposition;
 
     // Return
     return;
@@ -628,11 +632,13 @@ void GOptimizerLM::iteration(GOptimizerFunction& fct, GOptimizerPars& pars)
         std::cout << std::endl;
         #endif
 
-        // Solve: covar * X = grad. Handle matrix problems
+        // Solve: covar * X = grad. The sparsity pattern of the curvature
+        // matrix does in general not change between iterations, hence the
+        // symbolic analysis of the previous decomposition is reused.
+        // Handle matrix problems
         try {
-            *grad = covar->solve(*grad);
-            //GMatrixSparse decomposition = covar->cholesky_decompose(true);
-            //*grad = decomposition.cholesky_solver(*grad);
+            m_decomposition = covar->cholesky_decompose(m_decomposition, true);
+            *grad           = m_decomposition.cholesky_solver(*grad, true);
         }
         catch (GException::matrix_zero &e) {
             m_status = G_LM_SINGULAR;
@@ -861,21 +867,19 @@ void GOptimizerLM::errors(GOptimizerFunction& fct, GOptimizerPars& pars)
     // Loop over error computation (maximum 2 turns)
     for (int i = 0; i < 2; ++i) {
 
-        // Solve: covar * X = unit
+        // Compute diagonal of inverse curvature matrix by selected
+        // inversion of its Cholesky decomposition
         try {
-            GMatrixSparse decomposition = covar->cholesky_decompose(true);
-            GVector unit(npars);
+            m_decomposition = covar->cholesky_decompose(m_decomposition, true);
+            GVector diag    = m_decomposition.cholesky_inverse_diagonal(true);
             for (int ipar = 0; ipar < npars; ++ipar) {
-                unit[ipar] = 1.0;
-                GVector x  = decomposition.cholesky_solver(unit, true);
-                if (x[ipar] >= 0.0) {
-                    pars.par(ipar).factor_error(sqrt(x[ipar]));
+                if (diag[ipar] >= 0.0) {
+                    pars.par(ipar).factor_error(sqrt(diag[ipar]));
                 }
                 else {
                     pars.par(ipar).factor_error(0.0);
                     m_status = G_LM_BAD_ERRORS;
                 }
-                unit[ipar] = 0.0;
             }
         }
         catch (GException::matrix_zero &e) {
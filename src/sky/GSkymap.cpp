@@ -51,6 +51,11 @@
 #define G_DIR2PIX                                 "GSkymap::dir2pix(GSkyDir)"
 #define G_XY2DIR                                 "GSkymap::xy2dir(GSkyPixel)"
 #define G_DIR2XY                                   "GSkymap::dir2xy(GSkyDir)"
+#define G_PIX2DIR_BULK                     "GSkymap::pix2dir(std::vector<int>&)"
+#define G_DIR2PIX_BULK                 "GSkymap::dir2pix(std::vector<GSkyDir>&)"
+#define G_XY2DIR_BULK                 "GSkymap::xy2dir(std::vector<GSkyPixel>&)"
+#define G_DIR2XY_BULK                   "GSkymap::dir2xy(std::vector<GSkyDir>&)"
+#define G_REORDER                           "GSkymap::reorder(std::string&)"
 #define G_OMEGA1                                        "GSkymap::omega(int)"
 #define G_OMEGA2                                  "GSkymap::omega(GSkyPixel)"
 #define G_SET_WCS "GSkymap::set_wcs(std::string,std::string,double,double," \
@@ -859,6 +864,170 @@ GSkyPixel GSkymap::dir2xy(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixel indices
+ *
+ * @param[in] pix Pixel indices [0,...,npix()-1].
+ * @return Sky directions.
+ *
+ * @exception GException::wcs
+ *            No valid WCS found.
+ *
+ * Bulk version of pix2dir(const int&). All pixels are transformed by a
+ * single call to the bulk transformation of the WCS.
+ ***************************************************************************/
+std::vector<GSkyDir> GSkymap::pix2dir(const std::vector<int>& pix) const
+{
+    // Throw error if WCS is not valid
+    if (m_wcs == NULL) {
+        throw GException::wcs(G_PIX2DIR_BULK, "No valid WCS found.");
+    }
+
+    // Declare result
+    std::vector<GSkyDir> dirs;
+
+    // Determine sky directions from pixels. Use 2D version if sky map is
+    // 2D, otherwise use 1D version.
+    if (m_num_x == 0) {
+        dirs = m_wcs->pix2dir(pix);
+    }
+    else {
+        std::vector<GSkyPixel> pixels;
+        int num = pix.size();
+        pixels.reserve(num);
+        for (int i = 0; i < num; ++i) {
+            pixels.push_back(pix2xy(pix[i]));
+        }
+        dirs = m_wcs->xy2dir(pixels);
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pixel indices of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Pixel indices.
+ *
+ * @exception GException::wcs
+ *            No valid WCS found.
+ *
+ * Bulk version of dir2pix(const GSkyDir&). All sky directions are
+ * transformed by a single call to the bulk transformation of the WCS.
+ ***************************************************************************/
+std::vector<int> GSkymap::dir2pix(const std::vector<GSkyDir>& dirs) const
+{
+    // Throw error if WCS is not valid
+    if (m_wcs == NULL) {
+        throw GException::wcs(G_DIR2PIX_BULK, "No valid WCS found.");
+    }
+
+    // Declare result
+    std::vector<int> pix;
+
+    // Determine 1D pixel indices for sky directions
+    if (m_num_x == 0) {
+        pix = m_wcs->dir2pix(dirs);
+    }
+    else {
+        std::vector<GSkyPixel> pixels = m_wcs->dir2xy(dirs);
+        int num = pixels.size();
+        pix.reserve(num);
+        for (int i = 0; i < num; ++i) {
+            pix.push_back(xy2pix(pixels[i]));
+        }
+    }
+
+    // Return pixel indices
+    return pix;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky directions of sky pixels
+ *
+ * @param[in] pix Sky pixels.
+ * @return Sky directions.
+ *
+ * @exception GException::wcs
+ *            No valid WCS found.
+ *
+ * Bulk version of xy2dir(const GSkyPixel&). All pixels are transformed by
+ * a single call to the bulk transformation of the WCS.
+ ***************************************************************************/
+std::vector<GSkyDir> GSkymap::xy2dir(const std::vector<GSkyPixel>& pix) const
+{
+    // Throw error if WCS is not valid
+    if (m_wcs == NULL) {
+        throw GException::wcs(G_XY2DIR_BULK, "No valid WCS found.");
+    }
+
+    // Declare result
+    std::vector<GSkyDir> dirs;
+
+    // Determine sky directions from pixels. Use 2D version if sky map is
+    // 2D, otherwise use 1D version.
+    if (m_num_x == 0) {
+        std::vector<int> index;
+        int num = pix.size();
+        index.reserve(num);
+        for (int i = 0; i < num; ++i) {
+            index.push_back(xy2pix(pix[i]));
+        }
+        dirs = m_wcs->pix2dir(index);
+    }
+    else {
+        dirs = m_wcs->xy2dir(pix);
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Sky pixels.
+ *
+ * @exception GException::wcs
+ *            No valid WCS found.
+ *
+ * Bulk version of dir2xy(const GSkyDir&). All sky directions are
+ * transformed by a single call to the bulk transformation of the WCS.
+ ***************************************************************************/
+std::vector<GSkyPixel> GSkymap::dir2xy(const std::vector<GSkyDir>& dirs) const
+{
+    // Throw error if WCS is not valid
+    if (m_wcs == NULL) {
+        throw GException::wcs(G_DIR2XY_BULK, "No valid WCS found.");
+    }
+
+    // Declare result
+    std::vector<GSkyPixel> pix;
+
+    // Determine sky pixels for sky directions
+    if (m_num_x == 0) {
+        std::vector<int> index = m_wcs->dir2pix(dirs);
+        int num = index.size();
+        pix.reserve(num);
+        for (int i = 0; i < num; ++i) {
+            pix.push_back(pix2xy(index[i]));
+        }
+    }
+    else {
+        pix = m_wcs->dir2xy(dirs);
+    }
+
+    // Return sky pixels
+    return pix;
+}
+
+
 /***********************************************************************//**
  * @brief Returns solid angle of pixel
  *
@@ -998,6 +1167,89 @@ GSkyPixel GSkymap::pix2xy(const int& pix) const
 }
 
 
+/***********************************************************************//**
+ * @brief Change pixel ordering of HealPix sky map
+ *
+ * @param[in] ordering Pixel ordering (RING or NEST/NESTED).
+ *
+ * @exception GException::wcs_invalid
+ *            Sky map is not a HealPix map.
+ * @exception GException::wcs_hpx_bad_ordering
+ *            Invalid ordering parameter.
+ *
+ * Re-indexes the pixels of all maps into the requested pixel ordering and
+ * updates the ordering of the HealPix projection. The pixels are permuted
+ * in place by following the cycles of the ring-to-nested permutation, so
+ * that no copy of the pixel array is needed. Nothing is done if the map is
+ * already in the requested ordering.
+ ***************************************************************************/
+void GSkymap::reorder(const std::string& ordering)
+{
+    // Check that sky map is a HealPix map
+    GWcsHPX* wcs = dynamic_cast<GWcsHPX*>(m_wcs);
+    if (wcs == NULL) {
+        std::string code = (m_wcs != NULL) ? m_wcs->code() : "";
+        throw GException::wcs_invalid(G_REORDER, code,
+                                      "Only HealPix maps can be reordered.");
+    }
+
+    // Set new ordering in a copy of the projection (this also validates
+    // the ordering parameter)
+    GWcsHPX target(*wcs);
+    target.ordering(ordering);
+
+    // Continue only if ordering changes
+    if (target.ordering() != wcs->ordering()) {
+
+        // Set conversion direction
+        bool to_nest = (target.ordering() == "NESTED");
+
+        // Permute pixels in place by following the permutation cycles
+        std::vector<bool>   done(m_num_pixels, false);
+        std::vector<double> save(m_num_maps);
+        for (int start = 0; start < m_num_pixels; ++start) {
+
+            // Skip pixels that have already been moved
+            if (done[start]) {
+                continue;
+            }
+
+            // Save start pixel values of all maps
+            for (int map = 0; map < m_num_maps; ++map) {
+                save[map] = m_pixels[start+m_num_pixels*map];
+            }
+
+            // Follow cycle, moving the source pixel values into each pixel
+            int pix = start;
+            while (true) {
+                done[pix] = true;
+                int src   = (to_nest) ? wcs->nest2ring(pix)
+                                      : wcs->ring2nest(pix);
+                if (src == start) {
+                    for (int map = 0; map < m_num_maps; ++map) {
+                        m_pixels[pix+m_num_pixels*map] = save[map];
+                    }
+                    break;
+                }
+                for (int map = 0; map < m_num_maps; ++map) {
+                    int offset           = m_num_pixels*map;
+                    m_pixels[pix+offset] = m_pixels[src+offset];
+                }
+                pix = src;
+            }
+
+        } // endfor: looped over cycles
+
+        // Set new ordering
+        wcs->ordering(ordering);
+
+    } // endif: ordering changed
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Set WCS skymap
  *
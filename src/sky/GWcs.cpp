@@ -214,6 +214,114 @@ void GWcs::coordsys(const std::string& coordsys)
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixels
+ *
+ * @param[in] pix Pixel numbers.
+ * @return Sky directions.
+ *
+ * Computes the sky directions for an array of pixel numbers. This default
+ * implementation calls pix2dir(const int&) for each pixel. Derived classes
+ * may overload the method with a bulk transformation.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcs::pix2dir(const std::vector<int>& pix) const
+{
+    // Allocate result
+    std::vector<GSkyDir> dirs;
+    int num = pix.size();
+    dirs.reserve(num);
+
+    // Transform pixels
+    for (int i = 0; i < num; ++i) {
+        dirs.push_back(pix2dir(pix[i]));
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pixel numbers of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Pixel numbers.
+ *
+ * Computes the pixel numbers for an array of sky directions. This default
+ * implementation calls dir2pix(const GSkyDir&) for each sky direction.
+ * Derived classes may overload the method with a bulk transformation.
+ ***************************************************************************/
+std::vector<int> GWcs::dir2pix(const std::vector<GSkyDir>& dirs) const
+{
+    // Allocate result
+    std::vector<int> pix;
+    int num = dirs.size();
+    pix.reserve(num);
+
+    // Transform sky directions
+    for (int i = 0; i < num; ++i) {
+        pix.push_back(dir2pix(dirs[i]));
+    }
+
+    // Return pixel numbers
+    return pix;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky directions of sky pixels
+ *
+ * @param[in] pix Sky pixels.
+ * @return Sky directions.
+ *
+ * Computes the sky directions for an array of sky pixels. This default
+ * implementation calls xy2dir(const GSkyPixel&) for each pixel. Derived
+ * classes may overload the method with a bulk transformation.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcs::xy2dir(const std::vector<GSkyPixel>& pix) const
+{
+    // Allocate result
+    std::vector<GSkyDir> dirs;
+    int num = pix.size();
+    dirs.reserve(num);
+
+    // Transform pixels
+    for (int i = 0; i < num; ++i) {
+        dirs.push_back(xy2dir(pix[i]));
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Sky pixels.
+ *
+ * Computes the sky pixels for an array of sky directions. This default
+ * implementation calls dir2xy(const GSkyDir&) for each sky direction.
+ * Derived classes may overload the method with a bulk transformation.
+ ***************************************************************************/
+std::vector<GSkyPixel> GWcs::dir2xy(const std::vector<GSkyDir>& dirs) const
+{
+    // Allocate result
+    std::vector<GSkyPixel> pix;
+    int num = dirs.size();
+    pix.reserve(num);
+
+    // Transform sky directions
+    for (int i = 0; i < num; ++i) {
+        pix.push_back(dir2xy(dirs[i]));
+    }
+
+    // Return sky pixels
+    return pix;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Protected methods                            =
@@ -29,6 +29,10 @@
 #include <config.h>
 #endif
 #include <cmath>
+#include <vector>
+#if defined(__BMI2__)
+#include <immintrin.h>                          // _pdep_u32, _pext_u32
+#endif
 #include "GException.hpp"
 #include "GTools.hpp"
 #include "GMath.hpp"
@@ -40,9 +44,12 @@
 #define G_READ                                     "GWcsHPX::read(GFitsHDU*)"
 #define G_XY2DIR                                "GWcsHPX::xy2dir(GSkyPixel&)"
 #define G_DIR2XY2                                 "GWcsHPX::dir2xy(GSkyDir&)"
+#define G_PIX2DIR                          "GWcsHPX::pix2dir(std::vector<int>&)"
 #define G_PIX2ANG_RING           "GWcsHPX::pix2ang_ring(int,double*,double*)"
 #define G_PIX2ANG_NEST           "GWcsHPX::pix2ang_nest(int,double*,double*)"
 #define G_ORDERING_SET                       "GWcsHPX::coordsys(std::string)"
+#define G_RING2NEST                                 "GWcsHPX::ring2nest(int&)"
+#define G_NEST2RING                                 "GWcsHPX::nest2ring(int&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -51,6 +58,8 @@
 /* __ Debug definitions __________________________________________________ */
 
 /* __ Local prototypes ___________________________________________________ */
+static inline int spread_bits(const int& v);
+static inline int compress_bits(const int& v);
 
 /* __ Constants __________________________________________________________ */
 const int jrll[12]  = {2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4};
@@ -58,10 +67,6 @@ const int jpll[12]  = {1, 3, 5, 7, 0, 2, 4, 6, 1, 3, 5, 7};
 const int order_max = 13;
 const int ns_max    = 1 << order_max;
 
-/* __ Static conversion arrays ___________________________________________ */
-static short ctab[0x100];
-static short utab[0x100];
-
 /* __ Globals ____________________________________________________________ */
 const GWcsHPX      g_wcs_hpx_seed;
 const GWcsRegistry g_wcs_hpx_registry(&g_wcs_hpx_seed);
@@ -460,6 +465,122 @@ int GWcsHPX::dir2pix(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixels
+ *
+ * @param[in] pix Pixel numbers (0,1,...,m_num_pixels).
+ * @return Sky directions.
+ *
+ * @exception GException::out_of_range
+ *            Pixel number is out of range.
+ *
+ * Computes the sky directions for an array of pixel numbers. The ordering
+ * and coordinate system are resolved once for the entire array.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcsHPX::pix2dir(const std::vector<int>& pix) const
+{
+    // Allocate result
+    int                  num = pix.size();
+    std::vector<GSkyDir> dirs(num);
+
+    // Check that all pixels are in range
+    for (int i = 0; i < num; ++i) {
+        if (pix[i] < 0 || pix[i] >= m_num_pixels) {
+            throw GException::out_of_range(G_PIX2DIR, pix[i], 0, m_num_pixels-1);
+        }
+    }
+
+    // Compute (theta,phi) angles
+    std::vector<double> theta(num, 0.0);
+    std::vector<double> phi(num, 0.0);
+    if (num > 0) {
+        switch (m_ordering) {
+        case 0:
+            pix2ang_ring(num, &pix[0], &theta[0], &phi[0]);
+            break;
+        case 1:
+            pix2ang_nest(num, &pix[0], &theta[0], &phi[0]);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Store coordinate system dependent result
+    switch (m_coordsys) {
+    case 0:
+        for (int i = 0; i < num; ++i) {
+            dirs[i].radec(phi[i], gammalib::pihalf - theta[i]);
+        }
+        break;
+    case 1:
+        for (int i = 0; i < num; ++i) {
+            dirs[i].lb(phi[i], gammalib::pihalf - theta[i]);
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pixels for sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Pixel numbers.
+ *
+ * Computes the pixel numbers for an array of sky directions. The ordering
+ * and coordinate system are resolved once for the entire array.
+ ***************************************************************************/
+std::vector<int> GWcsHPX::dir2pix(const std::vector<GSkyDir>& dirs) const
+{
+    // Allocate result
+    int              num = dirs.size();
+    std::vector<int> pix(num, 0);
+
+    // Compute coordinate system dependent (z,phi)
+    std::vector<double> z(num, 0.0);
+    std::vector<double> phi(num, 0.0);
+    switch (m_coordsys) {
+    case 0:
+        for (int i = 0; i < num; ++i) {
+            z[i]   = std::cos(gammalib::pihalf - dirs[i].dec());
+            phi[i] = dirs[i].ra();
+        }
+        break;
+    case 1:
+        for (int i = 0; i < num; ++i) {
+            z[i]   = std::cos(gammalib::pihalf - dirs[i].b());
+            phi[i] = dirs[i].l();
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Perform ordering dependent conversion
+    if (num > 0) {
+        switch (m_ordering) {
+        case 0:
+            ang2pix_z_phi_ring(num, &z[0], &phi[0], &pix[0]);
+            break;
+        case 1:
+            ang2pix_z_phi_nest(num, &z[0], &phi[0], &pix[0]);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Return pixel numbers
+    return pix;
+}
+
+
 /***********************************************************************//**
  * @brief Returns sky direction of pixel
  *
@@ -589,6 +710,142 @@ void GWcsHPX::ordering(const std::string& ordering)
 }
 
 
+/***********************************************************************//**
+ * @brief Convert pixel index from ring to nested ordering
+ *
+ * @param[in] pix Pixel index in ring ordering (0,1,...,m_num_pixels-1).
+ * @return Pixel index in nested ordering.
+ *
+ * @exception GException::out_of_range
+ *            Pixel index is out of range.
+ *
+ * Returns the nested pixel index of a pixel that is given in ring ordering,
+ * irrespective of the ordering of the projection.
+ ***************************************************************************/
+int GWcsHPX::ring2nest(const int& pix) const
+{
+    // Check if pixel index is in range
+    if (pix < 0 || pix >= m_num_pixels) {
+        throw GException::out_of_range(G_RING2NEST, pix, 0, m_num_pixels-1);
+    }
+
+    // Declare ring variables
+    int nl2 = 2 * m_nside;
+    int nl4 = 4 * m_nside;
+    int iring;
+    int iphi;
+    int kshift;
+    int nr;
+    int face_num;
+
+    // North Polar cap
+    if (pix < m_ncap) {
+        iring    = (1 + isqrt(1+2*pix)) >> 1;       // counted from North pole
+        iphi     = (pix+1) - 2*iring*(iring-1);
+        kshift   = 0;
+        nr       = iring;
+        face_num = (iphi-1) / nr;
+    }
+
+    // Equatorial region
+    else if (pix < (m_num_pixels - m_ncap)) {
+        int ip   = pix - m_ncap;
+        int tmp  = ip >> (m_order+2);
+        iring    = tmp + m_nside;                   // counted from North pole
+        iphi     = ip - tmp*nl4 + 1;
+        kshift   = (iring+m_nside) & 1;
+        nr       = m_nside;
+        int ire  = iring - m_nside + 1;
+        int irm  = nl2 + 2 - ire;
+        int ifm  = (iphi - ire/2 + m_nside - 1) >> m_order;
+        int ifp  = (iphi - irm/2 + m_nside - 1) >> m_order;
+        face_num = (ifp == ifm) ? (ifp | 4) : ((ifp < ifm) ? ifp : (ifm + 8));
+    }
+
+    // South Polar cap
+    else {
+        int ip   = m_num_pixels - pix;
+        iring    = (1 + isqrt(2*ip-1)) >> 1;        // counted from South pole
+        iphi     = 4*iring + 1 - (ip - 2*iring*(iring-1));
+        kshift   = 0;
+        nr       = iring;
+        iring    = nl4 - iring;                     // counted from North pole
+        face_num = 8 + (iphi-1) / nr;
+    }
+
+    // Compute (x,y) coordinates within the face
+    int irt = iring - (jrll[face_num] * m_nside) + 1;
+    int ipt = 2*iphi - jpll[face_num]*nr - kshift - 1;
+    if (ipt >= nl2) {
+        ipt -= 8 * m_nside;
+    }
+    int ix = (ipt - irt) >> 1;
+    int iy = (-ipt - irt) >> 1;
+
+    // Return nested pixel index
+    return (face_num << (2*m_order)) + xy2pix(ix, iy);
+}
+
+
+/***********************************************************************//**
+ * @brief Convert pixel index from nested to ring ordering
+ *
+ * @param[in] pix Pixel index in nested ordering (0,1,...,m_num_pixels-1).
+ * @return Pixel index in ring ordering.
+ *
+ * @exception GException::out_of_range
+ *            Pixel index is out of range.
+ *
+ * Returns the ring pixel index of a pixel that is given in nested ordering,
+ * irrespective of the ordering of the projection.
+ ***************************************************************************/
+int GWcsHPX::nest2ring(const int& pix) const
+{
+    // Check if pixel index is in range
+    if (pix < 0 || pix >= m_num_pixels) {
+        throw GException::out_of_range(G_NEST2RING, pix, 0, m_num_pixels-1);
+    }
+
+    // Get face number and pixel coordinates
+    int nl4      = 4 * m_nside;
+    int face_num = pix >> (2*m_order);
+    int ix;
+    int iy;
+    pix2xy(pix & (m_npface - 1), &ix, &iy);
+
+    // Get ring number counted from North pole
+    int jr = (jrll[face_num] << m_order) - ix - iy - 1;
+
+    // Get number of pixels in ring and number of pixels in preceding rings
+    int nr;
+    int n_before;
+    int kshift;
+    if (jr < m_nside) {
+        nr       = jr;
+        n_before = 2*nr*(nr-1);
+        kshift   = 0;
+    }
+    else if (jr > 3*m_nside) {
+        nr       = nl4 - jr;
+        n_before = m_num_pixels - 2*(nr+1)*nr;
+        kshift   = 0;
+    }
+    else {
+        nr       = m_nside;
+        n_before = m_ncap + (jr-m_nside)*nl4;
+        kshift   = (jr-m_nside) & 1;
+    }
+
+    // Get pixel index in ring
+    int jp = (jpll[face_num]*nr + ix - iy + 1 + kshift) / 2;
+    if (jp > nl4) jp -= nl4;
+    if (jp <   1) jp += nl4;
+
+    // Return ring pixel index
+    return n_before + jp - 1;
+}
+
+
 /***********************************************************************//**
  * @brief Print WCS information
  *
@@ -653,16 +910,6 @@ void GWcsHPX::init_members(void)
     m_fact2       = 0.0;
     m_omega       = 0.0;
 
-    // Construct conversion arrays
-    for (int m = 0; m < 0x100; ++m) {
-    ctab[m] =
-         (m&0x1 )       | ((m&0x2 ) << 7) | ((m&0x4 ) >> 1) | ((m&0x8 ) << 6)
-      | ((m&0x10) >> 2) | ((m&0x20) << 5) | ((m&0x40) >> 3) | ((m&0x80) << 4);
-    utab[m] =
-         (m&0x1 )       | ((m&0x2 ) << 1) | ((m&0x4 ) << 2) | ((m&0x8 ) << 3)
-      | ((m&0x10) << 4) | ((m&0x20) << 5) | ((m&0x40) << 6) | ((m&0x80) << 7);
-    }
-
     // Return
     return;
 }
@@ -765,13 +1012,9 @@ int GWcsHPX::nside2order(int nside)
  ***************************************************************************/
 void GWcsHPX::pix2xy(const int& ipix, int* x, int* y) const
 {
-    // Set x coordinate
-    int raw = (ipix & 0x5555) | ((ipix & 0x55550000) >> 15);
-    *x      = ctab[raw & 0xff] | (ctab[raw >> 8] << 4);
-
-    // Set y coordinate
-    raw = ((ipix & 0xaaaa) >> 1) | ((ipix & 0xaaaa0000) >> 16);
-    *y  = ctab[raw & 0xff] | (ctab[raw >> 8] << 4);
+    // Set x and y coordinates from the even and odd bits
+    *x = compress_bits(ipix);
+    *y = compress_bits(ipix >> 1);
 
     // Return
     return;
@@ -787,7 +1030,7 @@ void GWcsHPX::pix2xy(const int& ipix, int* x, int* y) const
 int GWcsHPX::xy2pix(int x, int y) const
 {
     // Return pixel
-    return utab[x&0xff] | (utab[x>>8]<<16) | (utab[y&0xff]<<1) | (utab[y>>8]<<17);
+    return spread_bits(x) | (spread_bits(y) << 1);
 }
 
 
@@ -1020,6 +1263,288 @@ int GWcsHPX::ang2pix_z_phi_nest(double z, double phi) const
 }
 
 
+/***********************************************************************//**
+ * @brief Convert pixel indices to (theta,phi) angles for ring ordering
+ *
+ * @param[in] num Number of pixels.
+ * @param[in] ipix Pixel indices for which (theta,phi) are to be computed.
+ * @param[out] theta Result zenith angles in radians.
+ * @param[out] phi Result azimuth angles in radians.
+ *
+ * Bulk version of pix2ang_ring(). The pixel indices are assumed to be in
+ * range. The cosine of the zenith angle is computed for all pixels before
+ * the arc cosine is taken in a separate loop that the compiler can
+ * vectorise.
+ ***************************************************************************/
+void GWcsHPX::pix2ang_ring(const int& num, const int* ipix,
+                           double* theta, double* phi) const
+{
+    // Set constants
+    int nl2    = 2 * m_nside;
+    int nl4    = 4 * m_nside;
+    int nsouth = m_num_pixels - m_ncap;
+
+    // Compute cos(theta) and phi
+    for (int i = 0; i < num; ++i) {
+        int pix = ipix[i];
+        if (pix < m_ncap) {
+            int iring = (1 + isqrt(1+2*pix)) >> 1;
+            int iphi  = (pix+1) - 2*iring*(iring-1);
+            theta[i]  = 1.0 - (iring*iring) * m_fact2;
+            phi[i]    = (iphi - 0.5) * gammalib::pi/(2.0*iring);
+        }
+        else if (pix < nsouth) {
+            int    ip    = pix - m_ncap;
+            int    iring = ip/nl4 + m_nside;
+            int    iphi  = ip%nl4 + 1;
+            double fodd  = ((iring+m_nside)&1) ? 1 : 0.5;
+            theta[i]     = (nl2 - iring) * m_fact1;
+            phi[i]       = (iphi - fodd) * gammalib::pi/nl2;
+        }
+        else {
+            int ip    = m_num_pixels - pix;
+            int iring = (1 + isqrt(2*ip-1)) >> 1;
+            int iphi  = 4*iring + 1 - (ip - 2*iring*(iring-1));
+            theta[i]  = -1.0 + (iring*iring) * m_fact2;
+            phi[i]    = (iphi - 0.5) * gammalib::pi/(2.*iring);
+        }
+    }
+
+    // Convert cos(theta) into theta
+    for (int i = 0; i < num; ++i) {
+        theta[i] = std::acos(theta[i]);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Convert pixel indices to (theta,phi) angles for nested ordering
+ *
+ * @param[in] num Number of pixels.
+ * @param[in] ipix Pixel indices for which (theta,phi) are to be computed.
+ * @param[out] theta Result zenith angles in radians.
+ * @param[out] phi Result azimuth angles in radians.
+ *
+ * Bulk version of pix2ang_nest(). The pixel indices are assumed to be in
+ * range. The bit de-interleaving of all pixel indices is done in a first
+ * loop, the geometry in a second and the arc cosine in a third loop, so
+ * that the first and last loops can be vectorised by the compiler.
+ ***************************************************************************/
+void GWcsHPX::pix2ang_nest(const int& num, const int* ipix,
+                           double* theta, double* phi) const
+{
+    // Set constants
+    int nl4   = 4 * m_nside;
+    int mask  = m_npface - 1;
+    int shift = 2 * m_order;
+
+    // Get pixel coordinates within faces
+    std::vector<int> ix(num);
+    std::vector<int> iy(num);
+    for (int i = 0; i < num; ++i) {
+        int ipf = ipix[i] & mask;
+        ix[i]   = compress_bits(ipf);
+        iy[i]   = compress_bits(ipf >> 1);
+    }
+
+    // Compute cos(theta) and phi
+    for (int i = 0; i < num; ++i) {
+
+        // Get face number and ring number
+        int face_num = ipix[i] >> shift;
+        int jr       = (jrll[face_num] << m_order) - ix[i] - iy[i] - 1;
+
+        // Get region dependent parameters
+        int    nr;
+        double z;
+        int    kshift;
+        if (jr < m_nside) {
+            nr     = jr;
+            z      = 1. - nr*nr*m_fact2;
+            kshift = 0;
+        }
+        else if (jr > 3*m_nside) {
+            nr     = nl4 - jr;
+            z      = nr*nr*m_fact2 - 1;
+            kshift = 0;
+        }
+        else {
+            nr     = m_nside;
+            z      = (2*m_nside-jr) * m_fact1;
+            kshift = (jr-m_nside) & 1;
+        }
+
+        // Computes the phi coordinate on the sphere, in [0,2Pi]
+        int jp = (jpll[face_num]*nr + ix[i] - iy[i] + 1 + kshift) / 2;
+        if (jp > nl4) jp -= nl4;
+        if (jp <   1) jp += nl4;
+
+        // Store result
+        theta[i] = z;
+        phi[i]   = (jp - (kshift+1)*0.5) * (gammalib::pihalf / nr);
+
+    } // endfor: looped over pixels
+
+    // Convert cos(theta) into theta
+    for (int i = 0; i < num; ++i) {
+        theta[i] = std::acos(theta[i]);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pixels which contain angular coordinates (z,phi) for
+ *        ring ordering
+ *
+ * @param[in] num Number of coordinates.
+ * @param[in] z Cosines of zenith angles - cos(theta).
+ * @param[in] phi Azimuth angles in radians.
+ * @param[out] ipix Pixel indices.
+ *
+ * Bulk version of ang2pix_z_phi_ring().
+ ***************************************************************************/
+void GWcsHPX::ang2pix_z_phi_ring(const int& num, const double* z,
+                                 const double* phi, int* ipix) const
+{
+    // Set constants
+    int nl4 = 4 * m_nside;
+
+    // Loop over coordinates
+    for (int i = 0; i < num; ++i) {
+
+        // Setup
+        double za = std::fabs(z[i]);
+        double tt = gammalib::modulo(phi[i], gammalib::twopi) *
+                    gammalib::inv_pihalf; // in [0,4)
+
+        // Equatorial region
+        if (za <= gammalib::twothird) {
+            double temp1  = m_nside*(0.5+tt);
+            double temp2  = m_nside*z[i]*0.75;
+            int    jp     = int(temp1-temp2);
+            int    jm     = int(temp1+temp2);
+            int    ir     = m_nside + 1 + jp - jm;
+            int    kshift = 1 - (ir & 1);
+            int    ip     = (jp+jm-m_nside+kshift+1)/2;
+            ip            = int(gammalib::modulo(ip,nl4));
+            ipix[i]       = m_ncap + (ir-1)*nl4 + ip;
+        }
+
+        // North & South polar caps
+        else {
+            double tp  = tt - int(tt);
+            double tmp = m_nside * std::sqrt(3*(1-za));
+            int    jp  = int(tp*tmp);
+            int    jm  = int((1.0-tp)*tmp);
+            int    ir  = jp + jm + 1;
+            int    ip  = int(tt*ir);
+            ip = int(gammalib::modulo(ip,4*ir));
+            if (z[i] > 0) {
+                ipix[i] = 2*ir*(ir-1) + ip;
+            }
+            else {
+                ipix[i] = m_num_pixels - 2*ir*(ir+1) + ip;
+            }
+        }
+
+    } // endfor: looped over coordinates
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pixels which contain angular coordinates (z,phi) for
+ *        nested ordering
+ *
+ * @param[in] num Number of coordinates.
+ * @param[in] z Cosines of zenith angles - cos(theta).
+ * @param[in] phi Azimuth angles in radians.
+ * @param[out] ipix Pixel indices.
+ *
+ * Bulk version of ang2pix_z_phi_nest(). The face numbers and the (x,y)
+ * coordinates within the faces are computed in a first loop, the bit
+ * interleaving in a second loop that the compiler can vectorise.
+ ***************************************************************************/
+void GWcsHPX::ang2pix_z_phi_nest(const int& num, const double* z,
+                                 const double* phi, int* ipix) const
+{
+    // Allocate face coordinates
+    std::vector<int> ix(num);
+    std::vector<int> iy(num);
+
+    // Compute face numbers (stored in ipix) and face coordinates
+    for (int i = 0; i < num; ++i) {
+
+        // Setup
+        double za = std::fabs(z[i]);
+        double tt = gammalib::modulo(phi[i], gammalib::twopi) *
+                    gammalib::inv_pihalf; // in [0,4)
+
+        // Equatorial region
+        if (za <= gammalib::twothird) {
+            double temp1 = ns_max*(0.5+tt);
+            double temp2 = ns_max*z[i]*0.75;
+            int    jp    = int(temp1-temp2);
+            int    jm    = int(temp1+temp2);
+            int    ifp   = jp >> order_max;
+            int    ifm   = jm >> order_max;
+            if (ifp == ifm) {
+                ipix[i] = (ifp==4) ? 4: ifp+4;
+            }
+            else if (ifp < ifm) {
+                ipix[i] = ifp;
+            }
+            else {
+                ipix[i] = ifm + 8;
+            }
+            ix[i] = jm & (ns_max-1);
+            iy[i] = ns_max - (jp & (ns_max-1)) - 1;
+        }
+
+        // Polar region, za > 2/3
+        else {
+            int    ntt = int(tt);
+            double tp  = tt-ntt;
+            double tmp = ns_max * std::sqrt(3*(1-za));
+            int    jp  = int(tp*tmp);
+            int    jm  = int((1.0-tp)*tmp);
+            if (jp >= ns_max) jp = ns_max-1;
+            if (jm >= ns_max) jm = ns_max-1;
+            if (z[i] >= 0) {
+                ipix[i] = ntt;
+                ix[i]   = ns_max - jm - 1;
+                iy[i]   = ns_max - jp - 1;
+            }
+            else {
+                ipix[i] = ntt + 8;
+                ix[i]   = jp;
+                iy[i]   = jm;
+            }
+        }
+
+    } // endfor: looped over coordinates
+
+    // Interleave face coordinates and add face offsets
+    int shift_ipf  = 2 * (order_max - m_order);
+    int shift_face = 2 * m_order;
+    for (int i = 0; i < num; ++i) {
+        int ipf = (spread_bits(ix[i]) | (spread_bits(iy[i]) << 1)) >> shift_ipf;
+        ipix[i] = ipf + (ipix[i] << shift_face);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Integer n that fulfills n*n <= arg < (n+1)*(n+1)
  *
@@ -1072,3 +1597,58 @@ int GWcsHPX::prj_s2x(int nphi, int ntheta, int spt, int sxy,
     // Return
     return 0;
 }
+
+
+/*==========================================================================
+ =                                                                         =
+ =                             Local functions                             =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Spread the lower 16 bits of an integer to the even bits
+ *
+ * @param[in] v Integer (0,...,0xffff).
+ * @return Integer with bit n of @p v moved to bit 2n.
+ *
+ * Uses the BMI2 parallel bit deposit instruction if the library is compiled
+ * for a processor that supports it, and a branch-free shift-and-mask
+ * sequence otherwise. Both replace the former lookup tables and allow the
+ * compiler to vectorise the loops in which they are used.
+ ***************************************************************************/
+static inline int spread_bits(const int& v)
+{
+    #if defined(__BMI2__)
+    return (int)_pdep_u32((unsigned int)v, 0x55555555u);
+    #else
+    unsigned int x = (unsigned int)v & 0x0000ffffu;
+    x = (x | (x << 8)) & 0x00ff00ffu;
+    x = (x | (x << 4)) & 0x0f0f0f0fu;
+    x = (x | (x << 2)) & 0x33333333u;
+    x = (x | (x << 1)) & 0x55555555u;
+    return (int)x;
+    #endif
+}
+
+
+/***********************************************************************//**
+ * @brief Compress the even bits of an integer into the lower 16 bits
+ *
+ * @param[in] v Integer.
+ * @return Integer with bit 2n of @p v moved to bit n.
+ *
+ * Inverse of spread_bits(); the odd bits of @p v are ignored.
+ ***************************************************************************/
+static inline int compress_bits(const int& v)
+{
+    #if defined(__BMI2__)
+    return (int)_pext_u32((unsigned int)v, 0x55555555u);
+    #else
+    unsigned int x = (unsigned int)v & 0x55555555u;
+    x = (x | (x >> 1)) & 0x33333333u;
+    x = (x | (x >> 2)) & 0x0f0f0f0fu;
+    x = (x | (x >> 4)) & 0x00ff00ffu;
+    x = (x | (x >> 8)) & 0x0000ffffu;
+    return (int)x;
+    #endif
+}
@@ -57,6 +57,7 @@
 
 /* __ Coding definitions _________________________________________________ */
 //#define G_LIN_MATINV_FORCE_PC                             // Force PC usage
+#define G_BULK_CHUNK         1024   //!< Coordinates per bulk transformation
 
 /* __ Debug definitions __________________________________________________ */
 //#define G_DIR2XY_DEBUG                                      // Debug dir2xy
@@ -643,6 +644,129 @@ GSkyPixel GWcslib::dir2xy(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of sky pixels
+ *
+ * @param[in] pix Sky pixels.
+ * @return Sky directions.
+ *
+ * Transforms an array of sky pixels into sky directions. The pixels are
+ * passed in chunks of G_BULK_CHUNK coordinates through the pixel-to-world
+ * transformation chain, so that the linear transformation, the
+ * deprojection and the spherical rotation are each evaluated in a single
+ * loop over all coordinates of a chunk.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcslib::xy2dir(const std::vector<GSkyPixel>& pix) const
+{
+    // Allocate result
+    int                  num = pix.size();
+    std::vector<GSkyDir> dirs(num);
+
+    // Allocate memory for transformation
+    std::vector<double> pixcrd(2*G_BULK_CHUNK);
+    std::vector<double> imgcrd(2*G_BULK_CHUNK);
+    std::vector<double> phi(G_BULK_CHUNK);
+    std::vector<double> theta(G_BULK_CHUNK);
+    std::vector<double> world(2*G_BULK_CHUNK);
+    std::vector<int>    stat(G_BULK_CHUNK);
+
+    // Loop over chunks
+    for (int start = 0; start < num; start += G_BULK_CHUNK) {
+
+        // Determine number of coordinates in chunk
+        int ncoord = (num - start < G_BULK_CHUNK) ? num - start : G_BULK_CHUNK;
+
+        // Set sky pixels. We have to add 1.0 here as the WCS pixel
+        // reference (CRPIX) starts from one while GSkyPixel starts from 0.
+        for (int i = 0; i < ncoord; ++i) {
+            pixcrd[2*i]   = pix[start+i].x() + 1.0;
+            pixcrd[2*i+1] = pix[start+i].y() + 1.0;
+        }
+
+        // Transform pixel-to-world coordinates
+        wcs_p2s(ncoord, 2, &pixcrd[0], &imgcrd[0], &phi[0], &theta[0],
+                &world[0], &stat[0]);
+
+        // Set sky directions
+        if (m_coordsys == 0) {
+            for (int i = 0; i < ncoord; ++i) {
+                dirs[start+i].radec_deg(world[2*i], world[2*i+1]);
+            }
+        }
+        else {
+            for (int i = 0; i < ncoord; ++i) {
+                dirs[start+i].lb_deg(world[2*i], world[2*i+1]);
+            }
+        }
+
+    } // endfor: looped over chunks
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Sky pixels.
+ *
+ * Transforms an array of sky directions into sky pixels. The sky
+ * directions are passed in chunks of G_BULK_CHUNK coordinates through the
+ * world-to-pixel transformation chain.
+ ***************************************************************************/
+std::vector<GSkyPixel> GWcslib::dir2xy(const std::vector<GSkyDir>& dirs) const
+{
+    // Allocate result
+    int                    num = dirs.size();
+    std::vector<GSkyPixel> pix(num);
+
+    // Allocate memory for transformation
+    std::vector<double> pixcrd(2*G_BULK_CHUNK);
+    std::vector<double> imgcrd(2*G_BULK_CHUNK);
+    std::vector<double> phi(G_BULK_CHUNK);
+    std::vector<double> theta(G_BULK_CHUNK);
+    std::vector<double> world(2*G_BULK_CHUNK);
+    std::vector<int>    stat(G_BULK_CHUNK);
+
+    // Loop over chunks
+    for (int start = 0; start < num; start += G_BULK_CHUNK) {
+
+        // Determine number of coordinates in chunk
+        int ncoord = (num - start < G_BULK_CHUNK) ? num - start : G_BULK_CHUNK;
+
+        // Set world coordinates
+        if (m_coordsys == 0) {
+            for (int i = 0; i < ncoord; ++i) {
+                world[2*i]   = dirs[start+i].ra_deg();
+                world[2*i+1] = dirs[start+i].dec_deg();
+            }
+        }
+        else {
+            for (int i = 0; i < ncoord; ++i) {
+                world[2*i]   = dirs[start+i].l_deg();
+                world[2*i+1] = dirs[start+i].b_deg();
+            }
+        }
+
+        // Transform world-to-pixel coordinates
+        wcs_s2p(ncoord, 2, &world[0], &phi[0], &theta[0], &imgcrd[0],
+                &pixcrd[0], &stat[0]);
+
+        // Set sky pixels. We have to subtract 1 here as GSkyPixel starts
+        // from zero while the WCS reference (CRPIX) starts from one.
+        for (int i = 0; i < ncoord; ++i) {
+            pix[start+i] = GSkyPixel(pixcrd[2*i]-1.0, pixcrd[2*i+1]-1.0);
+        }
+
+    } // endfor: looped over chunks
+
+    // Return sky pixels
+    return pix;
+}
+
+
 /***********************************************************************//**
  * @brief Set World Coordinate System parameters
  *
@@ -1071,7 +1195,9 @@ void GWcslib::wcs_set(void) const
     // Initialize the linear transformation
     lin_set();
     
-    // Signal that WCS is set
+    // Signal that WCS is set. The flush makes sure that the WCS information
+    // is visible to other threads before the signal.
+    #pragma omp flush
     m_wcsset = true;
     
     // Return
@@ -1205,9 +1331,19 @@ void GWcslib::wcs_set_ctype(void) const
 void GWcslib::wcs_p2s(int ncoord, int nelem, const double* pixcrd, double* imgcrd,
                       double* phi, double* theta, double* world, int* stat) const
 {
-    // Initialize if required
-    if (!m_wcsset)
-        wcs_set();
+    // Initialize if required. This is done in a critical zone as several
+    // threads may request the first transformation at the same time. The
+    // flush makes sure that a thread that found the WCS set also sees the
+    // WCS information that has been flushed by wcs_set().
+    if (!m_wcsset) {
+        #pragma omp critical(GWcslib_wcs_set)
+        {
+            if (!m_wcsset) {
+                wcs_set();
+            }
+        }
+    }
+    #pragma omp flush
     
     // Sanity check
     if (ncoord < 1 || (ncoord > 1 && nelem < m_naxis)) {
@@ -1271,9 +1407,19 @@ void GWcslib::wcs_s2p(int ncoord, int nelem, const double* world,
                       double* phi, double* theta,  double* imgcrd,
                       double* pixcrd, int* stat) const
 {
-    // Initialize if required
-    if (!m_wcsset)
-        wcs_set();
+    // Initialize if required. This is done in a critical zone as several
+    // threads may request the first transformation at the same time. The
+    // flush makes sure that a thread that found the WCS set also sees the
+    // WCS information that has been flushed by wcs_set().
+    if (!m_wcsset) {
+        #pragma omp critical(GWcslib_wcs_set)
+        {
+            if (!m_wcsset) {
+                wcs_set();
+            }
+        }
+    }
+    #pragma omp flush
     
     // Sanity check
     if (ncoord < 1 || (ncoord > 1 && nelem < m_naxis)) {
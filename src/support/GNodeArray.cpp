@@ -37,6 +37,7 @@
 #define G_ACCESS                                "GNodeArray::operator[](int)"
 #define G_INTERPOLATE "GNodeArray::interpolate(double&,std::vector<double>&)"
 #define G_SET_VALUE                          "GNodeArray::set_value(double&)"
+#define G_WEIGHTS "GNodeArray::weights(double&,int&,int&,double&,double&)"
 #define G_SETUP                                         "GNodeArray::setup()"
 
 /* __ Macros _____________________________________________________________ */
@@ -211,7 +212,7 @@ double& GNodeArray::operator[](const int& index)
     #endif
 
     // Signal that setup needs to be called
-    m_need_setup = false;
+    m_need_setup = true;
 
     // Return node
     return m_node[index];
@@ -236,9 +237,6 @@ const double& GNodeArray::operator[](const int& index) const
     }
     #endif
 
-    // Signal that setup needs to be called
-    m_need_setup = false;
-
     // Return node
     return m_node[index];
 }
@@ -391,6 +389,9 @@ void GNodeArray::append(const double& node)
  *
  * This method performs a linear interpolation of values \f$y_i\f$. The
  * corresponding values \f$x_i\f$ are stored in the node array.
+ *
+ * The method does not modify the evaluation cache of the node array, and
+ * can therefore be used concurrently by several threads.
  ***************************************************************************/
 double GNodeArray::interpolate(const double& value,
                                const std::vector<double>& vector) const
@@ -406,12 +407,17 @@ double GNodeArray::interpolate(const double& value,
                                           vector.size());
     }
     
-    // Set interpolation value (circumvent const correctness)
-    set_value(value);
+    // Get indices and weighting factors. We do not use the evaluation
+    // cache here so that the method can be called concurrently.
+    int    inx_left;
+    int    inx_right;
+    double wgt_left;
+    double wgt_right;
+    weights(value, inx_left, inx_right, wgt_left, wgt_right);
 
     // Interpolate
-    double y = vector[inx_left()]  * wgt_left() +
-               vector[inx_right()] * wgt_right();
+    double y = vector[inx_left]  * wgt_left +
+               vector[inx_right] * wgt_right;
 
     // Return
     return y;
@@ -459,65 +465,107 @@ void GNodeArray::set_value(const double& value) const
 
     // Continue only if computation is required
     if (compute) {
+        weights(value, m_inx_left, m_inx_right, m_wgt_left, m_wgt_right);
+    }
 
-        // If array is linear then get left index from analytic formula
-        if (m_is_linear) {
+    // Store last value and signal availability
+    m_last_value     = value;
+    m_has_last_value = true;
 
-            // Set left index
-            m_inx_left = int(m_linear_slope * value + m_linear_offset);
-        
-            // Keep index in valid range
-            if (m_inx_left < 0) {
-                m_inx_left = 0;
-            }
-            else if (m_inx_left >= nodes-1) {
-                m_inx_left = nodes - 2;
-            }
+    // Return
+    return;
+}
 
-        } // endif: array is linear
 
-        // ... otherwise search the relevant indices by bisection
-        else {
-    
-            // Set left index if value is before first node
-            if (value < m_node[0]) {
-                m_inx_left = 0;
-            }
+/***********************************************************************//**
+ * @brief Compute indices and weighting factors for interpolation
+ *
+ * @param[in] value Value for which the interpolation should be done.
+ * @param[out] inx_left Index of left node.
+ * @param[out] inx_right Index of right node.
+ * @param[out] wgt_left Weight of left node.
+ * @param[out] wgt_right Weight of right node.
+ *
+ * @exception GException::not_enough_nodes
+ *            At least two nodes are required for setting up the factors
+ *
+ * Computes the indices that bound the specified value and the
+ * corresponding weighting factors for linear interpolation. Contrary to
+ * set_value(), the results are returned in the arguments and the node
+ * array is not modified. The method can therefore be called concurrently
+ * by several threads.
+ *
+ * The precomputed linear array parameters are only used if they are up
+ * to date. Otherwise, i.e. if nodes have been modified through the node
+ * access operator, the indices are searched by bisection.
+ ***************************************************************************/
+void GNodeArray::weights(const double& value,
+                         int&          inx_left,
+                         int&          inx_right,
+                         double&       wgt_left,
+                         double&       wgt_right) const
+{
+    // Get number of nodes
+    int nodes = m_node.size();
 
-            // Set left index if value is after last node
-            else if (value >  m_node[nodes-1]) {
-                m_inx_left = nodes - 2;
-            }
+    // Throw an exception if less than 2 nodes are available
+    if (nodes < 2) {
+        throw GException::not_enough_nodes(G_WEIGHTS, nodes);
+    }
 
-            // Set left index by bisection
-            else {
-                int low  = 0;
-                int high = nodes - 1;
-                while ((high - low) > 1) {
-                    int mid = (low+high) / 2;
-                    if (m_node[mid] > value) {
-                        high = mid;
-                    }
-                    else {
-                        low = mid;
-                    }
-                }
-                m_inx_left = low;
-            } // endelse: did bisection
+    // If array is linear then get left index from analytic formula
+    if (m_is_linear && !m_need_setup) {
+
+        // Set left index
+        inx_left = int(m_linear_slope * value + m_linear_offset);
+
+        // Keep index in valid range
+        if (inx_left < 0) {
+            inx_left = 0;
+        }
+        else if (inx_left >= nodes-1) {
+            inx_left = nodes - 2;
+        }
+
+    } // endif: array is linear
+
+    // ... otherwise search the relevant indices by bisection
+    else {
+
+        // Set left index if value is before first node
+        if (value < m_node[0]) {
+            inx_left = 0;
         }
 
-        // Set right index
-        m_inx_right = m_inx_left + 1;
+        // Set left index if value is after last node
+        else if (value >  m_node[nodes-1]) {
+            inx_left = nodes - 2;
+        }
 
-        // Set weighting factors
-        m_wgt_right = (value - m_node[m_inx_left]) / m_step[m_inx_left];
-        m_wgt_left  = 1.0 - m_wgt_right;
+        // Set left index by bisection
+        else {
+            int low  = 0;
+            int high = nodes - 1;
+            while ((high - low) > 1) {
+                int mid = (low+high) / 2;
+                if (m_node[mid] > value) {
+                    high = mid;
+                }
+                else {
+                    low = mid;
+                }
+            }
+            inx_left = low;
+        } // endelse: did bisection
+    }
 
-    } // endif: computation was required
+    // Set right index
+    inx_right = inx_left + 1;
 
-    // Store last value and signal availability
-    m_last_value     = value;
-    m_has_last_value = true;
+    // Set weighting factors
+    wgt_right = (value - m_node[inx_left]) /
+                (m_node[inx_right] - m_node[inx_left]);
+    wgt_left  = 1.0 - wgt_right;
 
     // Return
     return;
@@ -40,6 +40,11 @@
 #include <algorithm>
 #include "GTools.hpp"
 
+/* __ OpenMP section _____________________________________________________ */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* __ Compile options ____________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
@@ -824,3 +829,102 @@ bool gammalib::file_exists(const std::string& filename)
     // Return result
     return result;
 }
+
+
+/***********************************************************************//**
+ * @brief Return thread number of calling thread
+ *
+ * @return Thread number [0,...,max_threads()-1].
+ *
+ * Returns the number of the calling thread within the current team of
+ * threads. If OpenMP is not enabled, or if the function is called outside
+ * a parallel region, 0 is returned.
+ ***************************************************************************/
+int gammalib::thread_id(void)
+{
+    // Get thread number
+    #ifdef _OPENMP
+    int id = omp_get_thread_num();
+    #else
+    int id = 0;
+    #endif
+
+    // Return thread number
+    return id;
+}
+
+
+/***********************************************************************//**
+ * @brief Return maximum number of threads
+ *
+ * @return Maximum number of threads.
+ *
+ * Returns the maximum number of threads that will be used for a parallel
+ * region. If OpenMP is not enabled, 1 is returned.
+ ***************************************************************************/
+int gammalib::max_threads(void)
+{
+    // Get maximum number of threads
+    #ifdef _OPENMP
+    int num = omp_get_max_threads();
+    #else
+    int num = 1;
+    #endif
+
+    // Return maximum number of threads
+    return num;
+}
+
+
+/***********************************************************************//**
+ * @brief Return checksum of a block of data
+ *
+ * @param[in] data Pointer to data.
+ * @param[in] size Size of data in bytes.
+ * @return Checksum.
+ *
+ * Computes the 64 bit FNV-1a hash of a block of data. The checksum is
+ * meant to identify data content, for example as a cache key, and is not
+ * suited for cryptographic purposes.
+ ***************************************************************************/
+unsigned long long gammalib::checksum(const char* data, const size_t& size)
+{
+    // Set FNV-1a offset basis
+    const unsigned long long offset_basis = 0xcbf29ce484222325ULL;
+
+    // Return checksum
+    return (checksum(data, size, offset_basis));
+}
+
+
+/***********************************************************************//**
+ * @brief Continue checksum of a block of data
+ *
+ * @param[in] data Pointer to data.
+ * @param[in] size Size of data in bytes.
+ * @param[in] hash Checksum of preceding data.
+ * @return Checksum.
+ *
+ * Continues the 64 bit FNV-1a hash @p hash with a further block of data.
+ * This allows computing a checksum over data that are not contiguous in
+ * memory.
+ ***************************************************************************/
+unsigned long long gammalib::checksum(const char*               data,
+                                      const size_t&             size,
+                                      const unsigned long long& hash)
+{
+    // Set FNV-1a prime
+    const unsigned long long prime = 0x100000001b3ULL;
+
+    // Initialise checksum
+    unsigned long long result = hash;
+
+    // Hash all bytes
+    for (size_t i = 0; i < size; ++i) {
+        result ^= (unsigned long long)((unsigned char)data[i]);
+        result *= prime;
+    }
+
+    // Return checksum
+    return result;
+}
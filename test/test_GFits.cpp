@@ -869,6 +869,37 @@ void TestGFits::test_image_double(void)
     // Test 4D pixel access
     TEST_4D_ACCESS_IO(2,2,2,2)
 
+    // Open FITS image using memory mapping
+    GFits mapfile(filename, false, true);
+    ptr = mapfile.image(0);
+
+    // Test 4D pixel access
+    TEST_4D_ACCESS_IO(2,2,2,2)
+
+    // Check that the memory mapping is used for reading the pixels
+    test_assert(!infile.ismapped(), "Check that FITS file is not mapped");
+    test_assert(mapfile.ismapped(), "Check that FITS file is mapped");
+    test_assert(ptr->ismapped(), "Check that image pixels are mapped");
+
+    // Check that a copy of the image reads its pixels from the memory
+    // mapping after both openings of the file were closed
+    GFitsImage* copy = mapfile.image(0)->clone();
+    mapfile.close();
+    infile.close();
+    ptr = copy;
+    test_assert(ptr->ismapped(), "Check that image copy pixels are mapped");
+    TEST_4D_ACCESS_IO(2,2,2,2)
+    delete copy;
+
+    // Check that the memory mapping remains valid if a file that is
+    // opened twice is closed once
+    GFits mapfile1(filename, false, true);
+    GFits mapfile2(filename, false, true);
+    mapfile1.close();
+    ptr = mapfile2.image(0);
+    test_assert(ptr->ismapped(), "Check that image pixels are mapped");
+    TEST_4D_ACCESS_IO(2,2,2,2)
+
     // Return
     return;
 }
@@ -921,6 +952,66 @@ void TestGFits::test_bintable_double(void)
     // Test multiple column table
     TEST_TABLE2;
 
+    // Test chunked reading of rows
+    test_try("Read rows");
+    try {
+        GFits               fits(filename);
+        const GFitsTable*   table = fits.table(1);
+        std::vector<double> values(2*nvec);
+        (*table)["DOUBLE10"].read_rows(1, 2, &values[0]);
+        for (int i = 0; i < 2; ++i) {
+            for (int k = 0; k < nvec; ++k) {
+                test_value(values[i*nvec+k], col2(i+1,k), 1.0e-10);
+            }
+        }
+        test_assert(table->optimal_rows() > 0, "Check optimal number of rows");
+        fits.close();
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Read rows using memory mapping
+    test_try("Read rows with memory mapping");
+    try {
+        GFits               fits(filename, false, true);
+        std::vector<double> values(2*nvec);
+        (*fits.table(1))["DOUBLE10"].read_rows(1, 2, &values[0]);
+        for (int i = 0; i < 2; ++i) {
+            for (int k = 0; k < nvec; ++k) {
+                test_value(values[i*nvec+k], col2(i+1,k), 1.0e-10);
+            }
+        }
+        fits.close();
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Read tables back using memory mapping
+    test_try("Read Tables with memory mapping");
+    try {
+        GFits fits(filename, false, true);
+        col1 = static_cast<GFitsTableDoubleCol&>((*fits.table(1))["DOUBLE"]);
+        col2 = static_cast<GFitsTableDoubleCol&>((*fits.table(1))["DOUBLE10"]);
+        fits.close();
+        for (int i = 0; i < nrows; ++i) {
+            test_value(col1(i), double(i)*3.57+1.29, 1.0e-10);
+        }
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Test single column table
+    TEST_TABLE1;
+
+    // Test multiple column table
+    TEST_TABLE2;
+
     // Return
     return;
 }
@@ -1175,6 +1266,25 @@ void TestGFits::test_bintable_longlong(void)
     // Test multiple column table
     TEST_TABLE2_INT;
 
+    // Test chunked reading of integer rows
+    test_try("Read integer rows");
+    try {
+        GFits                  fits(filename);
+        const GFitsTable*      table = fits.table(1);
+        std::vector<long long> values(2*nvec);
+        (*table)["LONGLONG10"].read_rows(1, 2, &values[0]);
+        for (int i = 0; i < 2; ++i) {
+            for (int k = 0; k < nvec; ++k) {
+                test_value(int(values[i*nvec+k]), int(col2(i+1,k)));
+            }
+        }
+        fits.close();
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
     // Return
     return;
 }
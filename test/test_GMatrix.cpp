@@ -242,6 +242,7 @@ void TestGMatrix::set(void)
     append(static_cast<pfunction>(&TestGMatrix::matrix_arithmetics), "Test matrix arithmetics");
     append(static_cast<pfunction>(&TestGMatrix::matrix_functions), "Test matrix functions");
     append(static_cast<pfunction>(&TestGMatrix::matrix_compare), "Test matrix comparisons");
+    append(static_cast<pfunction>(&TestGMatrix::matrix_fixed), "Test fixed-size rotation matrix");
     //append(static_cast<pfunction>(&TestGMatrix::matrix_cholesky), "Test matrix Cholesky decomposition");
     append(static_cast<pfunction>(&TestGMatrix::matrix_print), "Test matrix printing");
 
@@ -445,6 +446,39 @@ void TestGMatrix::matrix_operations(void)
         test_try_failure(e);
     }
 
+    // Test multiplication of matrices that span several blocks
+    GMatrix big1(300,170);
+    GMatrix big2(170,90);
+    for (int row = 0; row < big1.rows(); ++row) {
+        for (int col = 0; col < big1.columns(); ++col) {
+            big1(row,col) = double((row*7 + col*3) % 11) - 5.0;
+        }
+    }
+    for (int row = 0; row < big2.rows(); ++row) {
+        for (int col = 0; col < big2.columns(); ++col) {
+            big2(row,col) = double((row*5 + col*2) % 13) - 6.0;
+        }
+    }
+    GMatrix test6 = big1 * big2;
+    result = (test6.rows() == 300 && test6.columns() == 90);
+    for (int row = 0; row < test6.rows() && result; ++row) {
+        for (int col = 0; col < test6.columns(); ++col) {
+            double value = 0.0;
+            for (int i = 0; i < big1.columns(); ++i) {
+                value += big1(row,i) * big2(i,col);
+            }
+            if (test6(row,col) != value) {
+                result = false;
+                break;
+            }
+        }
+    }
+    test_assert(result, "Test blocked matrix multiplication");
+
+    // Test unary multiplication of matrices that span several blocks
+    big1 *= big2;
+    test_assert(big1 == test6, "Test blocked unary matrix multiplication");
+
     // Return
     return;
 }
@@ -798,6 +832,76 @@ void TestGMatrix::matrix_cholesky(void)
 }
 */
 
+/***************************************************************************
+ * @brief Test fixed-size rotation matrix
+ *
+ * Checks that GMatrix3 and GVector3 give the same rotations as GMatrix and
+ * GVector.
+ ***************************************************************************/
+void TestGMatrix::matrix_fixed(void)
+{
+    // Set up rotation matrices
+    GMatrix  ry;
+    GMatrix  rz;
+    GMatrix3 ry3;
+    GMatrix3 rz3;
+    ry.eulery(-37.5);
+    rz.eulerz(-83.6);
+    ry3.eulery(-37.5);
+    rz3.eulerz(-83.6);
+    GMatrix  rot  = (ry * rz).transpose();
+    GMatrix3 rot3 = (ry3 * rz3).transpose();
+
+    // Check matrix elements
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            test_value(rot3(row,col), rot(row,col), 1.0e-14,
+                       "Check rotation matrix element");
+        }
+    }
+    test_assert(GMatrix3(rot) == rot3, "Check GMatrix constructor");
+    test_assert(rot3.matrix() == rot, "Check GMatrix conversion");
+
+    // Check vector rotation
+    GVector  native(0.3, -0.4, std::sqrt(0.75));
+    GVector3 native3(0.3, -0.4, std::sqrt(0.75));
+    GVector  cel  = rot * native;
+    GVector3 cel3 = rot3 * native3;
+    for (int i = 0; i < 3; ++i) {
+        test_value(cel3[i], cel[i], 1.0e-14, "Check rotated vector");
+    }
+    test_value(norm(cel3), 1.0, 1.0e-14, "Check norm of rotated vector");
+    test_value(cel3 * native3, cel * native, 1.0e-14, "Check scalar product");
+    GVector  cross1 = cross(cel, native);
+    GVector3 cross3 = cross(cel3, native3);
+    for (int i = 0; i < 3; ++i) {
+        test_value(cross3[i], cross1[i], 1.0e-14, "Check cross product");
+    }
+
+    // Check that transposed rotation is the inverse
+    GVector3 back = rot3.transpose() * cel3;
+    for (int i = 0; i < 3; ++i) {
+        test_value(back[i], native3[i], 1.0e-14, "Check inverse rotation");
+    }
+
+    // Check invalid matrix dimension
+    test_try("Check invalid matrix dimension");
+    try {
+        GMatrix3 invalid(GMatrix(3,4));
+        test_try_failure();
+    }
+    catch (GException::matrix_mismatch &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
 /***************************************************************************
  * @brief Test matrix printing
  ***************************************************************************/
@@ -1236,6 +1236,91 @@ void TestGMatrixSparse::matrix_cholesky(void)
     res = (ciz_residuals.abs()).max();
     test_value(res, 0.0, 1.0e-15, "Test compressed matrix Cholesky inverter");
 
+    // Test diagonal of inverse matrix from selected inversion
+    GVector diag = cd.cholesky_inverse_diagonal();
+    res = 0.0;
+    for (int i = 0; i < 5; ++i) {
+        double diff = std::abs(diag[i] - chol_test_inv(i,i));
+        if (diff > res) {
+            res = diff;
+        }
+    }
+    test_value(res, 0.0, 1.0e-15, "Test cholesky_inverse_diagonal() method");
+
+    // Test diagonal of inverse compressed matrix from selected inversion
+    diag = chol_test_zero.cholesky_decompose().cholesky_inverse_diagonal();
+    res  = 0.0;
+    for (int i = 0; i < 6; ++i) {
+        double diff = std::abs(diag[i] - chol_test_zero_inv(i,i));
+        if (diff > res) {
+            res = diff;
+        }
+    }
+    test_value(res, 0.0, 1.0e-15,
+               "Test compressed cholesky_inverse_diagonal() method");
+
+    // Test decomposition reusing a previous decomposition of a matrix with
+    // the same sparsity pattern
+    GMatrixSparse chol_test_scaled = chol_test;
+    chol_test_scaled(0,0) = 2.0;
+    chol_test_scaled(4,4) = 3.0;
+    GMatrixSparse cd_reused = chol_test_scaled.cholesky_decompose(cd);
+    GMatrixSparse cd_scaled = chol_test_scaled.cholesky_decompose();
+    GVector       b0(5);
+    for (int i = 0; i < 5; ++i) {
+        b0[i] = double(i+1);
+    }
+    s0  = cd_reused.cholesky_solver(b0);
+    res = max(abs(s0 - cd_scaled.cholesky_solver(b0)));
+    test_value(res, 0.0, 1.0e-15, "Test cholesky_decompose() with reuse");
+
+    // Test decomposition reusing a decomposition of a matrix with a
+    // different sparsity pattern
+    chol_test_scaled(1,2) = 0.1;
+    chol_test_scaled(2,1) = 0.1;
+    cd_reused = chol_test_scaled.cholesky_decompose(cd);
+    s0        = cd_reused.cholesky_solver(b0);
+    res       = max(abs(chol_test_scaled * s0 - b0));
+    test_value(res, 0.0, 1.0e-15,
+               "Test cholesky_decompose() with changed sparsity pattern");
+
+    // Setup larger banded matrix with a dense last row and column, which
+    // leads to supernodes with several columns and a multi-level tree
+    int           nbig = 400;
+    GMatrixSparse chol_big(nbig,nbig);
+    for (int i = 0; i < nbig; ++i) {
+        chol_big(i,i) = 10.0;
+        for (int k = 1; k <= 3 && i+k < nbig; ++k) {
+            chol_big(i,i+k) = 0.5 / double(k);
+            chol_big(i+k,i) = 0.5 / double(k);
+        }
+        if (i < nbig-1) {
+            chol_big(i,nbig-1) = 0.01;
+            chol_big(nbig-1,i) = 0.01;
+        }
+    }
+    GVector b_big(nbig);
+    for (int i = 0; i < nbig; ++i) {
+        b_big[i] = double(i % 7) - 3.0;
+    }
+    GVector x_big = chol_big.solve(b_big);
+    res = max(abs(chol_big * x_big - b_big));
+    test_value(res, 0.0, 1.0e-12, "Test Cholesky solver for large matrix");
+
+    // Test that non positive definite matrix is detected
+    chol_big(nbig/2,nbig/2) = -10.0;
+    test_try("Test Cholesky decomposition of non positive definite matrix");
+    try {
+        GMatrixSparse cd_big = chol_big.cholesky_decompose();
+        test_try_failure("Expected GException::matrix_not_pos_definite exception.");
+    }
+    catch (GException::matrix_not_pos_definite &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
     // Return
     return;
 }
@@ -627,6 +627,41 @@ void TestGMatrixSymmetric::matrix_functions(void)
                 "Test GMatrixSymmetric.extract_upper_triangle() method",
                 "Unexpected GMatrix:\n"+test2.print());
 
+    // Rank-1 update with full vector
+    GVector          vector = set_vector();
+    GMatrixSymmetric test3  = m_test;
+    test3.rank1_update(2.0, vector);
+    bool ok = true;
+    for (int row = 0; row < g_rows; ++row) {
+        for (int col = 0; col < g_cols; ++col) {
+            double ref = m_test(row,col) + 2.0 * vector[row] * vector[col];
+            if (std::abs(test3(row,col) - ref) > 1.0e-10) {
+                ok = false;
+            }
+        }
+    }
+    test_assert(ok, "Test GMatrixSymmetric.rank1_update(GVector) method",
+                "Unexpected matrix:\n"+test3.print());
+
+    // Rank-1 update with sparse vector
+    int    inx[2]    = {0, g_rows-1};
+    double values[2] = {vector[0], vector[g_rows-1]};
+    test3 = m_test;
+    test3.rank1_update(2.0, values, inx, 2);
+    ok = true;
+    for (int row = 0; row < g_rows; ++row) {
+        for (int col = 0; col < g_cols; ++col) {
+            double vrow = (row == 0 || row == g_rows-1) ? vector[row] : 0.0;
+            double vcol = (col == 0 || col == g_cols-1) ? vector[col] : 0.0;
+            double ref  = m_test(row,col) + 2.0 * vrow * vcol;
+            if (std::abs(test3(row,col) - ref) > 1.0e-10) {
+                ok = false;
+            }
+        }
+    }
+    test_assert(ok, "Test sparse GMatrixSymmetric.rank1_update() method",
+                "Unexpected matrix:\n"+test3.print());
+
     // Return
     return;
 }
@@ -46,6 +46,9 @@ void TestGNumerics::set(void)
     //Unbinned
     add_test(static_cast<pfunction>(&TestGNumerics::test_integral),"Test GIntegral");
     add_test(static_cast<pfunction>(&TestGNumerics::test_romberg_integration),"Test Romberg integration");
+    add_test(static_cast<pfunction>(&TestGNumerics::test_gauss_integration),"Test Gauss integration");
+    add_test(static_cast<pfunction>(&TestGNumerics::test_batch_evaluation),"Test batch evaluation");
+    add_test(static_cast<pfunction>(&TestGNumerics::test_vector_integration),"Test vector Romberg integration");
     return;
 }
 
@@ -81,6 +84,144 @@ void TestGNumerics::test_romberg_integration(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test Gauss-Kronrod and Gauss-Legendre integration.
+ ***************************************************************************/
+void TestGNumerics::test_gauss_integration(void)
+{
+    // Adaptive Gauss-Kronrod integration
+    Gauss     integrand(m_sigma);
+    GIntegral integral(&integrand);
+    double    result = integral.gauss_kronrod(-10.0*m_sigma, 10.0*m_sigma);
+    test_value(result,1.0,1.0e-6,"","Gaussian integral is not 1.0 (integral="+gammalib::str(result)+")");
+
+    result = integral.gauss_kronrod(-m_sigma, m_sigma);
+    test_value(result,0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result-0.68268948130801355))+")");
+    int calls_gk = integral.calls();
+
+    result = integral.gauss_kronrod(0.0, m_sigma);
+    test_value(result,0.3413447460687748,1.0e-6,"","Gaussian integral is not 0.341345 (difference="+gammalib::str((result-0.3413447460687748))+")");
+
+    // Check that fewer evaluations than for Romberg integration are needed
+    integral.romb(-m_sigma, m_sigma);
+    int calls_romb = integral.calls();
+    test_assert(calls_gk < calls_romb, "Check number of Gauss-Kronrod evaluations",
+                "Gauss-Kronrod ("+gammalib::str(calls_gk)+") needs more evaluations than Romberg ("+gammalib::str(calls_romb)+")");
+
+    // Check that very small intervals are handled
+    result = integral.gauss_kronrod(0.0, 1.0e-14);
+    test_value(result,1.0e-14*integrand.eval(0.0),1.0e-26,"","Gaussian integral over small interval is wrong");
+
+    // Check evaluation budget
+    integral.max_calls(45);
+    integral.silent(true);
+    integral.gauss_kronrod(-10.0*m_sigma, 10.0*m_sigma);
+    test_assert(integral.calls() <= 45, "Check Gauss-Kronrod evaluation budget",
+                "Number of evaluations "+gammalib::str(integral.calls())+" exceeds budget of 45");
+
+    // Fixed-order Gauss-Legendre integration
+    result = integral.gauss_legendre(-m_sigma, m_sigma, 16);
+    test_value(result,0.682689492137086,1.0e-12,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result-0.682689492137086))+")");
+    test_value(integral.calls(),16,"","Gauss-Legendre integration needs 16 evaluations");
+
+    // Check that unsupported Gauss-Legendre orders throw an exception
+    test_try("Check invalid Gauss-Legendre order");
+    try {
+        integral.gauss_legendre(0.0, 1.0, 5);
+        test_try_failure("Invalid Gauss-Legendre order should throw an exception.");
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+}
+
+
+/***********************************************************************//**
+ * @brief Test batch evaluation of integration kernels.
+ *
+ * Checks that all integration methods evaluate the kernel using the batch
+ * interface.
+ ***************************************************************************/
+void TestGNumerics::test_batch_evaluation(void)
+{
+    // Setup integral with batch kernel
+    GaussBatch integrand(m_sigma);
+    GIntegral  integral(&integrand);
+
+    // Romberg integration
+    double result = integral.romb(-m_sigma, m_sigma);
+    test_value(result,0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result-0.68268948130801355))+")");
+    test_value(integrand.m_batch,integral.calls(),"","Romberg integration does not use batch evaluation");
+
+    // Gauss-Kronrod integration
+    integrand.m_batch = 0;
+    result = integral.gauss_kronrod(-m_sigma, m_sigma);
+    test_value(result,0.682689492137086,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result-0.682689492137086))+")");
+    test_value(integrand.m_batch,integral.calls(),"","Gauss-Kronrod integration does not use batch evaluation");
+
+    // Gauss-Legendre integration
+    integrand.m_batch = 0;
+    result = integral.gauss_legendre(-m_sigma, m_sigma, 32);
+    test_value(result,0.682689492137086,1.0e-12,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result-0.682689492137086))+")");
+    test_value(integrand.m_batch,integral.calls(),"","Gauss-Legendre integration does not use batch evaluation");
+
+    // Exit test
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test Romberg integration of vector function kernels.
+ *
+ * Integrates a Gaussian together with its gradient with respect to sigma,
+ * and compares the integrated gradient to the finite difference of the
+ * integrals for slightly different sigma values.
+ ***************************************************************************/
+void TestGNumerics::test_vector_integration(void)
+{
+    // Integrate Gaussian and gradient
+    GaussGrad integrand(m_sigma);
+    GIntegral integral(&integrand);
+    GVector   result = integral.romb_vector(-m_sigma, m_sigma);
+    test_value(result.size(),2,"","Vector integration result has wrong size");
+    test_value(result[0],0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result[0]-0.68268948130801355))+")");
+
+    // Compare to scalar Romberg integration
+    Gauss     gauss(m_sigma);
+    GIntegral scalar(&gauss);
+    double    value = scalar.romb(-m_sigma, m_sigma);
+    test_value(result[0],value,1.0e-12,"","Vector integral differs from scalar integral");
+
+    // Compare gradient to finite difference
+    double    h = 1.0e-4 * m_sigma;
+    Gauss     gauss_plus(m_sigma+h);
+    Gauss     gauss_minus(m_sigma-h);
+    GIntegral integral_plus(&gauss_plus);
+    GIntegral integral_minus(&gauss_minus);
+    integral_plus.eps(1.0e-10);
+    integral_minus.eps(1.0e-10);
+    double numeric = (integral_plus.romb(-m_sigma, m_sigma) -
+                      integral_minus.romb(-m_sigma, m_sigma)) / (2.0*h);
+    double analytic = -2.0 * gauss.eval(m_sigma);
+    test_value(numeric,analytic,1.0e-6,"","Finite difference gradient is not "+gammalib::str(analytic));
+    test_value(result[1],numeric,1.0e-6,"","Integrated gradient differs from finite difference (difference="+gammalib::str((result[1]-numeric))+")");
+
+    // Integrate Gaussian together with a function that integrates to zero
+    GaussOdd  odd(m_sigma);
+    GIntegral integral_odd(&odd);
+    GVector   result_odd = integral_odd.romb_vector(-m_sigma, m_sigma);
+    test_value(result_odd[0],0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result_odd[0]-0.68268948130801355))+")");
+    test_value(result_odd[1],0.0,1.0e-6,"","Odd integral is not 0 (value="+gammalib::str(result_odd[1])+")");
+    test_assert(integral_odd.iter() < integral_odd.max_iter(), "Vector integration with zero integral did not converge");
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Main test function.
  ***************************************************************************/
@@ -51,6 +51,68 @@ protected:
     double m_sigma;
 };
 
+
+/***********************************************************************//**
+ * @class GaussBatch
+ *
+ * @brief Gaussian function with batch evaluation counter.
+ ***************************************************************************/
+class GaussBatch : public Gauss {
+public:
+    GaussBatch(const double& sigma) : Gauss(sigma), m_batch(0) { return; }
+    virtual ~GaussBatch(void) { return; }
+    using Gauss::eval;
+    void eval(const double* x, double* y, int n) {
+        for (int i = 0; i < n; ++i) {
+            y[i] = eval(x[i]);
+        }
+        m_batch += n;
+    }
+    int m_batch;
+};
+
+/***********************************************************************//**
+ * @class GaussGrad
+ *
+ * @brief Gaussian function and its gradient with respect to sigma.
+ ***************************************************************************/
+class GaussGrad : public GFunctions {
+public:
+    GaussGrad(const double& sigma) : m_sigma(sigma) { return; }
+    virtual ~GaussGrad(void) { return; }
+    int size(void) const { return 2; }
+    GVector eval(double x) {
+        GVector values(2);
+        double  arg = -0.5*x*x/m_sigma/m_sigma;
+        values[0]   = 1.0/std::sqrt(gammalib::twopi)/m_sigma * std::exp(arg);
+        values[1]   = values[0] * (x*x/m_sigma/m_sigma - 1.0) / m_sigma;
+        return values;
+    }
+protected:
+    double m_sigma;
+};
+
+/***********************************************************************//**
+ * @class GaussOdd
+ *
+ * @brief Gaussian function and an odd function that integrates to zero.
+ ***************************************************************************/
+class GaussOdd : public GFunctions {
+public:
+    GaussOdd(const double& sigma) : m_sigma(sigma) { return; }
+    virtual ~GaussOdd(void) { return; }
+    int size(void) const { return 2; }
+    GVector eval(double x) {
+        GVector values(2);
+        double  arg = -0.5*x*x/m_sigma/m_sigma;
+        values[0]   = 1.0/std::sqrt(gammalib::twopi)/m_sigma * std::exp(arg);
+        values[1]   = values[0] * x;
+        return values;
+    }
+protected:
+    double m_sigma;
+};
+
 class TestGNumerics : public GTestSuite
 {
     public:
@@ -62,6 +124,9 @@ class TestGNumerics : public GTestSuite
         virtual void set(void);
         void test_integral(void);
         void test_romberg_integration(void);
+        void test_gauss_integration(void);
+        void test_batch_evaluation(void);
+        void test_vector_integration(void);
 
     // Private attributes
     private:
@@ -31,6 +31,7 @@
 #include <iostream>                           // cout, cerr
 #include <stdexcept>                          // std::exception
 #include <stdlib.h>
+#include <cmath>
 #include "test_GSky.hpp"
 #include "GTools.hpp"
 
@@ -53,8 +54,10 @@ void TestGSky::set(void){
     add_test(static_cast<pfunction>(&TestGSky::test_GWcslib),"Test GWcslib");
     add_test(static_cast<pfunction>(&TestGSky::test_GSkymap_healpix_construct),"Test Healpix GSkymap constructors");
     add_test(static_cast<pfunction>(&TestGSky::test_GSkymap_healpix_io),"Test Healpix GSkymap I/O");
+    add_test(static_cast<pfunction>(&TestGSky::test_GSkymap_healpix_reorder),"Test Healpix GSkymap reordering");
     add_test(static_cast<pfunction>(&TestGSky::test_GSkymap_wcs_construct),"Test WCS GSkymap constructors");
     add_test(static_cast<pfunction>(&TestGSky::test_GSkymap_wcs_io),"Test WCS GSkymap I/O");
+    add_test(static_cast<pfunction>(&TestGSky::test_GSkymap_bulk),"Test GSkymap bulk transformations");
 
     return;
 }
@@ -352,6 +355,87 @@ void TestGSky::test_GWcslib(void)
 }
 
 
+/***************************************************************************
+ *  Test: GSkymap bulk transformations                                     *
+ ***************************************************************************/
+void TestGSky::test_GSkymap_bulk(void)
+{
+    // Set sky maps
+    std::vector<GSkymap> maps;
+    maps.push_back(GSkymap("CAR", "CEL", 83.63, 22.01, -0.1, 0.1, 50, 40));
+    maps.push_back(GSkymap("TAN", "GAL", 184.56, -5.78, -0.1, 0.1, 50, 40));
+    maps.push_back(GSkymap("HPX", "GAL", 8, "RING"));
+    maps.push_back(GSkymap("HPX", "CEL", 8, "NESTED"));
+
+    // Loop over sky maps
+    int nmaps = maps.size();
+    for (int k = 0; k < nmaps; ++k) {
+
+        // Get sky map
+        const GSkymap& map = maps[k];
+
+        // Set pixel indices
+        std::vector<int> pix;
+        for (int i = 0; i < map.npix(); ++i) {
+            pix.push_back(i);
+        }
+
+        // Test pix2dir() and dir2pix()
+        std::vector<GSkyDir> dirs = map.pix2dir(pix);
+        std::vector<int>     back = map.dir2pix(dirs);
+        test_value((int)dirs.size(), map.npix(), "Check number of directions");
+        test_value((int)back.size(), map.npix(), "Check number of pixels");
+        double dist_max = 0.0;
+        int    num_diff = 0;
+        for (int i = 0; i < map.npix(); ++i) {
+            GSkyDir dir  = map.pix2dir(i);
+            double  dist = std::fabs(dir.ra_deg()  - dirs[i].ra_deg()) +
+                           std::fabs(dir.dec_deg() - dirs[i].dec_deg());
+            if (dist > dist_max) {
+                dist_max = dist;
+            }
+            if (back[i] != map.dir2pix(dirs[i]) || back[i] != i) {
+                num_diff++;
+            }
+        }
+        test_value(dist_max, 0.0, 1.0e-10, "Check bulk pix2dir()");
+        test_value(num_diff, 0, "Check bulk dir2pix()");
+
+        // Test xy2dir() and dir2xy() for 2D maps
+        if (map.nx() > 0) {
+            std::vector<GSkyPixel> pixels;
+            for (int i = 0; i < map.npix(); ++i) {
+                pixels.push_back(map.pix2xy(i));
+            }
+            std::vector<GSkyDir>   xydirs   = map.xy2dir(pixels);
+            std::vector<GSkyPixel> xypixels = map.dir2xy(xydirs);
+            double dist_dir = 0.0;
+            double dist_pix = 0.0;
+            for (int i = 0; i < map.npix(); ++i) {
+                GSkyDir   dir   = map.xy2dir(pixels[i]);
+                double    dist  = std::fabs(dir.ra_deg()  - xydirs[i].ra_deg()) +
+                                  std::fabs(dir.dec_deg() - xydirs[i].dec_deg());
+                GSkyPixel pixel = map.dir2xy(xydirs[i]);
+                double    dx    = pixel.x() - xypixels[i].x();
+                double    dy    = pixel.y() - xypixels[i].y();
+                if (dist > dist_dir) {
+                    dist_dir = dist;
+                }
+                if (std::fabs(dx) + std::fabs(dy) > dist_pix) {
+                    dist_pix = std::fabs(dx) + std::fabs(dy);
+                }
+            }
+            test_value(dist_dir, 0.0, 1.0e-10, "Check bulk xy2dir()");
+            test_value(dist_pix, 0.0, 1.0e-10, "Check bulk dir2xy()");
+        }
+
+    } // endfor: looped over sky maps
+
+    // Exit test
+    return;
+}
+
+
 /***************************************************************************
  *  Test: GSkymap_healpix_construct                                        *
  ***************************************************************************/
@@ -566,6 +650,79 @@ void TestGSky::test_GSkymap_healpix_io(void)
 }
 
 
+/***************************************************************************
+ *  Test: GSkymap_healpix_reorder                                          *
+ ***************************************************************************/
+void TestGSky::test_GSkymap_healpix_reorder(void)
+{
+    // Set ring and nested maps with two layers
+    GSkymap ring("HPX", "GAL", 16, "RING", 2);
+    GSkymap nest("HPX", "GAL", 16, "NESTED", 2);
+    for (int i = 0; i < ring.npix(); ++i) {
+        ring(i,0) =  double(i);
+        ring(i,1) = -double(i);
+    }
+
+    // Check ring2nest() and nest2ring() against the pixel directions
+    const GWcsHPX* wcs = static_cast<const GWcsHPX*>(ring.wcs());
+    int num_ring2nest = 0;
+    int num_nest2ring = 0;
+    for (int i = 0; i < ring.npix(); ++i) {
+        int inest = wcs->ring2nest(i);
+        if (inest != nest.dir2pix(ring.pix2dir(i))) {
+            num_ring2nest++;
+        }
+        if (wcs->nest2ring(inest) != i) {
+            num_nest2ring++;
+        }
+    }
+    test_value(num_ring2nest, 0, "Check ring2nest()");
+    test_value(num_nest2ring, 0, "Check nest2ring()");
+
+    // Reorder map into nested ordering and check that every nested pixel
+    // holds the value of the corresponding ring pixel
+    GSkymap map = ring;
+    map.reorder("NEST");
+    int num_diff = 0;
+    for (int i = 0; i < map.npix(); ++i) {
+        int iring = ring.dir2pix(nest.pix2dir(i));
+        if (map(i,0) != ring(iring,0) || map(i,1) != ring(iring,1)) {
+            num_diff++;
+        }
+    }
+    test_assert(static_cast<const GWcsHPX*>(map.wcs())->ordering() == "NESTED",
+                "Check ordering after reorder()");
+    test_value(num_diff, 0, "Check reorder() into nested ordering");
+
+    // Reorder back into ring ordering
+    map.reorder("RING");
+    num_diff = 0;
+    for (int i = 0; i < map.npix(); ++i) {
+        if (map(i,0) != ring(i,0) || map(i,1) != ring(i,1)) {
+            num_diff++;
+        }
+    }
+    test_value(num_diff, 0, "Check reorder() into ring ordering");
+
+    // Check that reordering a WCS map throws an exception
+    test_try("Check reorder() of WCS map");
+    try {
+        GSkymap car("CAR", "CEL", 0.0, 0.0, 1.0, 1.0, 10, 10);
+        car.reorder("RING");
+        test_try_failure("Reordering a WCS map should throw an exception.");
+    }
+    catch (GException::wcs_invalid &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Exit test
+    return;
+}
+
+
 /***************************************************************************
  *  Test: GSkymap_wcs_construct                                            *
  ***************************************************************************/
@@ -38,8 +38,10 @@ class TestGSky : public GTestSuite
         void test_GWcslib(void);
         void test_GSkymap_healpix_construct(void);
         void test_GSkymap_healpix_io(void);
+        void test_GSkymap_healpix_reorder(void);
         void test_GSkymap_wcs_construct(void);
         void test_GSkymap_wcs_io(void);
+        void test_GSkymap_bulk(void);
 
     // Private methods
     private:
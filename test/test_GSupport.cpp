@@ -52,6 +52,7 @@ void TestGSupport::set(void){
     add_test(static_cast<pfunction>(&TestGSupport::test_node_array), "Test GNodeArray");
     add_test(static_cast<pfunction>(&TestGSupport::test_url_file),   "Test GUrlFile");
     add_test(static_cast<pfunction>(&TestGSupport::test_url_string), "Test GUrlString");
+    add_test(static_cast<pfunction>(&TestGSupport::test_checksum),   "Test checksum");
 
     // Return
     return;
@@ -291,6 +292,20 @@ void TestGSupport::test_node_array_interpolation(const int&    num,
         test_value(result, expected);
     }
 
+    // Test that reentrant weights are consistent with set_value
+    for (double value = -2.0; value <= +2.0; value += 0.2) {
+        int    inx_left;
+        int    inx_right;
+        double wgt_left;
+        double wgt_right;
+        array.weights(value, inx_left, inx_right, wgt_left, wgt_right);
+        array.set_value(value);
+        test_assert(inx_left  == array.inx_left(),  "Check left index");
+        test_assert(inx_right == array.inx_right(), "Check right index");
+        test_value(wgt_left,  array.wgt_left());
+        test_value(wgt_right, array.wgt_right());
+    }
+
     // Return
     return;
 }
@@ -444,6 +459,38 @@ void TestGSupport::test_url_string(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test checksum function
+ *
+ * Tests the checksum function against FNV-1a reference values and checks
+ * that a checksum can be continued over several blocks of data.
+ ***************************************************************************/
+void TestGSupport::test_checksum(void)
+{
+    // Test reference values
+    test_assert(gammalib::checksum("", 0) == 0xcbf29ce484222325ULL,
+                "Checksum of empty data");
+    test_assert(gammalib::checksum("a", 1) == 0xaf63dc4c8601ec8cULL,
+                "Checksum of \"a\"");
+    test_assert(gammalib::checksum("foobar", 6) == 0x85944171f73967e8ULL,
+                "Checksum of \"foobar\"");
+
+    // Test continued checksum
+    unsigned long long hash = gammalib::checksum("foo", 3);
+    hash = gammalib::checksum("bar", 3, hash);
+    test_assert(hash == gammalib::checksum("foobar", 6),
+                "Continued checksum");
+
+    // Test that checksum depends on data
+    test_assert(gammalib::checksum("foobar", 6) !=
+                gammalib::checksum("foobaz", 6),
+                "Checksum of different data");
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Main test entry point
  ***************************************************************************/
@@ -49,6 +49,7 @@ public:
     void         test_node_array(void);
     void         test_url_file(void);
     void         test_url_string(void);
+    void         test_checksum(void);
 
 private:
     // Private methods
@@ -429,6 +429,35 @@ void TestGVector::arithmetics(void){
     // tanh(GVector)
     test_assert(tanh(m_test).print()=="(0.800499, 0.975743, 0.997283, 0.999699, 0.999967)","tanh(GVector)");
 
+    // Chained vector expressions
+    m_result = exp(m_test/10.0 + 2.0 * m_test) - 1.0 - m_test / 2.0;
+    for (int i = 0; i < m_num; ++i) {
+        double ref = std::exp(m_test[i]/10.0 + 2.0 * m_test[i]) - 1.0 -
+                     m_test[i] / 2.0;
+        test_value(m_result[i], ref, 1.0e-10, "Chained vector expression");
+    }
+    GVector chain(sqrt(abs(-m_test)) * 3.0);
+    for (int i = 0; i < m_num; ++i) {
+        test_value(chain[i], std::sqrt(m_test[i]) * 3.0, 1.0e-10,
+                   "Vector expression constructor");
+    }
+    m_result  = m_test;
+    m_result  = m_result + m_result * 2.0;
+    m_result -= m_test * 3.0 - m_test;
+    for (int i = 0; i < m_num; ++i) {
+        test_value(m_result[i], m_test[i], 1.0e-10,
+                   "Aliased vector expression");
+    }
+    test_value(sum(m_test - 1.0), sum(m_test) - m_num, 1.0e-10,
+               "sum(GVector expression)");
+    test_value(norm(m_test * 2.0), 2.0 * norm(m_test), 1.0e-10,
+               "norm(GVector expression)");
+    test_value((m_test + 1.0) * (m_test - 1.0), m_test * m_test - m_num,
+               1.0e-10, "Scalar product of vector expressions");
+    m_result = m_bigger * 2.0;
+    test_assert(m_result.size() == m_bigger.size(),
+                "Resize on expression assignment");
+
     // Incompatible size GVector + GVector
     test_try("Incompatible size GVector + GVector:");
     try {
@@ -130,6 +130,10 @@ public:
     virtual void           read(const GFits& file){ return; }
     virtual void           write(GFits& file) const{ return; }
     virtual int            number(void) const{ return m_counts; }
+    virtual GTestEventBin* new_bin(void) const{ return NULL; }
+    virtual const GTestEventBin* bin(const int& index, GEventBin*) const{
+        return (*this)[index];
+    }
     virtual std::string    print(const GChatter& chatter = NORMAL) const{
         // Initialise result string
         std::string result;